@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+// Data generators shared by the operator benchmarks. They use a fixed seed so that every run,
+// and every binary compared against each other, works on exactly the same input.
+inline constexpr uint32_t BENCHMARK_DATA_SEED = 20240101;
+
+// `num_rows` int64 values drawn uniformly from [0, cardinality).
+inline ColumnInt64::MutablePtr make_int64_column(size_t num_rows, int64_t cardinality) {
+    std::mt19937_64 rng(BENCHMARK_DATA_SEED);
+    std::uniform_int_distribution<int64_t> dist(0, cardinality - 1);
+    auto column = ColumnInt64::create();
+    auto& data = column->get_data();
+    data.resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        data[i] = dist(rng);
+    }
+    return column;
+}
+
+// `num_rows` ascii strings of `str_len` bytes each, taking `cardinality` distinct values.
+inline ColumnString::MutablePtr make_string_column(size_t num_rows, int64_t cardinality,
+                                                   size_t str_len) {
+    std::mt19937_64 rng(BENCHMARK_DATA_SEED);
+    std::uniform_int_distribution<int64_t> dist(0, cardinality - 1);
+    auto column = ColumnString::create();
+    std::string value;
+    for (size_t i = 0; i < num_rows; ++i) {
+        value = std::to_string(dist(rng));
+        value.resize(str_len, 'x');
+        column->insert_data(value.data(), value.size());
+    }
+    return column;
+}
+
+} // namespace doris::vectorized
@@ -19,6 +19,11 @@
 
 #include "benchmark_bit_pack.hpp"
 #include "binary_cast_benchmark.hpp"
+#include "block_serde_benchmark.hpp"
+#include "block_sort_benchmark.hpp"
+#include "hash_table_benchmark.hpp"
+#include "page_codec_benchmark.hpp"
+#include "pipeline_benchmark.hpp"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_string.h"
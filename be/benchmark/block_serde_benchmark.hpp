@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/data.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include "agent/be_exec_version_manager.h"
+#include "benchmark_data_generator.hpp"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// Block <-> PBlock round trip, the serde every exchange and spill goes through. The benchmark
+// argument is the segment_v2::CompressionTypePB used for the column buffers; the compressed
+// size is reported as a counter so the ratio can be compared next to the throughput.
+inline constexpr size_t BLOCK_SERDE_BENCHMARK_ROWS = 65536;
+
+inline Block make_serde_benchmark_block() {
+    Block block;
+    block.insert({make_int64_column(BLOCK_SERDE_BENCHMARK_ROWS, 1 << 16),
+                  std::make_shared<DataTypeInt64>(), "k"});
+    block.insert({make_string_column(BLOCK_SERDE_BENCHMARK_ROWS, 1 << 10, 32),
+                  std::make_shared<DataTypeString>(), "s"});
+    return block;
+}
+
+static void BM_BlockSerialize(benchmark::State& state) {
+    const auto compression = static_cast<segment_v2::CompressionTypePB>(state.range(0));
+    Block block = make_serde_benchmark_block();
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+
+    for (auto _ : state) {
+        PBlock pblock;
+        auto st = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                  &uncompressed_bytes, &compressed_bytes, compression);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(pblock);
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+    state.counters["compressed_bytes"] = static_cast<double>(compressed_bytes);
+}
+
+static void BM_BlockDeserialize(benchmark::State& state) {
+    const auto compression = static_cast<segment_v2::CompressionTypePB>(state.range(0));
+    Block block = make_serde_benchmark_block();
+    PBlock pblock;
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    auto st = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                              &uncompressed_bytes, &compressed_bytes, compression);
+    if (!st.ok()) {
+        state.SkipWithError(st.to_string().c_str());
+        return;
+    }
+
+    for (auto _ : state) {
+        Block dest_block;
+        st = dest_block.deserialize(pblock);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(dest_block);
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+    state.counters["compressed_bytes"] = static_cast<double>(compressed_bytes);
+}
+
+BENCHMARK(BM_BlockSerialize)
+        ->Arg(segment_v2::CompressionTypePB::NO_COMPRESSION)
+        ->Arg(segment_v2::CompressionTypePB::LZ4)
+        ->Arg(segment_v2::CompressionTypePB::ZSTD);
+BENCHMARK(BM_BlockDeserialize)
+        ->Arg(segment_v2::CompressionTypePB::NO_COMPRESSION)
+        ->Arg(segment_v2::CompressionTypePB::LZ4)
+        ->Arg(segment_v2::CompressionTypePB::ZSTD);
+
+} // namespace doris::vectorized
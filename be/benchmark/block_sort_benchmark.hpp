@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data_generator.hpp"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// sort_block over one block, as the sort operators run it on every input block. The first
+// benchmark argument is the number of rows, the second the topn limit (0 for a full sort).
+inline Block make_sort_benchmark_block(size_t rows) {
+    Block block;
+    block.insert({make_int64_column(rows, rows), std::make_shared<DataTypeInt64>(), "k"});
+    block.insert({make_string_column(rows, rows, 16), std::make_shared<DataTypeString>(), "s"});
+    return block;
+}
+
+inline void run_sort_block_benchmark(benchmark::State& state, const SortDescription& description) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    const auto limit = static_cast<UInt64>(state.range(1));
+    Block src_block = make_sort_benchmark_block(rows);
+
+    for (auto _ : state) {
+        Block dest_block = src_block.clone_empty();
+        sort_block(src_block, dest_block, description, limit);
+        benchmark::DoNotOptimize(dest_block);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+static void BM_SortBlockInt64(benchmark::State& state) {
+    run_sort_block_benchmark(state, {SortColumnDescription(0, 1, 1)});
+}
+
+static void BM_SortBlockString(benchmark::State& state) {
+    run_sort_block_benchmark(state, {SortColumnDescription(1, 1, 1)});
+}
+
+static void BM_SortBlockInt64String(benchmark::State& state) {
+    run_sort_block_benchmark(state,
+                             {SortColumnDescription(0, 1, 1), SortColumnDescription(1, -1, 1)});
+}
+
+BENCHMARK(BM_SortBlockInt64)->Args({4096, 0})->Args({65536, 0})->Args({65536, 100});
+BENCHMARK(BM_SortBlockString)->Args({4096, 0})->Args({65536, 0})->Args({65536, 100});
+BENCHMARK(BM_SortBlockInt64String)->Args({4096, 0})->Args({65536, 0})->Args({65536, 100});
+
+} // namespace doris::vectorized
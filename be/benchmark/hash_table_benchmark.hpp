@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data_generator.hpp"
+#include "common/exception.h"
+#include "vec/common/columns_hashing.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+
+namespace doris::vectorized {
+
+// Build then probe a hash table the way the aggregation operators drive it: keys are
+// serialized once per block, then emplaced/found row by row. The benchmark argument is the
+// number of distinct keys among HASH_TABLE_BENCHMARK_ROWS rows.
+inline constexpr size_t HASH_TABLE_BENCHMARK_ROWS = 1 << 20;
+
+template <typename HashMethodType>
+void hash_table_build(HashMethodType& method, const ColumnRawPtrs& key_columns, size_t rows) {
+    using State = typename HashMethodType::State;
+    State state(key_columns);
+    method.init_serialized_keys(key_columns, rows);
+    for (size_t i = 0; i < rows; ++i) {
+        auto creator = [&](const auto& ctor, auto& key, auto& origin) { ctor(key, i); };
+        auto creator_for_null_key = [&](auto& mapped) {
+            throw doris::Exception(ErrorCode::INTERNAL_ERROR, "no null key");
+        };
+        method.lazy_emplace(state, i, creator, creator_for_null_key);
+    }
+}
+
+template <typename HashMethodType>
+size_t hash_table_probe(HashMethodType& method, const ColumnRawPtrs& key_columns, size_t rows) {
+    using State = typename HashMethodType::State;
+    State state(key_columns);
+    method.init_serialized_keys(key_columns, rows);
+    size_t found = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        found += method.find(state, i).is_found();
+    }
+    return found;
+}
+
+static void BM_HashTableOneNumberBuild(benchmark::State& state) {
+    auto keys = make_int64_column(HASH_TABLE_BENCHMARK_ROWS, state.range(0));
+    ColumnRawPtrs key_columns {keys.get()};
+
+    for (auto _ : state) {
+        MethodOneNumber<Int64, PHHashMap<Int64, IColumn::ColumnIndex, HashCRC32<Int64>>> method;
+        hash_table_build(method, key_columns, HASH_TABLE_BENCHMARK_ROWS);
+        benchmark::DoNotOptimize(method);
+    }
+    state.SetItemsProcessed(state.iterations() * HASH_TABLE_BENCHMARK_ROWS);
+}
+
+static void BM_HashTableOneNumberProbe(benchmark::State& state) {
+    auto keys = make_int64_column(HASH_TABLE_BENCHMARK_ROWS, state.range(0));
+    ColumnRawPtrs key_columns {keys.get()};
+    MethodOneNumber<Int64, PHHashMap<Int64, IColumn::ColumnIndex, HashCRC32<Int64>>> method;
+    hash_table_build(method, key_columns, HASH_TABLE_BENCHMARK_ROWS);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash_table_probe(method, key_columns, HASH_TABLE_BENCHMARK_ROWS));
+    }
+    state.SetItemsProcessed(state.iterations() * HASH_TABLE_BENCHMARK_ROWS);
+}
+
+static void BM_HashTableSerializedBuild(benchmark::State& state) {
+    auto int_keys = make_int64_column(HASH_TABLE_BENCHMARK_ROWS, state.range(0));
+    auto str_keys = make_string_column(HASH_TABLE_BENCHMARK_ROWS, state.range(0), 16);
+    ColumnRawPtrs key_columns {int_keys.get(), str_keys.get()};
+
+    for (auto _ : state) {
+        MethodSerialized<StringHashMap<IColumn::ColumnIndex>> method;
+        hash_table_build(method, key_columns, HASH_TABLE_BENCHMARK_ROWS);
+        benchmark::DoNotOptimize(method);
+    }
+    state.SetItemsProcessed(state.iterations() * HASH_TABLE_BENCHMARK_ROWS);
+}
+
+BENCHMARK(BM_HashTableOneNumberBuild)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_HashTableOneNumberProbe)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_HashTableSerializedBuild)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+} // namespace doris::vectorized
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "benchmark_data_generator.hpp"
+#include "olap/rowset/segment_v2/bitshuffle_page.h"
+#include "olap/rowset/segment_v2/bitshuffle_wrapper.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "util/slice.h"
+
+namespace doris::segment_v2 {
+
+// Encode and decode of one bitshuffle data page of bigint values, the default encoding of
+// integer columns. The benchmark argument is the number of distinct values on the page, which
+// drives how well the lz4 pass after the shuffle compresses.
+inline constexpr size_t PAGE_CODEC_BENCHMARK_ROWS = 65536;
+
+inline Status encode_bitshuffle_page(const vectorized::ColumnInt64& column, OwnedSlice* page) {
+    PageBuilderOptions options;
+    options.data_page_size = column.size() * sizeof(int64_t);
+    PageBuilder* raw_builder = nullptr;
+    RETURN_IF_ERROR(BitshufflePageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT>::create(
+            &raw_builder, options));
+    std::unique_ptr<PageBuilder> builder(raw_builder);
+    size_t count = column.size();
+    RETURN_IF_ERROR(builder->add(reinterpret_cast<const uint8_t*>(column.get_data().data()),
+                                 &count));
+    return builder->finish(page);
+}
+
+// Mirrors BitShufflePagePreDecoder: unshuffles the page body into `buffer`, which is what the
+// page decoder reads once the page has been loaded.
+inline Status unshuffle_bitshuffle_page(const Slice& page, std::string* buffer) {
+    size_t num_elements = 0;
+    size_t compressed_size = 0;
+    size_t num_element_after_padding = 0;
+    int size_of_element = 0;
+    RETURN_IF_ERROR(parse_bit_shuffle_header(page, num_elements, compressed_size,
+                                             num_element_after_padding, size_of_element));
+    buffer->resize(BITSHUFFLE_PAGE_HEADER_SIZE + num_element_after_padding * size_of_element);
+    memcpy(buffer->data(), page.data, BITSHUFFLE_PAGE_HEADER_SIZE);
+    auto bytes = bitshuffle::decompress_lz4(page.data + BITSHUFFLE_PAGE_HEADER_SIZE,
+                                            buffer->data() + BITSHUFFLE_PAGE_HEADER_SIZE,
+                                            num_element_after_padding, size_of_element, 0);
+    if (bytes < 0) {
+        return Status::RuntimeError("Unshuffle Process failed");
+    }
+    return Status::OK();
+}
+
+static void BM_BitshufflePageEncode(benchmark::State& state) {
+    auto column = vectorized::make_int64_column(PAGE_CODEC_BENCHMARK_ROWS, state.range(0));
+    size_t page_size = 0;
+
+    for (auto _ : state) {
+        OwnedSlice page;
+        auto st = encode_bitshuffle_page(*column, &page);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        page_size = page.slice().size;
+        benchmark::DoNotOptimize(page);
+    }
+    state.SetBytesProcessed(state.iterations() * PAGE_CODEC_BENCHMARK_ROWS * sizeof(int64_t));
+    state.counters["page_bytes"] = static_cast<double>(page_size);
+}
+
+static void BM_BitshufflePageDecode(benchmark::State& state) {
+    auto column = vectorized::make_int64_column(PAGE_CODEC_BENCHMARK_ROWS, state.range(0));
+    OwnedSlice page;
+    auto st = encode_bitshuffle_page(*column, &page);
+    if (!st.ok()) {
+        state.SkipWithError(st.to_string().c_str());
+        return;
+    }
+
+    std::string buffer;
+    PageDecoderOptions options;
+    for (auto _ : state) {
+        st = unshuffle_bitshuffle_page(page.slice(), &buffer);
+        BitShufflePageDecoder<FieldType::OLAP_FIELD_TYPE_BIGINT> decoder(
+                Slice(buffer.data(), buffer.size()), options);
+        if (st.ok()) {
+            st = decoder.init();
+        }
+        vectorized::MutableColumnPtr dst = vectorized::ColumnInt64::create();
+        size_t rows = PAGE_CODEC_BENCHMARK_ROWS;
+        if (st.ok()) {
+            st = decoder.next_batch(&rows, dst);
+        }
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(dst);
+    }
+    state.SetBytesProcessed(state.iterations() * PAGE_CODEC_BENCHMARK_ROWS * sizeof(int64_t));
+}
+
+BENCHMARK(BM_BitshufflePageEncode)->Arg(16)->Arg(1 << 12)->Arg(1 << 30);
+BENCHMARK(BM_BitshufflePageDecode)->Arg(16)->Arg(1 << 12)->Arg(1 << 30);
+
+} // namespace doris::segment_v2
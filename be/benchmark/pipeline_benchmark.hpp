@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "benchmark_data_generator.hpp"
+#include "common/exception.h"
+#include "util/stopwatch.hpp"
+#include "vec/common/assert_cast.h"
+#include "vec/common/columns_hashing.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+// An in-process scan -> filter -> agg -> sink pipeline without FE or storage. The source
+// blocks are generated up front and handed out one at a time to `parallelism` drivers, each
+// running the filter and a partial (local) aggregation, like the pipeline tasks of one
+// fragment. The sink merges the local hash tables on the calling thread.
+//
+// Besides the throughput, the per stage times summed over the drivers are reported as
+// counters, and `wait_ns` is the wall time the drivers spent not running an operator, i.e.
+// the handout and join overhead, which grows with the parallelism.
+struct PipelineBenchmarkSpec {
+    size_t num_blocks = 256;
+    size_t block_rows = 4096;
+    int64_t key_cardinality = 1 << 16;
+    // percent of the rows kept by the filter
+    int64_t selectivity = 50;
+};
+
+using PipelineBenchmarkAggMethod =
+        MethodOneNumber<Int64, PHHashMap<Int64, UInt64, HashCRC32<Int64>>>;
+
+struct PipelineBenchmarkDriverStats {
+    uint64_t filter_ns = 0;
+    uint64_t agg_ns = 0;
+};
+
+inline std::vector<Block> make_pipeline_benchmark_source(const PipelineBenchmarkSpec& spec) {
+    auto keys = make_int64_column(spec.num_blocks * spec.block_rows, spec.key_cardinality);
+    std::vector<Block> blocks;
+    blocks.reserve(spec.num_blocks);
+    for (size_t i = 0; i < spec.num_blocks; ++i) {
+        Block block;
+        block.insert({keys->cut(i * spec.block_rows, spec.block_rows),
+                      std::make_shared<DataTypeInt64>(), "k"});
+        blocks.push_back(std::move(block));
+    }
+    return blocks;
+}
+
+// filter: k % 100 < selectivity
+inline void pipeline_benchmark_filter(Block* block, int64_t selectivity) {
+    const auto& keys = assert_cast<const ColumnInt64&>(*block->get_by_position(0).column);
+    IColumn::Filter filter(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        filter[i] = keys.get_data()[i] % 100 < selectivity;
+    }
+    Block::filter_block_internal(block, filter);
+}
+
+// agg: select k, count(*) group by k
+inline void pipeline_benchmark_agg(PipelineBenchmarkAggMethod& method, const Block& block) {
+    using State = PipelineBenchmarkAggMethod::State;
+    ColumnRawPtrs key_columns {block.get_by_position(0).column.get()};
+    const auto rows = block.rows();
+    State state(key_columns);
+    method.init_serialized_keys(key_columns, rows);
+    auto creator = [&](const auto& ctor, auto& key, auto& origin) { ctor(key, 0); };
+    auto creator_for_null_key = [&](auto& mapped) {
+        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "no null key");
+    };
+    for (size_t i = 0; i < rows; ++i) {
+        ++*method.lazy_emplace(state, i, creator, creator_for_null_key);
+    }
+}
+
+static void BM_PipelineScanFilterAgg(benchmark::State& state) {
+    PipelineBenchmarkSpec spec;
+    const auto parallelism = static_cast<size_t>(state.range(0));
+    spec.selectivity = state.range(1);
+    const auto source = make_pipeline_benchmark_source(spec);
+
+    uint64_t filter_ns = 0;
+    uint64_t agg_ns = 0;
+    uint64_t sink_ns = 0;
+    uint64_t wait_ns = 0;
+    for (auto _ : state) {
+        MonotonicStopWatch wall_watch;
+        wall_watch.start();
+        std::atomic<size_t> next_block = 0;
+        std::vector<PipelineBenchmarkAggMethod> local_aggs(parallelism);
+        std::vector<PipelineBenchmarkDriverStats> stats(parallelism);
+        std::vector<std::thread> drivers;
+        for (size_t d = 0; d < parallelism; ++d) {
+            drivers.emplace_back([&, d]() {
+                MonotonicStopWatch watch;
+                for (size_t i = next_block++; i < source.size(); i = next_block++) {
+                    // scan: the block is copied out like a scanner fills a fresh block
+                    Block block = source[i];
+                    watch.start();
+                    pipeline_benchmark_filter(&block, spec.selectivity);
+                    stats[d].filter_ns += watch.elapsed_time();
+                    watch.start();
+                    pipeline_benchmark_agg(local_aggs[d], block);
+                    stats[d].agg_ns += watch.elapsed_time();
+                }
+            });
+        }
+        for (auto& driver : drivers) {
+            driver.join();
+        }
+        const auto drivers_wall_ns = wall_watch.elapsed_time();
+
+        MonotonicStopWatch sink_watch;
+        sink_watch.start();
+        PHHashMap<Int64, UInt64, HashCRC32<Int64>> result;
+        for (auto& local_agg : local_aggs) {
+            for (auto& cell : *local_agg.hash_table) {
+                if (auto* found = result.find(cell.get_first())) {
+                    found->second += cell.get_second();
+                } else {
+                    result.insert(cell.get_first(), cell.get_second());
+                }
+            }
+        }
+        benchmark::DoNotOptimize(result);
+        sink_ns += sink_watch.elapsed_time();
+
+        for (const auto& driver_stats : stats) {
+            filter_ns += driver_stats.filter_ns;
+            agg_ns += driver_stats.agg_ns;
+            wait_ns += drivers_wall_ns - driver_stats.filter_ns - driver_stats.agg_ns;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * spec.num_blocks * spec.block_rows);
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["filter_ns"] = static_cast<double>(filter_ns) / iterations;
+    state.counters["agg_ns"] = static_cast<double>(agg_ns) / iterations;
+    state.counters["sink_ns"] = static_cast<double>(sink_ns) / iterations;
+    state.counters["wait_ns"] = static_cast<double>(wait_ns) / iterations;
+}
+
+BENCHMARK(BM_PipelineScanFilterAgg)
+        ->ArgsProduct({{1, 2, 4, 8, 16}, {10, 50, 100}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace doris::vectorized
@@ -145,7 +145,23 @@ Status CgroupCpuCtl::init_cgroup_v2_query_path_public_file(std::string home_path
     RETURN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(_cgroup_v2_query_path_subtree_ctl_file, "+cpu",
                                                     "set cpu controller", false));
 
-    // 3 write cgroup.procs
+    // 3 enable cpuset controller for the workload groups, it is optional, the pinning of workload
+    // groups to cpus is only available when the cpuset controller is delegated to doris.
+    if (!config::workload_group_cpuset.empty()) {
+        Status st = CgroupCpuCtl::write_cg_sys_file(_doris_cgroup_cpu_path_subtree_ctl_file,
+                                                    "+cpuset", "set cpuset controller", false);
+        if (st.ok()) {
+            st = CgroupCpuCtl::write_cg_sys_file(_cgroup_v2_query_path_subtree_ctl_file,
+                                                 "+cpuset", "set cpuset controller", false);
+        }
+        if (!st.ok()) {
+            LOG(WARNING) << "enable cgroup v2 cpuset controller failed, workload group cpuset "
+                            "will not take effect, reason="
+                         << st.to_string_no_stack();
+        }
+    }
+
+    // 4 write cgroup.procs
     _doris_cg_v2_procs_file = query_path + "/cgroup.procs";
     if (access(_doris_cg_v2_procs_file.c_str(), F_OK) != 0) {
         return Status::InternalError<false>("not find cgroup v2 cgroup.procs file");
@@ -201,6 +217,22 @@ void CgroupCpuCtl::update_cpu_soft_limit(int cpu_shares) {
     }
 }
 
+void CgroupCpuCtl::update_cpuset(const std::string& cpus) {
+    if (!_init_succ) {
+        return;
+    }
+    std::lock_guard<std::shared_mutex> w_lock(_lock_mutex);
+    if (_cpuset != cpus) {
+        Status ret = modify_cg_cpuset_no_lock(cpus);
+        if (ret.ok()) {
+            _cpuset = cpus;
+        } else {
+            LOG(WARNING) << "update cpuset of workload group " << _wg_id << " to [" << cpus
+                         << "] failed, reason=" << ret.to_string_no_stack();
+        }
+    }
+}
+
 Status CgroupCpuCtl::write_cg_sys_file(std::string file_path, std::string value, std::string msg,
                                        bool is_append) {
     int fd = open(file_path.c_str(), is_append ? O_RDWR | O_APPEND : O_RDWR);
@@ -344,6 +376,11 @@ Status CgroupV1CpuCtl::modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) {
     return CgroupCpuCtl::write_cg_sys_file(_cgroup_v1_cpu_tg_quota_file, str_val, msg, false);
 }
 
+Status CgroupV1CpuCtl::modify_cg_cpuset_no_lock(const std::string& cpus) {
+    // cpuset is a separate hierarchy from cpu in cgroup v1, threads are only added to cpu
+    return Status::NotSupported<false>("workload group cpuset is only supported on cgroup v2");
+}
+
 Status CgroupV1CpuCtl::add_thread_to_cgroup() {
     return CgroupCpuCtl::add_thread_to_cgroup(_cgroup_v1_cpu_tg_task_file);
 }
@@ -389,6 +426,9 @@ Status CgroupV2CpuCtl::init() {
     RETURN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(_cgroup_v2_query_wg_type_file, "threaded",
                                                     "set cgroup type", false));
 
+    // not required, it only exists if the cpuset controller is enabled
+    _cgroup_v2_query_wg_cpuset_file = _cgroup_v2_query_wg_path + "/cpuset.cpus";
+
     LOG(INFO) << "cgroup v2 cpu path init success"
               << ", query wg path=" << _cgroup_v2_query_wg_path
               << ", cpu.max file = " << _cgroup_v2_query_wg_cpu_max_file
@@ -417,6 +457,14 @@ Status CgroupV2CpuCtl::modify_cg_cpu_soft_limit_no_lock(int cpu_weight) {
                                            false);
 }
 
+Status CgroupV2CpuCtl::modify_cg_cpuset_no_lock(const std::string& cpus) {
+    if (access(_cgroup_v2_query_wg_cpuset_file.c_str(), F_OK) != 0) {
+        return Status::InternalError<false>("not find cgroup v2 wg cpuset.cpus file");
+    }
+    std::string msg = "modify cpuset.cpus to [" + cpus + "]";
+    return CgroupCpuCtl::write_cg_sys_file(_cgroup_v2_query_wg_cpuset_file, cpus, msg, false);
+}
+
 Status CgroupV2CpuCtl::add_thread_to_cgroup() {
     return CgroupCpuCtl::add_thread_to_cgroup(_cgroup_v2_query_wg_thread_file);
 }
@@ -45,6 +45,9 @@ public:
 
     void update_cpu_soft_limit(int cpu_shares);
 
+    // empty cpus means the cpus of the parent cgroup
+    void update_cpuset(const std::string& cpus);
+
     // for log
     void get_cgroup_cpu_info(uint64_t* cpu_shares, int* cpu_hard_limit);
 
@@ -63,6 +66,8 @@ protected:
 
     virtual Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) = 0;
 
+    virtual Status modify_cg_cpuset_no_lock(const std::string& cpus) = 0;
+
     Status add_thread_to_cgroup(std::string task_file);
 
     static Status write_cg_sys_file(std::string file_path, std::string value, std::string msg,
@@ -91,6 +96,7 @@ protected:
     bool _init_succ = false;
     uint64_t _wg_id = -1; // workload group id
     uint64_t _cpu_shares = 0;
+    std::string _cpuset;
 };
 
 /*
@@ -125,6 +131,7 @@ public:
     Status init() override;
     Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) override;
     Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) override;
+    Status modify_cg_cpuset_no_lock(const std::string& cpus) override;
     Status add_thread_to_cgroup() override;
 
 private:
@@ -166,6 +173,9 @@ private:
     10 workload group cgroup type file:
         /sys/fs/cgroup/{doris_home}/query/{workload_group_id}/cgroup.type
 
+    11 workload group cpuset.cpus file, only if the cpuset controller is delegated to doris:
+        /sys/fs/cgroup/{doris_home}/query/{workload_group_id}/cpuset.cpus
+
 */
 class CgroupV2CpuCtl : public CgroupCpuCtl {
 public:
@@ -173,6 +183,7 @@ public:
     Status init() override;
     Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) override;
     Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) override;
+    Status modify_cg_cpuset_no_lock(const std::string& cpus) override;
     Status add_thread_to_cgroup() override;
 
 private:
@@ -181,6 +192,7 @@ private:
     std::string _cgroup_v2_query_wg_cpu_weight_file;
     std::string _cgroup_v2_query_wg_thread_file;
     std::string _cgroup_v2_query_wg_type_file;
+    std::string _cgroup_v2_query_wg_cpuset_file;
 };
 
 } // namespace doris
\ No newline at end of file
@@ -89,12 +89,14 @@
 #include "util/brpc_client_cache.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/hash_util.hpp"
 #include "util/jni-util.h"
 #include "util/mem_info.h"
 #include "util/random.h"
 #include "util/s3_util.h"
 #include "util/scoped_cleanup.h"
 #include "util/stopwatch.hpp"
+#include "util/thrift_util.h"
 #include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
@@ -515,9 +517,52 @@ bvar::Adder<uint64_t> report_disk_total("report", "disk_total");
 bvar::Adder<uint64_t> report_disk_failed("report", "disk_failed");
 bvar::Adder<uint64_t> report_tablet_total("report", "tablet_total");
 bvar::Adder<uint64_t> report_tablet_failed("report", "tablet_failed");
+bvar::Adder<uint64_t> report_tablet_unchanged("report", "tablet_unchanged");
 bvar::Adder<uint64_t> report_index_policy_total("report", "index_policy_total");
 bvar::Adder<uint64_t> report_index_policy_failed("report", "index_policy_failed");
 
+// Fingerprint of the last tablet report accepted by the master FE, only accessed by the
+// report tablet worker.
+struct LastTabletReport {
+    TNetworkAddress master_fe_addr;
+    uint64_t fingerprint = 0;
+    int32_t skip_times = 0;
+};
+LastTabletReport s_last_tablet_report;
+
+// Hash of the report without its report version, which is increased on every report.
+uint64_t tablet_report_fingerprint(TReportRequest* request) {
+    int64_t report_version = request->report_version;
+    request->__isset.report_version = false;
+    ThriftSerializer serializer(false, 4096);
+    uint8_t* buf = nullptr;
+    uint32_t len = 0;
+    Status st = serializer.serialize(request, &len, &buf);
+    request->__set_report_version(report_version);
+    if (!st.ok()) {
+        return 0;
+    }
+    return HashUtil::xxHash64WithSeed(reinterpret_cast<const char*>(buf), len, 0);
+}
+
+// Returns true if the report equals the last accepted one and may be skipped.
+bool skip_unchanged_tablet_report(TReportRequest* request, const ClusterInfo* cluster_info,
+                                  uint64_t* fingerprint) {
+    *fingerprint = 0;
+    if (config::report_unchanged_tablet_max_skip_times <= 0) {
+        return false;
+    }
+    *fingerprint = tablet_report_fingerprint(request);
+    auto& last = s_last_tablet_report;
+    if (*fingerprint == 0 || *fingerprint != last.fingerprint ||
+        cluster_info->master_fe_addr != last.master_fe_addr ||
+        last.skip_times >= config::report_unchanged_tablet_max_skip_times) {
+        return false;
+    }
+    ++last.skip_times;
+    return true;
+}
+
 } // namespace
 
 TaskWorkerPool::TaskWorkerPool(std::string_view name, int worker_count,
@@ -1183,11 +1228,23 @@ void report_tablet_callback(StorageEngine& engine, const ClusterInfo* cluster_in
     }
     request.__isset.resource = true;
 
+    // The FE takes a report as the full tablet list of this BE, so a report is skipped as a whole
+    // when nothing in it changed since the last one the master accepted.
+    uint64_t fingerprint = 0;
+    if (skip_unchanged_tablet_report(&request, cluster_info, &fingerprint)) {
+        report_tablet_unchanged << 1;
+        VLOG_NOTICE << "skip unchanged tablet report, tablet_count=" << request.tablets.size();
+        return;
+    }
+
     bool succ = handle_report(request, cluster_info, "tablet");
     report_tablet_total << 1;
     if (!succ) [[unlikely]] {
         report_tablet_failed << 1;
+        s_last_tablet_report = {};
+        return;
     }
+    s_last_tablet_report = {cluster_info->master_fe_addr, fingerprint, 0};
 }
 
 void report_tablet_callback(CloudStorageEngine& engine, const ClusterInfo* cluster_info) {
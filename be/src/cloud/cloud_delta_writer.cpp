@@ -109,8 +109,9 @@ const RowsetMetaSharedPtr& CloudDeltaWriter::rowset_meta() {
 Status CloudDeltaWriter::commit_rowset() {
     std::lock_guard<bthread::Mutex> lock(_mtx);
     if (!_is_init) {
-        // No data to write, but still need to write a empty rowset kv to keep version continuous
-        RETURN_IF_ERROR(_rowset_builder->init());
+        // No data to write, but still need to write a empty rowset kv to keep version continuous.
+        // The empty rowset has no file to recycle, so it is committed without being prepared.
+        RETURN_IF_ERROR(rowset_builder()->init(false));
         RETURN_IF_ERROR(_rowset_builder->build_rowset());
     }
     return _engine.meta_mgr().commit_rowset(*rowset_meta(), "");
@@ -751,7 +751,10 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
             }
             std::vector<RowsetSharedPtr> rowsets;
             rowsets.reserve(resp.rowset_meta().size());
-            for (const auto& cloud_rs_meta_pb : resp.rowset_meta()) {
+            // The rowsets of one schema version without variant columns have the same schema.
+            // Share the cached schema of the first one instead of serializing it for each rowset.
+            std::unordered_map<int32_t, RowsetMetaSharedPtr> schema_version_to_rs_meta;
+            for (auto& cloud_rs_meta_pb : *resp.mutable_rowset_meta()) {
                 VLOG_DEBUG << "get rowset meta, tablet_id=" << cloud_rs_meta_pb.tablet_id()
                            << ", version=[" << cloud_rs_meta_pb.start_version() << '-'
                            << cloud_rs_meta_pb.end_version() << ']';
@@ -761,6 +764,17 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                     existed_rowset->rowset_id().to_string() == cloud_rs_meta_pb.rowset_id_v2()) {
                     continue; // Same rowset, skip it
                 }
+                bool can_share_schema = cloud_rs_meta_pb.has_tablet_schema() &&
+                                        cloud_rs_meta_pb.has_schema_version() &&
+                                        !cloud_rs_meta_pb.has_variant_type_in_schema() &&
+                                        !cloud_rs_meta_pb.has_schema_dict_key_list();
+                RowsetMetaSharedPtr shared_schema_rs_meta;
+                if (can_share_schema) {
+                    auto it = schema_version_to_rs_meta.find(cloud_rs_meta_pb.schema_version());
+                    if (it != schema_version_to_rs_meta.end()) {
+                        shared_schema_rs_meta = it->second;
+                    }
+                }
                 RowsetMetaPB meta_pb;
                 // Check if the rowset meta contains a schema dictionary key list.
                 if (cloud_rs_meta_pb.has_schema_dict_key_list() && !resp.has_schema_dict()) {
@@ -779,6 +793,9 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                     meta_pb = cloud_rowset_meta_to_doris(copied_cloud_rs_meta_pb);
                 } else {
                     // Otherwise, use the schema dictionary from the response (if available).
+                    if (shared_schema_rs_meta != nullptr) {
+                        cloud_rs_meta_pb.clear_tablet_schema();
+                    }
                     meta_pb = cloud_rowset_meta_to_doris(cloud_rs_meta_pb);
                     if (resp.has_schema_dict()) {
                         RETURN_IF_ERROR(fill_schema_with_dict(cloud_rs_meta_pb, &meta_pb,
@@ -787,6 +804,11 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
                 }
                 auto rs_meta = std::make_shared<RowsetMeta>();
                 rs_meta->init_from_pb(meta_pb);
+                if (shared_schema_rs_meta != nullptr) {
+                    rs_meta->share_tablet_schema(*shared_schema_rs_meta);
+                } else if (can_share_schema) {
+                    schema_version_to_rs_meta.emplace(cloud_rs_meta_pb.schema_version(), rs_meta);
+                }
                 RowsetSharedPtr rowset;
                 // schema is nullptr implies using RowsetMeta.tablet_schema
                 Status s = RowsetFactory::create_rowset(nullptr, "", rs_meta, &rowset);
@@ -33,7 +33,7 @@ CloudRowsetBuilder::CloudRowsetBuilder(CloudStorageEngine& engine, const WriteRe
 
 CloudRowsetBuilder::~CloudRowsetBuilder() = default;
 
-Status CloudRowsetBuilder::init() {
+Status CloudRowsetBuilder::init(bool prepare_rowset) {
     _tablet = DORIS_TRY(_engine.get_tablet(_req.tablet_id));
 
     std::shared_ptr<MowContext> mow_context;
@@ -81,7 +81,9 @@ Status CloudRowsetBuilder::init() {
 
     _calc_delete_bitmap_token = _engine.calc_delete_bitmap_executor()->create_token();
 
-    RETURN_IF_ERROR(_engine.meta_mgr().prepare_rowset(*_rowset_writer->rowset_meta(), ""));
+    if (prepare_rowset) {
+        RETURN_IF_ERROR(_engine.meta_mgr().prepare_rowset(*_rowset_writer->rowset_meta(), ""));
+    }
 
     _is_init = true;
     return Status::OK();
@@ -31,7 +31,11 @@ public:
 
     ~CloudRowsetBuilder() override;
 
-    Status init() override;
+    Status init() override { return init(true); }
+
+    // `prepare_rowset = false` skips the prepare rpc to meta-service. Only for a rowset which
+    // writes no files, as nothing needs to be recycled if the load fails.
+    Status init(bool prepare_rowset);
 
     void update_tablet_stats();
 
@@ -34,6 +34,7 @@
 
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/cloud_tablet_mgr.h"
 #include "common/cast_set.h"
 #include "common/config.h"
@@ -169,6 +170,7 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
         }
     }
 
+    int64_t request_time_us = MonotonicMicros();
     // serially execute sync to reduce unnecessary network overhead
     std::unique_lock lock(_sync_meta_lock);
     if (options.query_version > 0) {
@@ -177,11 +179,25 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
             return Status::OK();
         }
     }
+    // A sync with the same options started after this request and succeeded while waiting for
+    // the lock, it has already fetched everything this one would, so the concurrent requests of
+    // a tablet are coalesced into one rpc.
+    if (!options.full_sync && _last_sync_start_us > request_time_us &&
+        _last_sync_options.warmup_delta_data == options.warmup_delta_data &&
+        _last_sync_options.sync_delete_bitmap == options.sync_delete_bitmap &&
+        _last_sync_options.merge_schema == options.merge_schema) {
+        return Status::OK();
+    }
 
+    int64_t sync_start_us = MonotonicMicros();
     auto st = _engine.meta_mgr().sync_tablet_rowsets_unlocked(this, lock, options, stats);
     if (st.is<ErrorCode::NOT_FOUND>()) {
         clear_cache();
     }
+    if (st.ok()) {
+        _last_sync_start_us = sync_start_us;
+        _last_sync_options = options;
+    }
 
     return st;
 }
@@ -253,6 +269,12 @@ void CloudTablet::add_rowsets(std::vector<RowsetSharedPtr> to_add, bool version_
         for (auto& rs : rowsets) {
             if (version_overlap || warmup_delta_data) {
 #ifndef BE_TEST
+                // When another compute group compacted a cold tablet, only warm up the index
+                // files of the output. Its segment data is downloaded once a query reads it.
+                bool warm_up_segment_data =
+                        warmup_delta_data || config::warm_up_compaction_output_min_qpd <= 0 ||
+                        _engine.tablet_hotspot().qpd(tablet_id()) >=
+                                static_cast<uint64_t>(config::warm_up_compaction_output_min_qpd);
                 // Warmup rowset data in background
                 for (int seg_id = 0; seg_id < rs->num_segments(); ++seg_id) {
                     const auto& rowset_meta = rs->rowset_meta();
@@ -277,21 +299,23 @@ void CloudTablet::add_rowsets(std::vector<RowsetSharedPtr> to_add, bool version_
                                     : rowset_meta->newest_write_timestamp() +
                                               _tablet_meta->ttl_seconds();
                     // clang-format off
-                    _engine.file_cache_block_downloader().submit_download_task(io::DownloadFileMeta {
-                            .path = storage_resource.value()->remote_segment_path(*rowset_meta, seg_id),
-                            .file_size = rs->rowset_meta()->segment_file_size(seg_id),
-                            .file_system = storage_resource.value()->fs,
-                            .ctx =
-                                    {
-                                            .expiration_time = expiration_time,
-                                            .is_dryrun = config::enable_reader_dryrun_when_download_file_cache,
-                                    },
-                            .download_done {[](Status st) {
-                                if (!st) {
-                                    LOG_WARNING("add rowset warm up error ").error(st);
-                                }
-                            }},
-                    });
+                    if (warm_up_segment_data) {
+                        _engine.file_cache_block_downloader().submit_download_task(io::DownloadFileMeta {
+                                .path = storage_resource.value()->remote_segment_path(*rowset_meta, seg_id),
+                                .file_size = rs->rowset_meta()->segment_file_size(seg_id),
+                                .file_system = storage_resource.value()->fs,
+                                .ctx =
+                                        {
+                                                .expiration_time = expiration_time,
+                                                .is_dryrun = config::enable_reader_dryrun_when_download_file_cache,
+                                        },
+                                .download_done {[](Status st) {
+                                    if (!st) {
+                                        LOG_WARNING("add rowset warm up error ").error(st);
+                                    }
+                                }},
+                        });
+                    }
 
                     auto download_idx_file = [&](const io::Path& idx_path) {
                         io::DownloadFileMeta meta {
@@ -427,6 +451,9 @@ void CloudTablet::delete_rowsets(const std::vector<RowsetSharedPtr>& to_delete,
     for (auto&& rs : to_delete) {
         _rs_version_map.erase(rs->version());
     }
+    if (_pk_mem_index != nullptr) {
+        _pk_mem_index->remove_rowsets(to_delete);
+    }
 
     _tablet_meta->modify_rs_metas({}, rs_metas, false);
 }
@@ -297,6 +297,9 @@ private:
     // this mutex MUST ONLY be used when sync meta
     bthread::Mutex _sync_meta_lock;
     // ATTENTION: lock order should be: _sync_meta_lock -> _meta_lock
+    // start time and options of the last successful sync_rowsets, protected by _sync_meta_lock
+    int64_t _last_sync_start_us = -1;
+    SyncOptions _last_sync_options;
 
     std::atomic<int64_t> _cumulative_point {-1};
     std::atomic<int64_t> _approximate_num_rowsets {-1};
@@ -70,6 +70,8 @@ public:
     // When query the tablet, count it
     void count(const BaseTablet& tablet);
     void get_top_n_hot_partition(std::vector<THotTableMessage>* hot_tables);
+    // The number of queries on the tablet in the last day, 0 if it has not been queried
+    uint64_t qpd(int64_t tablet_id);
 
 private:
     void make_dot_point();
@@ -90,6 +90,11 @@ DECLARE_mInt32(check_auto_compaction_interval_seconds);
 DECLARE_mInt32(max_base_compaction_task_num_per_disk);
 DECLARE_mBool(prioritize_query_perf_in_compaction);
 DECLARE_mInt32(compaction_max_rowset_count);
+// When a compute group syncs the output of a compaction done elsewhere, e.g. by a dedicated
+// compaction compute group, it warms up the segment data of the output only if the tablet was
+// queried at least this many times in the last day. The index files are always warmed up.
+// A value <= 0 warms up the segment data of every tablet.
+DECLARE_mInt64(warm_up_compaction_output_min_qpd);
 
 // CloudStorageEngine config
 DECLARE_mInt32(refresh_s3_info_interval_s);
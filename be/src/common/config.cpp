@@ -137,6 +137,8 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // P.S. This is also required, because tcmalloc can not allocate a chunk of
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
+DEFINE_mBool(enable_huge_page_for_mmap_alloc, "false");
+DEFINE_mInt64(numa_interleave_alloc_threshold, "-1");
 
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
@@ -225,8 +227,11 @@ DEFINE_Int32(delete_worker_count, "3");
 DEFINE_Int32(alter_tablet_worker_count, "3");
 // the count of thread to alter index
 DEFINE_Int32(alter_index_worker_count, "3");
+DEFINE_mInt32(alter_index_segment_parallelism, "4");
+DEFINE_mInt64(alter_index_ram_buffer_budget_mb, "2048");
 // the count of thread to clone
 DEFINE_Int32(clone_worker_count, "3");
+DEFINE_mInt32(clone_download_files_concurrency, "4");
 // the count of thread to clone
 DEFINE_Int32(storage_medium_migrate_count, "1");
 // the count of thread to check consistency
@@ -249,6 +254,7 @@ DEFINE_mInt32(report_task_interval_seconds, "10");
 DEFINE_mInt32(report_disk_state_interval_seconds, "60");
 // the interval time(seconds) for agent report olap table to FE
 DEFINE_mInt32(report_tablet_interval_seconds, "60");
+DEFINE_mInt32(report_unchanged_tablet_max_skip_times, "4");
 // the max download speed(KB/s)
 DEFINE_mInt32(max_download_speed_kbps, "50000");
 // download low speed limit(KB/s)
@@ -293,6 +299,45 @@ DEFINE_Int32(be_service_threads, "64");
 // The pipeline task has a high concurrency, therefore reducing its report frequency
 DEFINE_mInt32(pipeline_status_report_interval, "10");
 DEFINE_mInt32(pipeline_task_exec_time_slice, "100");
+// Put pipeline tasks in the levels of the task queue by the CPU time of their whole query,
+// not of the task alone, and shorten the time slice of the tasks in the top levels.
+DEFINE_mBool(enable_pipeline_task_level_by_query_cost, "false");
+// Push the tasks woken up by the same dependency together and spread them over the workers.
+DEFINE_mBool(enable_pipeline_batch_wake_up, "false");
+// Count the CPU cycles, instructions and cache misses of every operator with the hardware
+// performance counters of the thread, shown in the profile. Needs perf_event_paranoid <= 2.
+DEFINE_mBool(enable_pipeline_operator_perf_counters, "false");
+// Keep the last runs of pipeline tasks of every worker thread in memory, for
+// api/pipeline/tracing/snapshot to show what the workers were doing during a stall.
+DEFINE_mBool(enable_pipeline_task_trace_ring, "true");
+// The number of task runs kept per worker thread.
+DEFINE_Int32(pipeline_task_trace_ring_capacity, "4096");
+// Let a parallel scan of a tablet start at the segment another scan of it is reading and wrap
+// around for the segments before, so concurrent scans of the same tablet read the same pages
+// at about the same time and share them through the caches.
+DEFINE_mBool(enable_synchronized_scan, "false");
+// A scan only follows the position of a scan of the tablet that started this recently.
+DEFINE_mInt32(synchronized_scan_position_expire_ms, "10000");
+// Number of threads that insert the rows of a hash table shared by the tasks of a broadcast
+// join, 1 inserts them in the building task alone.
+DEFINE_mInt32(shared_hash_table_build_parallelism, "1");
+// Threads of the pool that helps to build the shared hash tables of broadcast joins
+DEFINE_Int32(join_build_thread_num, "16");
+// Whether a large join hash table has a bloom filter of its keys, which drops the probe rows
+// without a match before the lookup in the table.
+DEFINE_mBool(enable_hash_join_probe_bloom_filter, "false");
+// Whether streaming pre-aggregation still merges the rows of the groups already in its hash
+// table once the table stops expanding, instead of passing all rows through.
+DEFINE_mBool(enable_streaming_agg_merge_existing_groups, "false");
+// Whether a full sort on several columns radix sorts the normalized prefix of its leading
+// fixed-width sort columns, and only sorts rows with equal prefixes by the other columns.
+DEFINE_mBool(enable_sort_block_radix_sort, "true");
+// Whether the functions like count/min/max calculate a sliding rows frame of an analytic function
+// by merging the states of the parts of the frame, instead of adding all rows of each frame.
+DEFINE_mBool(enable_analytic_sliding_frame_merge, "true");
+// Whether the parallel tasks of a heap sort share the threshold row of their heaps, so that each
+// task drops the input rows after the row of the best full heap.
+DEFINE_mBool(enable_heap_sort_shared_threshold, "true");
 
 // task executor min concurrency per task
 DEFINE_Int32(task_executor_min_concurrency_per_task, "1");
@@ -358,6 +403,16 @@ DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648"
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
+// whether the lru caches evict with the CLOCK algorithm, where a cache hit takes the shard lock
+// shared and does not move the entry, instead of the strict LRU. LRU-K admission is not used in
+// this mode, and caches that evict by value timestamp keep the strict LRU.
+DEFINE_Bool(enable_lru_cache_clock_eviction, "false");
+// interval of moving capacity between the lru caches by the hits of their recently evicted keys,
+// 0 disables it. The keys are only kept when it is enabled at start.
+DEFINE_Int32(cache_rebalance_interval_sec, "0");
+// the capacity of a rebalanced cache stays within this ratio of its initial capacity
+DEFINE_mDouble(cache_rebalance_max_ratio, "0.5");
+DEFINE_mInt64(cache_capacity_shrink_step_bytes, "268435456");
 // the clean interval of tablet lookup cache
 DEFINE_mInt32(tablet_lookup_cache_stale_sweep_time_sec, "30");
 DEFINE_mInt32(point_query_row_cache_stale_sweep_time_sec, "300");
@@ -404,10 +459,17 @@ DEFINE_Int32(storage_page_cache_shard_size, "256");
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DEFINE_Int32(index_page_cache_percentage, "10");
+// Percentage of storage page cache kept for compressed pages, which serve the data and index
+// pages evicted from the decompressed page caches without reading the file again. 0 disables it.
+DEFINE_Int32(compressed_page_cache_percentage, "0");
+// Percentage of storage page cache kept for the data pages of the row store column, so that the
+// pages read by point queries are not evicted by scans. 0 keeps them in the data page cache.
+DEFINE_Int32(row_store_page_cache_percentage, "0");
 // whether to disable page cache feature in storage
 DEFINE_mBool(disable_storage_page_cache, "false");
 // whether to disable row cache feature in storage
 DEFINE_mBool(disable_storage_row_cache, "true");
+DEFINE_mBool(enable_fetch_rows_from_row_store_columns, "true");
 // whether to disable pk page cache feature in storage
 DEFINE_Bool(disable_pk_storage_page_cache, "false");
 
@@ -415,6 +477,8 @@ DEFINE_Bool(disable_pk_storage_page_cache, "false");
 DEFINE_String(pk_storage_page_cache_limit, "10%");
 // data page size for primary key index
 DEFINE_Int32(primary_key_data_page_size, "32768");
+DEFINE_mBool(enable_for_encoding_sorted_key_column, "false");
+DEFINE_mBool(enable_for_encoding_frame_filter, "true");
 
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
@@ -438,6 +502,17 @@ DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "1024");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
+// In vertical compaction, number of value column groups merged at the same time, 1 merges
+// them one by one
+DEFINE_mInt32(vertical_compaction_value_group_parallelism, "1");
+// Threads to merge value column groups ahead of the compaction threads
+DEFINE_Int32(vertical_compaction_value_group_thread_num, "8");
+// Max bytes per second that base and full compactions read from one disk, shared by all of
+// them on the disk. Cumulative compactions are not limited. -1 means no limit.
+DEFINE_mInt64(compaction_io_bytes_per_second_per_disk, "-1");
+// Estimate the number of distinct values of every column from the rows a compaction writes,
+// and log them with the compaction.
+DEFINE_mBool(enable_compaction_column_ndv, "false");
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
@@ -595,6 +670,8 @@ DEFINE_Int32(brpc_light_work_pool_max_queue_size, "-1");
 DEFINE_mBool(enable_bthread_transmit_block, "true");
 DEFINE_Int32(brpc_arrow_flight_work_pool_threads, "-1");
 DEFINE_Int32(brpc_arrow_flight_work_pool_max_queue_size, "-1");
+DEFINE_Int32(brpc_load_work_pool_threads, "-1");
+DEFINE_Int32(brpc_load_work_pool_max_queue_size, "-1");
 
 //Enable brpc builtin services, see:
 //https://brpc.apache.org/docs/server/basics/#disable-built-in-services-completely
@@ -634,6 +711,7 @@ DEFINE_mInt64(clean_stream_load_record_interval_secs, "1800");
 DEFINE_mBool(enable_stream_load_commit_txn_on_be, "false");
 // The buffer size to store stream table function schema info
 DEFINE_Int64(stream_tvf_buffer_size, "1048576"); // 1MB
+DEFINE_mInt64(stream_load_chunk_buffer_size, "131072"); // 128KB
 
 // OlapTableSink sender's send interval, should be less than the real response time of a tablet writer rpc.
 // You may need to lower the speed when the sink receiver bes are too busy.
@@ -678,6 +756,8 @@ DEFINE_Bool(ignore_file_cache_dir_upgrade_failure, "false");
 
 // Sleep time in milliseconds between memory maintenance iterations
 DEFINE_mInt32(memory_maintenance_sleep_time_ms, "50");
+DEFINE_mInt32(memory_growth_snapshot_interval_s, "10");
+DEFINE_mInt32(memory_growth_window_snapshots, "30");
 
 // Memory gc are expensive, wait a while to avoid too frequent.
 DEFINE_mInt32(memory_gc_sleep_time_ms, "500");
@@ -688,6 +768,9 @@ DEFINE_mInt64(write_buffer_size, "209715200");
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
+DEFINE_mInt64(memtable_limiter_target_flush_bytes, "67108864");
+DEFINE_mBool(enable_memtable_radix_sort, "true");
+DEFINE_mInt32(memtable_agg_parallelism, "1");
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DEFINE_mInt32(memtable_wait_for_memory_sleep_time_s, "300");
@@ -807,6 +890,14 @@ DEFINE_Int64(brpc_socket_max_unwritten_bytes, "-1");
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DEFINE_mBool(transfer_large_data_by_brpc, "true");
 
+// The max bytes of the queued blocks an exchange sink sends to an instance in one rpc, used when
+// the query does not set exchange_multi_blocks_byte_size. 0 sends one block per rpc, all backends
+// must be able to receive multiple blocks in one rpc before it is enabled.
+DEFINE_mInt32(exchange_sink_multi_blocks_byte_size, "0");
+// An exchange channel sends its next blocks without compression for a while when compressing a
+// block saves less than this fraction of its bytes, 0 always compresses the blocks.
+DEFINE_mDouble(exchange_compression_min_saving_ratio, "0.1");
+
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
 DEFINE_mInt64(max_runnings_transactions_per_txn_map, "2000");
@@ -921,6 +1012,8 @@ DEFINE_Int32(send_batch_thread_pool_queue_size, "102400");
 // When doing compaction, each segment may take at least 1MB buffer.
 DEFINE_mInt32(max_segment_num_per_rowset, "1000");
 DEFINE_mInt32(segment_compression_threshold_kb, "256");
+DEFINE_mBool(enable_adaptive_column_compression, "false");
+DEFINE_mDouble(adaptive_column_compression_zstd_min_saving, "0.2");
 
 // Time to clean up useless JDBC connection pool cache
 DEFINE_mInt32(jdbc_connection_pool_cache_clear_time_sec, "28800");
@@ -948,6 +1041,8 @@ DEFINE_String(kafka_debug, "disable");
 // Change this size to 0 to fix it temporarily.
 DEFINE_mInt32(routine_load_consumer_pool_size, "1024");
 
+DEFINE_mInt32(routine_load_consumer_batch_size, "64");
+
 // Used in single-stream-multi-table load. When receive a batch of messages from kafka,
 // if the size of batch is more than this threshold, we will request plans for all related tables.
 DEFINE_Int32(multi_table_batch_plan_threshold, "200");
@@ -992,6 +1087,9 @@ DEFINE_mInt32(parquet_header_max_size_mb, "1");
 DEFINE_mInt32(parquet_rowgroup_max_buffer_mb, "128");
 // Max buffer size for parquet chunk column
 DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
+// Decode the columns of a parquet row group concurrently when a batch reads at least this many
+// columns, 0 decodes them one after another on the scanner thread.
+DEFINE_mInt32(parquet_parallel_decode_min_columns, "0");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
@@ -1111,6 +1209,9 @@ DEFINE_Int64(file_cache_each_block_size, "1048576"); // 1MB
 
 DEFINE_Bool(clear_file_cache, "false");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
+// when the normal queue of the file cache is full, only cache a new block if it was accessed
+// more often recently than the block it would evict, so large scans do not wipe the hot blocks
+DEFINE_Bool(enable_file_cache_admission_filter, "false");
 DEFINE_mInt32(file_cache_enter_disk_resource_limit_mode_percent, "90");
 DEFINE_mInt32(file_cache_exit_disk_resource_limit_mode_percent, "88");
 DEFINE_mBool(enable_evict_file_cache_in_advance, "true");
@@ -1131,9 +1232,13 @@ DEFINE_mInt64(file_cache_error_log_limit_bytes, "209715200"); // 200MB
 DEFINE_mInt64(cache_lock_wait_long_tail_threshold_us, "30000000");
 DEFINE_mInt64(cache_lock_held_long_tail_threshold_us, "30000000");
 DEFINE_mBool(enable_file_cache_keep_base_compaction_output, "false");
+DEFINE_mInt64(file_cache_keep_hot_compaction_output_min_qpd, "100");
 DEFINE_mInt64(file_cache_remove_block_qps_limit, "1000");
 DEFINE_mInt64(file_cache_background_gc_interval_ms, "100");
 DEFINE_mBool(enable_reader_dryrun_when_download_file_cache, "true");
+DEFINE_mBool(enable_segment_prefetch_file_cache, "true");
+DEFINE_mInt32(segment_prefetch_window_rows, "65536");
+DEFINE_mInt64(segment_prefetch_max_bytes_per_query, "268435456");
 DEFINE_mInt64(file_cache_background_monitor_interval_ms, "5000");
 DEFINE_mInt64(file_cache_background_ttl_gc_interval_ms, "3000");
 DEFINE_mInt64(file_cache_background_ttl_gc_batch, "1000");
@@ -1142,6 +1247,12 @@ DEFINE_mInt64(file_cache_background_lru_dump_interval_ms, "60000");
 DEFINE_mInt64(file_cache_background_lru_dump_update_cnt_threshold, "1000");
 DEFINE_mInt64(file_cache_background_lru_dump_tail_record_num, "5000000");
 DEFINE_mInt64(file_cache_background_lru_log_replay_interval_ms, "1000");
+// checkpoint the whole lru queues at a clean shutdown and restore the cache from them at the
+// next start instead of scanning the cache directories. A crash falls back to the scan.
+DEFINE_Bool(enable_file_cache_restore_from_checkpoint, "false");
+// a cached block hit again within this many seconds of its last access is not moved to the end
+// of its lru queue, which shortens the cache lock held by hot reads. 0 moves it on every hit.
+DEFINE_mInt64(file_cache_lru_move_interval_s, "0");
 DEFINE_mBool(enable_evaluate_shadow_queue_diff, "false");
 
 DEFINE_Int32(file_cache_downloader_thread_num_min, "32");
@@ -1195,6 +1306,11 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
+// max number of the upload parts in flight of one s3 file writer, the writer grows its window
+// while the part latency stays low and halves it when the latency goes up. 0 means no limit.
+DEFINE_mInt32(s3_file_writer_max_inflight_parts, "0");
+// max number of the released s3 write buffers kept for reuse, 0 frees them at once
+DEFINE_mInt32(s3_write_buffer_pool_max_num, "0");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
 DEFINE_mInt64(hdfs_write_batch_buffer_size_mb, "1"); // 1MB
 
@@ -1307,6 +1423,10 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mBool(group_commit_enable_adaptive_interval, "false");
+DEFINE_mInt32(group_commit_adaptive_target_latency_ms, "5000");
+DEFINE_mInt32(group_commit_adaptive_min_interval_ms, "50");
+DEFINE_mBool(group_commit_wal_sync_on_append, "false");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1318,6 +1438,7 @@ DEFINE_Bool(enable_flush_file_cache_async, "true");
 
 // cgroup
 DEFINE_String(doris_cgroup_cpu_path, "");
+DEFINE_mString(workload_group_cpuset, "");
 
 DEFINE_mBool(enable_be_proc_monitor, "false");
 DEFINE_mInt32(be_proc_monitor_interval_ms, "10000");
@@ -1340,6 +1461,9 @@ DEFINE_Int32(download_binlog_rate_limit_kbs, "0");
 
 DEFINE_mInt32(buffered_reader_read_timeout_ms, "600000");
 
+DEFINE_mBool(enable_pipelined_decompress, "false");
+DEFINE_mInt32(pipelined_decompress_chunk_num, "4");
+
 DEFINE_Bool(enable_snapshot_action, "false");
 
 DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
@@ -1347,6 +1471,19 @@ DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
+// The number of sources a passthrough local exchange sends blocks to at first, 0 for all.
+// The number doubles when the rows passed exceed local_exchange_passthrough_rows_per_channel
+// per source, or a source has local_exchange_passthrough_channel_max_blocks blocks queued.
+DEFINE_mInt32(local_exchange_passthrough_initial_channels, "0");
+DEFINE_mInt64(local_exchange_passthrough_rows_per_channel, "65536");
+DEFINE_mInt32(local_exchange_passthrough_channel_max_blocks, "2");
+// Spread a hash partition of a local exchange over all tasks if it has more than
+// local_exchange_hot_partition_factor times the even share of the rows, for the operators that
+// merge the results of the tasks later, e.g. partial aggregations. Only checked after
+// local_exchange_hot_partition_min_rows rows.
+DEFINE_mBool(enable_local_exchange_split_hot_partitions, "false");
+DEFINE_mDouble(local_exchange_hot_partition_factor, "2");
+DEFINE_mInt64(local_exchange_hot_partition_min_rows, "65536");
 
 // Default 300s, if its value <= 0, then log is disabled
 DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
@@ -1382,6 +1519,11 @@ DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
 
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
+DEFINE_mInt64(paused_query_min_reserve_bytes, "67108864");
+DEFINE_String(spill_compression_type, "AUTO");
+DEFINE_Validator(spill_compression_type, [](const std::string& config) -> bool {
+    return config == "AUTO" || config == "ZSTD" || config == "LZ4" || config == "NONE";
+});
 
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
@@ -1390,6 +1532,7 @@ DEFINE_mBool(force_azure_blob_global_endpoint, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+DEFINE_mInt64(s3_read_parallel_part_size, "0");
 DEFINE_mBool(enable_s3_object_check_after_upload, "true");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
@@ -1481,6 +1624,7 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "4");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1492,6 +1636,9 @@ DEFINE_Int64(min_row_group_size, "134217728");
 
 DEFINE_mInt64(compaction_memory_bytes_limit, "1073741824");
 
+// Whether to reserve the estimated memory of a compaction from the process before merging
+DEFINE_mBool(enable_compaction_memory_reservation, "false");
+
 DEFINE_mInt64(compaction_batch_size, "-1");
 
 // If set to false, the parquet reader will not use page index to filter data.
@@ -1521,6 +1668,7 @@ DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
+DEFINE_mBool(enable_query_cache_delta_reuse, "true");
 
 // Enable validation to check the correctness of table size.
 DEFINE_Bool(enable_table_size_correctness_check, "false");
@@ -1544,8 +1692,20 @@ DEFINE_mInt32(schema_dict_cache_capacity, "4096");
 DEFINE_mBool(enable_prune_delete_sign_when_base_compaction, "true");
 
 DEFINE_mBool(enable_mow_verbose_log, "false");
+// Keep the primary keys of the small rowsets of merge-on-write tablets in memory, so that a
+// key lookup only opens the rowsets that have the key.
+DEFINE_mBool(enable_pk_mem_index, "false");
+// Rowsets with more rows are not kept in the in-memory primary key index.
+DEFINE_mInt64(pk_mem_index_max_rowset_rows, "10000");
+// Max keys in the in-memory primary key index of one tablet.
+DEFINE_mInt64(pk_mem_index_max_keys_per_tablet, "1000000");
 
 DEFINE_mInt32(tablet_sched_delay_time_ms, "5000");
+// Weight of the read amplification of recent queries in the priority of a tablet to compact,
+// added to its compaction score. 0 picks tablets by the compaction score only.
+DEFINE_mDouble(compaction_read_amplification_weight, "0");
+// The read amplification of a tablet counts half after this many seconds.
+DEFINE_mInt64(compaction_read_amplification_half_life_sec, "600");
 DEFINE_mInt32(load_trigger_compaction_version_percent, "66");
 DEFINE_mInt64(base_compaction_interval_seconds_since_last_operation, "86400");
 DEFINE_mBool(enable_compaction_pause_on_high_memory, "true");
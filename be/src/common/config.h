@@ -171,6 +171,15 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // P.S. This is also required, because tcmalloc can not allocate a chunk of
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
+// Whether to ask the kernel to back the allocations above mmap_threshold with transparent huge
+// pages, which saves page faults and TLB misses on large hash tables. It only takes effect when
+// /sys/kernel/mm/transparent_hugepage/enabled is `madvise` or `always`.
+DECLARE_mBool(enable_huge_page_for_mmap_alloc);
+// Allocations of at least this many bytes are interleaved across all numa nodes, <= 0 to disable.
+// They are mostly hash tables built by one task and probed by tasks on every node, which would
+// otherwise all live on the node of the building task. Smaller ones stay on the node of the task
+// that first touches them.
+DECLARE_mInt64(numa_interleave_alloc_threshold);
 
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
@@ -270,8 +279,15 @@ DECLARE_Int32(delete_worker_count);
 DECLARE_Int32(alter_tablet_worker_count);
 // the count of thread to alter index
 DECLARE_Int32(alter_index_worker_count);
+// the max count of segments of a tablet to build inverted indexes for at the same time
+DECLARE_mInt32(alter_index_segment_parallelism);
+// the memory in MB shared by the RAM buffers of the index writers of the segments built at the
+// same time, each of which may grow up to inverted_index_ram_buffer_size
+DECLARE_mInt64(alter_index_ram_buffer_budget_mb);
 // the count of thread to clone
 DECLARE_Int32(clone_worker_count);
+// the max count of the files, or file batches, of one tablet downloaded at the same time by a clone
+DECLARE_mInt32(clone_download_files_concurrency);
 // the count of thread to clone
 DECLARE_Int32(storage_medium_migrate_count);
 // the count of thread to check consistency
@@ -293,6 +309,9 @@ DECLARE_mInt32(report_task_interval_seconds);
 DECLARE_mInt32(report_disk_state_interval_seconds);
 // the interval time(seconds) for agent report olap table to FE
 DECLARE_mInt32(report_tablet_interval_seconds);
+// the max times in a row the tablet report is skipped because it equals the last successful one,
+// a full report is always sent after that for reconciliation. 0 means never skip
+DECLARE_mInt32(report_unchanged_tablet_max_skip_times);
 // the max download speed(KB/s)
 DECLARE_mInt32(max_download_speed_kbps);
 // download low speed limit(KB/s)
@@ -340,6 +359,45 @@ DECLARE_Int32(be_service_threads);
 DECLARE_mInt32(pipeline_status_report_interval);
 // Time slice for pipeline task execution (ms)
 DECLARE_mInt32(pipeline_task_exec_time_slice);
+// Put pipeline tasks in the levels of the task queue by the CPU time of their whole query,
+// not of the task alone, and shorten the time slice of the tasks in the top levels.
+DECLARE_mBool(enable_pipeline_task_level_by_query_cost);
+// Push the tasks woken up by the same dependency together and spread them over the workers.
+DECLARE_mBool(enable_pipeline_batch_wake_up);
+// Count the CPU cycles, instructions and cache misses of every operator with the hardware
+// performance counters of the thread, shown in the profile. Needs perf_event_paranoid <= 2.
+DECLARE_mBool(enable_pipeline_operator_perf_counters);
+// Keep the last runs of pipeline tasks of every worker thread in memory, for
+// api/pipeline/tracing/snapshot to show what the workers were doing during a stall.
+DECLARE_mBool(enable_pipeline_task_trace_ring);
+// The number of task runs kept per worker thread.
+DECLARE_Int32(pipeline_task_trace_ring_capacity);
+// Let a parallel scan of a tablet start at the segment another scan of it is reading and wrap
+// around for the segments before, so concurrent scans of the same tablet read the same pages
+// at about the same time and share them through the caches.
+DECLARE_mBool(enable_synchronized_scan);
+// A scan only follows the position of a scan of the tablet that started this recently.
+DECLARE_mInt32(synchronized_scan_position_expire_ms);
+// Number of threads that insert the rows of a hash table shared by the tasks of a broadcast
+// join, 1 inserts them in the building task alone.
+DECLARE_mInt32(shared_hash_table_build_parallelism);
+// Threads of the pool that helps to build the shared hash tables of broadcast joins
+DECLARE_Int32(join_build_thread_num);
+// Whether a large join hash table has a bloom filter of its keys, which drops the probe rows
+// without a match before the lookup in the table.
+DECLARE_mBool(enable_hash_join_probe_bloom_filter);
+// Whether streaming pre-aggregation still merges the rows of the groups already in its hash
+// table once the table stops expanding, instead of passing all rows through.
+DECLARE_mBool(enable_streaming_agg_merge_existing_groups);
+// Whether a full sort on several columns radix sorts the normalized prefix of its leading
+// fixed-width sort columns, and only sorts rows with equal prefixes by the other columns.
+DECLARE_mBool(enable_sort_block_radix_sort);
+// Whether the functions like count/min/max calculate a sliding rows frame of an analytic function
+// by merging the states of the parts of the frame, instead of adding all rows of each frame.
+DECLARE_mBool(enable_analytic_sliding_frame_merge);
+// Whether the parallel tasks of a heap sort share the threshold row of their heaps, so that each
+// task drops the input rows after the row of the best full heap.
+DECLARE_mBool(enable_heap_sort_shared_threshold);
 
 // task executor min concurrency per task
 DECLARE_mInt32(task_executor_min_concurrency_per_task);
@@ -388,6 +446,18 @@ DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
 DECLARE_mInt32(cache_periodic_prune_stale_sweep_sec);
+// whether the lru caches evict with the CLOCK algorithm, where a cache hit takes the shard lock
+// shared and does not move the entry, instead of the strict LRU. LRU-K admission is not used in
+// this mode, and caches that evict by value timestamp keep the strict LRU.
+DECLARE_Bool(enable_lru_cache_clock_eviction);
+// interval of moving capacity between the lru caches by the hits of their recently evicted keys,
+// 0 disables it. The keys are only kept when it is enabled at start.
+DECLARE_Int32(cache_rebalance_interval_sec);
+// the capacity of a rebalanced cache stays within this ratio of its initial capacity
+DECLARE_mDouble(cache_rebalance_max_ratio);
+// when memory gc reduces the capacity of a lru cache limited by bytes, it is reduced by at most
+// this many bytes at a time, so that each shard lock is held only briefly. <= 0 reduces it at once
+DECLARE_mInt64(cache_capacity_shrink_step_bytes);
 // the clean interval of tablet lookup cache
 DECLARE_mInt32(tablet_lookup_cache_stale_sweep_time_sec);
 DECLARE_mInt32(point_query_row_cache_stale_sweep_time_sec);
@@ -435,11 +505,20 @@ DECLARE_Int32(storage_page_cache_shard_size);
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DECLARE_Int32(index_page_cache_percentage);
+// Percentage of storage page cache kept for compressed pages, which serve the data and index
+// pages evicted from the decompressed page caches without reading the file again. 0 disables it.
+DECLARE_Int32(compressed_page_cache_percentage);
+// Percentage of storage page cache kept for the data pages of the row store column, so that the
+// pages read by point queries are not evicted by scans. 0 keeps them in the data page cache.
+DECLARE_Int32(row_store_page_cache_percentage);
 // whether to disable page cache feature in storage
 // TODO delete it. Divided into Data page, Index page, pk index page
 DECLARE_Bool(disable_storage_page_cache);
 // whether to disable row cache feature in storage
 DECLARE_mBool(disable_storage_row_cache);
+// whether rows fetched by row id are read from the row store column when it holds all the
+// fetched columns, even if the query does not require to fetch from the full row store
+DECLARE_mBool(enable_fetch_rows_from_row_store_columns);
 // whether to disable pk page cache feature in storage
 DECLARE_Bool(disable_pk_storage_page_cache);
 
@@ -448,6 +527,13 @@ DECLARE_Bool(disable_pk_storage_page_cache);
 DECLARE_String(pk_storage_page_cache_limit);
 // data page size for primary key index
 DECLARE_Int32(primary_key_data_page_size);
+// whether to store the first sort key column of integer or datetime type with
+// frame-of-reference encoding, which keeps ascending values as bit-packed deltas.
+// Segments written with it can not be read by BEs that are older than this option.
+DECLARE_mBool(enable_for_encoding_sorted_key_column);
+// whether to skip the frames of frame-of-reference encoded pages whose value range does not
+// match the predicates, when filtering rows by zone map
+DECLARE_mBool(enable_for_encoding_frame_filter);
 
 // inc_rowset snapshot rs sweep time interval
 DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
@@ -473,6 +559,17 @@ DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
+// In vertical compaction, number of value column groups merged at the same time, 1 merges
+// them one by one
+DECLARE_mInt32(vertical_compaction_value_group_parallelism);
+// Threads to merge value column groups ahead of the compaction threads
+DECLARE_Int32(vertical_compaction_value_group_thread_num);
+// Max bytes per second that base and full compactions read from one disk, shared by all of
+// them on the disk. Cumulative compactions are not limited. -1 means no limit.
+DECLARE_mInt64(compaction_io_bytes_per_second_per_disk);
+// Estimate the number of distinct values of every column from the rows a compaction writes,
+// and log them with the compaction.
+DECLARE_mBool(enable_compaction_column_ndv);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
@@ -626,6 +723,10 @@ DECLARE_Int32(brpc_light_work_pool_max_queue_size);
 DECLARE_mBool(enable_bthread_transmit_block);
 DECLARE_Int32(brpc_arrow_flight_work_pool_threads);
 DECLARE_Int32(brpc_arrow_flight_work_pool_max_queue_size);
+// threads to handle the tablet writer interfaces of load channels, which may wait for the memtable
+// memory limit, so that waiting loads do not hold the heavy threads needed by other interfaces
+DECLARE_Int32(brpc_load_work_pool_threads);
+DECLARE_Int32(brpc_load_work_pool_max_queue_size);
 
 // The maximum amount of data that can be processed by a stream load
 DECLARE_mInt64(streaming_load_max_mb);
@@ -656,6 +757,9 @@ DECLARE_mInt64(clean_stream_load_record_interval_secs);
 DECLARE_mBool(enable_stream_load_commit_txn_on_be);
 // The buffer size to store stream table function schema info
 DECLARE_Int64(stream_tvf_buffer_size);
+// The max size of a buffer that the received http body of a stream load is moved into before
+// being appended to the load pipe. A buffer is only as large as the data that has arrived.
+DECLARE_mInt64(stream_load_chunk_buffer_size);
 
 // OlapTableSink sender's send interval, should be less than the real response time of a tablet writer rpc.
 // You may need to lower the speed when the sink receiver bes are too busy.
@@ -703,6 +807,11 @@ DECLARE_Bool(ignore_file_cache_dir_upgrade_failure);
 
 // Sleep time in milliseconds between memory maintenance iterations
 DECLARE_mInt32(memory_maintenance_sleep_time_ms);
+// Interval in seconds of the snapshots of memory tracker consumption kept for the memory growth
+// of the process profile page, <= 0 to disable
+DECLARE_mInt32(memory_growth_snapshot_interval_s);
+// Number of snapshots in the memory growth window
+DECLARE_mInt32(memory_growth_window_snapshots);
 
 // Memory gc are expensive, wait a while to avoid too frequent.
 DECLARE_mInt32(memory_gc_sleep_time_ms);
@@ -713,6 +822,15 @@ DECLARE_mInt64(write_buffer_size);
 DECLARE_mInt64(write_buffer_size_for_agg);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
+// When the load memory limit is reached, memtables smaller than this size are flushed in the
+// order of how long they would take to grow to it, so that fast growing memtables are left to
+// become large segments. 0 means always flushing the largest memtable first.
+DECLARE_mInt64(memtable_limiter_target_flush_bytes);
+// sort memtable rows by radix sorting the normalized prefix of leading fixed-width key columns
+DECLARE_mBool(enable_memtable_radix_sort);
+// max number of key-disjoint ranges aggregated concurrently when flushing one memtable of
+// an aggregate or unique key table, 1 means the aggregation runs on the flush thread only
+DECLARE_mInt32(memtable_agg_parallelism);
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DECLARE_mInt32(memtable_wait_for_memory_sleep_time_s);
@@ -832,6 +950,14 @@ DECLARE_Int64(brpc_socket_max_unwritten_bytes);
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DECLARE_mBool(transfer_large_data_by_brpc);
 
+// The max bytes of the queued blocks an exchange sink sends to an instance in one rpc, used when
+// the query does not set exchange_multi_blocks_byte_size. 0 sends one block per rpc, all backends
+// must be able to receive multiple blocks in one rpc before it is enabled.
+DECLARE_mInt32(exchange_sink_multi_blocks_byte_size);
+// An exchange channel sends its next blocks without compression for a while when compressing a
+// block saves less than this fraction of its bytes, 0 always compresses the blocks.
+DECLARE_mDouble(exchange_compression_min_saving_ratio);
+
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
 DECLARE_mInt64(max_runnings_transactions_per_txn_map);
@@ -946,6 +1072,13 @@ DECLARE_mInt32(max_segment_num_per_rowset);
 // segment_compression_threshold_kb.
 DECLARE_mInt32(segment_compression_threshold_kb);
 
+// Let each column choose between LZ4, ZSTD and no compression by trying them on its first
+// page, instead of using the compression of the tablet for all columns.
+DECLARE_mBool(enable_adaptive_column_compression);
+// ZSTD is only chosen if its page is smaller than the LZ4 one by at least this ratio,
+// because it decodes much slower than LZ4.
+DECLARE_mDouble(adaptive_column_compression_zstd_min_saving);
+
 // Time to clean up useless JDBC connection pool cache
 DECLARE_mInt32(jdbc_connection_pool_cache_clear_time_sec);
 
@@ -971,6 +1104,11 @@ DECLARE_mString(kafka_debug);
 // Change this size to 0 to fix it temporarily.
 DECLARE_mInt32(routine_load_consumer_pool_size);
 
+// The max number of kafka messages a routine load consumer hands to its consumer group at once.
+// A consumer only waits for the broker until it has the first message of a batch, the rest are
+// the messages already fetched by librdkafka.
+DECLARE_mInt32(routine_load_consumer_batch_size);
+
 // the timeout of condition variable wait in blocking_get and blocking_put
 DECLARE_mInt32(blocking_queue_cv_wait_timeout_ms);
 
@@ -1015,6 +1153,9 @@ DECLARE_mInt32(parquet_header_max_size_mb);
 DECLARE_mInt32(parquet_rowgroup_max_buffer_mb);
 // Max buffer size for parquet chunk column
 DECLARE_mInt32(parquet_column_max_buffer_mb);
+// Decode the columns of a parquet row group concurrently when a batch reads at least this many
+// columns, 0 decodes them one after another on the scanner thread.
+DECLARE_mInt32(parquet_parallel_decode_min_columns);
 // Merge small IO, the max amplified read ratio
 DECLARE_mDouble(max_amplified_read_ratio);
 // Equivalent min size of each IO that can reach the maximum storage speed limit
@@ -1132,6 +1273,9 @@ DECLARE_String(file_cache_path);
 DECLARE_Int64(file_cache_each_block_size);
 DECLARE_Bool(clear_file_cache);
 DECLARE_Bool(enable_file_cache_query_limit);
+// when the normal queue of the file cache is full, only cache a new block if it was accessed
+// more often recently than the block it would evict, so large scans do not wipe the hot blocks
+DECLARE_Bool(enable_file_cache_admission_filter);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
 DECLARE_Int32(file_cache_exit_disk_resource_limit_mode_percent);
 DECLARE_mBool(enable_evict_file_cache_in_advance);
@@ -1157,9 +1301,20 @@ DECLARE_mInt64(cache_lock_held_long_tail_threshold_us);
 // If your file cache is ample enough to accommodate all the data in your database,
 // enable this option; otherwise, it is recommended to leave it disabled.
 DECLARE_mBool(enable_file_cache_keep_base_compaction_output);
+// The output of base and full compaction of a tablet that was queried at least this many times
+// in the last day is kept in the file cache, so the first queries after the compaction do not
+// miss the cache. A value <= 0 disables it.
+DECLARE_mInt64(file_cache_keep_hot_compaction_output_min_qpd);
 DECLARE_mInt64(file_cache_remove_block_qps_limit);
 DECLARE_mInt64(file_cache_background_gc_interval_ms);
 DECLARE_mBool(enable_reader_dryrun_when_download_file_cache);
+// Whether a segment scan on a file cached remote segment downloads the pages of the next
+// `segment_prefetch_window_rows` rows of all the read columns into the file cache in background.
+DECLARE_mBool(enable_segment_prefetch_file_cache);
+DECLARE_mInt32(segment_prefetch_window_rows);
+// The max bytes being prefetched by the segment scans of a query at a time, the pages over it
+// are read on demand. 0 means no limit.
+DECLARE_mInt64(segment_prefetch_max_bytes_per_query);
 DECLARE_mInt64(file_cache_background_monitor_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_batch);
@@ -1171,6 +1326,12 @@ DECLARE_mInt64(file_cache_background_lru_dump_interval_ms);
 DECLARE_mInt64(file_cache_background_lru_dump_update_cnt_threshold);
 DECLARE_mInt64(file_cache_background_lru_dump_tail_record_num);
 DECLARE_mInt64(file_cache_background_lru_log_replay_interval_ms);
+// checkpoint the whole lru queues at a clean shutdown and restore the cache from them at the
+// next start instead of scanning the cache directories. A crash falls back to the scan.
+DECLARE_Bool(enable_file_cache_restore_from_checkpoint);
+// a cached block hit again within this many seconds of its last access is not moved to the end
+// of its lru queue, which shortens the cache lock held by hot reads. 0 moves it on every hit.
+DECLARE_mInt64(file_cache_lru_move_interval_s);
 DECLARE_mBool(enable_evaluate_shadow_queue_diff);
 
 // inverted index searcher cache
@@ -1222,6 +1383,11 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 DECLARE_mInt64(s3_write_buffer_size);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
+// max number of the upload parts in flight of one s3 file writer, the writer grows its window
+// while the part latency stays low and halves it when the latency goes up. 0 means no limit.
+DECLARE_mInt32(s3_file_writer_max_inflight_parts);
+// max number of the released s3 write buffers kept for reuse, 0 frees them at once
+DECLARE_mInt32(s3_write_buffer_pool_max_num);
 // the max number of cached file handle for block segemnt
 DECLARE_mInt64(file_cache_max_file_reader_cache_size);
 DECLARE_mInt64(hdfs_write_batch_buffer_size_mb);
@@ -1363,6 +1529,16 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Whether to choose the group commit interval of each table from its load arrival rate and
+// WAL write / commit latency instead of the table's group_commit_interval_ms.
+DECLARE_mBool(group_commit_enable_adaptive_interval);
+// The visibility latency of loaded rows that the adaptive group commit interval aims for.
+DECLARE_mInt32(group_commit_adaptive_target_latency_ms);
+// The lower bound of the adaptive group commit interval.
+DECLARE_mInt32(group_commit_adaptive_min_interval_ms);
+// Whether to fdatasync the WAL after every append, so that acknowledged group commit loads
+// survive a machine crash. Concurrent syncs of WALs on the same disk are issued together.
+DECLARE_mBool(group_commit_wal_sync_on_append);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1379,6 +1555,10 @@ DECLARE_mBool(exit_on_exception);
 
 // cgroup
 DECLARE_String(doris_cgroup_cpu_path);
+// Pin the threads of workload groups to cpus with the cgroup v2 cpuset controller, in the form
+// of "group_name:cpu_list;group_name:cpu_list", e.g. "online:0-15;etl:16-63". The cpu list uses
+// the format of cpuset.cpus, groups not listed run on all the cpus of the query cgroup.
+DECLARE_mString(workload_group_cpuset);
 DECLARE_mBool(enable_be_proc_monitor);
 DECLARE_mInt32(be_proc_monitor_interval_ms);
 DECLARE_Int32(workload_group_metrics_interval_ms);
@@ -1403,6 +1583,12 @@ DECLARE_Int32(download_binlog_rate_limit_kbs);
 
 DECLARE_mInt32(buffered_reader_read_timeout_ms);
 
+// Whether to decompress compressed csv/json files on a thread of the buffered reader
+// prefetch pool, so that decompression overlaps with parsing.
+DECLARE_mBool(enable_pipelined_decompress);
+// The number of decompressed chunks buffered ahead of the parser by pipelined decompress.
+DECLARE_mInt32(pipelined_decompress_chunk_num);
+
 // whether to enable /api/snapshot api
 DECLARE_Bool(enable_snapshot_action);
 
@@ -1410,6 +1596,19 @@ DECLARE_Bool(enable_snapshot_action);
 DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
+// The number of sources a passthrough local exchange sends blocks to at first, 0 for all.
+// The number doubles when the rows passed exceed local_exchange_passthrough_rows_per_channel
+// per source, or a source has local_exchange_passthrough_channel_max_blocks blocks queued.
+DECLARE_mInt32(local_exchange_passthrough_initial_channels);
+DECLARE_mInt64(local_exchange_passthrough_rows_per_channel);
+DECLARE_mInt32(local_exchange_passthrough_channel_max_blocks);
+// Spread a hash partition of a local exchange over all tasks if it has more than
+// local_exchange_hot_partition_factor times the even share of the rows, for the operators that
+// merge the results of the tasks later, e.g. partial aggregations. Only checked after
+// local_exchange_hot_partition_min_rows rows.
+DECLARE_mBool(enable_local_exchange_split_hot_partitions);
+DECLARE_mDouble(local_exchange_hot_partition_factor);
+DECLARE_mInt64(local_exchange_hot_partition_min_rows);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
 
@@ -1441,6 +1640,12 @@ DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
+// A failed memory reservation of at least this size pauses the query even if it has nothing to
+// spill, so that it waits for memory instead of allocating it and being cancelled later.
+DECLARE_mInt64(paused_query_min_reserve_bytes);
+// Compression of spilled blocks: ZSTD, LZ4 or NONE. AUTO uses LZ4 on SSD spill dirs, where
+// compressing is slower than writing, and ZSTD on HDD spill dirs.
+DECLARE_String(spill_compression_type);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1465,6 +1670,9 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// A read from s3 of at least two parts of this size is split into ranged gets of this size
+// sent in parallel, 0 disables the split.
+DECLARE_mInt64(s3_read_parallel_part_size);
 DECLARE_mBool(enable_s3_object_check_after_upload);
 
 // write as inverted index tmp directory
@@ -1537,6 +1745,8 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads to load the tablet metas of each data dir, 1 loads them on the data dir thread
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1551,6 +1761,9 @@ DECLARE_Int64(min_row_group_size);
 
 DECLARE_mInt64(compaction_memory_bytes_limit);
 
+// Whether to reserve the estimated memory of a compaction from the process before merging
+DECLARE_mBool(enable_compaction_memory_reservation);
+
 DECLARE_mInt64(compaction_batch_size);
 
 DECLARE_mBool(enable_parquet_page_index);
@@ -1578,6 +1791,9 @@ DECLARE_mInt32(check_score_rounds_num);
 
 // MB
 DECLARE_Int32(query_cache_size);
+// Reuse the query cache entry of an older version of a duplicate key tablet, and only aggregate
+// the rowsets loaded since then, if the cached result is a partial aggregation.
+DECLARE_mBool(enable_query_cache_delta_reuse);
 DECLARE_Bool(force_regenerate_rowsetid_on_start_error);
 
 // Enable validation to check the correctness of table size.
@@ -1598,8 +1814,20 @@ DECLARE_mInt32(schema_dict_cache_capacity);
 DECLARE_mBool(enable_prune_delete_sign_when_base_compaction);
 
 DECLARE_mBool(enable_mow_verbose_log);
+// Keep the primary keys of the small rowsets of merge-on-write tablets in memory, so that a
+// key lookup only opens the rowsets that have the key.
+DECLARE_mBool(enable_pk_mem_index);
+// Rowsets with more rows are not kept in the in-memory primary key index.
+DECLARE_mInt64(pk_mem_index_max_rowset_rows);
+// Max keys in the in-memory primary key index of one tablet.
+DECLARE_mInt64(pk_mem_index_max_keys_per_tablet);
 
 DECLARE_mInt32(tablet_sched_delay_time_ms);
+// Weight of the read amplification of recent queries in the priority of a tablet to compact,
+// added to its compaction score. 0 picks tablets by the compaction score only.
+DECLARE_mDouble(compaction_read_amplification_weight);
+// The read amplification of a tablet counts half after this many seconds.
+DECLARE_mInt64(compaction_read_amplification_half_life_sec);
 DECLARE_mInt32(load_trigger_compaction_version_percent);
 DECLARE_mInt64(base_compaction_interval_seconds_since_last_operation);
 DECLARE_mBool(enable_compaction_pause_on_high_memory);
@@ -221,6 +221,17 @@ void refresh_common_allocator_metrics() {
     doris::GlobalMemoryArbitrator::refresh_memory_bvar();
 }
 
+void refresh_memory_growth_window() {
+    static int64_t last_snapshot_s = 0;
+    if (config::memory_growth_snapshot_interval_s <= 0) {
+        return;
+    }
+    if (UnixSeconds() - last_snapshot_s >= config::memory_growth_snapshot_interval_s) {
+        last_snapshot_s = UnixSeconds();
+        doris::ProcessProfile::instance()->memory_profile()->refresh_memory_growth_window();
+    }
+}
+
 void refresh_memory_state_after_memory_change() {
     if (abs(last_print_proc_mem - PerfCounters::get_vm_rss()) > 268435456) {
         last_print_proc_mem = PerfCounters::get_vm_rss();
@@ -359,6 +370,9 @@ void Daemon::memory_maintenance_thread() {
 
         // step 9. Reset Jemalloc dirty page decay.
         je_reset_dirty_decay();
+
+        // step 10. Snapshot memory trackers for the memory growth window.
+        refresh_memory_growth_window();
     }
 }
 
@@ -567,6 +581,16 @@ void Daemon::cache_prune_stale_thread() {
     }
 }
 
+void Daemon::cache_rebalance_thread() {
+    while (!_stop_background_threads_latch.wait_for(
+            std::chrono::seconds(config::cache_rebalance_interval_sec))) {
+        if (config::disable_memory_gc) {
+            continue;
+        }
+        CacheManager::instance()->for_each_cache_rebalance_capacity();
+    }
+}
+
 void Daemon::be_proc_monitor_thread() {
     while (!_stop_background_threads_latch.wait_for(
             std::chrono::milliseconds(config::be_proc_monitor_interval_ms))) {
@@ -614,6 +638,12 @@ void Daemon::start() {
             "Daemon", "cache_prune_stale_thread", [this]() { this->cache_prune_stale_thread(); },
             &_threads.emplace_back());
     CHECK(st.ok()) << st;
+    if (config::cache_rebalance_interval_sec > 0) {
+        st = Thread::create(
+                "Daemon", "cache_rebalance_thread", [this]() { this->cache_rebalance_thread(); },
+                &_threads.emplace_back());
+        CHECK(st.ok()) << st;
+    }
     st = Thread::create(
             "Daemon", "query_runtime_statistics_thread",
             [this]() { this->report_runtime_query_statistics_thread(); }, &_threads.emplace_back());
@@ -43,6 +43,7 @@ private:
     void je_reset_dirty_decay_thread() const;
     void cache_adjust_capacity_thread();
     void cache_prune_stale_thread();
+    void cache_rebalance_thread();
     void report_runtime_query_statistics_thread();
     void be_proc_monitor_thread();
     void calculate_workload_group_metrics_thread();
@@ -623,12 +623,13 @@ Status RowIdStorageReader::read_batch_doris_format_row(
     std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey> iterator_map;
     std::string row_store_buffer;
     RowStoreReadStruct row_store_read_struct(row_store_buffer);
-    if (request_block_desc.fetch_row_store()) {
+    if (request_block_desc.fetch_row_store() || config::enable_fetch_rows_from_row_store_columns) {
         for (int i = 0; i < request_block_desc.slots_size(); ++i) {
             row_store_read_struct.serdes.emplace_back(slots[i].get_data_type_ptr()->get_serde());
             row_store_read_struct.col_uid_to_idx[slots[i].col_unique_id()] = i;
             row_store_read_struct.default_values.emplace_back(slots[i].col_default_value());
         }
+        row_store_read_struct.fetch_row_store = request_block_desc.fetch_row_store();
     }
 
     for (int j = 0; j < request_block_desc.row_id_size(); ++j) {
@@ -963,6 +964,34 @@ Status RowIdStorageReader::read_batch_external_row(
     return Status::OK();
 }
 
+// A row store column holding all the slots serves a row with one page read, instead of one
+// per slot, which matters for wide rows.
+static bool read_from_row_store(RowStoreReadStruct& row_store_read_struct,
+                                const BetaRowsetSharedPtr& rowset,
+                                const std::vector<SlotDescriptor>& slots) {
+    if (row_store_read_struct.default_values.empty()) {
+        return false;
+    }
+    if (row_store_read_struct.fetch_row_store) {
+        return true;
+    }
+    auto [it, inserted] =
+            row_store_read_struct.rowset_has_row_store.emplace(rowset->rowset_id(), false);
+    if (inserted) {
+        const auto& schema = rowset->tablet_schema();
+        if (schema->field_index(BeConsts::ROW_STORE_COL) >= 0) {
+            const auto& row_store_uids = schema->row_columns_uids();
+            it->second = std::all_of(slots.begin(), slots.end(), [&](const SlotDescriptor& slot) {
+                return schema->field_index(slot.col_unique_id()) >= 0 &&
+                       (row_store_uids.empty() ||
+                        std::find(row_store_uids.begin(), row_store_uids.end(),
+                                  slot.col_unique_id()) != row_store_uids.end());
+            });
+        }
+    }
+    return it->second;
+}
+
 Status RowIdStorageReader::read_doris_format_row(
         const std::shared_ptr<IdFileMap>& id_file_map,
         const std::shared_ptr<FileMapping>& file_mapping, int64_t row_id,
@@ -1020,9 +1049,9 @@ Status RowIdStorageReader::read_doris_format_row(
     }
     segment_v2::SegmentSharedPtr segment = *it;
 
-    // if row_store_read_struct not empty, means the line we should read from row_store
-    if (!row_store_read_struct.default_values.empty()) {
-        CHECK(tablet->tablet_schema()->has_row_store_for_all_columns());
+    if (read_from_row_store(row_store_read_struct, rowset, slots)) {
+        CHECK(!row_store_read_struct.fetch_row_store ||
+              tablet->tablet_schema()->has_row_store_for_all_columns());
         RowLocation loc(rowset_id, segment->id(), cast_set<uint32_t>(row_id));
         row_store_read_struct.row_store_buffer.clear();
         RETURN_IF_ERROR(scope_timer_run(
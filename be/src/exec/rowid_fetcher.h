@@ -82,6 +82,10 @@ struct RowStoreReadStruct {
     vectorized::DataTypeSerDeSPtrs serdes;
     std::unordered_map<uint32_t, uint32_t> col_uid_to_idx;
     std::vector<std::string> default_values;
+    // read every row from the full row store, otherwise only the rows of the rowsets
+    // whose row store columns hold all the slots
+    bool fetch_row_store = false;
+    std::unordered_map<RowsetId, bool> rowset_has_row_store;
 };
 
 class RowIdStorageReader {
@@ -42,25 +42,28 @@ public:
         _enable_fixed_len_to_uint32_v2 = params->enable_fixed_len_to_uint32_v2;
         _limit_length();
     }
-    Status init_with_fixed_length(size_t runtime_size) {
-        if (_build_bf_by_runtime_size) {
-            // Use the same algorithm as org.apache.doris.planner.RuntimeFilter#calculateFilterSize
-            // m is the number of bits we would need to get the fpp specified
-            double m = -K * (double)runtime_size / std::log(1 - std::pow(FPP, 1.0 / K));
-
-            // Handle case where ndv == 1 => ceil(log2(m/8)) < 0.
-            int log_filter_size =
-                    std::max(0, (int)(std::ceil(std::log(m / 8) / std::numbers::ln2)));
-            auto be_calculate_size = (((int64_t)1) << log_filter_size);
-            // if FE do use ndv stat to predict the bf size, BE only use the row count. FE have more
-            // exactly row count stat. which one is min is more correctly.
-            if (_bloom_filter_size_calculated_by_ndv) {
-                _bloom_filter_length = std::min(be_calculate_size, _bloom_filter_length);
-            } else {
-                _bloom_filter_length = be_calculate_size;
-            }
-            _limit_length();
+    // The length in bytes of the bloom filter built by `init_with_fixed_length(runtime_size)`.
+    int64_t get_length(size_t runtime_size) const {
+        if (!_build_bf_by_runtime_size) {
+            return _bloom_filter_length;
+        }
+        // Use the same algorithm as org.apache.doris.planner.RuntimeFilter#calculateFilterSize
+        // m is the number of bits we would need to get the fpp specified
+        double m = -K * (double)runtime_size / std::log(1 - std::pow(FPP, 1.0 / K));
+
+        // Handle case where ndv == 1 => ceil(log2(m/8)) < 0.
+        int log_filter_size = std::max(0, (int)(std::ceil(std::log(m / 8) / std::numbers::ln2)));
+        auto be_calculate_size = (((int64_t)1) << log_filter_size);
+        // if FE do use ndv stat to predict the bf size, BE only use the row count. FE have more
+        // exactly row count stat. which one is min is more correctly.
+        if (_bloom_filter_size_calculated_by_ndv) {
+            return _limited_length(std::min(be_calculate_size, _bloom_filter_length));
         }
+        return _limited_length(be_calculate_size);
+    }
+
+    Status init_with_fixed_length(size_t runtime_size) {
+        _bloom_filter_length = get_length(runtime_size);
 
         DCHECK(_bloom_filter_length >= 0);
         DCHECK_EQ((_bloom_filter_length & (_bloom_filter_length - 1)), 0);
@@ -140,13 +143,15 @@ public:
 private:
     static constexpr double FPP = 0.05;
     static constexpr double K = 8; // BUCKET_WORDS
-    void _limit_length() {
+    void _limit_length() { _bloom_filter_length = _limited_length(_bloom_filter_length); }
+    int64_t _limited_length(int64_t length) const {
         if (_runtime_bloom_filter_min_size > 0) {
-            _bloom_filter_length = std::max(_bloom_filter_length, _runtime_bloom_filter_min_size);
+            length = std::max(length, _runtime_bloom_filter_min_size);
         }
         if (_runtime_bloom_filter_max_size > 0) {
-            _bloom_filter_length = std::min(_bloom_filter_length, _runtime_bloom_filter_max_size);
+            length = std::min(length, _runtime_bloom_filter_max_size);
         }
+        return length;
     }
 
 protected:
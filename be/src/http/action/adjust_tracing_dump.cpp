@@ -17,8 +17,11 @@
 
 #include "adjust_tracing_dump.h"
 
+#include <fmt/format.h>
+
 #include "common/logging.h"
 #include "http/http_channel.h"
+#include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_status.h"
 #include "runtime/exec_env.h"
@@ -34,4 +37,22 @@ void AdjustTracingDump::handle(HttpRequest* req) {
         HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, status.msg().data());
     }
 }
+
+void TracingSnapshotAction::handle(HttpRequest* req) {
+    int64_t seconds = 10;
+    if (const auto& param = req->param("seconds"); !param.empty()) {
+        try {
+            seconds = std::stoll(param);
+        } catch (const std::exception& e) {
+            auto msg = fmt::format("invalid argument.seconds: {}, meet error: {}\n", param,
+                                   e.what());
+            LOG(WARNING) << msg;
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, msg);
+            return;
+        }
+    }
+    auto* ctx = ExecEnv::GetInstance()->pipeline_tracer_context();
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HttpHeaders::JSON_TYPE.data());
+    HttpChannel::send_reply(req, HttpStatus::OK, ctx->to_chrome_trace(ctx->snapshot(seconds)));
+}
 } // namespace doris
@@ -32,4 +32,15 @@ public:
 
     void handle(HttpRequest* req) override;
 };
+
+// Returns the pipeline task runs of the last `seconds` (10 by default) kept in the trace rings
+// of the workers, as a Chrome trace that chrome://tracing and Perfetto open.
+class TracingSnapshotAction : public HttpHandlerWithAuth {
+public:
+    TracingSnapshotAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~TracingSnapshotAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
 } // namespace doris
@@ -17,6 +17,7 @@
 
 #include "http/action/http_stream.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <future>
 #include <sstream>
@@ -254,7 +255,12 @@ void HttpStreamAction::on_chunk_data(HttpRequest* req) {
     }
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
-        st = ByteBuffer::allocate(128 * 1024, &bb);
+        // do not allocate a whole chunk for the few bytes of a small request or a slow sender
+        st = ByteBuffer::allocate(
+                std::min(evbuffer_get_length(evbuf),
+                         static_cast<size_t>(std::max(config::stream_load_chunk_buffer_size,
+                                                      int64_t {4096}))),
+                &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -29,6 +29,7 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -360,7 +361,12 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     int64_t start_read_data_time = MonotonicNanos();
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
+        // do not allocate a whole chunk for the few bytes of a small request or a slow sender
+        Status st = ByteBuffer::allocate(
+                std::min(evbuffer_get_length(evbuf),
+                         static_cast<size_t>(std::max(config::stream_load_chunk_buffer_size,
+                                                      int64_t {4096}))),
+                &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -196,6 +196,11 @@ void process_profile_handler(const WebPageHandler::ArgumentMap& args, std::strin
     (*output) << "<pre id=\"processProfile\">"
               << doris::ProcessProfile::instance()->print_process_profile_no_root() << "</pre>"
               << "\n\n---\n\n";
+    (*output) << "<h2 id=\"memoryGrowthTitle\">Memory Growth</h2>" << std::endl;
+    (*output) << "<pre id=\"memoryGrowth\">"
+              << doris::ProcessProfile::instance()->memory_profile()->print_memory_growth(20)
+              << "</pre>"
+              << "\n\n---\n\n";
     memory_info_handler(output);
 
     // TODO, expect more information about process status, CPU, IO, etc.
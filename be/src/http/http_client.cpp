@@ -29,6 +29,7 @@
 #include "common/status.h"
 #include "http/http_headers.h"
 #include "runtime/exec_env.h"
+#include "util/md5.h"
 #include "util/security.h"
 #include "util/stack_util.h"
 
@@ -453,7 +454,7 @@ Status HttpClient::get_content_md5(std::string* md5) const {
     return Status::OK();
 }
 
-Status HttpClient::download(const std::string& local_path) {
+Status HttpClient::download(const std::string& local_path, std::string* md5) {
     set_method(GET);
     set_speed_limit();
 
@@ -471,7 +472,8 @@ Status HttpClient::download(const std::string& local_path) {
         return Status::InternalError("open file failed");
     }
     Status status;
-    auto callback = [&status, &fp, &local_path](const void* data, size_t length) {
+    Md5Digest digest;
+    auto callback = [&status, &fp, &local_path, &digest, md5](const void* data, size_t length) {
         auto res = fwrite(data, length, 1, fp.get());
         if (res != 1) {
             LOG(WARNING) << "fail to write data to file, file=" << local_path
@@ -479,6 +481,9 @@ Status HttpClient::download(const std::string& local_path) {
             status = Status::InternalError("fail to write data when download");
             return false;
         }
+        if (md5 != nullptr) {
+            digest.update(data, length);
+        }
         return true;
     };
 
@@ -487,6 +492,9 @@ Status HttpClient::download(const std::string& local_path) {
     }
     if (!status.ok()) {
         remove(local_path.c_str());
+    } else if (md5 != nullptr) {
+        digest.digest();
+        *md5 = digest.hex();
     }
     return status;
 }
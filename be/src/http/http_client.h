@@ -142,8 +142,9 @@ public:
     }
 
     // helper function to download a file, you can call this function to download
-    // a file to local_path
-    Status download(const std::string& local_path);
+    // a file to local_path. If `md5` is not null, it is set to the md5 hex of the file,
+    // computed while downloading.
+    Status download(const std::string& local_path, std::string* md5 = nullptr);
     Status download_multi_files(const std::string& local_dir,
                                 const std::unordered_set<std::string>& expected_files);
 
@@ -20,7 +20,9 @@
 
 #include "io/cache/block_file_cache.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
 
 #include "common/status.h"
@@ -192,6 +194,8 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
                                                             "file_cache_num_hit_blocks");
     _num_removed_blocks = std::make_shared<bvar::Adder<size_t>>(_cache_base_path.c_str(),
                                                                 "file_cache_num_removed_blocks");
+    _num_admission_rejected_blocks = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_num_admission_rejected_blocks");
 
     _num_hit_blocks_5m = std::make_shared<bvar::Window<bvar::Adder<size_t>>>(
             _cache_base_path.c_str(), "file_cache_num_hit_blocks_5m", _num_hit_blocks.get(), 300);
@@ -241,6 +245,11 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
                             7 * 24 * 60 * 60);
     _normal_queue = LRUQueue(cache_settings.query_queue_size, cache_settings.query_queue_elements,
                              24 * 60 * 60);
+    if (config::enable_file_cache_admission_filter) {
+        // about one counter per block the queue can hold
+        _normal_queue_sketch = std::make_unique<FrequencySketch>(std::clamp<size_t>(
+                cache_settings.query_queue_elements, 1024, static_cast<size_t>(1) << 22));
+    }
     _ttl_queue = LRUQueue(cache_settings.ttl_queue_size, cache_settings.ttl_queue_elements,
                           std::numeric_limits<int>::max());
 
@@ -341,7 +350,14 @@ Status BlockFileCache::initialize_unlocked(std::lock_guard<std::mutex>& cache_lo
         // 3. all queues should be restored sequencially to avoid conflict
         // TODO(zhengyu): we can parralize them but will increase complexity, so lets check the time cost
         // to see if any improvement is a necessary
-        restore_lru_queues_from_disk(cache_lock);
+        // 4. the checkpoint is only valid for one start, remove it before anything is cached
+        std::string checkpoint = _lru_dumper->checkpoint_filename();
+        std::error_code ec;
+        bool has_checkpoint = std::filesystem::exists(checkpoint, ec);
+        std::filesystem::remove(checkpoint, ec);
+        bool restored = restore_lru_queues_from_disk(cache_lock);
+        _restored_from_checkpoint =
+                config::enable_file_cache_restore_from_checkpoint && has_checkpoint && restored;
     }
     RETURN_IF_ERROR(_storage->init(this));
     _cache_background_monitor_thread = std::thread(&BlockFileCache::run_background_monitor, this);
@@ -365,8 +381,15 @@ void BlockFileCache::use_cell(const FileBlockCell& cell, FileBlocks* result, boo
     }
 
     auto& queue = get_queue(cell.file_block->cache_type());
+    if (_normal_queue_sketch && cell.file_block->cache_type() == FileCacheType::NORMAL) {
+        _normal_queue_sketch->increment(cell.file_block->get_hash_value(),
+                                        cell.file_block->offset());
+    }
     /// Move to the end of the queue. The iterator remains valid.
-    if (cell.queue_iterator && move_iter_flag) {
+    /// A cell used again shortly after is left in place, moving it hardly changes the eviction
+    /// order but the move and its lru log are done under the cache lock on every hit.
+    if (cell.queue_iterator && move_iter_flag &&
+        !cell.accessed_within(config::file_cache_lru_move_interval_s)) {
         queue.move_to_end(*cell.queue_iterator, cache_lock);
         _lru_recorder->record_queue_event(cell.file_block->cache_type(),
                                           CacheLRULogType::MOVETOBACK, cell.file_block->_key.hash,
@@ -634,7 +657,8 @@ FileBlocks BlockFileCache::split_range_into_cells(const UInt128Wrapper& hash,
     while (current_pos < end_pos_non_included) {
         current_size = std::min(remaining_size, _max_file_block_size);
         remaining_size -= current_size;
-        state = try_reserve(hash, context, current_pos, current_size, cache_lock)
+        state = admit(hash, context, current_pos, current_size, cache_lock) &&
+                                try_reserve(hash, context, current_pos, current_size, cache_lock)
                         ? state
                         : FileBlock::State::SKIP_CACHE;
         if (state == FileBlock::State::SKIP_CACHE) [[unlikely]] {
@@ -663,6 +687,29 @@ FileBlocks BlockFileCache::split_range_into_cells(const UInt128Wrapper& hash,
     return file_blocks;
 }
 
+bool BlockFileCache::admit(const UInt128Wrapper& hash, const CacheContext& context, size_t offset,
+                           size_t size, std::lock_guard<std::mutex>& cache_lock) {
+    if (_normal_queue_sketch == nullptr || context.cache_type != FileCacheType::NORMAL) {
+        return true;
+    }
+    _normal_queue_sketch->increment(hash, offset);
+    if (_normal_queue.get_capacity(cache_lock) + size <= _normal_queue.get_max_size() &&
+        _cur_cache_size + size <= _capacity) {
+        // nothing is evicted
+        return true;
+    }
+    if (_normal_queue.begin() == _normal_queue.end()) {
+        return true;
+    }
+    const auto& victim = *_normal_queue.begin();
+    if (_normal_queue_sketch->frequency(hash, offset) >
+        _normal_queue_sketch->frequency(victim.hash, victim.offset)) {
+        return true;
+    }
+    *_num_admission_rejected_blocks << 1;
+    return false;
+}
+
 void BlockFileCache::fill_holes_with_empty_file_blocks(FileBlocks& file_blocks,
                                                        const UInt128Wrapper& hash,
                                                        const CacheContext& context,
@@ -2276,11 +2323,49 @@ void BlockFileCache::run_background_lru_dump() {
     }
 }
 
-void BlockFileCache::restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock) {
-    _lru_dumper->restore_queue(_disposable_queue, "disposable", cache_lock);
-    _lru_dumper->restore_queue(_index_queue, "index", cache_lock);
-    _lru_dumper->restore_queue(_normal_queue, "normal", cache_lock);
-    _lru_dumper->restore_queue(_ttl_queue, "ttl", cache_lock);
+bool BlockFileCache::restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock) {
+    bool restored = true;
+    restored &= _lru_dumper->restore_queue(_disposable_queue, "disposable", cache_lock).ok();
+    restored &= _lru_dumper->restore_queue(_index_queue, "index", cache_lock).ok();
+    restored &= _lru_dumper->restore_queue(_normal_queue, "normal", cache_lock).ok();
+    restored &= _lru_dumper->restore_queue(_ttl_queue, "ttl", cache_lock).ok();
+    return restored;
+}
+
+void BlockFileCache::checkpoint_lru_queues() {
+    if (!config::enable_file_cache_restore_from_checkpoint ||
+        config::file_cache_background_lru_dump_tail_record_num <= 0 || !_is_initialized ||
+        !_async_open_done || _lru_dumper == nullptr) {
+        return;
+    }
+    SCOPED_CACHE_LOCK(_mutex, this);
+    // the dumps keep neither the expiration time of ttl blocks nor the blocks being downloaded,
+    // leave such caches to the directory scan
+    if (_ttl_queue.get_elements_num(cache_lock) > 0) {
+        LOG(INFO) << "skip file cache checkpoint of " << _cache_base_path << ", has ttl blocks";
+        return;
+    }
+    for (const auto& [_, offset_to_cell] : _files) {
+        for (const auto& [offset, cell] : offset_to_cell) {
+            if (cell.file_block->state_unsafe() != FileBlock::State::DOWNLOADED) {
+                LOG(INFO) << "skip file cache checkpoint of " << _cache_base_path
+                          << ", has blocks not downloaded";
+                return;
+            }
+        }
+    }
+    for (auto& [queue, name] : std::initializer_list<std::pair<LRUQueue*, std::string>> {
+                 {&_disposable_queue, "disposable"},
+                 {&_index_queue, "index"},
+                 {&_normal_queue, "normal"},
+                 {&_ttl_queue, "ttl"}}) {
+        if (Status st = _lru_dumper->dump_whole_queue(*queue, name); !st.ok()) {
+            LOG(WARNING) << "failed to checkpoint file cache queue " << name << ": " << st;
+            return;
+        }
+    }
+    std::ofstream out(_lru_dumper->checkpoint_filename());
+    LOG(INFO) << "file cache " << _cache_base_path << " checkpointed, cells=" << _files.size();
 }
 
 std::map<std::string, double> BlockFileCache::get_stats() {
@@ -30,6 +30,7 @@
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
 #include "io/cache/file_cache_storage.h"
+#include "io/cache/frequency_sketch.h"
 #include "io/cache/lru_queue_recorder.h"
 #include "util/runtime_profile.h"
 #include "util/threadpool.h"
@@ -116,6 +117,7 @@ public:
         if (_cache_background_lru_log_replay_thread.joinable()) {
             _cache_background_lru_log_replay_thread.join();
         }
+        checkpoint_lru_queues();
     }
 
     /// Restore cache from local filesystem.
@@ -197,6 +199,10 @@ public:
     bool try_reserve(const UInt128Wrapper& hash, const CacheContext& context, size_t offset,
                      size_t size, std::lock_guard<std::mutex>& cache_lock);
 
+    // Whether the admission filter lets a new block in, see FrequencySketch.
+    bool admit(const UInt128Wrapper& hash, const CacheContext& context, size_t offset,
+               size_t size, std::lock_guard<std::mutex>& cache_lock);
+
     /**
      * Proactively evict cache blocks to free up space before cache is full.
      * 
@@ -295,6 +301,12 @@ private:
                             std::chrono::steady_clock::now().time_since_epoch())
                             .count();
         }
+        bool accessed_within(int64_t seconds) const {
+            auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                               .count();
+            return atime != 0 && now - atime < seconds;
+        }
 
         /// Pointer to file block is always hold by the cache itself.
         /// Apart from pointer in cache, it can be hold by cache users, when they call
@@ -389,7 +401,11 @@ private:
     void run_background_gc();
     void run_background_lru_log_replay();
     void run_background_lru_dump();
-    void restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock);
+    // Returns true if every queue is restored from its dump.
+    bool restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock);
+    // Dumps the whole queues at shutdown and marks the dumps as a checkpoint of the cache, so
+    // the next start can skip the directory scan.
+    void checkpoint_lru_queues();
     void run_background_evict_in_advance();
 
     bool try_reserve_from_other_queue_by_time_interval(FileCacheType cur_type,
@@ -444,6 +460,8 @@ private:
     std::thread _cache_background_lru_dump_thread;
     std::thread _cache_background_lru_log_replay_thread;
     std::atomic_bool _async_open_done {false};
+    // the cells are restored from the checkpoint of the last shutdown, no need to scan the disk
+    bool _restored_from_checkpoint {false};
     // disk space or inode is less than the specified value
     bool _disk_resource_limit_mode {false};
     bool _need_evict_cache_in_advance {false};
@@ -468,6 +486,8 @@ private:
     LRUQueue _normal_queue;
     LRUQueue _disposable_queue;
     LRUQueue _ttl_queue;
+    // access frequencies of the normal queue blocks, only with the admission filter on
+    std::unique_ptr<FrequencySketch> _normal_queue_sketch;
 
     // keys for async remove
     RecycleFileCacheKeys _recycle_keys;
@@ -504,6 +524,7 @@ private:
     std::shared_ptr<bvar::Adder<size_t>> _num_read_blocks;
     std::shared_ptr<bvar::Adder<size_t>> _num_hit_blocks;
     std::shared_ptr<bvar::Adder<size_t>> _num_removed_blocks;
+    std::shared_ptr<bvar::Adder<size_t>> _num_admission_rejected_blocks;
 
     std::shared_ptr<bvar::Status<double>> _hit_ratio;
     std::shared_ptr<bvar::Status<double>> _hit_ratio_5m;
@@ -17,6 +17,8 @@
 
 #include "io/cache/cache_lru_dumper.h"
 
+#include <limits>
+
 #include "io/cache/block_file_cache.h"
 #include "io/cache/cache_lru_dumper.h"
 #include "io/cache/lru_queue_recorder.h"
@@ -251,21 +253,30 @@ void CacheLRUDumper::dump_queue(const std::string& queue_name) {
     if (_recorder->get_lru_queue_update_cnt_from_last_dump(type) >
         config::file_cache_background_lru_dump_update_cnt_threshold) {
         LRUQueue& queue = _recorder->get_shadow_queue(type);
-        do_dump_queue(queue, queue_name);
+        static_cast<void>(do_dump_queue(queue, queue_name,
+                                        config::file_cache_background_lru_dump_tail_record_num));
         _recorder->reset_lru_queue_update_cnt_from_last_dump(type);
     }
 }
 
-void CacheLRUDumper::do_dump_queue(LRUQueue& queue, const std::string& queue_name) {
-    Status st;
+Status CacheLRUDumper::dump_whole_queue(LRUQueue& queue, const std::string& queue_name) {
+    return do_dump_queue(queue, queue_name, std::numeric_limits<size_t>::max());
+}
+
+std::string CacheLRUDumper::checkpoint_filename() const {
+    return fmt::format("{}/lru_dump.checkpoint", _mgr->_cache_base_path);
+}
+
+Status CacheLRUDumper::do_dump_queue(LRUQueue& queue, const std::string& queue_name,
+                                     size_t max_elements) {
     std::vector<std::tuple<UInt128Wrapper, size_t, size_t>> elements;
-    elements.reserve(config::file_cache_background_lru_dump_tail_record_num);
 
     {
         std::lock_guard<std::mutex> lru_log_lock(_recorder->_mutex_lru_log);
+        elements.reserve(std::min(max_elements, queue.get_elements_num_unsafe()));
         size_t count = 0;
         for (const auto& [hash, offset, size] : queue) {
-            if (count++ >= config::file_cache_background_lru_dump_tail_record_num) break;
+            if (count++ >= max_elements) break;
             elements.emplace_back(hash, offset, size);
         }
     }
@@ -280,22 +291,22 @@ void CacheLRUDumper::do_dump_queue(LRUQueue& queue, const std::string& queue_nam
         std::string final_filename =
                 fmt::format("{}/lru_dump_{}.tail", _mgr->_cache_base_path, queue_name);
         std::ofstream out(tmp_filename, std::ios::binary);
-        if (out) {
-            LOG(INFO) << "begin dump " << queue_name << " with " << elements.size() << " elements";
-            for (const auto& [hash, offset, size] : elements) {
-                RETURN_IF_STATUS_ERROR(st,
-                                       dump_one_lru_entry(out, tmp_filename, hash, offset, size));
-            }
-            RETURN_IF_STATUS_ERROR(st, finalize_dump(out, elements.size(), tmp_filename,
-                                                     final_filename, file_size));
-        } else {
+        if (!out) {
             LOG(WARNING) << "open lru dump file failed, reason: " << tmp_filename
                          << " failed to create";
+            return Status::IOError<false>("failed to create {}", tmp_filename);
+        }
+        LOG(INFO) << "begin dump " << queue_name << " with " << elements.size() << " elements";
+        for (const auto& [hash, offset, size] : elements) {
+            RETURN_IF_ERROR(dump_one_lru_entry(out, tmp_filename, hash, offset, size));
         }
+        RETURN_IF_ERROR(
+                finalize_dump(out, elements.size(), tmp_filename, final_filename, file_size));
     }
     *(_mgr->_lru_dump_latency_us) << (duration_ns / 1000);
     LOG(INFO) << fmt::format("lru dump for {} size={} element={} time={}us", queue_name, file_size,
                              elements.size(), duration_ns / 1000);
+    return Status::OK();
 };
 
 Status CacheLRUDumper::parse_dump_footer(std::ifstream& in, std::string& filename,
@@ -401,9 +412,8 @@ Status CacheLRUDumper::parse_one_lru_entry(std::ifstream& in, std::string& filen
     return Status::OK();
 }
 
-void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_name,
-                                   std::lock_guard<std::mutex>& cache_lock) {
-    Status st;
+Status CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_name,
+                                     std::lock_guard<std::mutex>& cache_lock) {
     std::string filename = fmt::format("{}/lru_dump_{}.tail", _mgr->_cache_base_path, queue_name);
     std::ifstream in(filename, std::ios::binary);
     int64_t duration_ns = 0;
@@ -412,13 +422,13 @@ void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_nam
 
         SCOPED_RAW_TIMER(&duration_ns);
         size_t entry_num = 0;
-        RETURN_IF_STATUS_ERROR(st, parse_dump_footer(in, filename, entry_num));
+        RETURN_IF_ERROR(parse_dump_footer(in, filename, entry_num));
         LOG(INFO) << "lru dump file for " << queue_name << " has " << entry_num << " entries.";
         in.seekg(0, std::ios::beg);
         UInt128Wrapper hash;
         size_t offset, size;
         for (int i = 0; i < entry_num; ++i) {
-            RETURN_IF_STATUS_ERROR(st, parse_one_lru_entry(in, filename, hash, offset, size));
+            RETURN_IF_ERROR(parse_one_lru_entry(in, filename, hash, offset, size));
             CacheContext ctx;
             if (queue_name == "ttl") {
                 ctx.cache_type = FileCacheType::TTL;
@@ -438,7 +448,7 @@ void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_nam
             } else {
                 LOG_WARNING("unknown queue type for lru restore, skip");
                 DCHECK(false);
-                return;
+                return Status::InternalError<false>("unknown queue type {}", queue_name);
             }
             // TODO(zhengyu): we don't use stats yet, see if this will cause any problem
             _mgr->add_cell(hash, ctx, offset, size, FileBlock::State::DOWNLOADED, cache_lock);
@@ -446,8 +456,10 @@ void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_nam
         in.close();
     } else {
         LOG(INFO) << "no lru dump file is founded for " << queue_name;
+        return Status::NotFound<false>("no lru dump file {}", filename);
     }
     LOG(INFO) << "lru restore time costs: " << (duration_ns / 1000) << "us.";
+    return Status::OK();
 };
 
 void CacheLRUDumper::remove_lru_dump_files() {
@@ -459,6 +471,8 @@ void CacheLRUDumper::remove_lru_dump_files() {
             std::filesystem::remove(filename);
         }
     }
+    std::error_code ec;
+    std::filesystem::remove(checkpoint_filename(), ec);
 }
 
 } // end of namespace doris::io
@@ -40,12 +40,18 @@ public:
     CacheLRUDumper(BlockFileCache* mgr, LRUQueueRecorder* recorder)
             : _mgr(mgr), _recorder(recorder) {};
     void dump_queue(const std::string& queue_name);
-    void restore_queue(LRUQueue& queue, const std::string& queue_name,
-                       std::lock_guard<std::mutex>& cache_lock);
+    // Dumps every element of `queue`, not only its tail, so that the cache can be restored from
+    // the dumps alone at the next start.
+    Status dump_whole_queue(LRUQueue& queue, const std::string& queue_name);
+    Status restore_queue(LRUQueue& queue, const std::string& queue_name,
+                         std::lock_guard<std::mutex>& cache_lock);
     void remove_lru_dump_files();
 
+    // Marks that the dumps cover every cached block, written at a clean shutdown.
+    std::string checkpoint_filename() const;
+
 private:
-    void do_dump_queue(LRUQueue& queue, const std::string& queue_name);
+    Status do_dump_queue(LRUQueue& queue, const std::string& queue_name, size_t max_elements);
     Status check_ofstream_status(std::ofstream& out, std::string& filename);
     Status check_ifstream_status(std::ifstream& in, std::string& filename);
     Status dump_one_lru_entry(std::ofstream& out, std::string& filename, const UInt128Wrapper& hash,
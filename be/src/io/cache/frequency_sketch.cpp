@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/cache/frequency_sketch.h"
+
+#include <algorithm>
+
+namespace doris::io {
+
+static uint64_t block_hash(const UInt128Wrapper& hash, size_t offset) {
+    uint64_t h = KeyHash()(hash) ^ (offset * 0x9E3779B97F4A7C15ULL);
+    // the finalizer of murmur3, to spread the bits
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+FrequencySketch::FrequencySketch(size_t num_counters) {
+    size_t size = 1;
+    while (size < num_counters) {
+        size <<= 1;
+    }
+    _counters.resize(size * NUM_ROWS);
+    _mask = size - 1;
+    _sample_size = size * 10;
+}
+
+size_t FrequencySketch::_index(uint64_t block_hash, size_t row) const {
+    // each row takes 16 bits of the hash, in its own part of the counters
+    auto h = (block_hash >> (row * 16)) * 0x9E3779B97F4A7C15ULL;
+    return row * (_mask + 1) + ((h >> 32) & _mask);
+}
+
+void FrequencySketch::increment(const UInt128Wrapper& hash, size_t offset) {
+    auto h = block_hash(hash, offset);
+    for (size_t row = 0; row < NUM_ROWS; ++row) {
+        auto& counter = _counters[_index(h, row)];
+        if (counter < MAX_COUNT) {
+            ++counter;
+        }
+    }
+    if (++_num_increments >= _sample_size) {
+        _age();
+    }
+}
+
+uint8_t FrequencySketch::frequency(const UInt128Wrapper& hash, size_t offset) const {
+    auto h = block_hash(hash, offset);
+    uint8_t count = MAX_COUNT;
+    for (size_t row = 0; row < NUM_ROWS; ++row) {
+        count = std::min(count, _counters[_index(h, row)]);
+    }
+    return count;
+}
+
+void FrequencySketch::_age() {
+    for (auto& counter : _counters) {
+        counter >>= 1;
+    }
+    _num_increments /= 2;
+}
+
+} // namespace doris::io
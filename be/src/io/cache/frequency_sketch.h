@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "io/cache/file_cache_common.h"
+
+namespace doris::io {
+
+// Estimates how often the file blocks were accessed recently, it is a count-min sketch of 4
+// rows with counters saturating at 15. All counters are halved after every `10 * num_counters`
+// accesses, so the blocks that are not accessed any more fade out.
+//
+// It is the TinyLFU admission filter of the normal queue: when the queue is full, a new block is
+// only cached if it was accessed more often than the block it would evict, so a large scan
+// reading each block once does not evict the hot blocks.
+class FrequencySketch {
+public:
+    explicit FrequencySketch(size_t num_counters);
+
+    void increment(const UInt128Wrapper& hash, size_t offset);
+    uint8_t frequency(const UInt128Wrapper& hash, size_t offset) const;
+
+private:
+    static constexpr size_t NUM_ROWS = 4;
+    static constexpr uint8_t MAX_COUNT = 15;
+
+    size_t _index(uint64_t block_hash, size_t row) const;
+    void _age();
+
+    std::vector<uint8_t> _counters;
+    size_t _mask;
+    size_t _sample_size;
+    size_t _num_increments = 0;
+};
+
+} // namespace doris::io
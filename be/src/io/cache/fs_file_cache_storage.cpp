@@ -127,7 +127,11 @@ Status FSFileCacheStorage::init(BlockFileCache* _mgr) {
                 throw doris::Exception(Status::InternalError(msg));
             }
         }
-        load_cache_info_into_memory(mgr);
+        if (mgr->_restored_from_checkpoint) {
+            LOG_INFO("file cache {} is restored from checkpoint, skip scanning", _cache_base_path);
+        } else {
+            load_cache_info_into_memory(mgr);
+        }
         mgr->_async_open_done = true;
         LOG_INFO("file cache {} lazy load done.", _cache_base_path);
     });
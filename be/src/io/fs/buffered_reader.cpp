@@ -592,7 +592,7 @@ Status PrefetchBuffer::read_buffer(size_t off, const char* out, size_t buf_len,
     }
 
     {
-        LIMIT_REMOTE_SCAN_IO(bytes_read);
+        LIMIT_REMOTE_SCAN_IO(bytes_read, _io_ctx);
         // [0]: maximum len trying to read, [1] maximum length buffer can provide, [2] actual len buffer has
         size_t read_len = std::min({buf_len, _offset + _size - off, _offset + _len - off});
         {
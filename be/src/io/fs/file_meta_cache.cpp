@@ -17,15 +17,24 @@
 
 #include "io/fs/file_meta_cache.h"
 
+#include <fmt/format.h>
+
+#include "io/fs/file_reader.h"
 #include "vec/exec/format/parquet/parquet_thrift_util.h"
 
 namespace doris {
 
+std::string FileMetaCache::get_key(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                                   std::string_view name) {
+    return fmt::format("{}:{}:{}:{}", file_reader->path().native(), mtime, file_reader->size(),
+                       name);
+}
+
 Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
                                          int64_t mtime, size_t* meta_size,
                                          ObjLRUCache::CacheHandle* handle) {
     ObjLRUCache::CacheHandle cache_handle;
-    std::string cache_key = file_reader->path().native() + std::to_string(mtime);
+    std::string cache_key = get_key(file_reader, mtime, "footer");
     auto hit_cache = _cache.lookup({cache_key}, &cache_handle);
     if (hit_cache) {
         *handle = std::move(cache_handle);
@@ -33,10 +42,40 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
     } else {
         vectorized::FileMetaData* meta = nullptr;
         RETURN_IF_ERROR(vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx));
-        _cache.insert({cache_key}, meta, handle);
+        // the decoded footer takes more memory than the thrift bytes, which are the
+        // nearest known size
+        _cache.insert({cache_key}, meta, handle, *meta_size);
     }
 
     return Status::OK();
 }
 
+bool FileMetaCache::lookup_parquet_page_index(const io::FileReaderSPtr& file_reader,
+                                              int64_t mtime, int32_t row_group_id,
+                                              ObjLRUCache::CacheHandle* handle) {
+    return _cache.lookup({get_key(file_reader, mtime, fmt::format("page_index_{}", row_group_id))},
+                         handle);
+}
+
+void FileMetaCache::insert_parquet_page_index(const io::FileReaderSPtr& file_reader,
+                                              int64_t mtime, int32_t row_group_id,
+                                              const ParquetPageIndexData* page_index,
+                                              ObjLRUCache::CacheHandle* handle) {
+    _cache.insert({get_key(file_reader, mtime, fmt::format("page_index_{}", row_group_id))},
+                  page_index, handle,
+                  page_index->column_index.size() + page_index->offset_index.size());
+}
+
+bool FileMetaCache::lookup_orc_file_tail(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                                         ObjLRUCache::CacheHandle* handle) {
+    return _cache.lookup({get_key(file_reader, mtime, "orc_file_tail")}, handle);
+}
+
+void FileMetaCache::insert_orc_file_tail(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                                         const std::string* file_tail,
+                                         ObjLRUCache::CacheHandle* handle) {
+    _cache.insert({get_key(file_reader, mtime, "orc_file_tail")}, file_tail, handle,
+                  file_tail->size());
+}
+
 } // namespace doris
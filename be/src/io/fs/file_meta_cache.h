@@ -17,11 +17,20 @@
 
 #pragma once
 
+#include <string_view>
+#include <vector>
+
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
 
 namespace doris {
 
+// The raw column indexes and offset indexes of the columns of a parquet row group.
+struct ParquetPageIndexData {
+    std::vector<uint8_t> column_index;
+    std::vector<uint8_t> offset_index;
+};
+
 // A file meta cache depends on a LRU cache.
 // Such as parsed parquet footer.
 // The capacity will limit the number of cache entries in cache.
@@ -34,13 +43,28 @@ public:
 
     ObjLRUCache& cache() { return _cache; }
 
+    // The key of a piece of metadata of a file, such as "footer". The file size tells apart
+    // the versions of a file whose modification time is not known.
+    static std::string get_key(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                               std::string_view name);
+
     Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
                               size_t* meta_size, ObjLRUCache::CacheHandle* handle);
 
-    Status get_orc_footer() {
-        // TODO: implement
-        return Status::OK();
-    }
+    // Looks up the page indexes of a parquet row group, `insert_parquet_page_index` caches
+    // the ones read on a miss.
+    bool lookup_parquet_page_index(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                                   int32_t row_group_id, ObjLRUCache::CacheHandle* handle);
+    void insert_parquet_page_index(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                                   int32_t row_group_id, const ParquetPageIndexData* page_index,
+                                   ObjLRUCache::CacheHandle* handle);
+
+    // The serialized tail of an orc file, its postscript, footer and metadata, which the orc
+    // reader is created from without reading them again.
+    bool lookup_orc_file_tail(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                              ObjLRUCache::CacheHandle* handle);
+    void insert_orc_file_tail(const io::FileReaderSPtr& file_reader, int64_t mtime,
+                              const std::string* file_tail, ObjLRUCache::CacheHandle* handle);
 
 private:
     ObjLRUCache _cache;
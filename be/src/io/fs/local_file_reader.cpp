@@ -125,7 +125,7 @@ Status LocalFileReader::close() {
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -142,7 +142,7 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     bytes_req = std::min(bytes_req, _file_size - offset);
     *bytes_read = 0;
 
-    LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
+    LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read, io_ctx);
 
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
@@ -40,6 +40,8 @@ public:
 
     Status close(bool non_block = false) override;
 
+    int fd() const { return _fd; }
+
 private:
     Status _finalize();
     void _abort();
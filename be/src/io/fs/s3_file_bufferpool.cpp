@@ -21,6 +21,8 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -64,12 +66,58 @@ struct Memory : boost::noncopyable, Allocator {
     char* _data;
 };
 
+bvar::Adder<uint64_t> s3_file_buffer_pooled("s3_file_buffer_pooled");
+
+// The part memories released by finished buffers, reused by the next buffers instead of
+// allocating and freeing several megabytes for every part. Never destructed since freeing
+// the memories needs the thread context, which may be gone at exit.
+class PartMemoryPool {
+public:
+    static PartMemoryPool* instance() {
+        static auto* pool = new PartMemoryPool();
+        return pool;
+    }
+
+    std::unique_ptr<Memory<>> take(size_t size) {
+        std::lock_guard lock(_mutex);
+        if (_memories.empty() || _memories.back()->_size != size) {
+            return std::make_unique<Memory<>>(size);
+        }
+        auto memory = std::move(_memories.back());
+        _memories.pop_back();
+        s3_file_buffer_pooled << -1;
+        return memory;
+    }
+
+    // The memories of a stale size are dropped, the pooled ones all have the latest size.
+    void give_back(std::unique_ptr<Memory<>> memory) {
+        std::lock_guard lock(_mutex);
+        if (!_memories.empty() && _memories.back()->_size != memory->_size) {
+            s3_file_buffer_pooled << -static_cast<int64_t>(_memories.size());
+            _memories.clear();
+        }
+        if (_memories.size() >= static_cast<size_t>(config::s3_write_buffer_pool_max_num)) {
+            return;
+        }
+        _memories.push_back(std::move(memory));
+        s3_file_buffer_pooled << 1;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<Memory<>>> _memories;
+};
+
 struct FileBuffer::PartData {
-    Memory<> _memory;
-    PartData() : _memory(config::s3_write_buffer_size) {}
-    ~PartData() = default;
-    [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
-    [[nodiscard]] size_t size() const { return _memory._size; }
+    std::unique_ptr<Memory<>> _memory;
+    PartData() : _memory(PartMemoryPool::instance()->take(config::s3_write_buffer_size)) {}
+    ~PartData() {
+        if (config::s3_write_buffer_pool_max_num > 0) {
+            PartMemoryPool::instance()->give_back(std::move(_memory));
+        }
+    }
+    [[nodiscard]] Slice data() const { return Slice {_memory->_data, _memory->_size}; }
+    [[nodiscard]] size_t size() const { return _memory->_size; }
 };
 
 Slice FileBuffer::get_slice() const {
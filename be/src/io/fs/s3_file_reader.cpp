@@ -29,18 +29,22 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -103,7 +107,7 @@ Status S3FileReader::close() {
 }
 
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                  const IOContext* /*io_ctx*/) {
+                                  const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::InternalError(
@@ -118,6 +122,18 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         return Status::OK();
     }
 
+    LIMIT_REMOTE_SCAN_IO(bytes_read, io_ctx);
+
+    auto part_size = static_cast<size_t>(std::max<int64_t>(config::s3_read_parallel_part_size, 0));
+    if (part_size > 0 && bytes_req >= 2 * part_size) {
+        RETURN_IF_ERROR(_get_object_in_parts(offset, to, bytes_req, part_size));
+        *bytes_read = bytes_req;
+        return Status::OK();
+    }
+    return _get_object(offset, to, bytes_req, bytes_read);
+}
+
+Status S3FileReader::_get_object(size_t offset, char* to, size_t bytes_req, size_t* bytes_read) {
     auto client = _client->get();
     if (!client) {
         return Status::InternalError("init s3 client error");
@@ -128,8 +144,6 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     const int max_wait_time = config::s3_read_max_wait_time_ms; // Maximum wait time in milliseconds
     const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
 
-    LIMIT_REMOTE_SCAN_IO(bytes_read);
-
     int total_sleep_time = 0;
     while (retry_count <= max_retries) {
         *bytes_read = 0;
@@ -183,6 +197,50 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::InternalError(msg);
 }
 
+Status S3FileReader::_get_object_in_parts(size_t offset, char* to, size_t bytes_req,
+                                          size_t part_size) {
+    struct PartsContext {
+        size_t num_parts;
+        // the parts are claimed by the caller and the pool tasks, so a task still queued when
+        // all parts are claimed does nothing and the caller never waits for a queued task
+        std::atomic<size_t> next_part = 0;
+        std::mutex lock;
+        std::condition_variable cv;
+        size_t finished_parts = 0;
+        Status status;
+    };
+    auto ctx = std::make_shared<PartsContext>();
+    ctx->num_parts = (bytes_req + part_size - 1) / part_size;
+    auto read_parts = [this, ctx, offset, to, bytes_req, part_size]() {
+        size_t part;
+        while ((part = ctx->next_part++) < ctx->num_parts) {
+            size_t part_offset = part * part_size;
+            size_t part_bytes = std::min(part_size, bytes_req - part_offset);
+            size_t part_read = 0;
+            Status st = _get_object(offset + part_offset, to + part_offset, part_bytes, &part_read);
+            std::lock_guard l(ctx->lock);
+            if (!st.ok() && ctx->status.ok()) {
+                ctx->status = std::move(st);
+            }
+            if (++ctx->finished_parts == ctx->num_parts) {
+                ctx->cv.notify_one();
+            }
+        }
+    };
+
+    auto* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    for (size_t i = 1; pool != nullptr && i < ctx->num_parts; ++i) {
+        if (!pool->submit_func(read_parts).ok()) {
+            // the caller reads the rest
+            break;
+        }
+    }
+    read_parts();
+    std::unique_lock l(ctx->lock);
+    ctx->cv.wait(l, [&]() { return ctx->finished_parts == ctx->num_parts; });
+    return ctx->status;
+}
+
 void S3FileReader::_collect_profile_before_close() {
     if (_profile != nullptr) {
         const char* s3_profile_name = "S3Profile";
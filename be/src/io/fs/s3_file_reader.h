@@ -60,11 +60,17 @@ protected:
     void _collect_profile_before_close() override;
 
 private:
+    // Gets `bytes_req` bytes at `offset` with one request, retried on throttling.
+    Status _get_object(size_t offset, char* to, size_t bytes_req, size_t* bytes_read);
+    // Gets the range in parts of `part_size` bytes sent in parallel.
+    Status _get_object_in_parts(size_t offset, char* to, size_t bytes_req, size_t part_size);
+
+    // updated by the parallel part reads
     struct S3Statistics {
-        int64_t total_get_request_counter = 0;
-        int64_t too_many_request_err_counter = 0;
-        int64_t too_many_request_sleep_time_ms = 0;
-        int64_t total_bytes_read = 0;
+        std::atomic<int64_t> total_get_request_counter = 0;
+        std::atomic<int64_t> too_many_request_err_counter = 0;
+        std::atomic<int64_t> too_many_request_sleep_time_ms = 0;
+        std::atomic<int64_t> total_bytes_read = 0;
     };
     Path _path;
     size_t _file_size;
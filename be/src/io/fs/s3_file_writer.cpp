@@ -40,6 +40,7 @@
 #include "io/fs/s3_obj_storage_client.h"
 #include "runtime/exec_env.h"
 #include "util/s3_util.h"
+#include "util/time.h"
 
 namespace doris::io {
 #include "common/compile_check_begin.h"
@@ -169,6 +170,11 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
         ret = true;
         _st = std::move(s);
     }
+    {
+        std::lock_guard lock(_inflight_lock);
+        --_inflight_parts;
+        _inflight_cv.notify_one();
+    }
     // After the signal, there is a scenario where the previous invocation of _wait_until_finish
     // returns to the caller, and subsequently, the S3 file writer is destructed.
     // This means that accessing _failed afterwards would result in a heap use after free vulnerability.
@@ -176,6 +182,31 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
     return ret;
 }
 
+void S3FileWriter::_wait_for_inflight_window() {
+    std::unique_lock lock(_inflight_lock);
+    int max_inflight_parts = config::s3_file_writer_max_inflight_parts;
+    while (max_inflight_parts > 0 && !_failed &&
+           _inflight_parts >= std::min(_inflight_window, max_inflight_parts)) {
+        _inflight_cv.wait(lock);
+    }
+    ++_inflight_parts;
+}
+
+void S3FileWriter::_update_inflight_window(int64_t latency_us) {
+    std::lock_guard lock(_inflight_lock);
+    if (_base_part_latency_us == 0 || latency_us < _base_part_latency_us) {
+        _base_part_latency_us = latency_us;
+    }
+    if (latency_us <= 2 * _base_part_latency_us) {
+        _inflight_window = std::min(_inflight_window + 1,
+                                    std::max(config::s3_file_writer_max_inflight_parts, 2));
+    } else {
+        _inflight_window = std::max(_inflight_window / 2, 2);
+        // move the base towards the latency, so a lasting slowdown does not pin the window
+        _base_part_latency_us += (latency_us - _base_part_latency_us) / 4;
+    }
+}
+
 Status S3FileWriter::_build_upload_buffer() {
     auto builder = FileBufferBuilder();
     builder.set_type(BufferType::UPLOAD)
@@ -223,6 +254,7 @@ Status S3FileWriter::_close_impl() {
     }
 
     if (_pending_buf != nullptr) { // there is remaining data in buffer need to be uploaded
+        _wait_for_inflight_window();
         _countdown_event.add_count();
         RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
         _pending_buf = nullptr;
@@ -273,6 +305,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                     RETURN_IF_ERROR(_create_multi_upload_request());
                 }
                 _cur_part_num++;
+                _wait_for_inflight_window();
                 _countdown_event.add_count();
                 RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
                 _pending_buf = nullptr;
@@ -298,6 +331,7 @@ void S3FileWriter::_upload_one_part(int part_num, UploadFileBuffer& buf) {
         buf.set_status(Status::InternalError<false>("invalid obj storage client"));
         return;
     }
+    int64_t start_us = MonotonicMicros();
     auto resp = client->upload_part(_obj_storage_path_opts, buf.get_string_view_data(), part_num);
     if (resp.resp.status.code != ErrorCode::OK) {
         LOG_WARNING("failed to upload part, key={}, part_num={}, status={}",
@@ -305,6 +339,7 @@ void S3FileWriter::_upload_one_part(int part_num, UploadFileBuffer& buf) {
         buf.set_status(Status(resp.resp.status.code, std::move(resp.resp.status.msg)));
         return;
     }
+    _update_inflight_window(MonotonicMicros() - start_us);
     s3_bytes_written_total << buf.get_size();
 
     ObjectCompleteMultiPart completed_part {
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <bthread/condition_variable.h>
 #include <bthread/countdown_event.h>
+#include <bthread/mutex.h>
 
 #include <cstddef>
 #include <memory>
@@ -85,6 +87,8 @@ private:
     void _put_object(UploadFileBuffer& buf);
     void _upload_one_part(int part_num, UploadFileBuffer& buf);
     bool _complete_part_task_callback(Status s);
+    void _wait_for_inflight_window();
+    void _update_inflight_window(int64_t latency_us);
     Status _build_upload_buffer();
 
     ObjectStoragePathOptions _obj_storage_path_opts;
@@ -99,6 +103,14 @@ private:
 
     std::atomic_bool _failed = false;
 
+    // Bounds the parts in flight by config::s3_file_writer_max_inflight_parts. The window grows
+    // by one part while the upload latency stays within twice the lowest one and halves otherwise.
+    bthread::Mutex _inflight_lock;
+    bthread::ConditionVariable _inflight_cv;
+    int _inflight_parts = 0;
+    int _inflight_window = 2;
+    int64_t _base_part_latency_us = 0;
+
     Status _st;
     size_t _bytes_appended = 0;
 
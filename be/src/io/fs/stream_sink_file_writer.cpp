@@ -17,6 +17,7 @@
 
 #include "io/fs/stream_sink_file_writer.h"
 
+#include <butil/iobuf.h>
 #include <gen_cpp/internal_service.pb.h>
 
 #include "olap/olap_common.h"
@@ -51,7 +52,11 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
                << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
                << ", data_length: " << bytes_req << "file_type" << _file_type;
 
-    std::span<const Slice> slices {data, data_cnt};
+    // copy the data once, the replicas share its blocks
+    butil::IOBuf buf;
+    for (size_t i = 0; i < data_cnt; i++) {
+        buf.append(data[i].get_data(), data[i].get_size());
+    }
     size_t fault_injection_skipped_streams = 0;
     bool ok = false;
     Status st;
@@ -71,7 +76,7 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
         DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_all_replica",
                         { continue; });
         st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id, _bytes_appended,
-                                 slices, false, _file_type);
+                                 buf, false, _file_type);
         ok = ok || st.ok();
         if (!st.ok()) {
             LOG(WARNING) << "failed to send segment data to backend " << stream->dst_id()
@@ -141,7 +146,7 @@ Status StreamSinkFileWriter::_finalize() {
         DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_all_replica",
                         { continue; });
         auto st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id,
-                                      _bytes_appended, {}, true, _file_type);
+                                      _bytes_appended, butil::IOBuf {}, true, _file_type);
         ok = ok || st.ok();
         if (!st.ok()) {
             LOG(WARNING) << "failed to send segment eos to backend " << stream->dst_id()
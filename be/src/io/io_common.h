@@ -58,6 +58,30 @@ struct FileCacheStatistics {
     int64_t inverted_index_local_io_timer = 0;
     int64_t inverted_index_remote_io_timer = 0;
     int64_t inverted_index_io_timer = 0;
+
+    void merge(const FileCacheStatistics& other) {
+        num_local_io_total += other.num_local_io_total;
+        num_remote_io_total += other.num_remote_io_total;
+        local_io_timer += other.local_io_timer;
+        bytes_read_from_local += other.bytes_read_from_local;
+        bytes_read_from_remote += other.bytes_read_from_remote;
+        remote_io_timer += other.remote_io_timer;
+        write_cache_io_timer += other.write_cache_io_timer;
+        bytes_write_into_cache += other.bytes_write_into_cache;
+        num_skip_cache_io_total += other.num_skip_cache_io_total;
+        read_cache_file_directly_timer += other.read_cache_file_directly_timer;
+        cache_get_or_set_timer += other.cache_get_or_set_timer;
+        lock_wait_timer += other.lock_wait_timer;
+        get_timer += other.get_timer;
+        set_timer += other.set_timer;
+        inverted_index_num_local_io_total += other.inverted_index_num_local_io_total;
+        inverted_index_num_remote_io_total += other.inverted_index_num_remote_io_total;
+        inverted_index_bytes_read_from_local += other.inverted_index_bytes_read_from_local;
+        inverted_index_bytes_read_from_remote += other.inverted_index_bytes_read_from_remote;
+        inverted_index_local_io_timer += other.inverted_index_local_io_timer;
+        inverted_index_remote_io_timer += other.inverted_index_remote_io_timer;
+        inverted_index_io_timer += other.inverted_index_io_timer;
+    }
 };
 
 struct IOContext {
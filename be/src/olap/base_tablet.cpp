@@ -22,6 +22,7 @@
 #include <rapidjson/prettywriter.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <iterator>
 #include <random>
@@ -52,6 +53,7 @@
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
+#include "util/time.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/schema_util.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -138,6 +140,9 @@ BaseTablet::BaseTablet(TabletMetaSharedPtr tablet_meta) : _tablet_meta(std::move
                 tablet_schema_with_merged_max_schema_version(_tablet_meta->all_rs_metas());
     }
     DCHECK(_max_version_schema);
+    if (_tablet_meta->enable_unique_key_merge_on_write()) {
+        _pk_mem_index = std::make_unique<PrimaryKeyMemIndex>();
+    }
     g_total_tablet_num << 1;
 }
 
@@ -211,6 +216,46 @@ uint32_t BaseTablet::get_real_compaction_score() const {
                            });
 }
 
+void BaseTablet::update_read_amplification(int64_t num_rowsets, int64_t num_segments,
+                                           int64_t rows_del_by_bitmap) {
+    // a block of rows dropped by the delete bitmap costs about as much as opening a segment
+    _read_amplification_total.fetch_add(num_rowsets + num_segments + rows_del_by_bitmap / 4096,
+                                        std::memory_order_relaxed);
+}
+
+double BaseTablet::read_amplification(int64_t now_ms) {
+    std::lock_guard l(_read_amplification_lock);
+    int64_t half_life_sec = config::compaction_read_amplification_half_life_sec;
+    if (half_life_sec > 0 && now_ms > _read_amplification_update_ms) {
+        double elapsed_sec = static_cast<double>(now_ms - _read_amplification_update_ms) / 1000;
+        _read_amplification_decayed *= std::exp2(-elapsed_sec / static_cast<double>(half_life_sec));
+    }
+    int64_t total = _read_amplification_total.load(std::memory_order_relaxed);
+    _read_amplification_decayed += static_cast<double>(total - _read_amplification_seen);
+    _read_amplification_seen = total;
+    _read_amplification_update_ms = now_ms;
+    return _read_amplification_decayed;
+}
+
+void BaseTablet::set_scan_position(const RowsetId& rowset_id, int64_t segment_id) {
+    std::lock_guard l(_scan_position_lock);
+    _scan_position_rowset_id = rowset_id;
+    _scan_position_segment_id = segment_id;
+    _scan_position_update_ms = MonotonicMillis();
+}
+
+bool BaseTablet::get_scan_position(RowsetId* rowset_id, int64_t* segment_id) const {
+    std::lock_guard l(_scan_position_lock);
+    if (_scan_position_update_ms == 0 ||
+        MonotonicMillis() - _scan_position_update_ms >
+                config::synchronized_scan_position_expire_ms) {
+        return false;
+    }
+    *rowset_id = _scan_position_rowset_id;
+    *segment_id = _scan_position_segment_id;
+    return true;
+}
+
 Status BaseTablet::capture_rs_readers_unlocked(const Versions& version_path,
                                                std::vector<RowSetSplits>* rs_splits) const {
     DCHECK(rs_splits != nullptr && rs_splits->empty());
@@ -465,7 +510,8 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
                                   std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches,
                                   RowsetSharedPtr* rowset, bool with_rowid,
                                   std::string* encoded_seq_value, OlapReaderStatistics* stats,
-                                  DeleteBitmapPtr delete_bitmap) {
+                                  DeleteBitmapPtr delete_bitmap,
+                                  std::vector<SegmentPkIterators>* pk_iterators) {
     SCOPED_BVAR_LATENCY(g_tablet_lookup_rowkey_latency);
     size_t seq_col_length = 0;
     // use the latest tablet schema to decide if the tablet has sequence column currently
@@ -484,7 +530,14 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
 
     auto tablet_delete_bitmap =
             delete_bitmap == nullptr ? _tablet_meta->delete_bitmap_ptr() : delete_bitmap;
+    std::vector<bool> skip_rowsets;
+    if (config::enable_pk_mem_index && _pk_mem_index != nullptr) {
+        _pk_mem_index->prune(key_without_seq, specified_rowsets, &skip_rowsets);
+    }
     for (size_t i = 0; i < specified_rowsets.size(); i++) {
+        if (!skip_rowsets.empty() && skip_rowsets[i]) {
+            continue;
+        }
         const auto& rs = specified_rowsets[i];
         std::vector<KeyBoundsPB> segments_key_bounds;
         rs->rowset_meta()->get_segments_key_bounds(&segments_key_bounds);
@@ -509,10 +562,16 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
         }
         auto& segments = segment_caches[i]->get_segments();
         DCHECK_EQ(segments.size(), num_segments);
+        SegmentPkIterators* rs_pk_iterators = nullptr;
+        if (pk_iterators != nullptr) {
+            rs_pk_iterators = &(*pk_iterators)[i];
+            rs_pk_iterators->resize(segments.size());
+        }
 
         for (auto id : picked_segments) {
-            Status s = segments[id]->lookup_row_key(encoded_key, schema, with_seq_col, with_rowid,
-                                                    &loc, stats, encoded_seq_value);
+            Status s = segments[id]->lookup_row_key(
+                    encoded_key, schema, with_seq_col, with_rowid, &loc, stats, encoded_seq_value,
+                    rs_pk_iterators == nullptr ? nullptr : &(*rs_pk_iterators)[id]);
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -647,6 +706,9 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // The keys of the segment are looked up in ascending order, so keeping the index iterator
+    // of each older segment lets consecutive keys reuse the index page they were found in.
+    std::vector<SegmentPkIterators> pk_iterators(specified_rowsets.size());
     while (remaining > 0) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
@@ -720,11 +782,12 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
             if (tablet_delete_bitmap == nullptr) {
                 st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
                                     cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
-                                    &rowset_find);
+                                    &rowset_find, true, nullptr, nullptr, nullptr, &pk_iterators);
             } else {
                 st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
                                     cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
-                                    &rowset_find, true, nullptr, nullptr, tablet_delete_bitmap);
+                                    &rowset_find, true, nullptr, nullptr, tablet_delete_bitmap,
+                                    &pk_iterators);
             }
             bool expected_st = st.ok() || st.is<KEY_NOT_FOUND>() || st.is<KEY_ALREADY_EXISTS>();
             // It's a defensive DCHECK, we need to exclude some common errors to avoid core-dump
@@ -28,6 +28,7 @@
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
 #include "olap/partial_update_info.h"
+#include "olap/primary_key_mem_index.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "olap/tablet_fwd.h"
 #include "olap/tablet_meta.h"
@@ -45,6 +46,9 @@ class RowIdConversion;
 struct PartialUpdateInfo;
 class FixedReadPlan;
 
+// The primary key index iterators of the segments of a rowset, indexed by segment id.
+using SegmentPkIterators = std::vector<std::unique_ptr<segment_v2::IndexedColumnIterator>>;
+
 struct TabletWithVersion {
     BaseTabletSPtr tablet;
     int64_t version;
@@ -123,6 +127,15 @@ public:
     // note(tsy): we should unify the compaction score calculation finally
     uint32_t get_real_compaction_score() const;
 
+    // Adds the read amplification of one scan: the rowsets and segments it opened, and the
+    // rows it read only to drop them by the delete bitmap.
+    void update_read_amplification(int64_t num_rowsets, int64_t num_segments,
+                                   int64_t rows_del_by_bitmap);
+
+    // Read amplification of the recent scans, halved every
+    // `compaction_read_amplification_half_life_sec`.
+    double read_amplification(int64_t now_ms);
+
     // MUST hold shared meta lock
     Status capture_rs_readers_unlocked(const Versions& version_path,
                                        std::vector<RowSetSplits>* rs_splits) const;
@@ -161,6 +174,9 @@ public:
     // Lookup the row location of `encoded_key`, the function sets `row_location` on success.
     // NOTE: the method only works in unique key model with primary key index, you will got a
     //       not supported error in other data model.
+    // `pk_iterators` has one entry per specified rowset. If given, the primary key index
+    // iterators of the probed segments are kept there, so that a caller looking up ascending
+    // keys walks each index forward instead of reading its pages again for every key.
     Status lookup_row_key(const Slice& encoded_key, TabletSchema* latest_schema, bool with_seq_col,
                           const std::vector<RowsetSharedPtr>& specified_rowsets,
                           RowLocation* row_location, uint32_t version,
@@ -168,7 +184,8 @@ public:
                           RowsetSharedPtr* rowset = nullptr, bool with_rowid = true,
                           std::string* encoded_seq_value = nullptr,
                           OlapReaderStatistics* stats = nullptr,
-                          DeleteBitmapPtr tablet_delete_bitmap = nullptr);
+                          DeleteBitmapPtr tablet_delete_bitmap = nullptr,
+                          std::vector<SegmentPkIterators>* pk_iterators = nullptr);
 
     // calc delete bitmap when flush memtable, use a fake version to calc
     // For example, cur max version is 5, and we use version 6 to calc but
@@ -321,6 +338,13 @@ public:
     TabletUid tablet_uid() const { return _tablet_meta->tablet_uid(); }
     TabletInfo get_tablet_info() const { return TabletInfo(tablet_id(), tablet_uid()); }
 
+    // Remembers that a scan of the tablet has just started reading segment `segment_id` of
+    // `rowset_id`.
+    void set_scan_position(const RowsetId& rowset_id, int64_t segment_id);
+    // The segment a scan of the tablet started reading last, false if there is none within
+    // synchronized_scan_position_expire_ms.
+    bool get_scan_position(RowsetId* rowset_id, int64_t* segment_id) const;
+
     void get_base_rowset_delete_bitmap_count(
             uint64_t* max_base_rowset_delete_bitmap_score,
             int64_t* max_base_rowset_delete_bitmap_score_tablet_id);
@@ -366,9 +390,24 @@ protected:
     // `_alter_failed` is used to indicate whether the tablet failed to perform a schema change
     std::atomic<bool> _alter_failed = false;
 
+    std::atomic<int64_t> _read_amplification_total = 0;
+    std::mutex _read_amplification_lock;
+    // the part of `_read_amplification_total` already in `_read_amplification_decayed`
+    int64_t _read_amplification_seen = 0;
+    double _read_amplification_decayed = 0;
+    int64_t _read_amplification_update_ms = 0;
+
+    mutable std::mutex _scan_position_lock;
+    RowsetId _scan_position_rowset_id;
+    int64_t _scan_position_segment_id = 0;
+    int64_t _scan_position_update_ms = 0;
+
     // metrics of this tablet
     std::shared_ptr<MetricEntity> _metric_entity;
 
+    // keys of the small rowsets, nullptr if the tablet is not merge-on-write
+    std::unique_ptr<PrimaryKeyMemIndex> _pk_mem_index;
+
 protected:
     std::timed_mutex _schema_change_lock;
 
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/column_ndv_collector.h"
+
+#include <fmt/format.h>
+
+#include "common/exception.h"
+#include "common/logging.h"
+#include "olap/tablet_schema.h"
+#include "vec/core/block.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+void ColumnNdvCollector::add(const std::vector<uint32_t>& column_ids,
+                             const vectorized::Block& block) {
+    DCHECK_LE(column_ids.size(), block.columns());
+    size_t rows = block.rows();
+    if (rows == 0) {
+        return;
+    }
+    std::vector<uint64_t> hashes(rows);
+    for (size_t i = 0; i < column_ids.size(); ++i) {
+        auto& sketch = _sketches[column_ids[i]];
+        if (sketch.unsupported) {
+            continue;
+        }
+        std::fill(hashes.begin(), hashes.end(), 0);
+        try {
+            block.get_by_position(i).column->update_hashes_with_value(hashes.data());
+        } catch (const doris::Exception& e) {
+            // e.g. variant columns, skip the column for the rest of the compaction
+            VLOG_DEBUG << "failed to hash column " << column_ids[i] << ": " << e.what();
+            sketch.unsupported = true;
+            continue;
+        }
+        for (auto hash : hashes) {
+            sketch.hll.update(hash);
+        }
+        sketch.collected = true;
+    }
+}
+
+int64_t ColumnNdvCollector::ndv(uint32_t column_id) const {
+    const auto& sketch = _sketches[column_id];
+    if (!sketch.collected || sketch.unsupported) {
+        return -1;
+    }
+    return sketch.hll.estimate_cardinality();
+}
+
+std::string ColumnNdvCollector::debug_string(const TabletSchema& tablet_schema) const {
+    fmt::memory_buffer buf;
+    for (uint32_t i = 0; i < _sketches.size() && i < tablet_schema.num_columns(); ++i) {
+        int64_t column_ndv = ndv(i);
+        if (column_ndv < 0) {
+            continue;
+        }
+        fmt::format_to(buf, "{}{}={}", buf.size() == 0 ? "" : ", ",
+                       tablet_schema.column(i).name(), column_ndv);
+    }
+    return fmt::to_string(buf);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "olap/hll.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+class TabletSchema;
+
+namespace vectorized {
+class Block;
+} // namespace vectorized
+
+// Estimates the number of distinct values of every column from the blocks a compaction
+// writes, so the statistics come with the merge instead of a separate scan.
+class ColumnNdvCollector {
+public:
+    explicit ColumnNdvCollector(size_t num_columns) : _sketches(num_columns) {}
+
+    // `block` holds the columns `column_ids` of the tablet schema in this order. Blocks of
+    // disjoint column groups may be added concurrently.
+    void add(const std::vector<uint32_t>& column_ids, const vectorized::Block& block);
+
+    // Returns -1 if the column has not been collected.
+    int64_t ndv(uint32_t column_id) const;
+
+    std::string debug_string(const TabletSchema& tablet_schema) const;
+
+private:
+    struct ColumnSketch {
+        HyperLogLog hll;
+        bool collected = false;
+        // set if the column type cannot be hashed
+        bool unsupported = false;
+    };
+
+    std::vector<ColumnSketch> _sketches;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
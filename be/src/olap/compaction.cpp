@@ -39,6 +39,7 @@
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet.h"
+#include "cloud/cloud_tablet_hotspot.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
@@ -51,6 +52,7 @@
 #include "olap/cumulative_compaction_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
 #include "olap/data_dir.h"
+#include "olap/inverted_index_parser.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset.h"
@@ -76,7 +78,9 @@
 #include "olap/utils.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/defer_op.h"
 #include "util/doris_metrics.h"
+#include "util/pretty_printer.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -170,6 +174,24 @@ int64_t Compaction::merge_way_num() {
     return way_num;
 }
 
+int64_t Compaction::estimate_merge_memory() {
+    int64_t row_bytes = 0;
+    {
+        std::unique_lock<std::mutex> lock(_tablet->sample_info_lock);
+        for (const auto& info : _tablet->sample_infos) {
+            // vertical compaction merges one column group at a time
+            row_bytes = _is_vertical ? std::max(row_bytes, info.group_data_size)
+                                     : row_bytes + info.group_data_size;
+        }
+    }
+    if (row_bytes <= 0 && _input_row_num > 0) {
+        row_bytes = _input_rowsets_data_size / _input_row_num;
+    }
+    // every merge way holds a block of at most 4064 rows, see estimate_batch_size
+    int64_t estimate = merge_way_num() * (4096 - 32) * std::max<int64_t>(row_bytes, 1);
+    return std::min(estimate, config::compaction_memory_bytes_limit);
+}
+
 Status Compaction::merge_input_rowsets() {
     std::vector<RowsetReaderSharedPtr> input_rs_readers;
     input_rs_readers.reserve(_input_rowsets.size());
@@ -192,6 +214,11 @@ Status Compaction::merge_input_rowsets() {
         _stats.rowid_conversion = _rowid_conversion.get();
     }
 
+    if (config::enable_compaction_column_ndv) {
+        _ndv_collector = std::make_unique<ColumnNdvCollector>(_cur_tablet_schema->num_columns());
+        _stats.ndv_collector = _ndv_collector.get();
+    }
+
     int64_t way_num = merge_way_num();
 
     Status res;
@@ -224,6 +251,11 @@ Status Compaction::merge_input_rowsets() {
 
     COUNTER_UPDATE(_merged_rows_counter, _stats.merged_rows);
     COUNTER_UPDATE(_filtered_rows_counter, _stats.filtered_rows);
+    if (_ndv_collector != nullptr) {
+        LOG(INFO) << "column ndv of compaction output. tablet=" << _tablet->tablet_id()
+                  << ", output_version=" << _output_version << ", "
+                  << _ndv_collector->debug_string(*_cur_tablet_schema);
+    }
 
     // 3. In the `build`, `_close_file_writers` is called to close the inverted index file writer and write the final compound index file.
     RETURN_NOT_OK_STATUS_WITH_WARN(_output_rs_writer->build(_output_rowset),
@@ -517,6 +549,30 @@ Status CompactionMixin::execute_compact_impl(int64_t permits) {
     LOG(INFO) << "start " << compaction_name() << ". tablet=" << _tablet->tablet_id()
               << ", output_version=" << _output_version << ", permits: " << permits;
 
+    if (compaction_type() == ReaderType::READER_BASE_COMPACTION ||
+        compaction_type() == ReaderType::READER_FULL_COMPACTION) {
+        _stats.io_throttle = tablet()->data_dir()->compaction_io_throttle();
+    }
+    bool memory_reserved = false;
+    Defer defer_shrink_reserved {[&]() {
+        if (memory_reserved) {
+            thread_context()->thread_mem_tracker_mgr->shrink_reserved();
+        }
+    }};
+    if (config::enable_compaction_memory_reservation) {
+        // Fail before merging rather than being cancelled in the middle of it. The failure
+        // also makes the next merge of the tablet use smaller batches.
+        int64_t reserve_size = estimate_merge_memory();
+        Status st = thread_context()->thread_mem_tracker_mgr->try_reserve(
+                reserve_size, ThreadMemTrackerMgr::TryReserveChecker::CHECK_PROCESS);
+        if (!st.ok()) {
+            _tablet->last_compaction_status = Status::Error<ErrorCode::MEM_LIMIT_EXCEEDED>(
+                    "failed to reserve memory {} for {}: {}",
+                    PrettyPrinter::print_bytes(reserve_size), compaction_name(), st.to_string());
+            return _tablet->last_compaction_status;
+        }
+        memory_reserved = true;
+    }
     RETURN_IF_ERROR(merge_input_rowsets());
 
     // Currently, updates are only made in the time_series.
@@ -884,7 +940,8 @@ void Compaction::construct_index_compaction_columns(RowsetWriterContext& ctx) {
             continue;
         }
 
-        // if index properties are different, index compaction maybe needs to be skipped.
+        // if index properties analyze text differently, index compaction needs to be skipped.
+        // Properties that only differ in settings left at their defaults still merge postings.
         bool is_continue = false;
         std::optional<std::map<std::string, std::string>> first_properties;
         for (const auto& rowset : _input_rowsets) {
@@ -898,10 +955,11 @@ void Compaction::construct_index_compaction_columns(RowsetWriterContext& ctx) {
             if (!first_properties.has_value()) {
                 first_properties = properties;
             } else {
+                bool is_same = is_same_index_analysis(properties, first_properties.value());
                 DBUG_EXECUTE_IF(
                         "Compaction::do_inverted_index_compaction_index_properties_different",
-                        { properties.emplace("dummy_key", "dummy_value"); })
-                if (properties != first_properties.value()) {
+                        { is_same = false; })
+                if (!is_same) {
                     is_continue = true;
                     break;
                 }
@@ -1514,6 +1572,13 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.write_file_cache = (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
                            (config::enable_file_cache_keep_base_compaction_output &&
                             compaction_type() == ReaderType::READER_BASE_COMPACTION);
+    // The output of a hot tablet replaces the rowsets its queries read, keep it in the cache
+    // instead of letting the next queries download it again.
+    if (!ctx.write_file_cache && config::file_cache_keep_hot_compaction_output_min_qpd > 0) {
+        ctx.write_file_cache = _engine.tablet_hotspot().qpd(_tablet->tablet_id()) >=
+                               static_cast<uint64_t>(
+                                       config::file_cache_keep_hot_compaction_output_min_qpd);
+    }
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
     RETURN_IF_ERROR(
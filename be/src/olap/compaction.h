@@ -34,6 +34,7 @@
 #include "cloud/cloud_tablet.h"
 #include "common/status.h"
 #include "io/io_common.h"
+#include "olap/column_ndv_collector.h"
 #include "olap/merger.h"
 #include "olap/olap_common.h"
 #include "olap/rowid_conversion.h"
@@ -99,6 +100,10 @@ protected:
 
     int64_t merge_way_num();
 
+    // Predicts the peak memory of merging the input rowsets from the row sizes sampled by the
+    // last merges of the tablet, or from the rowset metas if there are none yet.
+    int64_t estimate_merge_memory();
+
     virtual Status update_delete_bitmap() = 0;
 
     // the root tracker for this compaction
@@ -131,6 +136,7 @@ protected:
 
     int64_t _newest_write_timestamp {-1};
     std::unique_ptr<RowIdConversion> _rowid_conversion = nullptr;
+    std::unique_ptr<ColumnNdvCollector> _ndv_collector;
     TabletSchemaSPtr _cur_tablet_schema;
 
     std::unique_ptr<RuntimeProfile> _profile;
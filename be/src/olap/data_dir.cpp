@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
@@ -61,9 +62,12 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
+#include "runtime/workload_management/io_throttle.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -124,7 +128,8 @@ DataDir::DataDir(StorageEngine& engine, const std::string& path, int64_t capacit
           _storage_medium(storage_medium),
           _is_used(false),
           _cluster_id(-1),
-          _to_be_deleted(false) {
+          _to_be_deleted(false),
+          _compaction_io_throttle(std::make_unique<IOThrottle>()) {
     _data_dir_metric_entity = DorisMetrics::instance()->metric_registry()->register_entity(
             std::string("data_dir.") + path, {{"path", path}});
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_total_capacity);
@@ -419,11 +424,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta";
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_lock;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_lock](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard lock(tablet_ids_lock);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -446,11 +452,42 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    // Tablet metas are read from the meta env one by one, but deserialized and loaded by a
+    // pool. Its queue is bounded, so a full queue makes the reading thread load the tablet itself
+    // instead of holding more tablet metas in memory.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    int load_tablet_threads = config::load_tablet_meta_threads_per_data_dir;
+    if (load_tablet_threads > 1) {
+        static_cast<void>(ThreadPoolBuilder("load_tablet_meta")
+                                  .set_min_threads(load_tablet_threads)
+                                  .set_max_threads(load_tablet_threads)
+                                  .set_max_queue_size(load_tablet_threads * 64)
+                                  .build(&load_tablet_pool));
+    }
+    auto load_tablet_func = [&load_tablet, &load_tablet_pool](int64_t tablet_id,
+                                                               int32_t schema_hash,
+                                                               std::string_view value) -> bool {
+        if (load_tablet_pool != nullptr) {
+            // the value is only valid in this call
+            auto st = load_tablet_pool->submit_func(
+                    [&load_tablet, tablet_id, schema_hash, meta = std::string(value)] {
+                        SCOPED_INIT_THREAD_CONTEXT();
+                        load_tablet(tablet_id, schema_hash, meta);
+                    });
+            if (st.ok()) {
+                return true;
+            }
+        }
+        load_tablet(tablet_id, schema_hash, value);
         return true;
     };
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    if (load_tablet_pool != nullptr) {
+        load_tablet_pool->wait();
+    }
     tablet_timer.stop();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
@@ -36,6 +36,7 @@
 
 namespace doris {
 
+class IOThrottle;
 class Tablet;
 class TabletManager;
 class TxnManager;
@@ -134,6 +135,9 @@ public:
 
     void disks_compaction_num_increment(int64_t delta);
 
+    // Shared by the compactions reading from this disk.
+    IOThrottle* compaction_io_throttle() { return _compaction_io_throttle.get(); }
+
     double get_usage(int64_t incoming_data_size) const {
         return _disk_capacity_bytes == 0
                        ? 0
@@ -192,6 +196,8 @@ private:
 
     OlapMeta* _meta = nullptr;
 
+    std::unique_ptr<IOThrottle> _compaction_io_throttle;
+
     std::shared_ptr<MetricEntity> _data_dir_metric_entity;
     IntGauge* disks_total_capacity = nullptr;
     IntGauge* disks_avail_capacity = nullptr;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
 #include <roaring/roaring.hh>
 
 #include "decimal12.h"
@@ -306,50 +307,8 @@ public:
             if (bf->is_ngram_bf()) {
                 return true;
             }
-            HybridSetBase::IteratorBase* iter = _values->begin();
-            while (iter->has_next()) {
-                if constexpr (std::is_same_v<T, StringRef>) {
-                    const auto* value = (const StringRef*)iter->get_value();
-                    if (bf->test_bytes(value->data, value->size)) {
-                        return true;
-                    }
-                } else if constexpr (Type == PrimitiveType::TYPE_DECIMALV2) {
-                    // DecimalV2 using decimal12_t in bloom filter in storage layer,
-                    // should convert value to decimal12_t
-                    // Datev1/DatetimeV1 using VecDatetimeValue in bloom filter, NO need to convert.
-                    const T* value = (const T*)(iter->get_value());
-                    decimal12_t decimal12_t_val(value->int_value(), value->frac_value());
-                    if (bf->test_bytes(
-                                const_cast<char*>(reinterpret_cast<const char*>(&decimal12_t_val)),
-                                sizeof(decimal12_t))) {
-                        return true;
-                    }
-                } else if constexpr (Type == PrimitiveType::TYPE_DATE) {
-                    const T* value = (const T*)(iter->get_value());
-                    uint24_t date_value(uint32_t(value->to_olap_date()));
-                    if (bf->test_bytes(
-                                const_cast<char*>(reinterpret_cast<const char*>(&date_value)),
-                                sizeof(uint24_t))) {
-                        return true;
-                    }
-                    // DatetimeV1 using int64_t in bloom filter
-                } else if constexpr (Type == PrimitiveType::TYPE_DATETIME) {
-                    const T* value = (const T*)(iter->get_value());
-                    int64_t datetime_value(value->to_olap_datetime());
-                    if (bf->test_bytes(
-                                const_cast<char*>(reinterpret_cast<const char*>(&datetime_value)),
-                                sizeof(int64_t))) {
-                        return true;
-                    }
-                } else {
-                    const T* value = (const T*)(iter->get_value());
-                    if (bf->test_bytes(reinterpret_cast<const char*>(value), sizeof(*value))) {
-                        return true;
-                    }
-                }
-                iter->next();
-            }
-            return false;
+            const auto& hashes = _get_bloom_filter_hashes(bf);
+            return bf->test_any_hash(hashes.data(), hashes.size());
         } else {
             LOG(FATAL) << "Bloom filter is not supported by predicate type.";
             return true;
@@ -554,6 +513,48 @@ private:
         return "InListPredicate(" + type_to_string(Type) + ", " + type_to_string(PT) + ")";
     }
 
+    // Hashes every value once, so that probing the bloom filters of many pages and segments
+    // does not hash a large IN list again for each of them. All bloom filter indexes use the
+    // same hash strategy, so the hashes of the first bloom filter fit the others too.
+    const std::vector<uint64_t>& _get_bloom_filter_hashes(const segment_v2::BloomFilter* bf) const {
+        std::call_once(_bloom_filter_hashes_once, [&]() {
+            _bloom_filter_hashes.reserve(_values->size());
+            HybridSetBase::IteratorBase* iter = _values->begin();
+            while (iter->has_next()) {
+                if constexpr (std::is_same_v<T, StringRef>) {
+                    const auto* value = (const StringRef*)iter->get_value();
+                    _bloom_filter_hashes.push_back(bf->hash(value->data, value->size));
+                } else if constexpr (Type == PrimitiveType::TYPE_DECIMALV2) {
+                    // DecimalV2 using decimal12_t in bloom filter in storage layer,
+                    // should convert value to decimal12_t
+                    // Datev1/DatetimeV1 using VecDatetimeValue in bloom filter, NO need to convert.
+                    const T* value = (const T*)(iter->get_value());
+                    decimal12_t decimal12_t_val(value->int_value(), value->frac_value());
+                    _bloom_filter_hashes.push_back(
+                            bf->hash(reinterpret_cast<const char*>(&decimal12_t_val),
+                                     sizeof(decimal12_t)));
+                } else if constexpr (Type == PrimitiveType::TYPE_DATE) {
+                    const T* value = (const T*)(iter->get_value());
+                    uint24_t date_value(uint32_t(value->to_olap_date()));
+                    _bloom_filter_hashes.push_back(
+                            bf->hash(reinterpret_cast<const char*>(&date_value), sizeof(uint24_t)));
+                    // DatetimeV1 using int64_t in bloom filter
+                } else if constexpr (Type == PrimitiveType::TYPE_DATETIME) {
+                    const T* value = (const T*)(iter->get_value());
+                    int64_t datetime_value(value->to_olap_datetime());
+                    _bloom_filter_hashes.push_back(bf->hash(
+                            reinterpret_cast<const char*>(&datetime_value), sizeof(int64_t)));
+                } else {
+                    const T* value = (const T*)(iter->get_value());
+                    _bloom_filter_hashes.push_back(
+                            bf->hash(reinterpret_cast<const char*>(value), sizeof(*value)));
+                }
+                iter->next();
+            }
+        });
+        return _bloom_filter_hashes;
+    }
+
     void _update_min_max(const T& value) {
         if (value > _max_value) {
             _max_value = value;
@@ -566,6 +567,8 @@ private:
     std::shared_ptr<HybridSetBase> _values;
     mutable std::map<std::pair<RowsetId, uint32_t>, std::vector<vectorized::UInt8>>
             _segment_id_to_value_in_dict_flags;
+    mutable std::once_flag _bloom_filter_hashes_once;
+    mutable std::vector<uint64_t> _bloom_filter_hashes;
     T _min_value;
     T _max_value;
 
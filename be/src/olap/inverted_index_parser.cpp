@@ -170,4 +170,27 @@ std::string get_custom_analyzer_string_from_properties(
     }
 }
 
+bool is_same_index_analysis(const std::map<std::string, std::string>& lhs,
+                            const std::map<std::string, std::string>& rhs) {
+    return get_custom_analyzer_string_from_properties(lhs) ==
+                   get_custom_analyzer_string_from_properties(rhs) &&
+           get_inverted_index_parser_type_from_string(get_parser_string_from_properties(lhs)) ==
+                   get_inverted_index_parser_type_from_string(
+                           get_parser_string_from_properties(rhs)) &&
+           get_parser_mode_string_from_properties(lhs) ==
+                   get_parser_mode_string_from_properties(rhs) &&
+           get_parser_phrase_support_string_from_properties(lhs) ==
+                   get_parser_phrase_support_string_from_properties(rhs) &&
+           get_parser_char_filter_map_from_properties(lhs) ==
+                   get_parser_char_filter_map_from_properties(rhs) &&
+           get_parser_ignore_above_value_from_properties(lhs) ==
+                   get_parser_ignore_above_value_from_properties(rhs) &&
+           get_parser_lowercase_from_properties<true>(lhs) ==
+                   get_parser_lowercase_from_properties<true>(rhs) &&
+           get_parser_stopwords_from_properties(lhs) ==
+                   get_parser_stopwords_from_properties(rhs) &&
+           get_parser_dict_compression_from_properties(lhs) ==
+                   get_parser_dict_compression_from_properties(rhs);
+}
+
 } // namespace doris
@@ -139,4 +139,9 @@ std::string get_parser_dict_compression_from_properties(
 std::string get_custom_analyzer_string_from_properties(
         const std::map<std::string, std::string>& properties);
 
+// Whether two sets of index properties analyze the same text into the same terms and postings.
+// A setting that is left out compares equal to its explicit default value.
+bool is_same_index_analysis(const std::map<std::string, std::string>& lhs,
+                            const std::map<std::string, std::string>& rhs);
+
 } // namespace doris
@@ -101,6 +101,10 @@ public:
     bool record_rowids = false;
     std::vector<int> topn_filter_source_node_ids;
     int topn_filter_target_node_id = -1;
+    // Predicates of the runtime filters which arrive after the reader is initialized. The
+    // scanner appends to it between two blocks, and the segments which are not initialized
+    // yet prune themselves and their pages by them, as by the topn runtime predicates.
+    const std::vector<std::shared_ptr<ColumnPredicate>>* late_arrival_rf_predicates = nullptr;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
     bool read_orderby_key_reverse = false;
     // columns for orderby keys
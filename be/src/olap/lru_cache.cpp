@@ -7,9 +7,11 @@
 #include <cstdlib>
 #include <mutex>
 #include <new>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 
+#include "common/config.h"
 #include "util/metrics.h"
 #include "util/time.h"
 
@@ -164,7 +166,8 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
-LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
+LRUCache::LRUCache(LRUCacheType type, bool is_lru_k, bool is_clock)
+        : _type(type), _is_lru_k(is_lru_k), _is_clock(is_clock) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
     _lru_normal.prev = &_lru_normal;
@@ -185,7 +188,11 @@ PrunedInfo LRUCache::set_capacity(size_t capacity) {
             return {0, 0};
         }
         _capacity = capacity;
-        _evict_from_lru(0, &last_ref_list);
+        if (_is_clock) {
+            _evict_from_clock(0, &last_ref_list);
+        } else {
+            _evict_from_lru(0, &last_ref_list);
+        }
     }
 
     int64_t pruned_count = 0;
@@ -201,12 +208,10 @@ PrunedInfo LRUCache::set_capacity(size_t capacity) {
 }
 
 uint64_t LRUCache::get_lookup_count() {
-    std::lock_guard l(_mutex);
     return _lookup_count;
 }
 
 uint64_t LRUCache::get_hit_count() {
-    std::lock_guard l(_mutex);
     return _hit_count;
 }
 
@@ -215,8 +220,12 @@ uint64_t LRUCache::get_stampede_count() {
     return _stampede_count;
 }
 
-uint64_t LRUCache::get_miss_count() {
+uint64_t LRUCache::get_ghost_hit_count() {
     std::lock_guard l(_mutex);
+    return _ghost_hit_count;
+}
+
+uint64_t LRUCache::get_miss_count() {
     return _miss_count;
 }
 
@@ -236,6 +245,12 @@ size_t LRUCache::get_element_count() {
 }
 
 bool LRUCache::_unref(LRUHandle* e) {
+    if (_is_clock) {
+        // handles are released without the lock in clock mode
+        uint32_t refs = std::atomic_ref(e->refs).fetch_sub(1, std::memory_order_acq_rel);
+        DCHECK(refs > 0);
+        return refs == 1;
+    }
     DCHECK(e->refs > 0);
     e->refs--;
     return e->refs == 0;
@@ -289,7 +304,31 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     }
 }
 
+bool LRUCache::_is_pinned(LRUHandle* e) const {
+    return _is_clock && std::atomic_ref(e->refs).load(std::memory_order_acquire) > 1;
+}
+
+Cache::Handle* LRUCache::_clock_lookup(const CacheKey& key, uint32_t hash) {
+    std::shared_lock l(_mutex);
+    ++_lookup_count;
+    LRUHandle* e = _table.lookup(key, hash);
+    if (e != nullptr) {
+        // the entry stays in its list, only the reference and visited bit change
+        DCHECK(e->in_cache);
+        std::atomic_ref(e->refs).fetch_add(1, std::memory_order_relaxed);
+        std::atomic_ref(e->visited).store(true, std::memory_order_relaxed);
+        std::atomic_ref(e->last_visit_time).store(UnixMillis(), std::memory_order_relaxed);
+        ++_hit_count;
+    } else {
+        ++_miss_count;
+    }
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
+    if (_is_clock) {
+        return _clock_lookup(key, hash);
+    }
     std::lock_guard l(_mutex);
     ++_lookup_count;
     LRUHandle* e = _table.lookup(key, hash);
@@ -325,6 +364,13 @@ void LRUCache::release(Cache::Handle* handle) {
         return;
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
+    if (_is_clock) {
+        // the cache holds a reference until the entry leaves it, the last one frees it
+        if (_unref(e)) {
+            e->free();
+        }
+        return;
+    }
     bool last_ref = false;
     {
         std::lock_guard l(_mutex);
@@ -369,6 +415,7 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
         DCHECK(remove_handle != nullptr);
         DCHECK(remove_handle->priority == CachePriority::NORMAL);
         _evict_one_entry(remove_handle);
+        _ghost_insert(remove_handle);
         remove_handle->next = *to_remove_head;
         *to_remove_head = remove_handle;
     }
@@ -381,11 +428,34 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
         DCHECK(remove_handle != nullptr);
         DCHECK(remove_handle->priority == CachePriority::DURABLE);
         _evict_one_entry(remove_handle);
+        _ghost_insert(remove_handle);
         remove_handle->next = *to_remove_head;
         *to_remove_head = remove_handle;
     }
 }
 
+void LRUCache::_evict_from_clock(size_t total_size, LRUHandle** to_remove_head) {
+    // 1. evict normal cache entries, 2. evict durable cache entries if need
+    for (LRUHandle* list : {&_lru_normal, &_lru_durable}) {
+        // every entry is passed at most twice, once to clear its visited bit
+        size_t steps = 2 * static_cast<size_t>(_table.element_count());
+        while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
+               list->next != list && steps-- > 0) {
+            LRUHandle* e = list->next;
+            if (_is_pinned(e) || e->visited) {
+                e->visited = false;
+                _lru_remove(e);
+                _lru_append(list, e);
+                continue;
+            }
+            _evict_one_entry(e);
+            _ghost_insert(e);
+            e->next = *to_remove_head;
+            *to_remove_head = e;
+        }
+    }
+}
+
 void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
     // 1. evict normal cache entries
     while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
@@ -393,6 +463,7 @@ void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
         LRUHandle* old = _lru_normal.next;
         DCHECK(old->priority == CachePriority::NORMAL);
         _evict_one_entry(old);
+        _ghost_insert(old);
         old->next = *to_remove_head;
         *to_remove_head = old;
     }
@@ -402,6 +473,7 @@ void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
         LRUHandle* old = _lru_durable.next;
         DCHECK(old->priority == CachePriority::DURABLE);
         _evict_one_entry(old);
+        _ghost_insert(old);
         old->next = *to_remove_head;
         *to_remove_head = old;
     }
@@ -460,6 +532,42 @@ bool LRUCache::_lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key
     return false;
 }
 
+void LRUCache::_ghost_insert(LRUHandle* e) {
+    if (!_enable_ghost) {
+        return;
+    }
+    size_t ghost_capacity = _capacity / kGhostCapacityDivisor;
+    if (e->total_size > ghost_capacity) {
+        return;
+    }
+    auto it = _ghost_map.find(e->hash);
+    if (it != _ghost_map.end()) {
+        _ghost_usage -= it->second->second;
+        _ghost_list.erase(it->second);
+        _ghost_map.erase(it);
+    }
+    while (_ghost_usage + e->total_size > ghost_capacity) {
+        DCHECK(!_ghost_list.empty());
+        _ghost_usage -= _ghost_list.back().second;
+        _ghost_map.erase(_ghost_list.back().first);
+        _ghost_list.pop_back();
+    }
+    _ghost_list.emplace_front(e->hash, e->total_size);
+    _ghost_map[e->hash] = _ghost_list.begin();
+    _ghost_usage += e->total_size;
+}
+
+void LRUCache::_ghost_lookup(visits_lru_cache_key ghost_key) {
+    auto it = _ghost_map.find(ghost_key);
+    if (it == _ghost_map.end()) {
+        return;
+    }
+    ++_ghost_hit_count;
+    _ghost_usage -= it->second->second;
+    _ghost_list.erase(it->second);
+    _ghost_map.erase(it);
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 CachePriority priority) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
@@ -474,6 +582,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 1; // only one for the returned handle.
     e->next = e->prev = nullptr;
     e->in_cache = false;
+    e->visited = false;
     e->priority = priority;
     e->type = _type;
     memcpy(e->key_data, key.data(), key.size());
@@ -483,13 +592,19 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     {
         std::lock_guard l(_mutex);
 
-        if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
+        if (_enable_ghost) {
+            _ghost_lookup(hash);
+        }
+
+        if (_is_lru_k && !_is_clock && _lru_k_insert_visits_list(e->total_size, hash)) {
             return reinterpret_cast<Cache::Handle*>(e);
         }
 
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
-        if (_cache_value_check_timestamp) {
+        if (_is_clock) {
+            _evict_from_clock(e->total_size, &to_remove_head);
+        } else if (_cache_value_check_timestamp) {
             _evict_from_lru_with_time(e->total_size, &to_remove_head);
         } else {
             _evict_from_lru(e->total_size, &to_remove_head);
@@ -502,6 +617,9 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         e->in_cache = true;
         _usage += e->total_size;
         e->refs++; // one for the returned handle, one for LRUCache.
+        if (_is_clock) {
+            _lru_append(priority == CachePriority::DURABLE ? &_lru_durable : &_lru_normal, e);
+        }
         if (old != nullptr) {
             _stampede_count++;
             old->in_cache = false;
@@ -512,11 +630,17 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
             // After all the old handles are released, the old entry will be freed and the memory of the old entry
             // will be released from the cache memory_tracker.
             _usage -= old->total_size;
+            if (_is_clock) {
+                // in clock mode, the entry is in its list until it leaves the cache
+                _lru_remove(old);
+            }
             // if false, old entry is being used externally, just ref-- and sub _usage,
             if (_unref(old)) {
                 // old is on LRU because it's in cache and its reference count
                 // was just 1 (Unref returned 0)
-                _lru_remove(old);
+                if (!_is_clock) {
+                    _lru_remove(old);
+                }
                 old->next = to_remove_head;
                 to_remove_head = old;
             }
@@ -540,7 +664,13 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
     {
         std::lock_guard l(_mutex);
         e = _table.remove(key, hash);
-        if (e != nullptr) {
+        if (e != nullptr && _is_clock) {
+            // the last handle may be released concurrently once it is unrefed, unref at last
+            _lru_remove(e);
+            e->in_cache = false;
+            _usage -= e->total_size;
+            last_ref = _unref(e);
+        } else if (e != nullptr) {
             last_ref = _unref(e);
             // if last_ref is false or in_cache is false, e must not be in lru
             if (last_ref && e->in_cache) {
@@ -563,17 +693,17 @@ PrunedInfo LRUCache::prune() {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        while (_lru_normal.next != &_lru_normal) {
-            LRUHandle* old = _lru_normal.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
-        }
-        while (_lru_durable.next != &_lru_durable) {
-            LRUHandle* old = _lru_durable.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
+        for (LRUHandle* list : {&_lru_normal, &_lru_durable}) {
+            LRUHandle* p = list->next;
+            while (p != list) {
+                LRUHandle* next = p->next;
+                if (!_is_pinned(p)) {
+                    _evict_one_entry(p);
+                    p->next = to_remove_head;
+                    to_remove_head = p;
+                }
+                p = next;
+            }
         }
     }
     int64_t pruned_count = 0;
@@ -595,6 +725,10 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
         LRUHandle* p = _lru_normal.next;
         while (p != &_lru_normal) {
             LRUHandle* next = p->next;
+            if (_is_pinned(p)) {
+                p = next;
+                continue;
+            }
             if (pred(p)) {
                 _evict_one_entry(p);
                 p->next = to_remove_head;
@@ -608,6 +742,10 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
         p = _lru_durable.next;
         while (p != &_lru_durable) {
             LRUHandle* next = p->next;
+            if (_is_pinned(p)) {
+                p = next;
+                continue;
+            }
             if (pred(p)) {
                 _evict_one_entry(p);
                 p->next = to_remove_head;
@@ -636,6 +774,10 @@ void LRUCache::set_cache_value_time_extractor(CacheValueTimeExtractor cache_valu
 
 void LRUCache::set_cache_value_check_timestamp(bool cache_value_check_timestamp) {
     _cache_value_check_timestamp = cache_value_check_timestamp;
+    // eviction by value timestamp needs the strict LRU, set before the cache is used
+    if (cache_value_check_timestamp) {
+        _is_clock = false;
+    }
 }
 
 inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
@@ -659,9 +801,10 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
             (total_element_count_capacity + (_num_shards - 1)) / _num_shards;
     auto** shards = new (std::nothrow) LRUCache*[_num_shards];
     for (int s = 0; s < _num_shards; s++) {
-        shards[s] = new LRUCache(type, is_lru_k);
+        shards[s] = new LRUCache(type, is_lru_k, config::enable_lru_cache_clock_eviction);
         shards[s]->set_capacity(per_shard);
         shards[s]->set_element_count_capacity(per_shard_element_count_capacity);
+        shards[s]->set_enable_ghost(config::cache_rebalance_interval_sec > 0);
     }
     _shards = shards;
 
@@ -785,6 +928,14 @@ int64_t ShardedLRUCache::get_usage() {
     return total_usage;
 }
 
+uint64_t ShardedLRUCache::get_ghost_hit_count() {
+    uint64_t total_ghost_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_ghost_hit_count += _shards[i]->get_ghost_hit_count();
+    }
+    return total_ghost_hit_count;
+}
+
 size_t ShardedLRUCache::get_element_count() {
     size_t total_element_count = 0;
     for (int i = 0; i < _num_shards; i++) {
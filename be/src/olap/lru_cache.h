@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 
@@ -40,6 +41,7 @@ static constexpr LRUCacheType DEFAULT_LRU_CACHE_TYPE = LRUCacheType::SIZE;
 static constexpr uint32_t DEFAULT_LRU_CACHE_NUM_SHARDS = 32;
 static constexpr size_t DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY = 0;
 static constexpr bool DEFAULT_LRU_CACHE_IS_LRU_K = false;
+static constexpr bool DEFAULT_LRU_CACHE_IS_CLOCK = false;
 
 class CacheKey {
 public:
@@ -214,6 +216,10 @@ public:
 
     virtual size_t get_element_count() = 0;
 
+    // Number of inserts of keys that were recently evicted for capacity, i.e. the hits the
+    // cache would have had with more capacity. Only counted with ghost entries enabled.
+    virtual uint64_t get_ghost_hit_count() { return 0; }
+
 private:
     DISALLOW_COPY_AND_ASSIGN(Cache);
 };
@@ -231,6 +237,7 @@ struct LRUHandle {
     size_t key_length;
     size_t total_size; // Entry charge, used to limit cache capacity, LRUCacheType::SIZE including key length.
     bool in_cache; // Whether entry is in the cache.
+    bool visited;  // Whether entry is hit since the clock hand passed it, only in clock mode.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -306,9 +313,16 @@ private:
 using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 
 // A single shard of sharded cache.
+//
+// In clock mode, an entry stays in its list from insert to eviction, a hit only takes the
+// shared lock, adds a reference and sets the visited bit, and release takes no lock. Eviction
+// passes the list from the oldest entry, gives the visited and pinned entries a second chance
+// by moving them to the newest end, and evicts the first one that is neither. LRU-K is not
+// used in clock mode, and caches that evict by value timestamp keep the strict LRU.
 class LRUCache {
 public:
-    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K);
+    LRUCache(LRUCacheType type, bool is_lru_k = DEFAULT_LRU_CACHE_IS_LRU_K,
+             bool is_clock = DEFAULT_LRU_CACHE_IS_CLOCK);
     ~LRUCache();
 
     // visits_lru_cache_key is the hash value of CacheKey.
@@ -323,6 +337,9 @@ public:
     void set_element_count_capacity(uint32_t element_count_capacity) {
         _element_count_capacity = element_count_capacity;
     }
+    // Keep the keys evicted for capacity, up to 1/kGhostCapacityDivisor of the capacity, to count
+    // the ghost hits. Must be set before the cache is used.
+    void set_enable_ghost(bool enable_ghost) { _enable_ghost = enable_ghost; }
 
     // Like Cache methods, but with an extra "hash" parameter.
     // Must call release on the returned handle pointer.
@@ -341,6 +358,7 @@ public:
     uint64_t get_hit_count();
     uint64_t get_miss_count();
     uint64_t get_stampede_count();
+    uint64_t get_ghost_hit_count();
 
     size_t get_usage();
     size_t get_capacity();
@@ -352,9 +370,17 @@ private:
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t total_size, LRUHandle** to_remove_head);
     void _evict_from_lru_with_time(size_t total_size, LRUHandle** to_remove_head);
+    void _evict_from_clock(size_t total_size, LRUHandle** to_remove_head);
+    Cache::Handle* _clock_lookup(const CacheKey& key, uint32_t hash);
+    // Whether the entry in list is being used, which only happens in clock mode.
+    bool _is_pinned(LRUHandle* e) const;
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    void _ghost_insert(LRUHandle* e);
+    void _ghost_lookup(visits_lru_cache_key ghost_key);
+
+    static constexpr size_t kGhostCapacityDivisor = 8;
 
 private:
     LRUCacheType _type;
@@ -363,7 +389,8 @@ private:
     size_t _capacity = 0;
 
     // _mutex protects the following state.
-    std::mutex _mutex;
+    // In clock mode, lookups share it, and handles are released without it.
+    std::shared_mutex _mutex;
     size_t _usage = 0;
 
     // Dummy head of LRU list.
@@ -375,9 +402,9 @@ private:
 
     HandleTable _table;
 
-    uint64_t _lookup_count = 0; // number of cache lookups
-    uint64_t _hit_count = 0;    // number of cache hits
-    uint64_t _miss_count = 0;   // number of cache misses
+    std::atomic<uint64_t> _lookup_count = 0; // number of cache lookups
+    std::atomic<uint64_t> _hit_count = 0;    // number of cache hits
+    std::atomic<uint64_t> _miss_count = 0;   // number of cache misses
     uint64_t _stampede_count = 0;
 
     CacheValueTimeExtractor _cache_value_time_extractor;
@@ -388,10 +415,19 @@ private:
     uint32_t _element_count_capacity = 0;
 
     bool _is_lru_k = false; // LRU-K algorithm, K=2
+    bool _is_clock = false; // CLOCK algorithm, see the comment of the class
     std::list<visits_lru_cache_pair> _visits_lru_cache_list;
     std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
             _visits_lru_cache_map;
     size_t _visits_lru_cache_usage = 0;
+
+    bool _enable_ghost = false;
+    // keys evicted for capacity with their total size, newest at the front
+    std::list<visits_lru_cache_pair> _ghost_list;
+    std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
+            _ghost_map;
+    size_t _ghost_usage = 0;
+    uint64_t _ghost_hit_count = 0;
 };
 
 class ShardedLRUCache : public Cache {
@@ -410,6 +446,7 @@ public:
     size_t get_element_count() override;
     PrunedInfo set_capacity(size_t capacity) override;
     size_t get_capacity() override;
+    uint64_t get_ghost_hit_count() override;
 
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
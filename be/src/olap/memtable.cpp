@@ -34,12 +34,18 @@
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/debug_points.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/sort/radix_sort.h"
+#include "vec/data_types/data_type_nullable.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -48,11 +54,75 @@ bvar::Adder<int64_t> g_memtable_cnt("memtable_cnt");
 
 using namespace ErrorCode;
 
+namespace {
+// Sorting a few rows by comparator is cheaper than building the radix prefix.
+constexpr size_t MIN_ROWS_FOR_RADIX_SORT = 256;
+// Smaller ranges are not worth the cost of scheduling a task.
+constexpr size_t MIN_ROWS_PER_AGG_PARTITION = 65536;
+
+struct KeyPrefixColumn {
+    const vectorized::IColumn* nested = nullptr;
+    const uint8_t* null_map = nullptr;
+    PrimitiveType type;
+    size_t bytes = 0;
+};
+
+// Byte width of the order-preserving encoding of a fixed-width key type, 0 if it has none.
+size_t key_prefix_width(PrimitiveType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+        return 1;
+    case TYPE_SMALLINT:
+        return 2;
+    case TYPE_INT:
+    case TYPE_DATEV2:
+    case TYPE_IPV4:
+        return 4;
+    case TYPE_BIGINT:
+    case TYPE_DATETIMEV2:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+template <PrimitiveType PT>
+void append_key_prefix(const KeyPrefixColumn& column,
+                       const DorisVector<RowInBlock*>& row_in_blocks, size_t begin,
+                       DorisVector<vectorized::RadixSortElement>& elements) {
+    using ValueType = typename PrimitiveTypeTraits<PT>::ColumnItemType;
+    using UnsignedType = std::make_unsigned_t<ValueType>;
+    constexpr size_t VALUE_BITS = sizeof(ValueType) * 8;
+    const auto& data =
+            assert_cast<const vectorized::ColumnVector<PT>&, TypeCheckOnRelease::DISABLE>(
+                    *column.nested)
+                    .get_data();
+    for (size_t i = 0; i < elements.size(); ++i) {
+        auto row_pos = row_in_blocks[begin + i]->_row_pos;
+        // flip the sign bit so that signed values compare correctly as unsigned
+        uint64_t encoded = static_cast<UnsignedType>(data[row_pos]);
+        if constexpr (std::is_signed_v<ValueType>) {
+            encoded ^= uint64_t(1) << (VALUE_BITS - 1);
+        }
+        if constexpr (VALUE_BITS < 64) {
+            if (column.null_map != nullptr) {
+                // nulls are sorted first, the same as compare_at with nan_direction_hint -1
+                encoded = column.null_map[row_pos] ? 0 : ((uint64_t(1) << VALUE_BITS) | encoded);
+            }
+        }
+        auto& key = elements[i].key;
+        key = column.bytes == sizeof(uint64_t) ? encoded : (key << (column.bytes * 8)) | encoded;
+    }
+}
+} // namespace
+
 MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schema,
                    const std::vector<SlotDescriptor*>* slot_descs, TupleDescriptor* tuple_desc,
                    bool enable_unique_key_mow, PartialUpdateInfo* partial_update_info,
                    const std::shared_ptr<ResourceContext>& resource_ctx)
         : _mem_type(MemType::ACTIVE),
+          _create_time_ns(MonotonicNanos()),
           _tablet_id(tablet_id),
           _enable_unique_key_mow(enable_unique_key_mow),
           _keys_type(tablet_schema->keys_type()),
@@ -82,7 +152,7 @@ MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schem
     }
     // TODO: Support ZOrderComparator in the future
     _init_columns_offset_by_slot_descs(slot_descs, tuple_desc);
-    _row_in_blocks = std::make_unique<DorisVector<std::shared_ptr<RowInBlock>>>();
+    _row_in_blocks = std::make_unique<DorisVector<RowInBlock*>>();
 }
 
 void MemTable::_init_columns_offset_by_slot_descs(const std::vector<SlotDescriptor*>* slot_descs,
@@ -169,8 +239,10 @@ MemTable::~MemTable() {
         }
 
         _arena.clear(true);
+        _agg_partition_arenas.clear();
         _vec_row_comparator.reset();
         _row_in_blocks.reset();
+        _row_arena.clear(true);
         _agg_functions.clear();
         _input_mutable_block.clear();
         _output_mutable_block.clear();
@@ -234,19 +306,41 @@ Status MemTable::insert(const vectorized::Block* input_block,
 
     auto num_rows = row_idxs.size();
     size_t cursor_in_mutableblock = _input_mutable_block.rows();
-    RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs.data(),
-                                                  row_idxs.data() + num_rows, &_column_offset));
-    for (int i = 0; i < num_rows; i++) {
-        _row_in_blocks->emplace_back(std::make_shared<RowInBlock>(cursor_in_mutableblock + i));
+    if (_is_contiguous_rows(row_idxs)) {
+        // the rows are not reordered, copy them range by range instead of gathering row by row
+        RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs[0], num_rows,
+                                                      &_column_offset));
+    } else {
+        RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs.data(),
+                                                      row_idxs.data() + num_rows, &_column_offset));
+    }
+    // RowInBlock is trivially destructible, so all rows of a batch are placed in one arena chunk
+    auto* rows = reinterpret_cast<RowInBlock*>(
+            _row_arena.aligned_alloc(sizeof(RowInBlock) * num_rows, alignof(RowInBlock)));
+    for (size_t i = 0; i < num_rows; i++) {
+        _row_in_blocks->emplace_back(new (rows + i) RowInBlock(cursor_in_mutableblock + i));
     }
 
     _stat.raw_rows += num_rows;
     return Status::OK();
 }
 
+bool MemTable::_is_contiguous_rows(const DorisVector<uint32_t>& row_idxs) {
+    if (row_idxs.empty() || row_idxs.back() - row_idxs.front() + 1 != row_idxs.size()) {
+        return false;
+    }
+    for (size_t i = 1; i < row_idxs.size(); ++i) {
+        if (row_idxs[i] != row_idxs[i - 1] + 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <bool has_skip_bitmap_col>
 void MemTable::_aggregate_two_row_in_block(vectorized::MutableBlock& mutable_block,
-                                           RowInBlock* src_row, RowInBlock* dst_row) {
+                                           RowInBlock* src_row, RowInBlock* dst_row,
+                                           vectorized::Arena& arena) {
     // for flexible partial update, the caller must guarantees that either src_row and dst_row
     // both specify the sequence column, or src_row and dst_row both don't specify the
     // sequence column
@@ -269,7 +363,7 @@ void MemTable::_aggregate_two_row_in_block(vectorized::MutableBlock& mutable_blo
             auto* col_ptr = mutable_block.mutable_columns()[cid].get();
             _agg_functions[cid]->add(dst_row->agg_places(cid),
                                      const_cast<const doris::vectorized::IColumn**>(&col_ptr),
-                                     src_row->_row_pos, _arena);
+                                     src_row->_row_pos, arena);
         }
     } else {
         DCHECK(_skip_bitmap_col_idx != -1);
@@ -286,7 +380,7 @@ void MemTable::_aggregate_two_row_in_block(vectorized::MutableBlock& mutable_blo
             auto* col_ptr = mutable_block.mutable_columns()[cid].get();
             _agg_functions[cid]->add(dst_row->agg_places(cid),
                                      const_cast<const doris::vectorized::IColumn**>(&col_ptr),
-                                     src_row->_row_pos, _arena);
+                                     src_row->_row_pos, arena);
         }
     }
 }
@@ -308,7 +402,8 @@ size_t MemTable::_sort() {
     size_t same_keys_num = 0;
     // sort new rows
     Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
-    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+    size_t sorted_key_columns = config::enable_memtable_radix_sort ? _sort_by_key_prefix(tie) : 0;
+    for (size_t i = sorted_key_columns; i < _tablet_schema->num_key_columns(); i++) {
         auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
         };
@@ -320,17 +415,16 @@ size_t MemTable::_sort() {
     while (iter.next()) {
         pdqsort(std::next(_row_in_blocks->begin(), iter.left()),
                 std::next(_row_in_blocks->begin(), iter.right()),
-                [&is_dup](const std::shared_ptr<RowInBlock>& lhs,
-                          const std::shared_ptr<RowInBlock>& rhs) -> bool {
+                [&is_dup](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
                     return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
                 });
         same_keys_num += iter.right() - iter.left();
     }
     // merge new rows and old rows
     _vec_row_comparator->set_block(&_input_mutable_block);
-    auto cmp_func = [this, is_dup, &same_keys_num](const std::shared_ptr<RowInBlock>& l,
-                                                   const std::shared_ptr<RowInBlock>& r) -> bool {
-        auto value = (*(this->_vec_row_comparator))(l.get(), r.get());
+    auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
+                                                   const RowInBlock* r) -> bool {
+        auto value = (*(this->_vec_row_comparator))(l, r);
         if (value == 0) {
             same_keys_num++;
             return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
@@ -344,6 +438,87 @@ size_t MemTable::_sort() {
     return same_keys_num;
 }
 
+size_t MemTable::_sort_by_key_prefix(Tie& tie) {
+    size_t begin = _last_sorted_pos;
+    size_t num_rows = _row_in_blocks->size() - begin;
+    if (num_rows < MIN_ROWS_FOR_RADIX_SORT) {
+        return 0;
+    }
+    // pack as many leading key columns as fit into one 64-bit prefix
+    std::vector<KeyPrefixColumn> prefix_columns;
+    size_t prefix_bytes = 0;
+    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+        const auto* column = _input_mutable_block.get_column_by_position(i).get();
+        KeyPrefixColumn prefix_column;
+        prefix_column.type =
+                vectorized::remove_nullable(_input_mutable_block.get_datatype_by_position(i))
+                        ->get_primitive_type();
+        prefix_column.bytes = key_prefix_width(prefix_column.type);
+        if (prefix_column.bytes == 0) {
+            break;
+        }
+        if (const auto* nullable =
+                    vectorized::check_and_get_column<vectorized::ColumnNullable>(*column)) {
+            prefix_column.nested = &nullable->get_nested_column();
+            prefix_column.null_map = nullable->get_null_map_data().data();
+            prefix_column.bytes += 1;
+        } else {
+            prefix_column.nested = column;
+        }
+        if (prefix_bytes + prefix_column.bytes > sizeof(uint64_t)) {
+            break;
+        }
+        prefix_bytes += prefix_column.bytes;
+        prefix_columns.push_back(prefix_column);
+    }
+    if (prefix_columns.empty()) {
+        return 0;
+    }
+
+    DorisVector<vectorized::RadixSortElement> elements(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        elements[i] = {0, static_cast<uint32_t>(i)};
+    }
+    for (const auto& prefix_column : prefix_columns) {
+        switch (prefix_column.type) {
+#define APPEND_KEY_PREFIX(PT)                                                   \
+    case PT:                                                                    \
+        append_key_prefix<PT>(prefix_column, *_row_in_blocks, begin, elements); \
+        break;
+            APPEND_KEY_PREFIX(TYPE_BOOLEAN)
+            APPEND_KEY_PREFIX(TYPE_TINYINT)
+            APPEND_KEY_PREFIX(TYPE_SMALLINT)
+            APPEND_KEY_PREFIX(TYPE_INT)
+            APPEND_KEY_PREFIX(TYPE_DATEV2)
+            APPEND_KEY_PREFIX(TYPE_IPV4)
+            APPEND_KEY_PREFIX(TYPE_BIGINT)
+            APPEND_KEY_PREFIX(TYPE_DATETIMEV2)
+#undef APPEND_KEY_PREFIX
+        default:
+            DCHECK(false) << "unexpected key prefix type " << type_to_string(prefix_column.type);
+            return 0;
+        }
+    }
+
+    {
+        DorisVector<vectorized::RadixSortElement> buffer(num_rows);
+        vectorized::radix_sort_lsd(elements.data(), buffer.data(), num_rows, prefix_bytes);
+    }
+
+    DorisVector<RowInBlock*> sorted_rows(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        sorted_rows[i] = (*_row_in_blocks)[begin + elements[i].index];
+    }
+    std::copy(sorted_rows.begin(), sorted_rows.end(), std::next(_row_in_blocks->begin(), begin));
+
+    // only rows with the same prefix need to be compared by the remaining key columns
+    tie[begin] = 0;
+    for (size_t i = 1; i < num_rows; ++i) {
+        tie[begin + i] = (elements[i - 1].key == elements[i].key);
+    }
+    return prefix_columns.size();
+}
+
 Status MemTable::_sort_by_cluster_keys() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
@@ -354,10 +529,12 @@ Status MemTable::_sort_by_cluster_keys() {
     auto clone_block = in_block.clone_without_columns();
     _output_mutable_block = vectorized::MutableBlock::build_mutable_block(&clone_block);
 
-    DorisVector<std::shared_ptr<RowInBlock>> row_in_blocks;
+    DorisVector<RowInBlock> rows;
+    DorisVector<RowInBlock*> row_in_blocks;
+    rows.reserve(mutable_block.rows());
     row_in_blocks.reserve(mutable_block.rows());
     for (size_t i = 0; i < mutable_block.rows(); i++) {
-        row_in_blocks.emplace_back(std::make_shared<RowInBlock>(i));
+        row_in_blocks.emplace_back(&rows.emplace_back(i));
     }
     Tie tie = Tie(0, mutable_block.rows());
 
@@ -378,8 +555,9 @@ Status MemTable::_sort_by_cluster_keys() {
     while (iter.next()) {
         pdqsort(std::next(row_in_blocks.begin(), iter.left()),
                 std::next(row_in_blocks.begin(), iter.right()),
-                [](const std::shared_ptr<RowInBlock>& lhs, const std::shared_ptr<RowInBlock>& rhs)
-                        -> bool { return lhs->_row_pos < rhs->_row_pos; });
+                [](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
+                    return lhs->_row_pos < rhs->_row_pos;
+                });
     }
 
     in_block = mutable_block.to_block();
@@ -398,35 +576,36 @@ Status MemTable::_sort_by_cluster_keys() {
                                           row_pos_vec.data() + in_block.rows(), &column_offset);
 }
 
-void MemTable::_sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
+void MemTable::_sort_one_column(DorisVector<RowInBlock*>& row_in_blocks, Tie& tie,
                                 std::function<int(RowInBlock*, RowInBlock*)> cmp) {
     auto iter = tie.iter();
     while (iter.next()) {
         pdqsort(std::next(row_in_blocks.begin(), static_cast<int>(iter.left())),
                 std::next(row_in_blocks.begin(), static_cast<int>(iter.right())),
-                [&cmp](auto lhs, auto rhs) -> bool { return cmp(lhs.get(), rhs.get()) < 0; });
+                [&cmp](auto lhs, auto rhs) -> bool { return cmp(lhs, rhs) < 0; });
         tie[iter.left()] = 0;
         for (auto i = iter.left() + 1; i < iter.right(); i++) {
-            tie[i] = (cmp(row_in_blocks[i - 1].get(), row_in_blocks[i].get()) == 0);
+            tie[i] = (cmp(row_in_blocks[i - 1], row_in_blocks[i]) == 0);
         }
     }
 }
 
 template <bool is_final>
 void MemTable::_finalize_one_row(RowInBlock* row,
-                                 const vectorized::ColumnsWithTypeAndName& block_data,
-                                 int row_pos) {
+                                 const vectorized::ColumnsWithTypeAndName& block_data, int row_pos,
+                                 vectorized::MutableBlock& output_block,
+                                 vectorized::Arena& arena) {
     // move key columns
     for (size_t i = 0; i < _tablet_schema->num_key_columns(); ++i) {
-        _output_mutable_block.get_column_by_position(i)->insert_from(*block_data[i].column.get(),
-                                                                     row->_row_pos);
+        output_block.get_column_by_position(i)->insert_from(*block_data[i].column.get(),
+                                                            row->_row_pos);
     }
     if (row->has_init_agg()) {
         // get value columns from agg_places
         for (size_t i = _tablet_schema->num_key_columns(); i < _num_columns; ++i) {
             auto function = _agg_functions[i];
             auto* agg_place = row->agg_places(i);
-            auto* col_ptr = _output_mutable_block.get_column_by_position(i).get();
+            auto* col_ptr = output_block.get_column_by_position(i).get();
             function->insert_result_into(agg_place, *col_ptr);
 
             if constexpr (is_final) {
@@ -442,16 +621,16 @@ void MemTable::_finalize_one_row(RowInBlock* row,
             for (size_t i = _tablet_schema->num_key_columns(); i < _num_columns; ++i) {
                 auto function = _agg_functions[i];
                 auto* agg_place = row->agg_places(i);
-                auto* col_ptr = _output_mutable_block.get_column_by_position(i).get();
+                auto* col_ptr = output_block.get_column_by_position(i).get();
                 function->add(agg_place, const_cast<const doris::vectorized::IColumn**>(&col_ptr),
-                              row_pos, _arena);
+                              row_pos, arena);
             }
         }
     } else {
         // move columns for rows do not need agg
         for (size_t i = _tablet_schema->num_key_columns(); i < _num_columns; ++i) {
-            _output_mutable_block.get_column_by_position(i)->insert_from(
-                    *block_data[i].column.get(), row->_row_pos);
+            output_block.get_column_by_position(i)->insert_from(*block_data[i].column.get(),
+                                                                row->_row_pos);
         }
     }
     if constexpr (!is_final) {
@@ -459,15 +638,16 @@ void MemTable::_finalize_one_row(RowInBlock* row,
     }
 }
 
-void MemTable::_init_row_for_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block) {
-    row->init_agg_places(_arena.aligned_alloc(_total_size_of_aggregate_states, 16),
+void MemTable::_init_row_for_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block,
+                                 vectorized::Arena& arena) {
+    row->init_agg_places(arena.aligned_alloc(_total_size_of_aggregate_states, 16),
                          _offsets_of_aggregate_states.data());
     for (auto cid = _tablet_schema->num_key_columns(); cid < _num_columns; cid++) {
         auto* col_ptr = mutable_block.mutable_columns()[cid].get();
         auto* data = row->agg_places(cid);
         _agg_functions[cid]->create(data);
         _agg_functions[cid]->add(data, const_cast<const doris::vectorized::IColumn**>(&col_ptr),
-                                 row->_row_pos, _arena);
+                                 row->_row_pos, arena);
     }
 }
 void MemTable::_clear_row_agg(RowInBlock* row) {
@@ -490,35 +670,14 @@ void MemTable::_aggregate() {
             vectorized::MutableBlock::build_mutable_block(&in_block);
     _vec_row_comparator->set_block(&mutable_block);
     auto& block_data = in_block.get_columns_with_type_and_name();
-    DorisVector<std::shared_ptr<RowInBlock>> temp_row_in_blocks;
+    DorisVector<RowInBlock*> temp_row_in_blocks;
     temp_row_in_blocks.reserve(_last_sorted_pos);
     //only init agg if needed
 
     if constexpr (!has_skip_bitmap_col) {
-        RowInBlock* prev_row = nullptr;
-        int row_pos = -1;
-        for (const auto& cur_row_ptr : *_row_in_blocks) {
-            RowInBlock* cur_row = cur_row_ptr.get();
-            if (!temp_row_in_blocks.empty() && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
-                if (!prev_row->has_init_agg()) {
-                    _init_row_for_agg(prev_row, mutable_block);
-                }
-                _stat.merged_rows++;
-                _aggregate_two_row_in_block<has_skip_bitmap_col>(mutable_block, cur_row, prev_row);
-            } else {
-                prev_row = cur_row;
-                if (!temp_row_in_blocks.empty()) {
-                    // no more rows to merge for prev row, finalize it
-                    _finalize_one_row<is_final>(temp_row_in_blocks.back().get(), block_data,
-                                                row_pos);
-                }
-                temp_row_in_blocks.push_back(cur_row_ptr);
-                row_pos++;
-            }
-        }
-        if (!temp_row_in_blocks.empty()) {
-            // finalize the last low
-            _finalize_one_row<is_final>(temp_row_in_blocks.back().get(), block_data, row_pos);
+        if (!is_final || !_aggregate_in_parallel(in_block, mutable_block)) {
+            _aggregate_rows<is_final>(0, _row_in_blocks->size(), mutable_block, block_data,
+                                      _output_mutable_block, _arena, &temp_row_in_blocks);
         }
     } else {
         DCHECK(_delete_sign_col_idx != -1);
@@ -543,12 +702,141 @@ void MemTable::_aggregate() {
     }
 }
 
+template <bool is_final>
+void MemTable::_aggregate_rows(size_t begin, size_t end, vectorized::MutableBlock& mutable_block,
+                               const vectorized::ColumnsWithTypeAndName& block_data,
+                               vectorized::MutableBlock& output_block, vectorized::Arena& arena,
+                               DorisVector<RowInBlock*>* temp_row_in_blocks) {
+    RowInBlock* prev_row = nullptr;
+    int row_pos = -1;
+    for (size_t i = begin; i < end; ++i) {
+        RowInBlock* cur_row = (*_row_in_blocks)[i];
+        if (prev_row != nullptr && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
+            if (!prev_row->has_init_agg()) {
+                _init_row_for_agg(prev_row, mutable_block, arena);
+            }
+            _stat.merged_rows++;
+            _aggregate_two_row_in_block<false>(mutable_block, cur_row, prev_row, arena);
+        } else {
+            if (prev_row != nullptr) {
+                // no more rows to merge for prev row, finalize it
+                _finalize_one_row<is_final>(prev_row, block_data, row_pos, output_block, arena);
+            }
+            prev_row = cur_row;
+            if (temp_row_in_blocks != nullptr) {
+                temp_row_in_blocks->push_back(cur_row);
+            }
+            row_pos++;
+        }
+    }
+    if (prev_row != nullptr) {
+        // finalize the last low
+        _finalize_one_row<is_final>(prev_row, block_data, row_pos, output_block, arena);
+    }
+}
+
+bool MemTable::_aggregate_in_parallel(const vectorized::Block& in_block,
+                                      vectorized::MutableBlock& mutable_block) {
+    size_t num_rows = _row_in_blocks->size();
+    auto parallelism = static_cast<size_t>(std::max(1, config::memtable_agg_parallelism));
+    if (_agg_thread_pool == nullptr || parallelism <= 1 ||
+        num_rows < 2 * MIN_ROWS_PER_AGG_PARTITION) {
+        return false;
+    }
+    // split the sorted rows into ranges that never share a key, so that each range can be
+    // aggregated independently
+    size_t num_partitions = std::min(parallelism, num_rows / MIN_ROWS_PER_AGG_PARTITION);
+    std::vector<size_t> bounds {0};
+    for (size_t i = 1; i < num_partitions; ++i) {
+        size_t bound = std::max(bounds.back() + 1, num_rows * i / num_partitions);
+        while (bound < num_rows && (*_vec_row_comparator)((*_row_in_blocks)[bound - 1],
+                                                          (*_row_in_blocks)[bound]) == 0) {
+            ++bound;
+        }
+        if (bound >= num_rows) {
+            break;
+        }
+        bounds.push_back(bound);
+    }
+    bounds.push_back(num_rows);
+    num_partitions = bounds.size() - 1;
+    if (num_partitions <= 1) {
+        return false;
+    }
+
+    // The first range is written to _output_mutable_block with _arena, the others get their own
+    // output block and arena. The arenas are kept until the memtable is destroyed, so that the
+    // agg states of a failed flush can still be released in ~MemTable.
+    std::vector<vectorized::MutableBlock> outputs(num_partitions);
+    std::vector<vectorized::Arena*> arenas(num_partitions, &_arena);
+    for (size_t i = 1; i < num_partitions; ++i) {
+        auto empty_block = in_block.clone_empty();
+        outputs[i] = vectorized::MutableBlock::build_mutable_block(&empty_block);
+        arenas[i] = _agg_partition_arenas.emplace_back(std::make_unique<vectorized::Arena>()).get();
+    }
+
+    // A range is run by whoever claims it first. The flushing thread claims every range that
+    // no pool thread has started, so waiting for the pool can never deadlock even if the pool
+    // is fully occupied by other flush tasks.
+    struct ParallelAggState {
+        explicit ParallelAggState(size_t n) : claimed(n), latch(static_cast<int>(n)) {}
+        std::vector<std::atomic<bool>> claimed;
+        CountDownLatch latch;
+        std::mutex status_lock;
+        Status status;
+    };
+    auto state = std::make_shared<ParallelAggState>(num_partitions);
+    auto run_partition = [this, &mutable_block, &in_block, &bounds, &outputs, &arenas](
+                                 ParallelAggState& agg_state, size_t i) {
+        if (agg_state.claimed[i].exchange(true)) {
+            return;
+        }
+        Status st = [&]() -> Status {
+            RETURN_IF_CATCH_EXCEPTION(_aggregate_rows<true>(
+                    bounds[i], bounds[i + 1], mutable_block,
+                    in_block.get_columns_with_type_and_name(),
+                    i == 0 ? _output_mutable_block : outputs[i], *arenas[i], nullptr));
+            return Status::OK();
+        }();
+        if (!st.ok()) {
+            std::lock_guard<std::mutex> l(agg_state.status_lock);
+            agg_state.status.update(st);
+        }
+        agg_state.latch.count_down();
+    };
+    for (size_t i = 1; i < num_partitions; ++i) {
+        // if submit fails, the range is simply run by the flushing thread below
+        static_cast<void>(_agg_thread_pool->submit_func(
+                [state, run_partition, i, resource_ctx = _resource_ctx,
+                 mem_tracker = _mem_tracker]() {
+                    if (state->claimed[i].load()) {
+                        return;
+                    }
+                    SCOPED_ATTACH_TASK(resource_ctx);
+                    SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
+                            resource_ctx->memory_context()->mem_tracker()->write_tracker());
+                    SCOPED_CONSUME_MEM_TRACKER(mem_tracker);
+                    run_partition(*state, i);
+                }));
+    }
+    for (size_t i = 0; i < num_partitions; ++i) {
+        run_partition(*state, i);
+    }
+    state->latch.wait();
+    THROW_IF_ERROR(state->status);
+
+    for (size_t i = 1; i < num_partitions; ++i) {
+        THROW_IF_ERROR(_output_mutable_block.merge(outputs[i].to_block()));
+    }
+    return true;
+}
+
 template <bool is_final>
 void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
         const vectorized::ColumnsWithTypeAndName& block_data,
         vectorized::MutableBlock& mutable_block,
-        DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks) {
-    std::shared_ptr<RowInBlock> prev_row {nullptr};
+        DorisVector<RowInBlock*>& temp_row_in_blocks) {
+    RowInBlock* prev_row = nullptr;
     int row_pos = -1;
     auto& skip_bitmaps = assert_cast<vectorized::ColumnBitmap*>(
                                  mutable_block.mutable_columns()[_skip_bitmap_col_idx].get())
@@ -556,32 +844,33 @@ void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
     auto& delete_signs = assert_cast<vectorized::ColumnInt8*>(
                                  mutable_block.mutable_columns()[_delete_sign_col_idx].get())
                                  ->get_data();
-    std::shared_ptr<RowInBlock> row_with_delete_sign {nullptr};
-    std::shared_ptr<RowInBlock> row_without_delete_sign {nullptr};
+    RowInBlock* row_with_delete_sign = nullptr;
+    RowInBlock* row_without_delete_sign = nullptr;
 
     auto finalize_rows = [&]() {
         if (row_with_delete_sign != nullptr) {
             temp_row_in_blocks.push_back(row_with_delete_sign);
-            _finalize_one_row<is_final>(row_with_delete_sign.get(), block_data, ++row_pos);
+            _finalize_one_row<is_final>(row_with_delete_sign, block_data, ++row_pos,
+                                        _output_mutable_block, _arena);
             row_with_delete_sign = nullptr;
         }
         if (row_without_delete_sign != nullptr) {
             temp_row_in_blocks.push_back(row_without_delete_sign);
-            _finalize_one_row<is_final>(row_without_delete_sign.get(), block_data, ++row_pos);
+            _finalize_one_row<is_final>(row_without_delete_sign, block_data, ++row_pos,
+                                        _output_mutable_block, _arena);
             row_without_delete_sign = nullptr;
         }
         // _arena.clear();
     };
 
-    auto add_row = [&](std::shared_ptr<RowInBlock> row, bool with_delete_sign) {
+    auto add_row = [&](RowInBlock* row, bool with_delete_sign) {
         if (with_delete_sign) {
-            row_with_delete_sign = std::move(row);
+            row_with_delete_sign = row;
         } else {
-            row_without_delete_sign = std::move(row);
+            row_without_delete_sign = row;
         }
     };
-    for (const auto& cur_row_ptr : *_row_in_blocks) {
-        RowInBlock* cur_row = cur_row_ptr.get();
+    for (RowInBlock* cur_row : *_row_in_blocks) {
         const BitmapValue& skip_bitmap = skip_bitmaps[cur_row->_row_pos];
         bool cur_row_has_delete_sign = (!skip_bitmap.contains(_delete_sign_col_unique_id) &&
                                         delete_signs[cur_row->_row_pos] != 0);
@@ -589,11 +878,11 @@ void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
                 (row_with_delete_sign == nullptr) ? row_without_delete_sign : row_with_delete_sign;
         // compare keys, the keys of row_with_delete_sign and row_without_delete_sign is the same,
         // choose any of them if it's valid
-        if (prev_row != nullptr && (*_vec_row_comparator)(prev_row.get(), cur_row) == 0) {
+        if (prev_row != nullptr && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
             if (cur_row_has_delete_sign) {
                 if (row_without_delete_sign != nullptr) {
                     // if there exits row without delete sign, remove it first
-                    _clear_row_agg(row_without_delete_sign.get());
+                    _clear_row_agg(row_without_delete_sign);
                     _stat.merged_rows++;
                     row_without_delete_sign = nullptr;
                 }
@@ -604,17 +893,17 @@ void MemTable::_aggregate_for_flexible_partial_update_without_seq_col(
             }
 
             if (prev_row == nullptr) {
-                add_row(cur_row_ptr, cur_row_has_delete_sign);
+                add_row(cur_row, cur_row_has_delete_sign);
             } else {
                 if (!prev_row->has_init_agg()) {
-                    _init_row_for_agg(prev_row.get(), mutable_block);
+                    _init_row_for_agg(prev_row, mutable_block, _arena);
                 }
                 _stat.merged_rows++;
-                _aggregate_two_row_in_block<true>(mutable_block, cur_row, prev_row.get());
+                _aggregate_two_row_in_block<true>(mutable_block, cur_row, prev_row, _arena);
             }
         } else {
             finalize_rows();
-            add_row(cur_row_ptr, cur_row_has_delete_sign);
+            add_row(cur_row, cur_row_has_delete_sign);
         }
     }
     // finalize the last lows
@@ -625,14 +914,13 @@ template <bool is_final>
 void MemTable::_aggregate_for_flexible_partial_update_with_seq_col(
         const vectorized::ColumnsWithTypeAndName& block_data,
         vectorized::MutableBlock& mutable_block,
-        DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks) {
+        DorisVector<RowInBlock*>& temp_row_in_blocks) {
     // For flexible partial update, when table has sequence column, we don't do any aggregation
     // in memtable. These duplicate rows will be aggregated in VerticalSegmentWriter
     int row_pos = -1;
-    for (const auto& row_ptr : *_row_in_blocks) {
-        RowInBlock* row = row_ptr.get();
-        temp_row_in_blocks.push_back(row_ptr);
-        _finalize_one_row<is_final>(row, block_data, ++row_pos);
+    for (RowInBlock* row : *_row_in_blocks) {
+        temp_row_in_blocks.push_back(row);
+        _finalize_one_row<is_final>(row, block_data, ++row_pos, _output_mutable_block, _arena);
     }
 }
 
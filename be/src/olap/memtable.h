@@ -23,6 +23,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "common/status.h"
@@ -30,6 +31,7 @@
 #include "olap/tablet_schema.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/thread_context.h"
+#include "util/time.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/common/arena.h"
 #include "vec/common/custom_allocator.h"
@@ -39,6 +41,7 @@ namespace doris {
 
 class Schema;
 class SlotDescriptor;
+class ThreadPool;
 class TabletSchema;
 class TupleDescriptor;
 enum KeysType : int;
@@ -69,6 +72,8 @@ struct RowInBlock {
 
     inline void remove_init_agg() { _has_init_agg = false; }
 };
+// RowInBlock is allocated from MemTable::_row_arena and never destructed.
+static_assert(std::is_trivially_destructible_v<RowInBlock>);
 
 class Tie {
 public:
@@ -178,6 +183,8 @@ public:
 
     int64_t tablet_id() const { return _tablet_id; }
     size_t memory_usage() const { return _mem_tracker->consumption(); }
+    // time since this memtable was created
+    int64_t age_ns() const { return MonotonicNanos() - _create_time_ns; }
     size_t get_flush_reserve_memory_size() const;
     // insert tuple from (row_pos) to (row_pos+num_rows)
     Status insert(const vectorized::Block* block, const DorisVector<uint32_t>& row_idxs);
@@ -204,17 +211,25 @@ public:
 
     void update_mem_type(MemType memtype) { _mem_type = memtype; }
 
+    // The final aggregation may be split into key-disjoint ranges that run concurrently
+    // on this pool, at most config::memtable_agg_parallelism ranges per memtable.
+    void set_agg_thread_pool(ThreadPool* thread_pool) { _agg_thread_pool = thread_pool; }
+
 private:
     // for vectorized
     template <bool has_skip_bitmap_col>
     void _aggregate_two_row_in_block(vectorized::MutableBlock& mutable_block, RowInBlock* new_row,
-                                     RowInBlock* row_in_skiplist);
+                                     RowInBlock* row_in_skiplist, vectorized::Arena& arena);
 
     // Used to wrapped by to_block to do exception handle logic
     Status _to_block(std::unique_ptr<vectorized::Block>* res);
 
+    // true if row_idxs is an ascending run of consecutive rows
+    static bool _is_contiguous_rows(const DorisVector<uint32_t>& row_idxs);
+
 private:
     std::atomic<MemType> _mem_type;
+    int64_t _create_time_ns;
     int64_t _tablet_id;
     bool _enable_unique_key_mow = false;
     bool _is_flush_success = false;
@@ -231,6 +246,12 @@ private:
     // In this way, we can make MemTable::memory_usage() to be more accurate, and eventually
     // reduce the number of segment files that are generated by current load
     vectorized::Arena _arena;
+    // Holds the RowInBlock of every inserted row, so that inserting a batch of rows only
+    // needs one allocation and _row_in_blocks can point to them without reference counting.
+    vectorized::Arena _row_arena;
+    // Agg states of the ranges aggregated by _aggregate_in_parallel, except the first one.
+    std::vector<std::unique_ptr<vectorized::Arena>> _agg_partition_arenas;
+    ThreadPool* _agg_thread_pool = nullptr;
 
     void _init_columns_offset_by_slot_descs(const std::vector<SlotDescriptor*>* slot_descs,
                                             const TupleDescriptor* tuple_desc);
@@ -248,29 +269,45 @@ private:
 
     //return number of same keys
     size_t _sort();
+    // radix sort the new rows by the normalized prefix of the leading fixed-width key columns,
+    // return the number of key columns whose order is fully decided by the prefix
+    size_t _sort_by_key_prefix(Tie& tie);
     Status _sort_by_cluster_keys();
-    void _sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
+    void _sort_one_column(DorisVector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(RowInBlock*, RowInBlock*)> cmp);
     template <bool is_final>
     void _finalize_one_row(RowInBlock* row, const vectorized::ColumnsWithTypeAndName& block_data,
-                           int row_pos);
-    void _init_row_for_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block);
+                           int row_pos, vectorized::MutableBlock& output_block,
+                           vectorized::Arena& arena);
+    void _init_row_for_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block,
+                           vectorized::Arena& arena);
     void _clear_row_agg(RowInBlock* row);
 
     template <bool is_final, bool has_skip_bitmap_col = false>
     void _aggregate();
 
+    // aggregate the sorted rows in [begin, end) of _row_in_blocks into output_block
+    template <bool is_final>
+    void _aggregate_rows(size_t begin, size_t end, vectorized::MutableBlock& mutable_block,
+                         const vectorized::ColumnsWithTypeAndName& block_data,
+                         vectorized::MutableBlock& output_block, vectorized::Arena& arena,
+                         DorisVector<RowInBlock*>* temp_row_in_blocks);
+
+    // return false if the rows are too few to be worth aggregating in parallel
+    bool _aggregate_in_parallel(const vectorized::Block& in_block,
+                                vectorized::MutableBlock& mutable_block);
+
     template <bool is_final>
     void _aggregate_for_flexible_partial_update_without_seq_col(
             const vectorized::ColumnsWithTypeAndName& block_data,
             vectorized::MutableBlock& mutable_block,
-            DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks);
+            DorisVector<RowInBlock*>& temp_row_in_blocks);
 
     template <bool is_final>
     void _aggregate_for_flexible_partial_update_with_seq_col(
             const vectorized::ColumnsWithTypeAndName& block_data,
             vectorized::MutableBlock& mutable_block,
-            DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks);
+            DorisVector<RowInBlock*>& temp_row_in_blocks);
 
     Status _put_into_output(vectorized::Block& in_block);
     bool _is_first_insertion;
@@ -279,7 +316,7 @@ private:
     std::vector<vectorized::AggregateFunctionPtr> _agg_functions;
     std::vector<size_t> _offsets_of_aggregate_states;
     size_t _total_size_of_aggregate_states;
-    std::unique_ptr<DorisVector<std::shared_ptr<RowInBlock>>> _row_in_blocks;
+    std::unique_ptr<DorisVector<RowInBlock*>> _row_in_blocks;
 
     size_t _num_columns;
     int32_t _seq_col_idx_in_block {-1};
@@ -206,6 +206,7 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
             ExecEnv::GetInstance()->storage_engine().memtable_flush_executor()->dec_flushing_task();
         }};
         std::unique_ptr<vectorized::Block> block;
+        memtable->set_agg_thread_pool(_thread_pool);
         RETURN_IF_ERROR(memtable->to_block(&block));
         RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
         memtable->set_flush_success();
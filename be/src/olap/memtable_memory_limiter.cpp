@@ -19,6 +19,8 @@
 
 #include <bvar/bvar.h>
 
+#include <limits>
+
 #include "common/config.h"
 #include "olap/memtable.h"
 #include "olap/memtable_writer.h"
@@ -244,23 +246,35 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(uint64_t wg_id, int64_t n
         return 0;
     }
 
-    using WriterMem = std::pair<std::weak_ptr<MemTableWriter>, int64_t>;
-    auto cmp = [](WriterMem left, WriterMem right) { return left.second < right.second; };
+    struct WriterMem {
+        std::weak_ptr<MemTableWriter> writer;
+        int64_t mem;
+        std::tuple<int, int64_t> priority;
+    };
+    auto cmp = [](const WriterMem& left, const WriterMem& right) {
+        return left.priority < right.priority;
+    };
     std::priority_queue<WriterMem, std::vector<WriterMem>, decltype(cmp)> heap(cmp);
 
+    int64_t target_bytes = config::memtable_limiter_target_flush_bytes;
     for (auto writer : _active_writers) {
         auto w = writer.lock();
         if (w == nullptr) {
             continue;
         }
-        heap.emplace(w, w->active_memtable_mem_consumption());
+        int64_t mem = w->active_memtable_mem_consumption();
+        bool flush_queue_full = static_cast<int64_t>(w->flush_running_count()) >=
+                                config::memtable_flush_running_count_limit;
+        int64_t ingest_rate = target_bytes > 0 ? w->active_memtable_ingest_rate() : 0;
+        heap.push({w, mem, flush_priority(mem, ingest_rate, flush_queue_full, target_bytes)});
     }
 
     int64_t mem_flushed = 0;
     int64_t num_flushed = 0;
 
     while (mem_flushed < need_flush && !heap.empty()) {
-        auto [writer, sort_mem] = heap.top();
+        auto writer = heap.top().writer;
+        auto sort_mem = heap.top().mem;
         heap.pop();
         auto w = writer.lock();
         if (w == nullptr) {
@@ -294,6 +308,23 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(uint64_t wg_id, int64_t n
     return mem_flushed;
 }
 
+std::tuple<int, int64_t> MemTableMemoryLimiter::flush_priority(int64_t mem, int64_t ingest_rate,
+                                                              bool flush_queue_full,
+                                                              int64_t target_bytes) {
+    if (flush_queue_full) {
+        return {0, mem};
+    }
+    if (target_bytes <= 0 || mem >= target_bytes) {
+        return {2, mem};
+    }
+    if (ingest_rate <= 0) {
+        // not growing at all, it will hold the memory until the load finishes
+        return {1, std::numeric_limits<int64_t>::max()};
+    }
+    // milliseconds to reach the target size at the current ingest rate
+    return {1, (target_bytes - mem) * 1000 / ingest_rate};
+}
+
 void MemTableMemoryLimiter::refresh_mem_tracker() {
     std::lock_guard<std::mutex> l(_lock);
     _refresh_mem_tracker();
@@ -19,6 +19,8 @@
 
 #include <stdint.h>
 
+#include <tuple>
+
 #include "common/status.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/workload_group/workload_group.h"
@@ -53,6 +55,14 @@ public:
 
     int64_t mem_usage() const { return _mem_usage; }
 
+    // The order in which active memtables are flushed when the limit is reached, larger first.
+    // Without a target segment size, the largest memtable goes first. Otherwise memtables that
+    // already reached the target go first, then the ones that would take longest to reach it,
+    // so that fast growing memtables can still become large segments by themselves. Writers
+    // whose flush queue is full go last because another flush would only wait in the queue.
+    static std::tuple<int, int64_t> flush_priority(int64_t mem, int64_t ingest_rate,
+                                                   bool flush_queue_full, int64_t target_bytes);
+
 private:
     // check if the total mem consumption exceeds limit.
     // If yes, it will flush memtable to try to reduce memory consumption.
@@ -368,4 +368,13 @@ int64_t MemTableWriter::active_memtable_mem_consumption() {
     return _mem_table != nullptr ? _mem_table->memory_usage() : 0;
 }
 
+int64_t MemTableWriter::active_memtable_ingest_rate() {
+    std::lock_guard<std::mutex> l(_mem_table_ptr_lock);
+    if (_mem_table == nullptr) {
+        return 0;
+    }
+    int64_t age_ms = std::max<int64_t>(1, _mem_table->age_ns() / 1000 / 1000);
+    return static_cast<int64_t>(_mem_table->memory_usage()) * 1000 / age_ms;
+}
+
 } // namespace doris
@@ -84,6 +84,8 @@ public:
 
     int64_t mem_consumption(MemType mem);
     int64_t active_memtable_mem_consumption();
+    // bytes per second written into the active memtable since it was created
+    int64_t active_memtable_ingest_rate();
 
     // Submit current memtable to flush queue, and return without waiting.
     // This is currently for reducing mem consumption of this memtable writer.
@@ -23,6 +23,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -38,6 +40,7 @@
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/base_tablet.h"
+#include "olap/column_ndv_collector.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
@@ -52,7 +55,11 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/exec_env.h"
+#include "runtime/workload_management/io_throttle.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
@@ -60,6 +67,19 @@
 
 namespace doris {
 #include "common/compile_check_begin.h"
+// Waits for the I/O budget of the disk and charges the bytes `reader_stats` have read since
+// the last call.
+static void throttle_merge_io(IOThrottle* io_throttle, const OlapReaderStatistics& reader_stats,
+                              int64_t* charged_bytes) {
+    if (io_throttle == nullptr) {
+        return;
+    }
+    io_throttle->set_io_bytes_per_second(config::compaction_io_bytes_per_second_per_disk);
+    io_throttle->acquire(-1);
+    io_throttle->update_next_io_time(reader_stats.compressed_bytes_read - *charged_bytes);
+    *charged_bytes = reader_stats.compressed_bytes_read;
+}
+
 Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
                               const TabletSchema& cur_tablet_schema,
                               const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
@@ -109,6 +129,10 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
     vectorized::Block block = cur_tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
+    IOThrottle* io_throttle = stats_output != nullptr ? stats_output->io_throttle : nullptr;
+    ColumnNdvCollector* ndv_collector =
+            stats_output != nullptr ? stats_output->ndv_collector : nullptr;
+    int64_t charged_bytes = 0;
     while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
@@ -121,6 +145,10 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
+        throttle_merge_io(io_throttle, reader.stats(), &charged_bytes);
+        if (ndv_collector != nullptr) {
+            ndv_collector->add(reader_params.return_columns, block);
+        }
         RETURN_NOT_OK_STATUS_WITH_WARN(dst_rowset_writer->add_block(&block),
                                        "failed to write block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
@@ -240,18 +268,17 @@ void Merger::vertical_split_columns(const TabletSchema& tablet_schema,
     }
 }
 
-Status Merger::vertical_compact_one_group(
-        BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
-        bool is_key, const std::vector<uint32_t>& column_group,
-        vectorized::RowSourcesBuffer* row_source_buf,
-        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
-        RowsetWriter* dst_rowset_writer, uint32_t max_rows_per_segment, Statistics* stats_output,
-        std::vector<uint32_t> key_group_cluster_key_idxes, int64_t batch_size,
-        CompactionSampleInfo* sample_info) {
-    // build tablet reader
-    VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
-    vectorized::VerticalBlockReader reader(row_source_buf);
-    TabletReader::ReaderParams reader_params;
+// Inits `reader` to merge `column_group` of the source rowsets, `reader_params` must live as
+// long as `reader`.
+static Status init_group_reader(BaseTabletSPtr tablet, ReaderType reader_type,
+                                const TabletSchema& tablet_schema, bool is_key,
+                                const std::vector<uint32_t>& column_group,
+                                const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+                                RowsetWriter* dst_rowset_writer, Statistics* stats_output,
+                                std::vector<uint32_t> key_group_cluster_key_idxes,
+                                int64_t batch_size, CompactionSampleInfo* sample_info,
+                                TabletReader::ReaderParams& reader_params,
+                                vectorized::VerticalBlockReader& reader) {
     reader_params.is_key_column_group = is_key;
     reader_params.key_group_cluster_key_idxes = key_group_cluster_key_idxes;
     reader_params.tablet = tablet;
@@ -275,10 +302,8 @@ Status Merger::vertical_compact_one_group(
     }
 
     reader_params.tablet_schema = merge_tablet_schema;
-    bool has_cluster_key = false;
     if (!tablet->tablet_schema()->cluster_key_uids().empty()) {
         reader_params.delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
-        has_cluster_key = true;
     }
 
     if (is_key && stats_output && stats_output->rowid_conversion) {
@@ -290,11 +315,34 @@ Status Merger::vertical_compact_one_group(
     reader_params.return_columns = column_group;
     reader_params.origin_return_columns = &reader_params.return_columns;
     reader_params.batch_size = batch_size;
-    RETURN_IF_ERROR(reader.init(reader_params, sample_info));
+    return reader.init(reader_params, sample_info);
+}
+
+Status Merger::vertical_compact_one_group(
+        BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
+        bool is_key, const std::vector<uint32_t>& column_group,
+        vectorized::RowSourcesBuffer* row_source_buf,
+        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+        RowsetWriter* dst_rowset_writer, uint32_t max_rows_per_segment, Statistics* stats_output,
+        std::vector<uint32_t> key_group_cluster_key_idxes, int64_t batch_size,
+        CompactionSampleInfo* sample_info) {
+    // build tablet reader
+    VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
+    vectorized::VerticalBlockReader reader(row_source_buf);
+    TabletReader::ReaderParams reader_params;
+    RETURN_IF_ERROR(init_group_reader(tablet, reader_type, tablet_schema, is_key, column_group,
+                                      src_rowset_readers, dst_rowset_writer, stats_output,
+                                      key_group_cluster_key_idxes, batch_size, sample_info,
+                                      reader_params, reader));
+    bool has_cluster_key = !tablet->tablet_schema()->cluster_key_uids().empty();
 
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
+    IOThrottle* io_throttle = stats_output != nullptr ? stats_output->io_throttle : nullptr;
+    ColumnNdvCollector* ndv_collector =
+            stats_output != nullptr ? stats_output->ndv_collector : nullptr;
+    int64_t charged_bytes = 0;
     while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
@@ -306,6 +354,10 @@ Status Merger::vertical_compact_one_group(
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
+        throttle_merge_io(io_throttle, reader.stats(), &charged_bytes);
+        if (ndv_collector != nullptr) {
+            ndv_collector->add(reader_params.return_columns, block);
+        }
         RETURN_NOT_OK_STATUS_WITH_WARN(
                 dst_rowset_writer->add_columns(&block, column_group, is_key, max_rows_per_segment,
                                                has_cluster_key),
@@ -457,6 +509,237 @@ int64_t estimate_batch_size(int group_index, BaseTabletSPtr tablet, int64_t way_
     return res;
 }
 
+namespace {
+// A value column group merged by a pool thread ahead of the compaction thread, which writes
+// the merged blocks once it has written all groups before this one. Whoever claims the group
+// first merges it, so the compaction thread merges the group itself if no pool thread has
+// started it, and never waits for a busy pool.
+class ValueGroupMerge {
+public:
+    // At most this many merged blocks wait to be written, the merge pauses until they are.
+    static constexpr size_t MAX_BUFFERED_BLOCKS = 2;
+
+    bool claim(bool by_pool) {
+        std::lock_guard l(_lock);
+        if (_claimed) {
+            return false;
+        }
+        _claimed = true;
+        _merged_by_pool = by_pool;
+        return true;
+    }
+
+    // Returns false if the compaction is cancelled.
+    bool push(vectorized::Block&& block) {
+        std::unique_lock l(_lock);
+        _cond.wait(l, [this]() { return _cancelled || _blocks.size() < MAX_BUFFERED_BLOCKS; });
+        if (_cancelled) {
+            return false;
+        }
+        _blocks.push_back(std::move(block));
+        _cond.notify_all();
+        return true;
+    }
+
+    void finish(Status st) {
+        std::lock_guard l(_lock);
+        _status = std::move(st);
+        _finished = true;
+        _cond.notify_all();
+    }
+
+    // Sets `*eof` and returns the status of the merge after the last block.
+    Status pop(vectorized::Block* block, bool* eof) {
+        std::unique_lock l(_lock);
+        _cond.wait(l, [this]() { return !_blocks.empty() || _finished; });
+        if (!_blocks.empty()) {
+            *block = std::move(_blocks.front());
+            _blocks.pop_front();
+            *eof = false;
+            _cond.notify_all();
+            return Status::OK();
+        }
+        *eof = true;
+        return _status;
+    }
+
+    // Makes sure the group is not merged any more when this returns.
+    void cancel_and_wait() {
+        std::unique_lock l(_lock);
+        _cancelled = true;
+        _cond.notify_all();
+        if (!_claimed) {
+            _claimed = true;
+            return;
+        }
+        _cond.wait(l, [this]() { return !_merged_by_pool || _finished; });
+    }
+
+    // Owned copies, the compaction thread keeps using the original ones.
+    std::unique_ptr<vectorized::RowSourcesBuffer> row_sources;
+    std::vector<RowsetReaderSharedPtr> rs_readers;
+    int64_t batch_size = 0;
+    IOThrottle* io_throttle = nullptr;
+    ColumnNdvCollector* ndv_collector = nullptr;
+    CompactionSampleInfo sample_info {0, 0, 0};
+
+private:
+    std::mutex _lock;
+    std::condition_variable _cond;
+    std::deque<vectorized::Block> _blocks;
+    bool _claimed = false;
+    bool _merged_by_pool = false;
+    bool _finished = false;
+    bool _cancelled = false;
+    Status _status;
+};
+} // namespace
+
+static Status merge_value_group(BaseTabletSPtr tablet, ReaderType reader_type,
+                                const TabletSchema& tablet_schema,
+                                const std::vector<uint32_t>& column_group,
+                                RowsetWriter* dst_rowset_writer, ValueGroupMerge* merge) {
+    vectorized::VerticalBlockReader reader(merge->row_sources.get());
+    TabletReader::ReaderParams reader_params;
+    RETURN_IF_ERROR(init_group_reader(tablet, reader_type, tablet_schema, false, column_group,
+                                      merge->rs_readers, dst_rowset_writer, nullptr, {},
+                                      merge->batch_size, &merge->sample_info, reader_params,
+                                      reader));
+    bool eof = false;
+    int64_t charged_bytes = 0;
+    while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
+        auto tablet_state = tablet->tablet_state();
+        if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
+            tablet->clear_cache();
+            return Status::Error<INTERNAL_ERROR>("tablet {} is not used any more",
+                                                 tablet->tablet_id());
+        }
+        vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
+        RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
+                                       "failed to read next block when merging rowsets of tablet " +
+                                               std::to_string(tablet->tablet_id()));
+        throttle_merge_io(merge->io_throttle, reader.stats(), &charged_bytes);
+        if (merge->ndv_collector != nullptr) {
+            merge->ndv_collector->add(reader_params.return_columns, block);
+        }
+        if (block.rows() > 0 && !merge->push(std::move(block))) {
+            return Status::Cancelled("vertical compaction of tablet {} is cancelled",
+                                     tablet->tablet_id());
+        }
+    }
+    if (ExecEnv::GetInstance()->storage_engine().stopped()) {
+        return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
+                                             tablet->tablet_id());
+    }
+    return Status::OK();
+}
+
+static Status write_merged_value_group(BaseTabletSPtr tablet,
+                                       const std::vector<uint32_t>& column_group,
+                                       RowsetWriter* dst_rowset_writer,
+                                       uint32_t max_rows_per_segment, ValueGroupMerge* merge) {
+    bool has_cluster_key = !tablet->tablet_schema()->cluster_key_uids().empty();
+    while (true) {
+        vectorized::Block block;
+        bool eof = false;
+        RETURN_IF_ERROR(merge->pop(&block, &eof));
+        if (eof) {
+            break;
+        }
+        RETURN_NOT_OK_STATUS_WITH_WARN(
+                dst_rowset_writer->add_columns(&block, column_group, false, max_rows_per_segment,
+                                               has_cluster_key),
+                "failed to write block when merging rowsets of tablet " +
+                        std::to_string(tablet->tablet_id()));
+    }
+    return dst_rowset_writer->flush_columns(false);
+}
+
+// Merges the value column groups after the key group, up to `parallelism` of them at the same
+// time. The segments are written group by group as in the serial merge, only the merging of
+// the next groups runs ahead on the pool.
+static Status vertical_merge_value_groups(
+        BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
+        const std::vector<std::vector<uint32_t>>& column_groups,
+        vectorized::RowSourcesBuffer* row_sources_buf,
+        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+        RowsetWriter* dst_rowset_writer, uint32_t max_rows_per_segment, int64_t merge_way_num,
+        Statistics* stats_output, const std::vector<uint32_t>& key_group_cluster_key_idxes,
+        size_t parallelism, ThreadPool* pool) {
+    auto group_batch_size = [&](size_t i) {
+        return config::compaction_batch_size != -1
+                       ? config::compaction_batch_size
+                       : estimate_batch_size(cast_set<int>(i), tablet, merge_way_num);
+    };
+    // Every group merged ahead holds a copy of the row sources if they are kept in memory.
+    size_t row_sources_bytes = row_sources_buf->buffered_size() * sizeof(uint16_t);
+    if (row_sources_bytes > 0) {
+        size_t budget = config::compaction_memory_bytes_limit / 4;
+        parallelism = std::clamp<size_t>(budget / row_sources_bytes + 1, 1, parallelism);
+    }
+    std::vector<std::shared_ptr<ValueGroupMerge>> merges(column_groups.size());
+    Defer defer {[&]() {
+        for (auto& merge : merges) {
+            if (merge != nullptr) {
+                merge->cancel_and_wait();
+            }
+        }
+    }};
+    // The first value group is merged by the compaction thread, the next `parallelism - 1`
+    // groups are merged ahead on the pool.
+    size_t next_to_submit = 2;
+    for (size_t i = 1; i < column_groups.size(); ++i) {
+        for (; next_to_submit < column_groups.size() && next_to_submit < i + parallelism;
+             ++next_to_submit) {
+            auto merge = std::make_shared<ValueGroupMerge>();
+            RETURN_IF_ERROR(row_sources_buf->clone(&merge->row_sources));
+            for (const auto& rs_reader : src_rowset_readers) {
+                merge->rs_readers.push_back(rs_reader->clone());
+            }
+            merge->batch_size = group_batch_size(next_to_submit);
+            merge->io_throttle = stats_output != nullptr ? stats_output->io_throttle : nullptr;
+            merge->ndv_collector = stats_output != nullptr ? stats_output->ndv_collector : nullptr;
+            merges[next_to_submit] = merge;
+            const auto& column_group = column_groups[next_to_submit];
+            // if submit fails, the group is merged by the compaction thread below
+            static_cast<void>(pool->submit_func([merge, tablet, reader_type, &tablet_schema,
+                                                 &column_group, dst_rowset_writer]() {
+                if (!merge->claim(true)) {
+                    return;
+                }
+                merge->finish(merge_value_group(tablet, reader_type, tablet_schema, column_group,
+                                                dst_rowset_writer, merge.get()));
+            }));
+        }
+
+        auto& merge = merges[i];
+        CompactionSampleInfo sample_info;
+        Status st;
+        if (merge == nullptr || merge->claim(false)) {
+            st = Merger::vertical_compact_one_group(
+                    tablet, reader_type, tablet_schema, false, column_groups[i], row_sources_buf,
+                    src_rowset_readers, dst_rowset_writer, max_rows_per_segment, stats_output,
+                    key_group_cluster_key_idxes, group_batch_size(i), &sample_info);
+            if (st.ok()) {
+                st = row_sources_buf->seek_to_begin();
+            }
+        } else {
+            st = write_merged_value_group(tablet, column_groups[i], dst_rowset_writer,
+                                          max_rows_per_segment, merge.get());
+            merge->cancel_and_wait();
+            sample_info = merge->sample_info;
+        }
+        // release the copies of the row sources as soon as the group is done
+        merges[i].reset();
+        {
+            std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
+            tablet->sample_infos[i] = sample_info;
+        }
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 // steps to do vertical merge:
 // 1. split columns into column groups
 // 2. compact groups one by one, generate a row_source_buf when compact key group
@@ -479,6 +762,13 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
         std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
         tablet->sample_infos.resize(column_groups.size(), {0, 0, 0});
     }
+    ThreadPool* pool = ExecEnv::GetInstance()->vertical_compaction_thread_pool();
+    size_t parallelism = 1;
+    if (pool != nullptr && column_groups.size() > 2) {
+        parallelism = std::min<size_t>(
+                std::max(config::vertical_compaction_value_group_parallelism, 1),
+                column_groups.size() - 1);
+    }
     // compact group one by one
     for (auto i = 0; i < column_groups.size(); ++i) {
         VLOG_NOTICE << "row source size: " << row_sources_buf.total_size();
@@ -500,6 +790,13 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
             RETURN_IF_ERROR(row_sources_buf.flush());
         }
         RETURN_IF_ERROR(row_sources_buf.seek_to_begin());
+        if (is_key && parallelism > 1) {
+            RETURN_IF_ERROR(vertical_merge_value_groups(
+                    tablet, reader_type, tablet_schema, column_groups, &row_sources_buf,
+                    src_rowset_readers, dst_rowset_writer, max_rows_per_segment, merge_way_num,
+                    stats_output, key_group_cluster_key_idxes, parallelism, pool));
+            break;
+        }
     }
 
     // finish compact, build output rowset
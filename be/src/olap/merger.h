@@ -27,6 +27,8 @@
 #include "olap/tablet_fwd.h"
 
 namespace doris {
+class ColumnNdvCollector;
+class IOThrottle;
 class KeyBoundsPB;
 class RowIdConversion;
 class RowsetWriter;
@@ -54,6 +56,10 @@ public:
         int64_t cached_bytes_total = 0;
         int64_t bytes_read_from_local = 0;
         int64_t bytes_read_from_remote = 0;
+        // limits the bytes read from the source rowsets per second, nullptr for no limit
+        IOThrottle* io_throttle = nullptr;
+        // collects the NDV of the merged columns if not nullptr
+        ColumnNdvCollector* ndv_collector = nullptr;
     };
 
     // merge rows from `src_rowset_readers` and write into `dst_rowset_writer`.
@@ -20,6 +20,7 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <glog/logging.h>
 
+#include <cstring>
 #include <ostream>
 
 #include "runtime/exec_env.h"
@@ -38,6 +39,11 @@ MemoryTrackedPageBase<T>::MemoryTrackedPageBase(size_t size, bool use_cache,
     }
 }
 
+template <typename T>
+MemoryTrackedPageBase<T>::MemoryTrackedPageBase(size_t size,
+                                                std::shared_ptr<MemTrackerLimiter> mem_tracker)
+        : _size(size), _mem_tracker_by_allocator(std::move(mem_tracker)) {}
+
 MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(size_t size, bool use_cache,
                                                                  segment_v2::PageTypePB page_type)
         : MemoryTrackedPageBase<char*>(size, use_cache, page_type), _capacity(size) {
@@ -48,6 +54,16 @@ MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(size_t size, bo
     }
 }
 
+MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(
+        size_t size, std::shared_ptr<MemTrackerLimiter> mem_tracker)
+        : MemoryTrackedPageBase<char*>(size, std::move(mem_tracker)), _capacity(size) {
+    {
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(this->_mem_tracker_by_allocator);
+        this->_data = reinterpret_cast<char*>(
+                Allocator<false>::alloc(this->_capacity, ALLOCATOR_ALIGNMENT_16));
+    }
+}
+
 MemoryTrackedPageWithPageEntity::~MemoryTrackedPageWithPageEntity() {
     if (this->_data != nullptr) {
         DCHECK(this->_capacity != 0 && this->_size != 0);
@@ -74,14 +90,36 @@ MemoryTrackedPageWithPagePtr<T>::~MemoryTrackedPageWithPagePtr() {
 StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
                                                         int32_t index_cache_percentage,
                                                         int64_t pk_index_cache_capacity,
-                                                        uint32_t num_shards) {
+                                                        uint32_t num_shards,
+                                                        int32_t compressed_cache_percentage,
+                                                        int32_t row_store_cache_percentage) {
     return new StoragePageCache(capacity, index_cache_percentage, pk_index_cache_capacity,
-                                num_shards);
+                                num_shards, compressed_cache_percentage,
+                                row_store_cache_percentage);
 }
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                                   int64_t pk_index_cache_capacity, uint32_t num_shards)
+                                   int64_t pk_index_cache_capacity, uint32_t num_shards,
+                                   int32_t compressed_cache_percentage,
+                                   int32_t row_store_cache_percentage)
         : _index_cache_percentage(index_cache_percentage) {
+    CHECK(compressed_cache_percentage >= 0 && compressed_cache_percentage < 100)
+            << "invalid compressed page cache percentage";
+    CHECK(row_store_cache_percentage >= 0 &&
+          compressed_cache_percentage + row_store_cache_percentage < 100)
+            << "invalid row store page cache percentage";
+    size_t origin_capacity = capacity;
+    if (row_store_cache_percentage > 0) {
+        size_t row_store_capacity = origin_capacity * row_store_cache_percentage / 100;
+        _row_store_page_cache = std::make_unique<RowStorePageCache>(row_store_capacity, num_shards);
+        capacity -= row_store_capacity;
+    }
+    if (compressed_cache_percentage > 0) {
+        size_t compressed_capacity = origin_capacity * compressed_cache_percentage / 100;
+        _compressed_page_cache =
+                std::make_unique<CompressedPageCache>(compressed_capacity, num_shards);
+        capacity -= compressed_capacity;
+    }
     if (index_cache_percentage == 0) {
         _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
     } else if (index_cache_percentage == 100) {
@@ -99,8 +137,8 @@ StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percenta
 }
 
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
-                              segment_v2::PageTypePB page_type) {
-    auto* cache = _get_page_cache(page_type);
+                              segment_v2::PageTypePB page_type, bool row_store) {
+    auto* cache = _get_page_cache(page_type, row_store);
     auto* lru_handle = cache->lookup(key.encode());
     if (lru_handle == nullptr) {
         return false;
@@ -110,18 +148,45 @@ bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
 }
 
 void StoragePageCache::insert(const CacheKey& key, DataPage* data, PageCacheHandle* handle,
-                              segment_v2::PageTypePB page_type, bool in_memory) {
+                              segment_v2::PageTypePB page_type, bool in_memory,
+                              bool row_store) {
     CachePriority priority = CachePriority::NORMAL;
     if (in_memory) {
         priority = CachePriority::DURABLE;
     }
 
-    auto* cache = _get_page_cache(page_type);
+    auto* cache = _get_page_cache(page_type, row_store);
     auto* lru_handle = cache->insert(key.encode(), data, data->capacity(), 0, priority);
     DCHECK(lru_handle != nullptr);
     *handle = PageCacheHandle(cache, lru_handle);
 }
 
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle) {
+    if (_compressed_page_cache == nullptr) {
+        return false;
+    }
+    auto* lru_handle = _compressed_page_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_compressed_page_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, const Slice& data) {
+    if (_compressed_page_cache == nullptr) {
+        return;
+    }
+    auto page = std::make_unique<DataPage>(data.size, _compressed_page_cache->mem_tracker());
+    memcpy(page->data(), data.data, data.size);
+    auto* lru_handle =
+            _compressed_page_cache->insert(key.encode(), page.get(), page->capacity(), 0);
+    DCHECK(lru_handle != nullptr);
+    _compressed_page_cache->release(lru_handle);
+    // Now page is managed by the compressed page cache.
+    page.release();
+}
+
 template <typename T>
 void StoragePageCache::insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type, bool in_memory) {
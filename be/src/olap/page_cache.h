@@ -42,6 +42,7 @@ class MemoryTrackedPageBase : public LRUCacheValueBase {
 public:
     MemoryTrackedPageBase() = default;
     MemoryTrackedPageBase(size_t b, bool use_cache, segment_v2::PageTypePB page_type);
+    MemoryTrackedPageBase(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker);
 
     MemoryTrackedPageBase(const MemoryTrackedPageBase&) = delete;
     MemoryTrackedPageBase& operator=(const MemoryTrackedPageBase&) = delete;
@@ -59,6 +60,7 @@ protected:
 class MemoryTrackedPageWithPageEntity : Allocator<false>, public MemoryTrackedPageBase<char*> {
 public:
     MemoryTrackedPageWithPageEntity(size_t b, bool use_cache, segment_v2::PageTypePB page_type);
+    MemoryTrackedPageWithPageEntity(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker);
 
     size_t capacity() { return this->_capacity; }
 
@@ -138,19 +140,43 @@ public:
                                  config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {}
     };
 
+    // Keeps pages as they are read from the file, before decompression, so that a page evicted
+    // from the caches of decompressed pages is decompressed from memory instead of read again.
+    class CompressedPageCache : public LRUCachePolicy {
+    public:
+        CompressedPageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::COMPRESSED_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
+                                 num_shards) {}
+    };
+
+    // Keeps the data pages of the row store column, which are read by point queries, apart from
+    // the data pages read by scans.
+    class RowStorePageCache : public LRUCachePolicy {
+    public:
+        RowStorePageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::ROW_STORE_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
+                                 num_shards) {}
+    };
+
     static constexpr uint32_t kDefaultNumShards = 16;
 
     // Create global instance of this class
     static StoragePageCache* create_global_cache(size_t capacity, int32_t index_cache_percentage,
                                                  int64_t pk_index_cache_capacity,
-                                                 uint32_t num_shards = kDefaultNumShards);
+                                                 uint32_t num_shards = kDefaultNumShards,
+                                                 int32_t compressed_cache_percentage = 0,
+                                                 int32_t row_store_cache_percentage = 0);
 
     // Return global instance.
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return ExecEnv::GetInstance()->get_storage_page_cache(); }
 
     StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                     int64_t pk_index_cache_capacity, uint32_t num_shards);
+                     int64_t pk_index_cache_capacity, uint32_t num_shards,
+                     int32_t compressed_cache_percentage = 0,
+                     int32_t row_store_cache_percentage = 0);
 
     // Lookup the given page in the cache.
     //
@@ -158,10 +184,12 @@ public:
     // PageCacheHandle will release cache entry to cache when it
     // destructs.
     //
-    // Cache type selection is determined by page_type argument
+    // Cache type selection is determined by page_type argument, data pages of the row store
+    // column are looked up in the row store page cache if it is enabled.
     //
     // Return true if entry is found, otherwise return false.
-    bool lookup(const CacheKey& key, PageCacheHandle* handle, segment_v2::PageTypePB page_type);
+    bool lookup(const CacheKey& key, PageCacheHandle* handle, segment_v2::PageTypePB page_type,
+                bool row_store = false);
 
     // Insert a page with key into this cache.
     // Given handle will be set to valid reference.
@@ -169,7 +197,7 @@ public:
     // concurrently, this function can assure that only one page is cached.
     // The in_memory page will have higher priority.
     void insert(const CacheKey& key, DataPage* data, PageCacheHandle* handle,
-                segment_v2::PageTypePB page_type, bool in_memory = false);
+                segment_v2::PageTypePB page_type, bool in_memory = false, bool row_store = false);
 
     // Insert a std::share_ptr which points to a page into this cache.
     // size should be the size of the page instead of shared_ptr.
@@ -182,8 +210,16 @@ public:
     void insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                 segment_v2::PageTypePB page_type, bool in_memory = false);
 
-    std::shared_ptr<MemTrackerLimiter> mem_tracker(segment_v2::PageTypePB page_type) {
-        return _get_page_cache(page_type)->mem_tracker();
+    // Lookup the compressed page of the given key, as it was read from the file.
+    // Return false if the compressed page cache is disabled or the page is not found.
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle);
+
+    // Insert a copy of the compressed page `data` into the compressed page cache, if enabled.
+    void insert_compressed(const CacheKey& key, const Slice& data);
+
+    std::shared_ptr<MemTrackerLimiter> mem_tracker(segment_v2::PageTypePB page_type,
+                                                   bool row_store = false) {
+        return _get_page_cache(page_type, row_store)->mem_tracker();
     }
 
 private:
@@ -196,8 +232,15 @@ private:
     // page cache to make it for flexible. we need this cache When construct
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
-
-    LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
+    // Second tier of the data and index page caches, null if disabled.
+    std::unique_ptr<CompressedPageCache> _compressed_page_cache;
+    // Data pages of the row store column, null if they are kept in the data page cache.
+    std::unique_ptr<RowStorePageCache> _row_store_page_cache;
+
+    LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type, bool row_store = false) {
+        if (row_store && page_type == segment_v2::DATA_PAGE && _row_store_page_cache != nullptr) {
+            return _row_store_page_cache.get();
+        }
         switch (page_type) {
         case segment_v2::DATA_PAGE: {
             return _data_page_cache.get();
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/primary_key_mem_index.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string_view>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "olap/primary_key_index.h"
+#include "olap/rowset/beta_rowset.h"
+#include "olap/rowset/rowset.h"
+#include "olap/rowset/segment_v2/indexed_column_reader.h"
+#include "olap/segment_loader.h"
+#include "olap/tablet_schema.h"
+#include "vec/data_types/data_type_factory.hpp"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+void PrimaryKeyMemIndex::prune(const Slice& key_without_seq,
+                               const std::vector<RowsetSharedPtr>& rowsets,
+                               std::vector<bool>* skip) {
+    std::vector<RowsetSharedPtr> to_index;
+    {
+        std::shared_lock l(_lock);
+        for (const auto& rowset : rowsets) {
+            if (_should_index(*rowset)) {
+                to_index.push_back(rowset);
+            }
+        }
+    }
+    for (const auto& rowset : to_index) {
+        // the rowset is looked up from its segments then
+        Status st = _add_rowset(rowset);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to index primary keys of rowset " << rowset->rowset_id().to_string()
+                         << " in memory: " << st;
+        }
+    }
+
+    skip->assign(rowsets.size(), false);
+    std::shared_lock l(_lock);
+    if (_rowsets.empty()) {
+        return;
+    }
+    auto it = _keys.find(std::string_view(key_without_seq.data, key_without_seq.size));
+    for (size_t i = 0; i < rowsets.size(); ++i) {
+        const auto& rowset_id = rowsets[i]->rowset_id();
+        if (!_rowsets.contains(rowset_id)) {
+            continue;
+        }
+        (*skip)[i] = it == _keys.end() ||
+                     std::find(it->second.begin(), it->second.end(), rowset_id) == it->second.end();
+    }
+}
+
+void PrimaryKeyMemIndex::remove_rowsets(const std::vector<RowsetSharedPtr>& rowsets) {
+    std::lock_guard l(_lock);
+    if (_removed_rowsets.size() > 1024) {
+        _removed_rowsets.clear();
+    }
+    for (const auto& rowset : rowsets) {
+        _removed_rowsets.insert(rowset->rowset_id());
+        auto it = _rowsets.find(rowset->rowset_id());
+        if (it == _rowsets.end()) {
+            continue;
+        }
+        _num_removed_entries += it->second;
+        _rowsets.erase(it);
+    }
+    if (_num_removed_entries > _num_entries / 2) {
+        _compact();
+    }
+}
+
+size_t PrimaryKeyMemIndex::num_keys() const {
+    std::shared_lock l(_lock);
+    return _num_entries - _num_removed_entries;
+}
+
+bool PrimaryKeyMemIndex::_should_index(const Rowset& rowset) const {
+    auto num_rows = static_cast<int64_t>(rowset.num_rows());
+    if (num_rows > config::pk_mem_index_max_rowset_rows) {
+        return false;
+    }
+    if (static_cast<int64_t>(_num_entries - _num_removed_entries) + num_rows >
+        config::pk_mem_index_max_keys_per_tablet) {
+        return false;
+    }
+    const auto& rowset_id = rowset.rowset_id();
+    return !_rowsets.contains(rowset_id) && !_removed_rowsets.contains(rowset_id);
+}
+
+Status PrimaryKeyMemIndex::_add_rowset(const RowsetSharedPtr& rowset) {
+    SegmentCacheHandle segment_cache;
+    RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(
+            std::static_pointer_cast<BetaRowset>(rowset), &segment_cache, true, true));
+    // the keys in the primary key index end with the sequence column and the row id
+    const auto& schema = rowset->tablet_schema();
+    size_t suffix_length = 0;
+    if (schema->has_sequence_col()) {
+        suffix_length += schema->column(schema->sequence_col_idx()).length() + 1;
+    }
+    if (!schema->cluster_key_uids().empty()) {
+        suffix_length += PrimaryKeyIndexReader::ROW_ID_LENGTH;
+    }
+
+    std::vector<std::string> keys;
+    keys.reserve(rowset->num_rows());
+    for (const auto& segment : segment_cache.get_segments()) {
+        RETURN_IF_ERROR(segment->load_pk_index_and_bf(nullptr));
+        const auto* pk_idx = segment->get_primary_key_index();
+        if (pk_idx == nullptr) {
+            return Status::NotSupported("segment {} of rowset {} has no primary key index",
+                                        segment->id(), rowset->rowset_id().to_string());
+        }
+        size_t remaining = pk_idx->num_rows();
+        if (remaining == 0) {
+            continue;
+        }
+        std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
+        RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
+        Slice min_key;
+        bool exact_match = false;
+        RETURN_IF_ERROR(iter->seek_at_or_after(&min_key, &exact_match));
+        auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+                pk_idx->type_info()->type(), 1, 0);
+        while (remaining > 0) {
+            auto index_column = index_type->create_column();
+            size_t num_read = std::min<size_t>(remaining, 1024);
+            RETURN_IF_ERROR(iter->next_batch(&num_read, index_column));
+            if (num_read == 0) {
+                return Status::InternalError("primary key index of segment {} ends early",
+                                             segment->id());
+            }
+            for (size_t i = 0; i < num_read; ++i) {
+                auto key = index_column->get_data_at(i);
+                DCHECK_GE(key.size, suffix_length);
+                keys.emplace_back(key.data, key.size - suffix_length);
+            }
+            remaining -= num_read;
+        }
+    }
+
+    std::lock_guard l(_lock);
+    const auto& rowset_id = rowset->rowset_id();
+    if (_rowsets.contains(rowset_id) || _removed_rowsets.contains(rowset_id)) {
+        // indexed by another lookup at the same time, or compacted
+        return Status::OK();
+    }
+    size_t num_entries = 0;
+    for (auto& key : keys) {
+        auto& rowset_ids = _keys[std::move(key)];
+        // the segments of a rowset may have the same key
+        if (rowset_ids.empty() || rowset_ids.back() != rowset_id) {
+            rowset_ids.push_back(rowset_id);
+            ++num_entries;
+        }
+    }
+    _rowsets.emplace(rowset_id, num_entries);
+    _num_entries += num_entries;
+    return Status::OK();
+}
+
+void PrimaryKeyMemIndex::_compact() {
+    for (auto it = _keys.begin(); it != _keys.end();) {
+        auto& rowset_ids = it->second;
+        std::erase_if(rowset_ids,
+                      [this](const RowsetId& rowset_id) { return !_rowsets.contains(rowset_id); });
+        if (rowset_ids.empty()) {
+            _keys.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    _num_entries -= _num_removed_entries;
+    _num_removed_entries = 0;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
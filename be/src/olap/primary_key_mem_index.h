@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <parallel_hashmap/phmap.h>
+
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/rowset_fwd.h"
+#include "util/slice.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Primary keys of the small rowsets of a merge-on-write tablet, kept in memory.
+// Frequent tiny loads leave many small rowsets, and a key lookup probes the key bounds, bloom
+// filter and primary key index of each of them. The index tells with one probe which of the
+// indexed rowsets have the key, so the lookup only opens the segments of those.
+class PrimaryKeyMemIndex {
+public:
+    // Sets `(*skip)[i]` if `rowsets[i]` is indexed and does not have `key_without_seq`.
+    // Indexes the small rowsets in `rowsets` first if they fit in the budget, a rowset that
+    // fails to be indexed is not skipped.
+    void prune(const Slice& key_without_seq, const std::vector<RowsetSharedPtr>& rowsets,
+               std::vector<bool>* skip);
+
+    // Drops the keys of rowsets that are not visible any more.
+    void remove_rowsets(const std::vector<RowsetSharedPtr>& rowsets);
+
+    size_t num_keys() const;
+
+private:
+    bool _should_index(const Rowset& rowset) const;
+    Status _add_rowset(const RowsetSharedPtr& rowset);
+    // Removes the entries of removed rowsets, must hold `_lock`.
+    void _compact();
+
+    mutable std::shared_mutex _lock;
+    // key without sequence column and row id -> the indexed rowsets that have it
+    phmap::flat_hash_map<std::string, std::vector<RowsetId>> _keys;
+    // indexed rowset -> number of its keys
+    std::unordered_map<RowsetId, size_t> _rowsets;
+    // recently removed rowsets, lookups that started before may still pass them
+    std::unordered_set<RowsetId> _removed_rowsets;
+    // entries of `_keys`, including those of removed rowsets
+    size_t _num_entries = 0;
+    size_t _num_removed_entries = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
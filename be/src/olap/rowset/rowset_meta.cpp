@@ -179,6 +179,16 @@ void RowsetMeta::set_tablet_schema(const TabletSchemaPB& tablet_schema) {
     _schema = pair.second;
 }
 
+void RowsetMeta::share_tablet_schema(const RowsetMeta& other) {
+    DCHECK(other._handle != nullptr);
+    if (_handle) {
+        TabletSchemaCache::instance()->release(_handle);
+    }
+    auto pair = TabletSchemaCache::instance()->acquire(other._handle);
+    _handle = pair.first;
+    _schema = pair.second;
+}
+
 bool RowsetMeta::_deserialize_from_pb(std::string_view value) {
     if (!_rowset_meta_pb.ParseFromArray(value.data(), value.size())) {
         _rowset_meta_pb.Clear();
@@ -341,6 +341,8 @@ public:
 
     void set_tablet_schema(const TabletSchemaSPtr& tablet_schema);
     void set_tablet_schema(const TabletSchemaPB& tablet_schema);
+    // Use the same cached schema as `other`, which is cheaper than setting an equal schema.
+    void share_tablet_schema(const RowsetMeta& other);
 
     const TabletSchemaSPtr& tablet_schema() const { return _schema; }
 
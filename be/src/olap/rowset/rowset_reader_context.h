@@ -39,6 +39,7 @@ struct RowsetReaderContext {
     TabletSchemaSPtr tablet_schema = nullptr;
     std::vector<int> topn_filter_source_node_ids;
     int topn_filter_target_node_id = -1;
+    const std::vector<std::shared_ptr<ColumnPredicate>>* late_arrival_rf_predicates = nullptr;
     // whether rowset should return ordered rows.
     bool need_ordered_result = true;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -106,6 +106,11 @@ private:
 
     bool _has_empty = false;
     uint32_t _empty_code = 0;
+
+    // the last dict item that is added, low cardinality columns often repeat it
+    Slice _last_item;
+    uint32_t _last_code = 0;
+    bool _has_last_item = false;
 };
 
 class BinaryDictPageDecoder : public PageDecoder {
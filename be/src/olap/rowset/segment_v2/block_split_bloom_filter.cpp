@@ -19,6 +19,10 @@
 
 #include <glog/logging.h>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace doris {
 namespace segment_v2 {
 
@@ -60,5 +64,29 @@ bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
     return true;
 }
 
+bool BlockSplitBloomFilter::test_any_hash(const uint64_t* hashes, size_t num_hashes) const {
+#ifdef __AVX2__
+    // Each tiny Bloom filter block is exactly one 256 bit register: compute the 8 masks of a
+    // key in one go and check that the block has all of their bits.
+    const uint32_t bucket_mask = static_cast<uint32_t>(_num_bytes / BYTES_PER_BLOCK - 1);
+    const __m256i salt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SALT));
+    const __m256i one = _mm256_set1_epi32(1);
+    for (size_t i = 0; i < num_hashes; ++i) {
+        const uint32_t bucket_index = static_cast<uint32_t>(hashes[i] >> 32) & bucket_mask;
+        __m256i mask = _mm256_mullo_epi32(
+                _mm256_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(hashes[i]))), salt);
+        mask = _mm256_sllv_epi32(one, _mm256_srli_epi32(mask, 27));
+        const __m256i block = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(_data + bucket_index * BYTES_PER_BLOCK));
+        if (_mm256_testc_si256(block, mask)) {
+            return true;
+        }
+    }
+    return false;
+#else
+    return BloomFilter::test_any_hash(hashes, num_hashes);
+#endif
+}
+
 } // namespace segment_v2
 } // namespace doris
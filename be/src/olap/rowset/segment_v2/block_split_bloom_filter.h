@@ -35,6 +35,8 @@ public:
 
     bool test_hash(uint64_t hash) const override;
 
+    bool test_any_hash(const uint64_t* hashes, size_t num_hashes) const override;
+
 private:
     // Bytes in a tiny Bloom filter block.
     static constexpr int BYTES_PER_BLOCK = 32;
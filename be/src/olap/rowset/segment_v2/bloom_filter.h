@@ -207,6 +207,16 @@ public:
     virtual void add_hash(uint64_t hash) = 0;
     virtual bool test_hash(uint64_t hash) const = 0;
 
+    // Returns true if any of the hashes may be in the bloom filter.
+    virtual bool test_any_hash(const uint64_t* hashes, size_t num_hashes) const {
+        for (size_t i = 0; i < num_hashes; ++i) {
+            if (test_hash(hashes[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     Status merge(const BloomFilter* other) {
         DCHECK(other->size() == _size);
         for (uint32_t i = 0; i < other->size(); i++) {
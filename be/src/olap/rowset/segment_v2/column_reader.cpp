@@ -29,6 +29,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/exception.h"
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
 #include "olap/block_column_predicate.h"
@@ -364,6 +365,7 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     opts.use_page_cache = iter_opts.use_page_cache;
     opts.kept_in_memory = _opts.kept_in_memory;
     opts.type = iter_opts.type;
+    opts.is_row_store = _opts.is_row_store;
     opts.file_reader = iter_opts.file_reader;
     opts.page_pointer = pp;
     opts.codec = codec;
@@ -709,6 +711,27 @@ Status ColumnReader::seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterat
     return Status::OK();
 }
 
+Status ColumnReader::get_page_ranges(const roaring::Roaring& rows,
+                                     const ColumnIteratorOptions& iter_opts,
+                                     std::vector<io::PrefetchRange>* ranges) {
+    if (rows.isEmpty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory, iter_opts));
+    // skip the pages before the first row instead of ranking each of them
+    auto iter = _ordinal_index->seek_at_or_before(rows.minimum());
+    for (; iter.valid() && iter.first_ordinal() <= rows.maximum(); iter.next()) {
+        uint64_t rows_before = iter.first_ordinal() == 0
+                                       ? 0
+                                       : rows.rank(cast_set<uint32_t>(iter.first_ordinal() - 1));
+        if (rows.rank(cast_set<uint32_t>(iter.last_ordinal())) > rows_before) {
+            const PagePointer& pp = iter.page();
+            ranges->emplace_back(pp.offset, pp.offset + pp.size);
+        }
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::new_iterator(ColumnIterator** iterator, const TabletColumn* tablet_column) {
     if (is_empty()) {
         *iterator = new EmptyFileColumnIterator();
@@ -996,6 +1019,24 @@ Status StructFileColumnIterator::seek_to_ordinal(ordinal_t ord) {
     return Status::OK();
 }
 
+Status StructFileColumnIterator::get_field_row_ranges_by_zone_map(
+        size_t field_index, const AndBlockColumnPredicate* col_predicates, RowRanges* row_ranges) {
+    DCHECK_LT(field_index, _sub_column_iterators.size());
+    return _sub_column_iterators[field_index]->get_row_ranges_by_zone_map(col_predicates, nullptr,
+                                                                          row_ranges);
+}
+
+Status StructFileColumnIterator::get_page_ranges(const roaring::Roaring& rows,
+                                                 std::vector<io::PrefetchRange>* ranges) {
+    if (_null_iterator) {
+        RETURN_IF_ERROR(_null_iterator->get_page_ranges(rows, ranges));
+    }
+    for (auto& sub_iterator : _sub_column_iterators) {
+        RETURN_IF_ERROR(sub_iterator->get_page_ranges(rows, ranges));
+    }
+    return Status::OK();
+}
+
 Status StructFileColumnIterator::read_by_rowids(const rowid_t* rowids, const size_t count,
                                                 vectorized::MutableColumnPtr& dst) {
     for (size_t i = 0; i < count; ++i) {
@@ -1453,7 +1494,63 @@ Status FileColumnIterator::get_row_ranges_by_zone_map(
     if (_reader->has_zone_map()) {
         RETURN_IF_ERROR(_reader->get_row_ranges_by_zone_map(col_predicates, delete_predicates,
                                                             row_ranges, _opts));
+        // Frames are checked on the pages the scan reads next, so only do it when the page
+        // cache saves the second read. Null rows have no values, so frame positions are not
+        // row ordinals in nullable columns.
+        if (config::enable_for_encoding_frame_filter && _opts.use_page_cache &&
+            _reader->encoding_info()->encoding() == FOR_ENCODING && !_reader->is_nullable()) {
+            RETURN_IF_ERROR(_get_row_ranges_by_frames(col_predicates, row_ranges));
+        }
+    }
+    return Status::OK();
+}
+
+Status FileColumnIterator::_get_row_ranges_by_frames(const AndBlockColumnPredicate* col_predicates,
+                                                     RowRanges* row_ranges) {
+    FieldType type = _reader->get_meta_type();
+    std::unique_ptr<WrapperField> min_value(WrapperField::create_by_type(type));
+    std::unique_ptr<WrapperField> max_value(WrapperField::create_by_type(type));
+    min_value->set_not_null();
+    max_value->set_not_null();
+
+    RowRanges frame_row_ranges;
+    int32_t last_page_index = -1;
+    for (size_t i = 0; i < row_ranges->range_size(); ++i) {
+        auto from = row_ranges->get_range_from(i);
+        auto to = row_ranges->get_range_to(i);
+        OrdinalPageIndexIterator iter;
+        RETURN_IF_ERROR(_reader->seek_at_or_before(from, &iter, _opts));
+        for (; iter.valid() && static_cast<int64_t>(iter.first_ordinal()) < to; iter.next()) {
+            if (iter.page_index() <= last_page_index) {
+                continue;
+            }
+            last_page_index = iter.page_index();
+
+            PageHandle handle;
+            Slice page_body;
+            PageFooterPB footer;
+            _opts.type = DATA_PAGE;
+            RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer,
+                                               _compress_codec));
+            ParsedPage page;
+            RETURN_IF_ERROR(ParsedPage::create(std::move(handle), page_body,
+                                               footer.data_page_footer(), _reader->encoding_info(),
+                                               iter.page(), iter.page_index(), &page));
+            auto* decoder = page.data_decoder.get();
+            for (size_t frame = 0; frame < decoder->num_frames(); ++frame) {
+                size_t first = 0;
+                size_t count = 0;
+                if (decoder->frame_value_range(frame, &first, &count, min_value->cell_ptr(),
+                                               max_value->cell_ptr()) &&
+                    !col_predicates->evaluate_and({min_value.get(), max_value.get()})) {
+                    continue;
+                }
+                auto frame_from = cast_set<int64_t>(page.first_ordinal + first);
+                frame_row_ranges.add(RowRange(frame_from, frame_from + cast_set<int64_t>(count)));
+            }
+        }
     }
+    RowRanges::ranges_intersection(*row_ranges, frame_row_ranges, row_ranges);
     return Status::OK();
 }
 
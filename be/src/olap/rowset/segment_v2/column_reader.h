@@ -51,6 +51,10 @@
 #include "vec/data_types/data_type.h"
 #include "vec/json/path_in_data.h"
 
+namespace roaring {
+class Roaring;
+} // namespace roaring
+
 namespace doris {
 #include "common/compile_check_begin.h"
 
@@ -63,6 +67,7 @@ class StorageReadOptions;
 
 namespace io {
 class FileReader;
+struct PrefetchRange;
 } // namespace io
 struct Slice;
 struct StringRef;
@@ -89,6 +94,8 @@ struct ColumnReaderOptions {
     bool kept_in_memory = false;
 
     int be_exec_version = -1;
+    // the column is the row store column, read by point queries
+    bool is_row_store = false;
 };
 
 struct ColumnIteratorOptions {
@@ -152,6 +159,10 @@ public:
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter,
                              const ColumnIteratorOptions& iter_opts);
 
+    // Append the file range of every data page that holds any row of `rows`.
+    Status get_page_ranges(const roaring::Roaring& rows, const ColumnIteratorOptions& iter_opts,
+                           std::vector<io::PrefetchRange>* ranges);
+
     // read a page from file into a page handle
     Status read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp,
                      PageHandle* handle, Slice* page_body, PageFooterPB* footer,
@@ -346,6 +357,13 @@ public:
 
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // Append the file ranges of the pages this iterator reads for `rows`, so that they can be
+    // prefetched. Iterators that do not know their pages in advance append nothing.
+    virtual Status get_page_ranges(const roaring::Roaring& rows,
+                                   std::vector<io::PrefetchRange>* ranges) {
+        return Status::OK();
+    }
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -391,11 +409,19 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    Status get_page_ranges(const roaring::Roaring& rows,
+                           std::vector<io::PrefetchRange>* ranges) override {
+        return _reader->get_page_ranges(rows, _opts, ranges);
+    }
+
 private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
     Status _read_dict_data();
+    // Narrow `row_ranges` to the frames of frame-of-reference pages that may match.
+    Status _get_row_ranges_by_frames(const AndBlockColumnPredicate* col_predicates,
+                                     RowRanges* row_ranges);
 
     ColumnReader* _reader = nullptr;
 
@@ -510,6 +536,15 @@ public:
         return _sub_column_iterators[0]->get_current_ordinal();
     }
 
+    // get row ranges by the zone map of the `field_index`-th field, whose rows are
+    // aligned with the struct rows. `row_ranges` is kept if the field has no zone map.
+    Status get_field_row_ranges_by_zone_map(size_t field_index,
+                                            const AndBlockColumnPredicate* col_predicates,
+                                            RowRanges* row_ranges);
+
+    Status get_page_ranges(const roaring::Roaring& rows,
+                           std::vector<io::PrefetchRange>* ranges) override;
+
 private:
     ColumnReader* _struct_reader = nullptr;
     std::unique_ptr<ColumnIterator> _null_iterator;
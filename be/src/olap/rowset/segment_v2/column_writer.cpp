@@ -132,7 +132,9 @@ Status ColumnWriter::create_struct_writer(const ColumnWriterOptions& opts,
         // create sub writer
         ColumnWriterOptions column_options;
         column_options.meta = opts.meta->mutable_children_columns(i);
-        column_options.need_zone_map = false;
+        column_options.need_zone_map = opts.need_sub_column_zone_map &&
+                                       ZoneMapIndexWriter::is_supported_type(sub_column.type());
+        column_options.need_sub_column_zone_map = opts.need_sub_column_zone_map;
         column_options.need_bloom_filter = sub_column.is_bf_column();
         column_options.need_bitmap_index = sub_column.has_bitmap_index();
         std::unique_ptr<ColumnWriter> sub_column_writer;
@@ -705,6 +707,9 @@ Status ScalarColumnWriter::finish_current_page() {
     if (_new_page_callback != nullptr) {
         _new_page_callback->put_extra_info_in_page(data_page_footer);
     }
+    if (!_compression_selected) {
+        RETURN_IF_ERROR(_select_compression(body));
+    }
     // trying to compress page body
     OwnedSlice compressed_body;
     RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving,
@@ -723,6 +728,54 @@ Status ScalarColumnWriter::finish_current_page() {
     return Status::OK();
 }
 
+// Replaces the compression of the tablet by the one that suits this column best, judged by
+// its first page: LZ4 decodes much faster than ZSTD, so ZSTD is only worth it when it makes
+// the page clearly smaller, and a page LZ4 can not shrink is not worth decompressing at all.
+// The choice is stored in the column meta, so that the reader decodes all pages with it.
+Status ScalarColumnWriter::_select_compression(const std::vector<Slice>& body) {
+    _compression_selected = true;
+    if (!config::enable_adaptive_column_compression ||
+        _opts.meta->compression() == NO_COMPRESSION) {
+        return Status::OK();
+    }
+    size_t uncompressed_size = Slice::compute_total_size(body);
+    if (uncompressed_size == 0) {
+        return Status::OK();
+    }
+    auto compressed_size = [&](CompressionTypePB type, size_t* size) {
+        BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(type, &codec));
+        if (codec->exceed_max_compress_len(uncompressed_size)) {
+            *size = uncompressed_size;
+            return Status::OK();
+        }
+        faststring buf;
+        RETURN_IF_ERROR_OR_CATCH_EXCEPTION(codec->compress(body, uncompressed_size, &buf));
+        *size = buf.size();
+        return Status::OK();
+    };
+    size_t lz4_size = 0;
+    size_t zstd_size = 0;
+    RETURN_IF_ERROR(compressed_size(LZ4F, &lz4_size));
+    RETURN_IF_ERROR(compressed_size(ZSTD, &zstd_size));
+
+    auto saving = [](size_t from, size_t to) {
+        return 1.0 - cast_set<double>(to) / cast_set<double>(from);
+    };
+    CompressionTypePB type = LZ4F;
+    if (zstd_size < lz4_size &&
+        saving(lz4_size, zstd_size) >= config::adaptive_column_compression_zstd_min_saving) {
+        type = ZSTD;
+    } else if (saving(uncompressed_size, lz4_size) < _opts.compression_min_space_saving) {
+        type = NO_COMPRESSION;
+    }
+    VLOG_DEBUG << "column " << get_field()->name() << " selects compression " << type
+               << ", uncompressed size: " << uncompressed_size << ", lz4 size: " << lz4_size
+               << ", zstd size: " << zstd_size;
+    _opts.meta->set_compression(type);
+    return get_block_compression_codec(type, &_compress_codec);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -800,6 +853,16 @@ Status StructColumnWriter::write_inverted_index() {
     return Status::OK();
 }
 
+Status StructColumnWriter::write_zone_map() {
+    if (_opts.need_zone_map) {
+        return Status::NotSupported("struct not support zone map");
+    }
+    for (auto& column_writer : _sub_column_writers) {
+        RETURN_IF_ERROR(column_writer->write_zone_map());
+    }
+    return Status::OK();
+}
+
 Status StructColumnWriter::append_nullable(const uint8_t* null_map, const uint8_t** ptr,
                                            size_t num_rows) {
     RETURN_IF_ERROR(append_data(ptr, num_rows));
@@ -59,6 +59,9 @@ struct ColumnWriterOptions {
     // space saving = 1 - compressed_size / uncompressed_size
     double compression_min_space_saving = 0.1;
     bool need_zone_map = false;
+    // write zone maps for the scalar fields of a struct column, their rows are aligned
+    // with the struct rows so the zone maps filter struct rows too
+    bool need_sub_column_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
     bool is_ngram_bf_index = false;
@@ -273,7 +276,10 @@ private:
     std::vector<std::unique_ptr<Page>> _pages;
     ordinal_t _first_rowid = 0;
 
+    Status _select_compression(const std::vector<Slice>& body);
+
     BlockCompressionCodec* _compress_codec;
+    bool _compression_selected = false;
 
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
@@ -326,12 +332,7 @@ public:
 
     Status finish_current_page() override;
 
-    Status write_zone_map() override {
-        if (_opts.need_zone_map) {
-            return Status::NotSupported("struct not support zone map");
-        }
-        return Status::OK();
-    }
+    Status write_zone_map() override;
 
     Status write_bitmap_index() override {
         if (_opts.need_bitmap_index) {
@@ -385,5 +385,18 @@ EncodingTypePB EncodingInfo::get_default_encoding(const TypeInfo* type_info,
     return s_encoding_info_resolver.get_default_encoding(type_info->type(), optimize_value_seek);
 }
 
+EncodingTypePB EncodingInfo::get_sorted_column_encoding(FieldType type) {
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+        // ascending frames are stored as bit-packed deltas from the frame min
+        return FOR_ENCODING;
+    default:
+        return DEFAULT_ENCODING;
+    }
+}
+
 } // namespace segment_v2
 } // namespace doris
@@ -57,6 +57,10 @@ public:
     // and support fast value seek operation
     static EncodingTypePB get_default_encoding(const TypeInfo* type_info, bool optimize_value_seek);
 
+    // Encoding for a data column whose values are ascending inside a segment, e.g. the first
+    // sort key column. Returns DEFAULT_ENCODING if the type has nothing better than the default.
+    static EncodingTypePB get_sorted_column_encoding(FieldType type);
+
     Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) const {
         return _create_builder_func(opts, builder);
     }
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "olap/rowset/segment_v2/page_decoder.h" // for PageDecoder
@@ -155,12 +158,87 @@ public:
         return Status::OK();
     }
 
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        _buffer.resize(max_fetch);
+        if (!_decoder->get_batch(_buffer.data(), max_fetch)) [[unlikely]] {
+            return Status::Corruption("failed to decode {} values from frame of reference page",
+                                      max_fetch);
+        }
+        dst->insert_many_fix_len_data((char*)_buffer.data(), max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        } else {
+            _decoder->skip(-cast_set<int32_t>(max_fetch));
+        }
+        return Status::OK();
+    }
+
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return next_batch<>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (*n == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        auto total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _num_elements)) {
+                break;
+            }
+            // rowids are ascending, so this only decodes each touched frame once
+            _decoder->skip(cast_set<int32_t>(static_cast<int64_t>(ord) -
+                                             static_cast<int64_t>(_decoder->current_index())));
+            _cur_index = ord;
+            if (!_decoder->get(&_buffer[read_count])) [[unlikely]] {
+                return Status::Corruption("failed to decode value {} from frame of reference page",
+                                          ord);
+            }
+            ++_cur_index;
+            ++read_count;
+        }
+
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data((char*)_buffer.data(), read_count);
+        }
+
+        *n = read_count;
+        return Status::OK();
     }
 
     Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return next_batch<false>(n, dst);
+    }
+
+    size_t num_frames() const override { return _decoder->frame_count(); }
+
+    bool frame_value_range(size_t index, size_t* first, size_t* count, void* min_value,
+                           void* max_value) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        uint32_t frame_first = 0;
+        uint32_t frame_count = 0;
+        bool bounded = _decoder->frame_value_range(
+                cast_set<uint32_t>(index), &frame_first, &frame_count,
+                static_cast<CppType*>(min_value), static_cast<CppType*>(max_value));
+        *first = frame_first;
+        *count = frame_count;
+        return bounded;
     }
 
     size_t count() const override { return _num_elements; }
@@ -175,6 +253,7 @@ private:
     uint32_t _num_elements;
     size_t _cur_index;
     std::unique_ptr<ForDecoder<CppType>> _decoder;
+    std::vector<CppType> _buffer;
 };
 
 #include "common/compile_check_end.h"
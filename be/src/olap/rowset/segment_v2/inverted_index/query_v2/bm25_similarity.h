@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace doris::segment_v2::idx_query_v2 {
+
+// BM25 of a term within a segment. The inverted index keeps no field norms, so the document
+// length normalization is left out (b = 0) and a score only depends on the term frequency.
+class BM25Similarity {
+public:
+    static constexpr float K1 = 1.2F;
+
+    BM25Similarity() = default;
+    BM25Similarity(int64_t doc_freq, int64_t num_docs)
+            : _idf(static_cast<float>(
+                      std::log(1.0 + (static_cast<double>(num_docs - doc_freq) + 0.5) /
+                                             (static_cast<double>(doc_freq) + 0.5)))) {}
+
+    float score(int32_t freq) const {
+        auto tf = static_cast<float>(freq);
+        return _idf * tf * (K1 + 1) / (tf + K1);
+    }
+
+    // The upper bound of score(), approached as the term frequency grows.
+    float max_score() const { return _idf * (K1 + 1); }
+
+private:
+    float _idf = 0;
+};
+
+} // namespace doris::segment_v2::idx_query_v2
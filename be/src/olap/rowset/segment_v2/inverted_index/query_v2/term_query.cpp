@@ -31,6 +31,7 @@ TermQuery::TermQuery(const std::shared_ptr<lucene::search::IndexSearcher>& searc
                      const TQueryOptions& query_options, QueryInfo query_info) {
     _iter = TermIterator::create(nullptr, searcher->getReader(), query_info.field_name,
                                  query_info.terms[0]);
+    _similarity = BM25Similarity(_iter->doc_freq(), searcher->getReader()->maxDoc());
 }
 
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
@@ -19,6 +19,7 @@
 
 #include <memory>
 
+#include "olap/rowset/segment_v2/inverted_index/query_v2/bm25_similarity.h"
 #include "olap/rowset/segment_v2/inverted_index/query_v2/query.h"
 
 namespace doris::segment_v2::idx_query_v2 {
@@ -36,9 +37,14 @@ public:
     int32_t advance(int32_t target) const { return _iter->advance(target); }
     int64_t cost() const { return _iter->doc_freq(); }
 
+    // BM25 of the current doc
+    float score() const { return _similarity.score(_iter->freq()); }
+    float max_score() const { return _similarity.max_score(); }
+
 private:
     TermDocs* _term_docs = nullptr;
     TermIterPtr _iter;
+    BM25Similarity _similarity;
 };
 
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
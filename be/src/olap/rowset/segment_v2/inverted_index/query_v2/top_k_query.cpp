@@ -0,0 +1,31 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/top_k_query.h"
+
+namespace doris::segment_v2::idx_query_v2 {
+
+TopKQuery::TopKQuery(std::vector<TermQueryPtr> terms, size_t k) : _terms(std::move(terms)), _k(k) {}
+
+void TopKQuery::execute(const std::shared_ptr<roaring::Roaring>& result) {
+    _top_docs = max_score_top_k(_terms, _k);
+    for (const auto& scored_doc : _top_docs) {
+        result->add(scored_doc.doc);
+    }
+}
+
+} // namespace doris::segment_v2::idx_query_v2
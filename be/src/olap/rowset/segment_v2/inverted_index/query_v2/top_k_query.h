@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/node.h"
+#include "olap/rowset/segment_v2/inverted_index/query_v2/query.h"
+#include "olap/rowset/segment_v2/inverted_index/query_v2/term_query.h"
+
+namespace doris::segment_v2::idx_query_v2 {
+
+struct ScoredDoc {
+    int32_t doc = 0;
+    float score = 0;
+};
+
+// Returns the k docs with the highest sum of scores over the scorers they match, best first,
+// ties broken by the smaller doc. A scorer provides next_doc(), advance(target), score() of its
+// current doc and max_score(), the upper bound of score().
+//
+// Uses MaxScore so that most of the docs are never scored: once k docs are collected, the
+// scorers whose summed upper bounds cannot beat the k-th best score become non-essential. A
+// candidate doc must match one of the essential scorers, and the non-essential ones are only
+// advanced to it while its score can still reach the top k.
+template <typename ScorerPtr>
+std::vector<ScoredDoc> max_score_top_k(std::vector<ScorerPtr> scorers, size_t k) {
+    std::vector<ScoredDoc> top_docs;
+    if (k == 0 || scorers.empty()) {
+        return top_docs;
+    }
+    std::sort(scorers.begin(), scorers.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->max_score() < rhs->max_score();
+    });
+
+    const size_t num_scorers = scorers.size();
+    std::vector<int32_t> docs(num_scorers);
+    // upper_bounds[i] is the sum of the max scores of scorers[0, i]
+    std::vector<float> upper_bounds(num_scorers);
+    float upper_bound = 0;
+    for (size_t i = 0; i < num_scorers; ++i) {
+        docs[i] = scorers[i]->next_doc();
+        upper_bound += scorers[i]->max_score();
+        upper_bounds[i] = upper_bound;
+    }
+
+    // a heap whose top is the worst of the collected docs
+    auto better = [](const ScoredDoc& lhs, const ScoredDoc& rhs) {
+        return lhs.score > rhs.score || (lhs.score == rhs.score && lhs.doc < rhs.doc);
+    };
+    top_docs.reserve(k);
+    size_t first_essential = 0;
+    float threshold = 0;
+    while (true) {
+        int32_t doc = INT_MAX;
+        for (size_t i = first_essential; i < num_scorers; ++i) {
+            doc = std::min(doc, docs[i]);
+        }
+        if (doc == INT_MAX) {
+            break;
+        }
+
+        float score = 0;
+        for (size_t i = first_essential; i < num_scorers; ++i) {
+            if (docs[i] == doc) {
+                score += scorers[i]->score();
+                docs[i] = scorers[i]->next_doc();
+            }
+        }
+        const bool is_full = top_docs.size() == k;
+        for (size_t i = first_essential; i-- > 0;) {
+            if (is_full && score + upper_bounds[i] <= threshold) {
+                break;
+            }
+            if (docs[i] < doc) {
+                docs[i] = scorers[i]->advance(doc);
+            }
+            if (docs[i] == doc) {
+                score += scorers[i]->score();
+            }
+        }
+
+        // the docs come in ascending order, so a tie never replaces a collected doc
+        if (is_full && score <= threshold) {
+            continue;
+        }
+        if (is_full) {
+            std::pop_heap(top_docs.begin(), top_docs.end(), better);
+            top_docs.pop_back();
+        }
+        top_docs.push_back({doc, score});
+        std::push_heap(top_docs.begin(), top_docs.end(), better);
+        if (top_docs.size() == k) {
+            threshold = top_docs.front().score;
+            while (first_essential < num_scorers && upper_bounds[first_essential] <= threshold) {
+                ++first_essential;
+            }
+        }
+    }
+    std::sort_heap(top_docs.begin(), top_docs.end(), better);
+    return top_docs;
+}
+
+// Scores the docs matching any of the terms by BM25 and keeps only the k best ones, for
+// relevance ordered searches that need neither the full matching bitmap nor a later sort.
+class TopKQuery : public Query {
+public:
+    TopKQuery(std::vector<TermQueryPtr> terms, size_t k);
+    ~TopKQuery() override = default;
+
+    void execute(const std::shared_ptr<roaring::Roaring>& result);
+
+    // The top k docs of the last execute(), best first.
+    const std::vector<ScoredDoc>& top_docs() const { return _top_docs; }
+
+private:
+    std::vector<TermQueryPtr> _terms;
+    size_t _k;
+    std::vector<ScoredDoc> _top_docs;
+};
+
+using TopKQueryPtr = std::shared_ptr<TopKQuery>;
+
+} // namespace doris::segment_v2::idx_query_v2
@@ -28,6 +28,7 @@
 #include <CLucene/util/bkd/bkd_docid_iterator.h>
 #include <CLucene/util/stringUtil.h>
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
 #include <roaring/roaring.hh>
@@ -380,6 +381,14 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
             return Status::OK();
         }
 
+        bool combined = false;
+        RETURN_IF_ERROR(match_by_term_cache(io_ctx, stats, runtime_state, query_type, query_info,
+                                            cache_key, bit_map, &combined));
+        if (combined) {
+            cache->insert(cache_key, bit_map, &cache_handler);
+            return Status::OK();
+        }
+
         InvertedIndexCacheHandle inverted_index_cache_handle;
         RETURN_IF_ERROR(
                 handle_searcher_cache(runtime_state, &inverted_index_cache_handle, io_ctx, stats));
@@ -400,6 +409,102 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
     }
 }
 
+Status FullTextIndexReader::match_by_term_cache(const io::IOContext* io_ctx,
+                                                OlapReaderStatistics* stats,
+                                                RuntimeState* runtime_state,
+                                                InvertedIndexQueryType query_type,
+                                                const InvertedIndexQueryInfo& query_info,
+                                                const InvertedIndexQueryCache::CacheKey& query_key,
+                                                std::shared_ptr<roaring::Roaring>& bit_map,
+                                                bool* combined) {
+    *combined = false;
+    if (!runtime_state->query_options().enable_inverted_index_query_cache) {
+        return Status::OK();
+    }
+    if (query_type != InvertedIndexQueryType::MATCH_ANY_QUERY &&
+        query_type != InvertedIndexQueryType::MATCH_ALL_QUERY) {
+        return Status::OK();
+    }
+    const auto& term_infos = query_info.term_infos;
+    if (term_infos.size() < 2 ||
+        !std::ranges::all_of(term_infos, [](const auto& t) { return t.is_single_term(); })) {
+        return Status::OK();
+    }
+
+    auto* cache = InvertedIndexQueryCache::instance();
+    std::vector<InvertedIndexQueryCacheHandle> term_handles(term_infos.size());
+    std::vector<std::shared_ptr<roaring::Roaring>> term_bitmaps(term_infos.size());
+    std::vector<InvertedIndexQueryInfo> term_queries(term_infos.size());
+    bool has_missing = false;
+    for (size_t i = 0; i < term_infos.size(); ++i) {
+        term_queries[i].field_name = query_info.field_name;
+        term_queries[i].term_infos.emplace_back(term_infos[i].get_single_term(), 0);
+        InvertedIndexQueryCache::CacheKey term_key {query_key.index_path, query_key.column_name,
+                                                    InvertedIndexQueryType::MATCH_ANY_QUERY,
+                                                    term_queries[i].generate_tokens_key()};
+        if (cache->lookup(term_key, &term_handles[i])) {
+            term_bitmaps[i] = term_handles[i].get_bitmap();
+        } else {
+            has_missing = true;
+        }
+    }
+
+    if (has_missing) {
+        // The conjunction skips through the postings of the rarer terms, which beats building
+        // the bitmaps of all terms, so MATCH_ALL is only combined when every term is cached.
+        if (query_type == InvertedIndexQueryType::MATCH_ALL_QUERY) {
+            return Status::OK();
+        }
+        InvertedIndexCacheHandle inverted_index_cache_handle;
+        RETURN_IF_ERROR(
+                handle_searcher_cache(runtime_state, &inverted_index_cache_handle, io_ctx, stats));
+        auto searcher_variant = inverted_index_cache_handle.get_index_searcher();
+        auto* searcher_ptr = std::get_if<FulltextIndexSearcherPtr>(&searcher_variant);
+        if (searcher_ptr == nullptr) {
+            return Status::OK();
+        }
+        for (size_t i = 0; i < term_infos.size(); ++i) {
+            if (term_bitmaps[i] != nullptr) {
+                continue;
+            }
+            auto term_bitmap = std::make_shared<roaring::Roaring>();
+            RETURN_IF_ERROR(match_index_search(io_ctx, stats, runtime_state,
+                                               InvertedIndexQueryType::MATCH_ANY_QUERY,
+                                               term_queries[i], *searcher_ptr, term_bitmap));
+            term_bitmap->runOptimize();
+            term_bitmap->shrinkToFit();
+            InvertedIndexQueryCache::CacheKey term_key {
+                    query_key.index_path, query_key.column_name,
+                    InvertedIndexQueryType::MATCH_ANY_QUERY, term_queries[i].generate_tokens_key()};
+            cache->insert(term_key, term_bitmap, &term_handles[i]);
+            term_bitmaps[i] = std::move(term_bitmap);
+        }
+    }
+
+    // The cached bitmaps are shared with other queries, so they are combined into a new one.
+    auto result = std::make_shared<roaring::Roaring>();
+    if (query_type == InvertedIndexQueryType::MATCH_ANY_QUERY) {
+        std::vector<const roaring::Roaring*> inputs;
+        inputs.reserve(term_bitmaps.size());
+        for (const auto& term_bitmap : term_bitmaps) {
+            inputs.push_back(term_bitmap.get());
+        }
+        *result = roaring::Roaring::fastunion(inputs.size(), inputs.data());
+    } else {
+        std::ranges::sort(term_bitmaps, [](const auto& a, const auto& b) {
+            return a->cardinality() < b->cardinality();
+        });
+        *result = *term_bitmaps[0];
+        for (size_t i = 1; i < term_bitmaps.size() && !result->isEmpty(); ++i) {
+            *result &= *term_bitmaps[i];
+        }
+    }
+    result->runOptimize();
+    bit_map = std::move(result);
+    *combined = true;
+    return Status::OK();
+}
+
 InvertedIndexReaderType FullTextIndexReader::type() {
     return InvertedIndexReaderType::FULLTEXT;
 }
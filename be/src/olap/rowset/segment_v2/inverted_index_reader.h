@@ -264,6 +264,17 @@ public:
     }
 
     InvertedIndexReaderType type() override;
+
+private:
+    // MATCH_ANY and MATCH_ALL of several terms are the union and the intersection of the
+    // postings of their terms. The postings of each term are cached on their own, under the key
+    // of a single term MATCH_ANY, so queries over overlapping terms share them. `combined` is
+    // false if the query has to be searched as a whole.
+    Status match_by_term_cache(const io::IOContext* io_ctx, OlapReaderStatistics* stats,
+                               RuntimeState* runtime_state, InvertedIndexQueryType query_type,
+                               const InvertedIndexQueryInfo& query_info,
+                               const InvertedIndexQueryCache::CacheKey& query_key,
+                               std::shared_ptr<roaring::Roaring>& bit_map, bool* combined);
 };
 
 class StringTypeInvertedIndexReader : public InvertedIndexReader {
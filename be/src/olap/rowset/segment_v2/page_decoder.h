@@ -74,6 +74,18 @@ public:
         return Status::NotSupported("not implement vec op now");
     }
 
+    // Return the number of frames, the groups of values whose value range is kept in the
+    // page metadata, so that a predicate can skip a frame without decoding it.
+    virtual size_t num_frames() const { return 0; }
+
+    // Get the positions [*first, *first + *count) of frame `index` in this page, its min value and
+    // an upper bound of its max value. Return false if the value range of this frame is unknown,
+    // the positions are set anyway.
+    virtual bool frame_value_range(size_t index, size_t* first, size_t* count, void* min_value,
+                                   void* max_value) {
+        return false;
+    }
+
     // Return the number of elements in this page.
     virtual size_t count() const = 0;
 
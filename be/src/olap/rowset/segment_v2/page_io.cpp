@@ -135,7 +135,8 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                          opts.file_reader->size(), opts.page_pointer.offset);
     VLOG_DEBUG << fmt::format("Reading page {}:{}:{}", cache_key.fname, cache_key.fsize,
                               cache_key.offset);
-    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+    if (opts.use_page_cache && cache &&
+        cache->lookup(cache_key, &cache_handle, opts.type, opts.is_row_store)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
@@ -160,11 +161,24 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                   opts.file_reader->path().native());
     }
 
+    // pages to be cached are tracked by the cache they are inserted into
+    auto new_page = [&](size_t size) {
+        if (opts.use_page_cache && cache && opts.is_row_store) {
+            return std::make_unique<DataPage>(size, cache->mem_tracker(opts.type, true));
+        }
+        return std::make_unique<DataPage>(size, opts.use_page_cache, opts.type);
+    };
     // hold compressed page at first, reset to decompressed page later
-    std::unique_ptr<DataPage> page =
-            std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
-    Slice page_slice(page->data(), page_size);
-    {
+    std::unique_ptr<DataPage> page;
+    // the compressed page kept in memory, which saves the read from the file
+    PageCacheHandle compressed_handle;
+    Slice page_slice;
+    if (opts.use_page_cache && cache && cache->lookup_compressed(cache_key, &compressed_handle)) {
+        page_slice = compressed_handle.data();
+        DCHECK_EQ(page_slice.size, page_size);
+    } else {
+        page = new_page(page_size);
+        page_slice = Slice(page->data(), page_size);
         SCOPED_RAW_TIMER(&opts.stats->io_ns);
         size_t bytes_read = 0;
         RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
@@ -203,8 +217,8 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                     opts.file_reader->path().native());
         }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
-        std::unique_ptr<DataPage> decompressed_page = std::make_unique<DataPage>(
-                footer->uncompressed_size() + footer_size + 4, opts.use_page_cache, opts.type);
+        std::unique_ptr<DataPage> decompressed_page =
+                new_page(footer->uncompressed_size() + footer_size + 4);
 
         // decompress page body
         Slice compressed_body(page_slice.data, body_size);
@@ -219,11 +233,16 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         // append footer and footer size
         memcpy(decompressed_body.data + decompressed_body.size, page_slice.data + body_size,
                footer_size + 4);
+        if (page != nullptr && opts.use_page_cache && cache) {
+            cache->insert_compressed(cache_key, Slice(page->data(), page_size));
+        }
         // free memory of compressed page
         page = std::move(decompressed_page);
         page_slice = Slice(page->data(), footer->uncompressed_size() + footer_size + 4);
         opts.stats->uncompressed_bytes_read += page_slice.size;
     } else {
+        // only compressed pages are kept in the compressed page cache
+        DCHECK(page != nullptr);
         opts.stats->uncompressed_bytes_read += body_size;
     }
 
@@ -240,7 +259,8 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
     page->reset_size(page_slice.size);
     if (opts.use_page_cache && cache) {
         // insert this page into cache and return the cache handle
-        cache->insert(cache_key, page.get(), &cache_handle, opts.type, opts.kept_in_memory);
+        cache->insert(cache_key, page.get(), &cache_handle, opts.type, opts.kept_in_memory,
+                      opts.is_row_store);
         *handle = PageHandle(std::move(cache_handle));
     } else {
         *handle = PageHandle(page.get());
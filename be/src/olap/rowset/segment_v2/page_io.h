@@ -59,6 +59,8 @@ struct PageReadOptions {
     // page types are divided into DATA_PAGE & INDEX_PAGE
     // INDEX_PAGE including index_page, dict_page and short_key_page
     PageTypePB type;
+    // whether the page belongs to the row store column, whose data pages may be cached apart
+    bool is_row_store = false;
     // block to read page
     io::FileReader* file_reader = nullptr;
     // location of the page
@@ -87,6 +89,7 @@ struct PageReadOptions {
         use_page_cache = old.use_page_cache;
         kept_in_memory = old.kept_in_memory;
         type = old.type;
+        is_row_store = old.is_row_store;
         encoding_info = old.encoding_info;
         pre_decode = old.pre_decode;
     }
@@ -23,6 +23,8 @@
 
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
 
 #include "cloud/config.h"
@@ -57,6 +59,7 @@
 #include "olap/tablet_schema.h"
 #include "olap/types.h"
 #include "olap/utils.h"
+#include "olap/wrapper_field.h"
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
@@ -198,7 +201,6 @@ Status Segment::_open(OlapReaderStatistics* stats) {
     }
 
     _meta_mem_usage += sizeof(*this);
-    _meta_mem_usage += _tablet_schema->num_columns() * config::estimated_mem_per_column_reader;
 
     // 1024 comes from SegmentWriterOptions
     _meta_mem_usage += (_num_rows + 1023) / 1024 * (36 + 4);
@@ -219,6 +221,53 @@ Status Segment::_open_index_file_reader() {
     return Status::OK();
 }
 
+bool Segment::_sparse_column_match_predicates(const SubcolumnReader& sparse_column, ColumnId cid,
+                                              const std::vector<ColumnPredicate*>& predicates) {
+    if (sparse_column.sparse_column_meta == nullptr) {
+        return true;
+    }
+    const ZoneMapPB* zone_map = nullptr;
+    for (const auto& index : sparse_column.sparse_column_meta->indexes()) {
+        if (index.type() == ZONE_MAP_INDEX) {
+            zone_map = &index.zone_map_index().segment_zone_map();
+        }
+    }
+    if (zone_map == nullptr || zone_map->pass_all()) {
+        return true;
+    }
+    const auto& type = sparse_column.file_column_type;
+    auto field_type = static_cast<FieldType>(sparse_column.sparse_column_meta->type());
+    auto length = sparse_column.sparse_column_meta->length();
+    std::unique_ptr<WrapperField> min_value;
+    std::unique_ptr<WrapperField> max_value;
+    for (const auto* predicate : predicates) {
+        // sparse columns are mostly null, so only the predicates which never match null are
+        // evaluated on the zone map of the non-null values
+        if (predicate->column_id() != cid ||
+            !(PredicateTypeTraits::is_comparison(predicate->type()) ||
+              PredicateTypeTraits::is_list(predicate->type())) ||
+            !predicate->can_do_apply_safely(type->get_primitive_type(), type->is_nullable())) {
+            continue;
+        }
+        if (!zone_map->has_not_null()) {
+            return false;
+        }
+        if (min_value == nullptr) {
+            min_value.reset(WrapperField::create_by_type(field_type, length));
+            max_value.reset(WrapperField::create_by_type(field_type, length));
+            if (min_value == nullptr || max_value == nullptr ||
+                !min_value->from_string(zone_map->min()).ok() ||
+                !max_value->from_string(zone_map->max()).ok()) {
+                return true;
+            }
+        }
+        if (!predicate->evaluate_and({min_value.get(), max_value.get()})) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_options,
                              std::unique_ptr<RowwiseIterator>* iter) {
     if (read_options.runtime_state != nullptr) {
@@ -241,10 +290,19 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             int32_t unique_id = col.unique_id() > 0 ? col.unique_id() : col.parent_unique_id();
             const auto* node = _sub_column_tree[unique_id].find_exact(relative_path);
             reader = node != nullptr ? node->data.reader.get() : nullptr;
+            const auto* sparse_node =
+                    node == nullptr && _sparse_column_tree.contains(unique_id)
+                            ? _sparse_column_tree[unique_id].find_exact(relative_path)
+                            : nullptr;
+            if (sparse_node != nullptr &&
+                !_sparse_column_match_predicates(sparse_node->data, column_id,
+                                                 read_options.column_predicates)) {
+                iter->reset(new EmptySegmentIterator(*schema));
+                read_options.stats->filtered_segment_number++;
+                return Status::OK();
+            }
         } else {
-            reader = _column_readers.contains(col.unique_id())
-                             ? _column_readers[col.unique_id()].get()
-                             : nullptr;
+            RETURN_IF_ERROR(_get_column_reader_by_uid(col.unique_id(), read_options.stats, &reader));
         }
         if (!reader || !reader->has_zone_map()) {
             continue;
@@ -272,10 +330,12 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader_by_uid(uid, read_options.stats, &reader));
+            if (reader != nullptr &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -284,6 +344,29 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         }
     }
 
+    if (read_options.late_arrival_rf_predicates != nullptr) {
+        for (const auto& predicate : *read_options.late_arrival_rf_predicates) {
+            if (predicate->column_id() >= schema->num_columns() ||
+                schema->column(predicate->column_id()) == nullptr) {
+                continue;
+            }
+            int32_t uid = read_options.tablet_schema->column(predicate->column_id()).unique_id();
+            AndBlockColumnPredicate and_predicate;
+            and_predicate.add_column_predicate(
+                    SingleColumnBlockPredicate::create_unique(predicate.get()));
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader_by_uid(uid, read_options.stats, &reader));
+            if (reader != nullptr && reader->has_zone_map() &&
+                can_apply_predicate_safely(predicate->column_id(), predicate.get(), *schema,
+                                           read_options.io_ctx.reader_type) &&
+                !reader->match_condition(&and_predicate)) {
+                *iter = std::make_unique<EmptySegmentIterator>(*schema);
+                read_options.stats->filtered_segment_number++;
+                return Status::OK();
+            }
+        }
+    }
+
     {
         SCOPED_RAW_TIMER(&read_options.stats->segment_load_index_timer_ns);
         RETURN_IF_ERROR(load_index(read_options.stats));
@@ -302,10 +385,20 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         !read_options.column_predicates.empty()) {
         auto pruned_predicates = read_options.column_predicates;
         auto pruned = false;
-        for (auto& it : _column_readers) {
-            const auto uid = it.first;
-            const auto column_id = read_options.tablet_schema->field_index(uid);
-            if (it.second->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
+        std::set<ColumnId> predicate_column_ids;
+        for (auto* pred : read_options.column_predicates) {
+            predicate_column_ids.insert(pred->column_id());
+        }
+        for (auto column_id : predicate_column_ids) {
+            const auto& column = read_options.tablet_schema->column(column_id);
+            if (column.is_extracted_column()) {
+                continue;
+            }
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(
+                    _get_column_reader_by_uid(column.unique_id(), read_options.stats, &reader));
+            if (reader != nullptr &&
+                reader->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
                 pruned = true;
             }
         }
@@ -632,22 +725,14 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
             column_id_to_footer_ordinal.emplace(column_pb.unique_id(), ordinal);
         }
     }
-    // init by unique_id
+    // init by unique_id, the readers are created by _get_column_reader_by_uid
     for (uint32_t ordinal = 0; ordinal < _tablet_schema->num_columns(); ++ordinal) {
         const auto& column = _tablet_schema->column(ordinal);
         auto iter = column_id_to_footer_ordinal.find(column.unique_id());
         if (iter == column_id_to_footer_ordinal.end()) {
             continue;
         }
-
-        ColumnReaderOptions opts {
-                .kept_in_memory = _tablet_schema->is_in_memory(),
-                .be_exec_version = _be_exec_version,
-        };
-        std::unique_ptr<ColumnReader> reader;
-        RETURN_IF_ERROR(ColumnReader::create(opts, footer.columns(iter->second), footer.num_rows(),
-                                             _file_reader, &reader));
-        _column_readers.emplace(column.unique_id(), std::move(reader));
+        _column_uid_to_footer_ordinal.emplace(column.unique_id(), iter->second);
     }
 
     // init by column path
@@ -701,7 +786,8 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
                         sparse_path.copy_pop_front(),
                         SubcolumnReader {nullptr,
                                          vectorized::DataTypeFactory::instance().create_data_type(
-                                                 spase_column_pb)});
+                                                 spase_column_pb),
+                                         std::make_shared<ColumnMetaPB>(spase_column_pb)});
             }
         }
     }
@@ -890,24 +976,24 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     if (tablet_column.has_path_info() || tablet_column.is_variant_type()) {
         return new_column_iterator_with_path(tablet_column, iter, opt);
     }
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader_by_uid(tablet_column.unique_id(), opt->stats, &reader));
     // init default iterator
-    if (!_column_readers.contains(tablet_column.unique_id())) {
+    if (reader == nullptr) {
         RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
         return Status::OK();
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(
-            _column_readers.at(tablet_column.unique_id())->new_iterator(&it, &tablet_column));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
 
     if (config::enable_column_type_check && !tablet_column.is_agg_state_type() &&
-        tablet_column.type() != _column_readers.at(tablet_column.unique_id())->get_meta_type()) {
+        tablet_column.type() != reader->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
                      << " column schema name: " << tablet_column.name()
                      << " column schema type: " << int(tablet_column.type())
-                     << " column reader meta type: "
-                     << int(_column_readers.at(tablet_column.unique_id())->get_meta_type());
+                     << " column reader meta type: " << int(reader->get_meta_type());
         return Status::InternalError("different type between schema and column reader");
     }
     return Status::OK();
@@ -916,14 +1002,21 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
 Status Segment::new_column_iterator(int32_t unique_id, const StorageReadOptions* opt,
                                     std::unique_ptr<ColumnIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(opt->stats));
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader_by_uid(unique_id, opt->stats, &reader));
+    if (reader == nullptr) {
+        return Status::InternalError("column {} is not found in segment {}", unique_id,
+                                     _segment_id);
+    }
     ColumnIterator* it;
     TabletColumn tablet_column = _tablet_schema->column_by_uid(unique_id);
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it, &tablet_column));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
     return Status::OK();
 }
 
-ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
+Status Segment::_get_column_reader(const TabletColumn& col, OlapReaderStatistics* stats,
+                                   ColumnReader** reader) {
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
         auto relative_path = col.path_info_ptr()->copy_pop_front();
@@ -931,23 +1024,57 @@ ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
         const auto* node = col.has_path_info()
                                    ? _sub_column_tree[unique_id].find_exact(relative_path)
                                    : nullptr;
-        if (node != nullptr) {
-            return node->data.reader.get();
+        *reader = node != nullptr ? node->data.reader.get() : nullptr;
+        return Status::OK();
+    }
+    return _get_column_reader_by_uid(col.unique_id(), stats, reader);
+}
+
+Status Segment::_get_column_reader_by_uid(int32_t unique_id, OlapReaderStatistics* stats,
+                                          ColumnReader** reader) {
+    *reader = nullptr;
+    auto ordinal = _column_uid_to_footer_ordinal.find(unique_id);
+    if (ordinal == _column_uid_to_footer_ordinal.end()) {
+        return Status::OK();
+    }
+    {
+        std::shared_lock lock(_column_readers_lock);
+        auto it = _column_readers.find(unique_id);
+        if (it != _column_readers.end() && it->second != nullptr) {
+            *reader = it->second.get();
+            return Status::OK();
         }
-        return nullptr;
     }
-    auto col_unique_id = col.unique_id();
-    if (_column_readers.contains(col_unique_id)) {
-        return _column_readers[col_unique_id].get();
+
+    SCOPED_RAW_TIMER(&stats->segment_create_column_readers_timer_ns);
+    std::shared_ptr<SegmentFooterPB> footer_pb_shared;
+    RETURN_IF_ERROR(_get_segment_footer(footer_pb_shared, stats));
+    std::lock_guard lock(_column_readers_lock);
+    auto& column_reader = _column_readers[unique_id];
+    if (column_reader == nullptr) {
+        int32_t field_index = _tablet_schema->field_index(unique_id);
+        ColumnReaderOptions opts {
+                .kept_in_memory = _tablet_schema->is_in_memory(),
+                .be_exec_version = _be_exec_version,
+                .is_row_store = field_index >= 0 &&
+                                _tablet_schema->column(field_index).is_row_store_column(),
+        };
+        RETURN_IF_ERROR(ColumnReader::create(opts, footer_pb_shared->columns(ordinal->second),
+                                             footer_pb_shared->num_rows(), _file_reader,
+                                             &column_reader));
+        _meta_mem_usage += config::estimated_mem_per_column_reader;
+        update_metadata_size();
     }
-    return nullptr;
+    *reader = column_reader.get();
+    return Status::OK();
 }
 
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           const StorageReadOptions& read_options,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, read_options.stats, &reader));
     if (reader != nullptr && reader->has_bitmap_index()) {
         BitmapIndexIterator* it;
         RETURN_IF_ERROR(reader->new_bitmap_index_iterator(&it));
@@ -964,7 +1091,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
         _be_exec_version = read_options.runtime_state->be_exec_version();
     }
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, read_options.stats, &reader));
     if (reader != nullptr && index_meta) {
         // call DorisCallOnce.call without check if _index_file_reader is nullptr
         // to avoid data race during parallel method calls
@@ -979,7 +1107,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
 
 Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_schema,
                                bool with_seq_col, bool with_rowid, RowLocation* row_location,
-                               OlapReaderStatistics* stats, std::string* encoded_seq_value) {
+                               OlapReaderStatistics* stats, std::string* encoded_seq_value,
+                               std::unique_ptr<IndexedColumnIterator>* index_iterator) {
     RETURN_IF_ERROR(load_pk_index_and_bf(stats));
     bool has_seq_col = latest_schema->has_sequence_col();
     bool has_rowid = !latest_schema->cluster_key_uids().empty();
@@ -998,16 +1127,21 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
-    auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
+    std::unique_ptr<segment_v2::IndexedColumnIterator> local_index_iterator;
+    if (index_iterator == nullptr) {
+        index_iterator = &local_index_iterator;
+    }
+    if (*index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(index_iterator, stats));
+    }
+    auto st = (*index_iterator)->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
     }
     if (st.is<ErrorCode::ENTRY_NOT_FOUND>() || (!has_seq_col && !has_rowid && !exact_match)) {
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
-    row_location->row_id = cast_set<uint32_t>(index_iterator->get_current_ordinal());
+    row_location->row_id = cast_set<uint32_t>((*index_iterator)->get_current_ordinal());
     row_location->segment_id = _segment_id;
     row_location->rowset_id = _rowset_id;
 
@@ -1016,7 +1150,7 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
             _pk_index_reader->type_info()->type(), 1, 0);
     auto index_column = index_type->create_column();
     size_t num_read = num_to_read;
-    RETURN_IF_ERROR(index_iterator->next_batch(&num_read, index_column));
+    RETURN_IF_ERROR((*index_iterator)->next_batch(&num_read, index_column));
     DCHECK(num_to_read == num_read);
 
     Slice sought_key = Slice(index_column->get_data_at(0).data, index_column->get_data_at(0).size);
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <map>
 #include <memory> // for unique_ptr
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -57,6 +58,7 @@ namespace vectorized {
 class IDataType;
 }
 
+class ColumnPredicate;
 class ShortKeyIndexDecoder;
 class Schema;
 class StorageReadOptions;
@@ -67,6 +69,7 @@ struct RowLocation;
 namespace segment_v2 {
 
 class BitmapIndexIterator;
+class IndexedColumnIterator;
 class Segment;
 class InvertedIndexIterator;
 class IndexFileReader;
@@ -140,9 +143,13 @@ public:
         return _pk_index_reader.get();
     }
 
+    // If `index_iterator` is given, the primary key index iterator is kept in it and reused by
+    // the next lookup, so that looking up ascending keys does not read the same index page
+    // again for each of them.
     Status lookup_row_key(const Slice& key, const TabletSchema* latest_schema, bool with_seq_col,
                           bool with_rowid, RowLocation* row_location, OlapReaderStatistics* stats,
-                          std::string* encoded_seq_value = nullptr);
+                          std::string* encoded_seq_value = nullptr,
+                          std::unique_ptr<IndexedColumnIterator>* index_iterator = nullptr);
 
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
@@ -234,7 +241,12 @@ private:
     Status _parse_footer(std::shared_ptr<SegmentFooterPB>& footer, OlapReaderStatistics* stats);
     Status _create_column_readers(const SegmentFooterPB& footer);
     Status _load_pk_bloom_filter(OlapReaderStatistics* stats);
-    ColumnReader* _get_column_reader(const TabletColumn& col);
+    Status _get_column_reader(const TabletColumn& col, OlapReaderStatistics* stats,
+                              ColumnReader** reader);
+    // Get the reader of the column with `unique_id`, creating it on the first access.
+    // `*reader` is nullptr if this segment has no data for the column.
+    Status _get_column_reader_by_uid(int32_t unique_id, OlapReaderStatistics* stats,
+                                     ColumnReader** reader);
 
     // Get Iterator which will read variant root column and extract with paths and types info
     Status _new_iterator_with_variant_root(const TabletColumn& tablet_column,
@@ -248,6 +260,11 @@ private:
 
     Status _create_column_readers_once(OlapReaderStatistics* stats);
 
+    // Whether the predicates on a sparse column of variant may match any row, by the segment zone
+    // map of its non-null values.
+    static bool _sparse_column_match_predicates(const SubcolumnReader& sparse_column, ColumnId cid,
+                                                const std::vector<ColumnPredicate*>& predicates);
+
     Status _get_segment_footer(std::shared_ptr<SegmentFooterPB>&, OlapReaderStatistics* stats);
 
     StoragePageCache::CacheKey get_segment_footer_cache_key() const;
@@ -271,11 +288,15 @@ private:
     std::unique_ptr<PrimaryKeyIndexMetaPB> _pk_index_meta;
     PagePointerPB _sk_index_page;
 
+    // map column unique id ---> ordinal of its ColumnMetaPB in the footer
+    // for each column in TabletSchema that has data in this segment. A column that is
+    // missing may be added after this segment is generated.
+    std::unordered_map<int32_t, uint32_t> _column_uid_to_footer_ordinal;
     // map column unique id ---> column reader
-    // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
-    // This means that this segment has no data for that column, which may be added
-    // after this segment is generated.
+    // A ColumnReader is created on the first access of its column, so that a query on a few
+    // columns of a wide table does not pay for the readers of all the others.
     std::map<int32_t, std::unique_ptr<ColumnReader>> _column_readers;
+    std::shared_mutex _column_readers_lock;
 
     // Init from ColumnMetaPB in SegmentFooterPB
     // map column unique id ---> it's inner data type
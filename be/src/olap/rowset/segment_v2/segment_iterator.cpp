@@ -38,6 +38,8 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/cache/cached_remote_file_reader.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
@@ -62,6 +64,7 @@
 #include "olap/types.h"
 #include "olap/utils.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
@@ -70,6 +73,7 @@
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
@@ -404,6 +408,17 @@ Status SegmentIterator::_lazy_init() {
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
     }
+    // Only file cached remote segments benefit, local reads are cheap enough on demand.
+    if (config::enable_segment_prefetch_file_cache && !_opts.read_orderby_key_reverse &&
+        _opts.io_ctx.reader_type == ReaderType::READER_QUERY && !_row_bitmap.isEmpty() &&
+        dynamic_cast<io::CachedRemoteFileReader*>(_segment->file_reader().get()) != nullptr) {
+        _prefetch_file_reader = _segment->file_reader();
+        if (_opts.runtime_state != nullptr && _opts.runtime_state->get_query_ctx() != nullptr) {
+            _query_prefetch_bytes =
+                    _opts.runtime_state->get_query_ctx()->file_cache_prefetch_bytes();
+        }
+        _prefetch_column_pages(_row_bitmap.minimum());
+    }
     return Status::OK();
 }
 
@@ -570,7 +585,9 @@ Status SegmentIterator::_get_row_ranges_by_column_conditions() {
 
     if (!_row_bitmap.isEmpty() &&
         (!_opts.topn_filter_source_node_ids.empty() || !_opts.col_id_to_predicates.empty() ||
-         _opts.delete_condition_predicates->num_of_column_predicate() > 0)) {
+         _opts.delete_condition_predicates->num_of_column_predicate() > 0 ||
+         (_opts.late_arrival_rf_predicates != nullptr &&
+          !_opts.late_arrival_rf_predicates->empty()))) {
         RowRanges condition_row_ranges = RowRanges::create_single(_segment->num_rows());
         RETURN_IF_ERROR(_get_row_ranges_from_conditions(&condition_row_ranges));
         size_t pre_size = _row_bitmap.cardinality();
@@ -589,6 +606,26 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
         cids.insert(entry.first);
     }
 
+    // The runtime filters arriving after the reader is initialized are not in
+    // `col_id_to_predicates`, but they can still prune the pages of this segment.
+    std::vector<std::pair<ColumnId, std::unique_ptr<AndBlockColumnPredicate>>>
+            late_arrival_rf_predicates;
+    if (_opts.late_arrival_rf_predicates != nullptr) {
+        for (const auto& predicate : *_opts.late_arrival_rf_predicates) {
+            auto cid = predicate->column_id();
+            if (cid >= _schema->num_columns() || _schema->column(cid) == nullptr ||
+                _column_iterators[cid] == nullptr ||
+                !_segment->can_apply_predicate_safely(cid, predicate.get(), *_schema,
+                                                      _opts.io_ctx.reader_type)) {
+                continue;
+            }
+            auto and_predicate = std::make_unique<AndBlockColumnPredicate>();
+            and_predicate->add_column_predicate(
+                    SingleColumnBlockPredicate::create_unique(predicate.get()));
+            late_arrival_rf_predicates.emplace_back(cid, std::move(and_predicate));
+        }
+    }
+
     size_t pre_size = 0;
 
     {
@@ -609,6 +646,13 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
             RowRanges::ranges_intersection(bf_row_ranges, column_bf_row_ranges, &bf_row_ranges);
         }
 
+        for (const auto& [cid, predicate] : late_arrival_rf_predicates) {
+            RowRanges column_bf_row_ranges = RowRanges::create_single(num_rows());
+            RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_bloom_filter(
+                    predicate.get(), &column_bf_row_ranges));
+            RowRanges::ranges_intersection(bf_row_ranges, column_bf_row_ranges, &bf_row_ranges);
+        }
+
         pre_size = condition_row_ranges->count();
         RowRanges::ranges_intersection(*condition_row_ranges, bf_row_ranges, condition_row_ranges);
         _opts.stats->rows_bf_filtered += (pre_size - condition_row_ranges->count());
@@ -649,6 +693,14 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
                                            &zone_map_row_ranges);
         }
 
+        for (const auto& [cid, predicate] : late_arrival_rf_predicates) {
+            RowRanges column_row_ranges = RowRanges::create_single(num_rows());
+            RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(
+                    predicate.get(), nullptr, &column_row_ranges));
+            RowRanges::ranges_intersection(zone_map_row_ranges, column_row_ranges,
+                                           &zone_map_row_ranges);
+        }
+
         pre_size = condition_row_ranges->count();
         RowRanges::ranges_intersection(*condition_row_ranges, zone_map_row_ranges,
                                        condition_row_ranges);
@@ -1704,6 +1756,9 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (_prefetch_file_reader != nullptr && nrows_read > 0) {
+        _prefetch_column_pages(_block_rowids[nrows_read - 1] + 1);
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
 
@@ -1782,6 +1837,90 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     return Status::OK();
 }
 
+void SegmentIterator::_prefetch_column_pages(rowid_t rowid) {
+    static constexpr int64_t PREFETCH_MERGE_DISTANCE_BYTES = 128 * 1024;
+    static constexpr int64_t PREFETCH_MAX_READ_BYTES = 4 * 1024 * 1024;
+    auto window_rows = static_cast<uint64_t>(std::max(config::segment_prefetch_window_rows, 1));
+    // prefetch the next window once the reads are in the second half of the current one
+    if (rowid >= num_rows() || rowid + window_rows / 2 < _prefetched_end_rowid) {
+        return;
+    }
+    rowid_t begin = std::max(rowid, _prefetched_end_rowid);
+    auto end = cast_set<rowid_t>(std::min<uint64_t>(num_rows(), begin + window_rows));
+    _prefetched_end_rowid = end;
+    roaring::Roaring rows;
+    rows.addRange(begin, end);
+    rows &= _row_bitmap;
+    if (rows.isEmpty()) {
+        return;
+    }
+
+    std::vector<io::PrefetchRange> ranges;
+    for (auto cid : _schema->column_ids()) {
+        if (_column_iterators[cid] == nullptr) {
+            continue;
+        }
+        Status st = _column_iterators[cid]->get_page_ranges(rows, &ranges);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to get the pages to prefetch of segment " << segment_id()
+                         << ", column " << cid << ": " << st;
+            _prefetch_file_reader.reset();
+            return;
+        }
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.start_offset < rhs.start_offset;
+    });
+
+    // The downloads outlive this iterator, so they must not refer to its query statistics.
+    io::IOContext io_ctx = _opts.io_ctx;
+    io_ctx.is_dryrun = true;
+    io_ctx.query_id = nullptr;
+    io_ctx.file_cache_stats = nullptr;
+    const int64_t max_query_prefetch_bytes = config::segment_prefetch_max_bytes_per_query;
+    for (const auto& range : io::PrefetchRange::merge_adjacent_seq_ranges(
+                 ranges, PREFETCH_MERGE_DISTANCE_BYTES, PREFETCH_MAX_READ_BYTES)) {
+        auto range_bytes = cast_set<int64_t>(range.end_offset - range.start_offset);
+        if (_query_prefetch_bytes != nullptr) {
+            if (max_query_prefetch_bytes > 0 &&
+                _query_prefetch_bytes->load(std::memory_order_relaxed) + range_bytes >
+                        max_query_prefetch_bytes) {
+                // over the budget of the query, the pages are read on demand
+                return;
+            }
+            _query_prefetch_bytes->fetch_add(range_bytes, std::memory_order_relaxed);
+        }
+        Status st = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+                [file_reader = _prefetch_file_reader, io_ctx, range,
+                 query_prefetch_bytes = _query_prefetch_bytes, range_bytes]() {
+                    Defer release_budget {[&]() {
+                        if (query_prefetch_bytes != nullptr) {
+                            query_prefetch_bytes->fetch_sub(range_bytes,
+                                                            std::memory_order_relaxed);
+                        }
+                    }};
+                    size_t size = range.end_offset - range.start_offset;
+                    // a dry run still copies the data if it falls back to a direct remote read
+                    std::unique_ptr<char[]> buffer(new char[size]);
+                    size_t bytes_read = 0;
+                    Status st = file_reader->read_at(range.start_offset, {buffer.get(), size},
+                                                     &bytes_read, &io_ctx);
+                    if (!st.ok()) {
+                        LOG(WARNING) << "failed to prefetch " << file_reader->path().native()
+                                     << ", offset: " << range.start_offset << ", size: " << size
+                                     << ": " << st;
+                    }
+                });
+        if (!st.ok()) {
+            if (_query_prefetch_bytes != nullptr) {
+                _query_prefetch_bytes->fetch_sub(range_bytes, std::memory_order_relaxed);
+            }
+            // the pool is full, the pages are read on demand
+            return;
+        }
+    }
+}
+
 void SegmentIterator::_replace_version_col(size_t num_rows) {
     // Only the rowset with single version need to replace the version column.
     // Doris can't determine the version before publish_version finished, so
@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include <map>
+#include <atomic>
 #include <memory>
 #include <ostream>
 #include <roaring/roaring.hh>
@@ -223,6 +224,9 @@ private:
                                        vectorized::MutableColumns& column_block, size_t nrows);
     [[nodiscard]] Status _read_columns_by_index(uint32_t nrows_read_limit, uint32_t& nrows_read,
                                                 bool set_block_rowid);
+    // Warm the file cache in the background with the pages of the read columns for the next
+    // window of rows from `rowid` on, so that the remote reads of all the columns overlap.
+    void _prefetch_column_pages(rowid_t rowid);
     void _replace_version_col(size_t num_rows);
     Status _init_current_block(vectorized::Block* block,
                                std::vector<vectorized::MutableColumnPtr>& non_pred_vector,
@@ -391,6 +395,12 @@ private:
     roaring::Roaring _row_bitmap;
     // an iterator for `_row_bitmap` that can be used to extract row range to scan
     std::unique_ptr<BitmapRangeIterator> _range_iter;
+    // set if the pages to read are prefetched into the file cache
+    io::FileReaderSPtr _prefetch_file_reader;
+    // the rows before it have been prefetched
+    rowid_t _prefetched_end_rowid = 0;
+    // the bytes being prefetched for the query, see QueryContext::file_cache_prefetch_bytes()
+    std::shared_ptr<std::atomic<int64_t>> _query_prefetch_bytes;
     // the next rowid to read
     rowid_t _cur_rowid;
     // members related to lazy materialization read
@@ -42,10 +42,12 @@
 #include "olap/rowset/rowset_writer_context.h" // RowsetWriterContext
 #include "olap/rowset/segment_creator.h"
 #include "olap/rowset/segment_v2/column_writer.h" // ColumnWriter
+#include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/index_file_writer.h"
 #include "olap/rowset/segment_v2/inverted_index_writer.h"
 #include "olap/rowset/segment_v2/page_io.h"
 #include "olap/rowset/segment_v2/page_pointer.h"
+#include "olap/rowset/segment_v2/zone_map_index.h"
 #include "olap/segment_loader.h"
 #include "olap/short_key_index.h"
 #include "olap/storage_engine.h"
@@ -181,6 +183,14 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
     opts.meta = _footer.add_columns();
 
     init_column_meta(opts.meta, cid, column, schema);
+    // the first sort key column is ascending inside a segment
+    if (config::enable_for_encoding_sorted_key_column && cid == 0 && column.is_key() &&
+        !_is_mow_with_cluster_key()) {
+        auto encoding = EncodingInfo::get_sorted_column_encoding(column.type());
+        if (encoding != DEFAULT_ENCODING) {
+            opts.meta->set_encoding(encoding);
+        }
+    }
 
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
@@ -229,6 +239,10 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
         opts.index_file_writer = _index_file_writer;
         // TODO support multiple inverted index
     }
+    // struct fields keep their own zone maps, see ColumnWriterOptions
+    opts.need_sub_column_zone_map =
+            opts.need_zone_map && column.type() == FieldType::OLAP_FIELD_TYPE_STRUCT;
+
 #define DISABLE_INDEX_IF_FIELD_TYPE(TYPE, type_name)          \
     if (column.type() == FieldType::OLAP_FIELD_TYPE_##TYPE) { \
         opts.need_zone_map = false;                           \
@@ -430,8 +444,14 @@ Status SegmentWriter::append_block_with_variant_subcolumns(vectorized::Block& da
 
             // add sparse column to footer
             auto* column_pb = _footer.mutable_columns(i);
-            init_column_meta(column_pb->add_sparse_columns(), -1, sparse_tablet_column,
-                             _flush_schema);
+            auto* sparse_column_pb = column_pb->add_sparse_columns();
+            init_column_meta(sparse_column_pb, -1, sparse_tablet_column, _flush_schema);
+            // the values are merged into the root column, keep their zone map for pruning
+            RETURN_IF_ERROR(write_sparse_column_zone_map(
+                    sparse_tablet_column,
+                    {entry->data.get_finalized_column_ptr()->get_ptr(),
+                     entry->data.get_least_common_type(), sparse_tablet_column.name()},
+                    0, data.rows(), _file_writer, sparse_column_pb));
         }
     }
 
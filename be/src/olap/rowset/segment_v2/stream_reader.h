@@ -47,6 +47,9 @@ using SubstreamReaderTree = vectorized::SubcolumnsTree<SubstreamIterator, false>
 struct SubcolumnReader {
     std::unique_ptr<ColumnReader> reader;
     std::shared_ptr<const vectorized::IDataType> file_column_type;
+    // Sparse columns have no reader, their data is read from the root column. Keep their meta for
+    // the segment zone map.
+    std::shared_ptr<const ColumnMetaPB> sparse_column_meta;
 };
 using SubcolumnColumnReaders = vectorized::SubcolumnsTree<SubcolumnReader, true>;
 
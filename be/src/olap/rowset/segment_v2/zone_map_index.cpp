@@ -27,6 +27,7 @@
 #include "olap/rowset/segment_v2/encoding_info.h"
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/indexed_column_writer.h"
+#include "olap/tablet_schema.h"
 #include "olap/types.h"
 #include "runtime/primitive_type.h"
 #include "util/slice.h"
@@ -35,6 +36,7 @@
 #include "vec/common/string_ref.h"
 #include "vec/common/unaligned.h"
 #include "vec/data_types/data_type.h"
+#include "vec/olap/olap_data_convertor.h"
 
 namespace doris {
 struct uint24_t;
@@ -140,6 +142,44 @@ Status TypedZoneMapIndexWriter<Type>::finish(io::FileWriter* file_writer,
     return writer.finish(meta->mutable_page_zone_maps());
 }
 
+Status write_sparse_column_zone_map(const TabletColumn& column,
+                                    const vectorized::ColumnWithTypeAndName& data, size_t row_pos,
+                                    size_t num_rows, io::FileWriter* file_writer,
+                                    ColumnMetaPB* meta) {
+    std::unique_ptr<Field> field(StorageFieldFactory::create(column));
+    if (field == nullptr || num_rows == 0 ||
+        !ZoneMapIndexWriter::is_supported_type(field->type())) {
+        return Status::OK();
+    }
+    vectorized::OlapBlockDataConvertor convertor;
+    convertor.add_column_data_convertor(column);
+    RETURN_IF_ERROR(convertor.set_source_content_with_specifid_column(data, row_pos, num_rows, 0));
+    auto [status, converted] = convertor.convert_column_data(0);
+    RETURN_IF_ERROR(status);
+
+    std::unique_ptr<ZoneMapIndexWriter> writer;
+    RETURN_IF_ERROR(ZoneMapIndexWriter::create(field.get(), writer));
+    const auto* null_map = converted->get_nullmap();
+    const auto* values = reinterpret_cast<const uint8_t*>(converted->get_data());
+    size_t offset = 0;
+    while (offset < num_rows) {
+        size_t step = 1;
+        bool is_null = null_map != nullptr && null_map[offset];
+        while (offset + step < num_rows &&
+               (null_map != nullptr && null_map[offset + step]) == is_null) {
+            ++step;
+        }
+        if (is_null) {
+            writer->add_nulls(static_cast<uint32_t>(step));
+        } else {
+            writer->add_values(values + offset * field->size(), step);
+        }
+        offset += step;
+    }
+    RETURN_IF_ERROR(writer->flush());
+    return writer->finish(file_writer, meta->add_indexes());
+}
+
 Status ZoneMapIndexReader::load(bool use_page_cache, bool kept_in_memory,
                                 OlapReaderStatistics* index_load_stats) {
     // TODO yyq: implement a new once flag to avoid status construct.
@@ -230,5 +270,18 @@ Status ZoneMapIndexWriter::create(Field* field, std::unique_ptr<ZoneMapIndexWrit
         return Status::InvalidArgument("Invalid type!");
     }
 }
+
+bool ZoneMapIndexWriter::is_supported_type(FieldType type) {
+    switch (type) {
+#define M(NAME) case FieldType::OLAP_FIELD_##NAME:
+        APPLY_FOR_PRIMITITYPE(M)
+#undef M
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL:
+    case FieldType::OLAP_FIELD_TYPE_BOOL:
+        return true;
+    default:
+        return false;
+    }
+}
 } // namespace segment_v2
 } // namespace doris
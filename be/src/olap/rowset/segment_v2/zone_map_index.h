@@ -35,9 +35,13 @@
 
 namespace doris {
 
+class TabletColumn;
 namespace io {
 class FileWriter;
 } // namespace io
+namespace vectorized {
+struct ColumnWithTypeAndName;
+} // namespace vectorized
 
 namespace segment_v2 {
 
@@ -76,6 +80,9 @@ class ZoneMapIndexWriter {
 public:
     static Status create(Field* field, std::unique_ptr<ZoneMapIndexWriter>& res);
 
+    // Whether create() supports columns of `type`.
+    static bool is_supported_type(FieldType type);
+
     ZoneMapIndexWriter() = default;
 
     virtual ~ZoneMapIndexWriter() = default;
@@ -143,6 +150,14 @@ private:
     uint64_t _estimated_size = 0;
 };
 
+// Writes the zone map index of rows [row_pos, row_pos + num_rows) of `data` into `meta`, as one
+// page. It is used by the sparse subcolumns of variant, which are stored in the root column and
+// have no column writer of their own. Columns of unsupported types are skipped.
+Status write_sparse_column_zone_map(const TabletColumn& column,
+                                    const vectorized::ColumnWithTypeAndName& data, size_t row_pos,
+                                    size_t num_rows, io::FileWriter* file_writer,
+                                    ColumnMetaPB* meta);
+
 class ZoneMapIndexReader : public MetadataAdder<ZoneMapIndexReader> {
 public:
     explicit ZoneMapIndexReader(io::FileReaderSPtr file_reader,
@@ -28,6 +28,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <limits>
 #include <list>
 #include <mutex>
 #include <ostream>
@@ -228,6 +229,7 @@ Status TabletManager::_add_tablet_to_map_unlocked(TTabletId tablet_id,
     tablet->register_tablet_into_dir();
     tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
     tablet_map[tablet_id] = tablet;
+    _publish_tablet_map_unlocked(tablet_id);
     _add_tablet_to_partition(tablet);
     g_tablet_meta_schema_columns_count << tablet->tablet_meta()->tablet_columns_num();
     COUNTER_UPDATE(ADD_CHILD_TIMER(profile, "RegisterTabletInfo", "AddTablet"),
@@ -554,6 +556,7 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
         _remove_tablet_from_partition(to_drop_tablet);
         tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
         tablet_map.erase(tablet_id);
+        _publish_tablet_map_unlocked(tablet_id);
     }
 
     to_drop_tablet->clear_cache();
@@ -593,7 +596,7 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
 }
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, bool include_deleted, string* err) {
-    std::shared_lock rdlock(_get_tablets_shard_lock(tablet_id));
+    // the published tablet map is read without the shard lock
     return _get_tablet_unlocked(tablet_id, include_deleted, err);
 }
 
@@ -606,20 +609,13 @@ std::vector<TabletSharedPtr> TabletManager::get_all_tablet(std::function<bool(Ta
 
 void TabletManager::for_each_tablet(std::function<void(const TabletSharedPtr&)>&& handler,
                                     std::function<bool(Tablet*)>&& filter) {
-    std::vector<TabletSharedPtr> tablets;
     for (const auto& tablets_shard : _tablets_shards) {
-        tablets.clear();
-        {
-            std::shared_lock rdlock(tablets_shard.lock);
-            for (const auto& [id, tablet] : tablets_shard.tablet_map) {
-                if (filter(tablet.get())) {
-                    tablets.emplace_back(tablet);
-                }
+        auto tablet_map = tablets_shard.tablet_map_snapshot.get();
+        for (const auto& [id, tablet] : *tablet_map) {
+            if (filter(tablet.get())) {
+                handler(tablet);
             }
         }
-        for (const auto& tablet : tablets) {
-            handler(tablet);
-        }
     }
 }
 
@@ -659,7 +655,6 @@ TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool in
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, TabletUid tablet_uid,
                                           bool include_deleted, string* err) {
-    std::shared_lock rdlock(_get_tablets_shard_lock(tablet_id));
     TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id, include_deleted, err);
     if (tablet != nullptr && tablet->tablet_uid() == tablet_uid) {
         return tablet;
@@ -738,6 +733,7 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    uint32_t highest_priority = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
     TabletSharedPtr best_tablet;
@@ -801,6 +797,14 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (current_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
+        // Tablets read a lot go first, their compaction saves the most query cost.
+        uint32_t current_compaction_priority = current_compaction_score;
+        if (config::compaction_read_amplification_weight > 0) {
+            double read_cost = tablet_ptr->read_amplification(now_ms) *
+                               config::compaction_read_amplification_weight;
+            current_compaction_priority += static_cast<uint32_t>(
+                    std::min(read_cost, std::numeric_limits<int32_t>::max() / 2.0));
+        }
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
@@ -815,10 +819,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
 
         if (compaction_num_per_round > 1 && !tablet_ptr->should_fetch_from_peer()) {
             TabletScore ts;
-            ts.score = current_compaction_score;
+            ts.score = current_compaction_priority;
             ts.tablet_ptr = tablet_ptr;
             if ((top_tablets.size() >= compaction_num_per_round &&
-                 current_compaction_score > top_tablets.top().score) ||
+                 current_compaction_priority > top_tablets.top().score) ||
                 top_tablets.size() < compaction_num_per_round) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
@@ -831,11 +835,13 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                 }
             }
         } else {
-            if (current_compaction_score > highest_score && !tablet_ptr->should_fetch_from_peer()) {
+            if (current_compaction_priority > highest_priority &&
+                !tablet_ptr->should_fetch_from_peer()) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
                 if (ret) {
-                    highest_score = current_compaction_score;
+                    highest_score = std::max(current_compaction_score, highest_score);
+                    highest_priority = current_compaction_priority;
                     best_tablet = tablet_ptr;
                 }
             }
@@ -1573,9 +1579,10 @@ Status TabletManager::_create_tablet_meta_unlocked(const TCreateTabletReq& reque
 
 TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id) {
     VLOG_NOTICE << "begin to get tablet. tablet_id=" << tablet_id;
-    tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
-    const auto& iter = tablet_map.find(tablet_id);
-    if (iter != tablet_map.end()) {
+    // the published tablet map equals `tablet_map` whenever the shard lock is not held by writers
+    auto tablet_map = _get_tablets_shard(tablet_id).tablet_map_snapshot.get();
+    const auto& iter = tablet_map->find(tablet_id);
+    if (iter != tablet_map->end()) {
         return iter->second;
     }
     return nullptr;
@@ -1607,8 +1614,8 @@ void TabletManager::_remove_tablet_from_partition(const TabletSharedPtr& tablet)
 void TabletManager::obtain_specific_quantity_tablets(vector<TabletInfo>& tablets_info,
                                                      int64_t num) {
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rdlock(tablets_shard.lock);
-        for (const auto& item : tablets_shard.tablet_map) {
+        auto tablet_map = tablets_shard.tablet_map_snapshot.get();
+        for (const auto& item : *tablet_map) {
             TabletSharedPtr tablet = item.second;
             if (tablets_info.size() >= num) {
                 return;
@@ -1629,6 +1636,12 @@ TabletManager::tablet_map_t& TabletManager::_get_tablet_map(TTabletId tabletId)
     return _get_tablets_shard(tabletId).tablet_map;
 }
 
+void TabletManager::_publish_tablet_map_unlocked(TTabletId tablet_id) {
+    auto& tablets_shard = _get_tablets_shard(tablet_id);
+    tablets_shard.tablet_map_snapshot.set(
+            std::make_unique<const tablet_map_t>(tablets_shard.tablet_map));
+}
+
 TabletManager::tablets_shard& TabletManager::_get_tablets_shard(TTabletId tabletId) {
     return _tablets_shards[tabletId & _tablets_shards_mask];
 }
@@ -36,6 +36,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/multi_version.h"
 #include "common/status.h"
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
@@ -236,10 +237,14 @@ private:
         tablets_shard() = default;
         tablets_shard(tablets_shard&& shard) {
             tablet_map = std::move(shard.tablet_map);
+            tablet_map_snapshot = std::move(shard.tablet_map_snapshot);
             tablets_under_transition = std::move(shard.tablets_under_transition);
         }
         mutable std::shared_mutex lock;
         tablet_map_t tablet_map;
+        // Copy of `tablet_map` published under the write lock after each change. Lookups and
+        // scans of all tablets read it without the lock, so they never wait for the writers.
+        MultiVersion<tablet_map_t> tablet_map_snapshot {std::make_unique<const tablet_map_t>()};
         std::mutex lock_for_transition;
         // tablet do clone, path gc, move to trash, disk migrate will record in tablets_under_transition
         // tablet <reason, thread_id, lock_times>
@@ -275,6 +280,9 @@ private:
 
     tablet_map_t& _get_tablet_map(TTabletId tablet_id);
 
+    // Publish the tablet map of the shard of `tablet_id`, must hold the write lock of the shard.
+    void _publish_tablet_map_unlocked(TTabletId tablet_id);
+
     tablets_shard& _get_tablets_shard(TTabletId tabletId);
 
     std::mutex _two_tablet_mtx;
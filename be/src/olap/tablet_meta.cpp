@@ -1464,18 +1464,11 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
                 DeleteBitmapAggCache::instance()->release(handle2);
             }
         }
-        {
-            std::shared_lock l(lock);
-            DeleteBitmap::BitmapKey start {std::get<0>(bmk), std::get<1>(bmk), start_version};
-            for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end(); ++it) {
-                auto& [k, bm] = *it;
-                if (std::get<0>(k) != std::get<0>(bmk) || std::get<1>(k) != std::get<1>(bmk) ||
-                    std::get<2>(k) > std::get<2>(bmk)) {
-                    break;
-                }
-                val->bitmap |= bm;
-            }
-        }
+        _union_versions(bmk, start_version, &val->bitmap);
+        // The cached bitmap lives long and is read by every query, deleted rows often come
+        // in runs, so compress them into run containers.
+        val->bitmap.runOptimize();
+        val->bitmap.shrinkToFit();
         size_t charge = val->bitmap.getSizeInBytes() + sizeof(DeleteBitmapAggCache::Value);
         handle = DeleteBitmapAggCache::instance()->insert(key, val, charge, charge,
                                                           CachePriority::NORMAL);
@@ -1511,6 +1504,13 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
 std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg_without_cache(
         const BitmapKey& bmk, const int64_t start_version) const {
     std::shared_ptr<roaring::Roaring> bitmap = std::make_shared<roaring::Roaring>();
+    _union_versions(bmk, start_version, bitmap.get());
+    return bitmap;
+}
+
+void DeleteBitmap::_union_versions(const BitmapKey& bmk, Version start_version,
+                                   roaring::Roaring* bitmap) const {
+    std::vector<const roaring::Roaring*> bitmaps;
     std::shared_lock l(lock);
     DeleteBitmap::BitmapKey start {std::get<0>(bmk), std::get<1>(bmk), start_version};
     for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end(); ++it) {
@@ -1519,9 +1519,18 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg_without_cache(
             std::get<2>(k) > std::get<2>(bmk)) {
             break;
         }
-        *bitmap |= bm;
+        bitmaps.push_back(&bm);
+    }
+    if (bitmaps.empty()) {
+        return;
+    }
+    // A row updated by many loads has a small bitmap on each version, unioning them all at
+    // once avoids copying the growing result container by container for each of them.
+    if (bitmap->isEmpty()) {
+        *bitmap = roaring::Roaring::fastunion(bitmaps.size(), bitmaps.data());
+    } else {
+        *bitmap |= roaring::Roaring::fastunion(bitmaps.size(), bitmaps.data());
     }
-    return bitmap;
 }
 
 std::string tablet_state_name(TabletState state) {
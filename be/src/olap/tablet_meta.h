@@ -581,6 +581,10 @@ public:
 
 private:
     DeleteBitmap::Version _get_rowset_cache_version(const BitmapKey& bmk) const;
+    // Unions the bitmaps of `bmk`'s segment with versions in [start_version, version of bmk]
+    // into `bitmap`.
+    void _union_versions(const BitmapKey& bmk, Version start_version,
+                         roaring::Roaring* bitmap) const;
 
     int64_t _tablet_id;
     mutable std::shared_mutex _rowset_cache_version_lock;
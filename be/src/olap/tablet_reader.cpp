@@ -159,6 +159,36 @@ bool TabletReader::_optimize_for_single_rowset(
     return !has_overlapping && nonoverlapping_count == 1 && !has_delete_rowset;
 }
 
+bool TabletReader::_rowsets_not_mono_asc_disjoint(const ReaderParams& read_params) {
+    std::string pre_rs_last_key;
+    bool pre_rs_key_bounds_truncated {false};
+    const std::vector<RowSetSplits>& rs_splits = read_params.rs_splits;
+    for (const auto& rs_split : rs_splits) {
+        if (rs_split.rs_reader->rowset()->num_rows() == 0) {
+            continue;
+        }
+        if (rs_split.rs_reader->rowset()->is_segments_overlapping()) {
+            return true;
+        }
+        std::string rs_first_key;
+        bool has_first_key = rs_split.rs_reader->rowset()->first_key(&rs_first_key);
+        if (!has_first_key) {
+            return true;
+        }
+        bool cur_rs_key_bounds_truncated {
+                rs_split.rs_reader->rowset()->is_segments_key_bounds_truncated()};
+        if (!Slice::lhs_is_strictly_less_than_rhs(Slice {pre_rs_last_key},
+                                                  pre_rs_key_bounds_truncated, Slice {rs_first_key},
+                                                  cur_rs_key_bounds_truncated)) {
+            return true;
+        }
+        bool has_last_key = rs_split.rs_reader->rowset()->last_key(&pre_rs_last_key);
+        pre_rs_key_bounds_truncated = cur_rs_key_bounds_truncated;
+        CHECK(has_last_key);
+    }
+    return false;
+}
+
 Status TabletReader::_capture_rs_readers(const ReaderParams& read_params) {
     SCOPED_RAW_TIMER(&_stats.tablet_reader_capture_rs_readers_timer_ns);
     if (read_params.rs_splits.empty()) {
@@ -235,6 +265,7 @@ Status TabletReader::_capture_rs_readers(const ReaderParams& read_params) {
     _reader_context.need_ordered_result = need_ordered_result;
     _reader_context.topn_filter_source_node_ids = read_params.topn_filter_source_node_ids;
     _reader_context.topn_filter_target_node_id = read_params.topn_filter_target_node_id;
+    _reader_context.late_arrival_rf_predicates = read_params.late_arrival_rf_predicates;
     _reader_context.read_orderby_key_reverse = read_params.read_orderby_key_reverse;
     _reader_context.read_orderby_key_limit = read_params.read_orderby_key_limit;
     _reader_context.filter_block_conjuncts = read_params.filter_block_conjuncts;
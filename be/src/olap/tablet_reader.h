@@ -170,6 +170,8 @@ public:
         RowIdConversion* rowid_conversion = nullptr;
         std::vector<int> topn_filter_source_node_ids;
         int topn_filter_target_node_id = -1;
+        // predicates of the runtime filters arriving after the reader is initialized
+        const std::vector<std::shared_ptr<ColumnPredicate>>* late_arrival_rf_predicates = nullptr;
         // used for special optimization for query : ORDER BY key LIMIT n
         bool read_orderby_key = false;
         // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -246,6 +248,9 @@ protected:
 
     bool _optimize_for_single_rowset(const std::vector<RowsetReaderSharedPtr>& rs_readers);
 
+    // return false if keys of rowsets are mono ascending and disjoint
+    bool _rowsets_not_mono_asc_disjoint(const ReaderParams& read_params);
+
     Status _init_keys_param(const ReaderParams& read_params);
 
     Status _init_orderby_keys_param(const ReaderParams& read_params);
@@ -64,6 +64,18 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
     return std::make_pair(lru_handle, tablet_schema_ptr);
 }
 
+std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::acquire(Cache::Handle* handle) {
+    auto* e = reinterpret_cast<LRUHandle*>(handle);
+    auto* value = (CacheValue*)LRUCachePolicy::value(handle);
+    // The entry is pinned by `handle`, so it can only be missing if the cache is disabled.
+    auto* lru_handle = e->in_cache ? lookup(CacheKey(e->key_data, e->key_length)) : nullptr;
+    if (lru_handle == nullptr) {
+        return insert(value->tablet_schema->to_key());
+    }
+    g_tablet_schema_cache_hit_count << 1;
+    return std::make_pair(lru_handle, value->tablet_schema);
+}
+
 void TabletSchemaCache::release(Cache::Handle* lru_handle) {
     LRUCachePolicy::release(lru_handle);
 }
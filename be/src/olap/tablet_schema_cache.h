@@ -42,6 +42,10 @@ public:
 
     std::pair<Cache::Handle*, TabletSchemaSPtr> insert(const std::string& key);
 
+    // Returns a new handle of the schema held by `handle`, without serializing the schema
+    // again to compute its key.
+    std::pair<Cache::Handle*, TabletSchemaSPtr> acquire(Cache::Handle* handle);
+
     void release(Cache::Handle*);
 
 private:
@@ -29,7 +29,10 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -66,6 +69,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -565,31 +569,38 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size = 0;
     MonotonicStopWatch watch;
     watch.start();
-    for (auto& file_name : file_name_list) {
+    auto download_file = [&](const std::string& file_name) -> Status {
         auto remote_file_url = remote_url_prefix + file_name;
 
-        // get file length
+        // get file length and md5
         uint64_t file_size = 0;
-        auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
+        std::string file_md5;
+        auto get_file_size_cb = [&remote_file_url, &file_size, &file_md5](HttpClient* client) {
+            std::string url = remote_file_url;
+            if (config::enable_download_md5sum_check) {
+                url = fmt::format("{}&acquire_md5=true", remote_file_url);
+            }
+            RETURN_IF_ERROR(client->init(url));
             client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
             RETURN_IF_ERROR(client->head());
             RETURN_IF_ERROR(client->get_content_length(&file_size));
+            if (config::enable_download_md5sum_check) {
+                RETURN_IF_ERROR(client->get_content_md5(&file_md5));
+            }
             return Status::OK();
         };
         RETURN_IF_ERROR(
                 HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_file_size_cb));
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(file_size)) {
+        // check disk capacity, the files are downloaded at the same time
+        if (data_dir->reach_capacity_limit(total_file_size.fetch_add(file_size) + file_size)) {
             return Status::Error<EXCEEDED_LIMIT>(
                     "reach the capacity limit of path {}, file_size={}", data_dir->path(),
                     file_size);
         }
 
-        total_file_size += file_size;
         uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
@@ -601,11 +612,21 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
                   << " to: " << local_file_path << ". size(B): " << file_size
                   << ", timeout(s): " << estimate_timeout;
 
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path,
-                            file_size](HttpClient* client) {
+        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size,
+                            &file_md5](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
+            // verify the md5 computed while downloading, the file is not read again
+            std::string local_file_md5;
+            RETURN_IF_ERROR(client->download(local_file_path,
+                                             file_md5.empty() ? nullptr : &local_file_md5));
+            if (local_file_md5 != file_md5) {
+                LOG(WARNING) << "download file md5 error"
+                             << ", remote_path=" << mask_token(remote_file_url)
+                             << ", remote_file_md5=" << file_md5
+                             << ", local_file_md5=" << local_file_md5;
+                return Status::InternalError("downloaded file md5 is not equal");
+            }
 
             std::error_code ec;
             // Check file length
@@ -625,24 +646,84 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             return io::global_local_filesystem()->permission(local_file_path,
                                                              io::LocalFileSystem::PERMS_OWNER_RW);
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    // Clone files from remote backend
+    std::vector<std::function<Status()>> downloads;
+    for (const auto& file_name : file_name_list) {
+        downloads.emplace_back([&download_file, &file_name]() { return download_file(file_name); });
+    }
+    RETURN_IF_ERROR(_download_concurrently(std::move(downloads)));
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
-        copy_rate = total_file_size / ((double)total_time_ms) / 1000;
+        copy_rate = total_file_size.load() / ((double)total_time_ms) / 1000;
     }
-    _copy_size = (int64_t)total_file_size;
+    _copy_size = (int64_t)total_file_size.load();
     _copy_time_ms = (int64_t)total_time_ms;
     LOG(INFO) << "succeed to copy tablet " << _signature
               << ", total files: " << file_name_list.size()
-              << ", total file size: " << total_file_size << " B, cost: " << total_time_ms << " ms"
+              << ", total file size: " << total_file_size.load() << " B, cost: " << total_time_ms
+              << " ms"
               << ", rate: " << copy_rate << " MB/s";
     return Status::OK();
 }
 
+Status EngineCloneTask::_download_concurrently(std::vector<std::function<Status()>>&& downloads) {
+    if (downloads.empty()) {
+        return Status::OK();
+    }
+    // The last one downloads the tablet header, it is run after all the data files are complete.
+    auto download_header = std::move(downloads.back());
+    downloads.pop_back();
+
+    int concurrency = std::min(config::clone_download_files_concurrency,
+                               static_cast<int>(downloads.size()));
+    if (concurrency <= 1) {
+        for (auto& download : downloads) {
+            RETURN_IF_ERROR(download());
+        }
+        return download_header();
+    }
+
+    std::unique_ptr<ThreadPool> download_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("CloneDownloadPool")
+                            .set_min_threads(concurrency)
+                            .set_max_threads(concurrency)
+                            .build(&download_pool));
+    std::mutex status_lock;
+    Status status;
+    for (auto& download : downloads) {
+        auto st = download_pool->submit_func([&, this]() {
+            SCOPED_ATTACH_TASK(_mem_tracker);
+            {
+                std::lock_guard l(status_lock);
+                if (!status.ok()) {
+                    return;
+                }
+            }
+            auto st = download();
+            if (!st.ok()) {
+                std::lock_guard l(status_lock);
+                if (status.ok()) {
+                    status = std::move(st);
+                }
+            }
+        });
+        if (!st.ok()) {
+            std::lock_guard l(status_lock);
+            status = std::move(st);
+            break;
+        }
+    }
+    download_pool->wait();
+    RETURN_IF_ERROR(status);
+    return download_header();
+}
+
 Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::string& address,
                                               const std::string& remote_dir,
                                               const std::string& local_dir) {
@@ -678,6 +759,7 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
     std::vector<std::pair<std::string, size_t>> batch_files;
+    std::vector<std::function<Status()>> downloads;
     for (size_t i = 0; i < total_files;) {
         size_t batch_file_size = 0;
         for (size_t j = i; j < total_files; j++) {
@@ -691,19 +773,21 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
             batch_file_size += file_info_list[j].second;
         }
 
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(batch_file_size)) {
+        // check disk capacity, the batches are downloaded at the same time
+        if (data_dir->reach_capacity_limit(total_file_size + batch_file_size)) {
             return Status::Error<EXCEEDED_LIMIT>(
                     "reach the capacity limit of path {}, file_size={}", data_dir->path(),
                     batch_file_size);
         }
 
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
-
         total_file_size += batch_file_size;
         i += batch_files.size();
+        downloads.emplace_back([&, batch_files = std::move(batch_files)]() {
+            return download_files_v2(address, token, remote_dir, local_dir, batch_files);
+        });
         batch_files.clear();
     }
+    RETURN_IF_ERROR(_download_concurrently(std::move(downloads)));
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
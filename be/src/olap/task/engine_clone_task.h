@@ -19,6 +19,7 @@
 
 #include <gen_cpp/Types_types.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -85,6 +86,11 @@ private:
     Status _batch_download_files(DataDir* data_dir, const std::string& endpoint,
                                  const std::string& remote_dir, const std::string& local_dir);
 
+    // Run the downloads of the files of one tablet with up to
+    // `clone_download_files_concurrency` threads, the last one downloads the header and is
+    // run alone after all others succeed.
+    Status _download_concurrently(std::vector<std::function<Status()>>&& downloads);
+
     Status _make_snapshot(const std::string& ip, int port, TTableId tablet_id,
                           TSchemaHash schema_hash, int timeout_s,
                           const std::vector<Version>& missing_versions, std::string* snapshot_path,
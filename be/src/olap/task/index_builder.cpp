@@ -17,8 +17,10 @@
 
 #include "olap/task/index_builder.h"
 
+#include <algorithm>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset.h"
@@ -30,7 +32,9 @@
 #include "olap/segment_loader.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace doris {
@@ -43,12 +47,9 @@ IndexBuilder::IndexBuilder(StorageEngine& engine, TabletSharedPtr tablet,
           _tablet(std::move(tablet)),
           _columns(columns),
           _alter_inverted_indexes(alter_inverted_indexes),
-          _is_drop_op(is_drop_op) {
-    _olap_data_convertor = std::make_unique<vectorized::OlapBlockDataConvertor>();
-}
+          _is_drop_op(is_drop_op) {}
 
 IndexBuilder::~IndexBuilder() {
-    _olap_data_convertor.reset();
     _inverted_index_builders.clear();
 }
 
@@ -352,6 +353,7 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
         const auto& fs = io::global_local_filesystem();
         auto output_rowset_schema = output_rowset_meta->tablet_schema();
         size_t inverted_index_size = 0;
+        std::vector<SegmentIndexBuildTask> build_tasks;
         for (auto& seg_ptr : segments) {
             std::string index_path_prefix {
                     InvertedIndexDescriptor::get_index_file_path_prefix(local_segment_path(
@@ -359,7 +361,8 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
                             seg_ptr->id()))};
             std::vector<ColumnId> return_columns;
             std::vector<std::pair<int64_t, int64_t>> inverted_index_writer_signs;
-            _olap_data_convertor->reserve(_alter_inverted_indexes.size());
+            auto olap_data_convertor = std::make_unique<vectorized::OlapBlockDataConvertor>();
+            olap_data_convertor->reserve(_alter_inverted_indexes.size());
 
             std::unique_ptr<IndexFileWriter> index_file_writer = nullptr;
             if (output_rowset_schema->get_inverted_index_storage_format() >=
@@ -422,7 +425,7 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
                     continue;
                 }
                 DCHECK(output_rowset_schema->has_inverted_index_with_index_id(index_id));
-                _olap_data_convertor->add_column_data_convertor(column);
+                olap_data_convertor->add_column_data_convertor(column);
                 return_columns.emplace_back(column_idx);
                 std::unique_ptr<Field> field(FieldFactory::create(column));
                 const auto* index_meta = output_rowset_schema->inverted_index(column);
@@ -456,77 +459,11 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
                 // no columns to read
                 continue;
             }
-            // create iterator for each segment
-            StorageReadOptions read_options;
-            OlapReaderStatistics stats;
-            read_options.stats = &stats;
-            read_options.tablet_schema = output_rowset_schema;
-            std::shared_ptr<Schema> schema =
-                    std::make_shared<Schema>(output_rowset_schema->columns(), return_columns);
-            std::unique_ptr<RowwiseIterator> iter;
-            auto res = seg_ptr->new_iterator(schema, read_options, &iter);
-            DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_create_iterator_error", {
-                res = Status::Error<ErrorCode::INTERNAL_ERROR>(
-                        "debug point: handle_single_rowset_create_iterator_error");
-            })
-            if (!res.ok()) {
-                LOG(WARNING) << "failed to create iterator[" << seg_ptr->id()
-                             << "]: " << res.to_string();
-                return Status::Error<ErrorCode::ROWSET_READER_INIT>(res.to_string());
-            }
-
-            auto block = vectorized::Block::create_unique(
-                    output_rowset_schema->create_block(return_columns));
-            while (true) {
-                auto status = iter->next_batch(block.get());
-                DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_iterator_next_batch_error", {
-                    status = Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
-                            "next_batch fault injection");
-                });
-                if (!status.ok()) {
-                    if (status.is<ErrorCode::END_OF_FILE>()) {
-                        break;
-                    }
-                    LOG(WARNING)
-                            << "failed to read next block when schema change for inverted index."
-                            << ", err=" << status.to_string();
-                    return status;
-                }
-
-                // write inverted index data
-                status = _write_inverted_index_data(output_rowset_schema, iter->data_id(),
-                                                    block.get());
-                DBUG_EXECUTE_IF(
-                        "IndexBuilder::handle_single_rowset_write_inverted_index_data_error", {
-                            status = Status::Error<ErrorCode::INTERNAL_ERROR>(
-                                    "debug point: "
-                                    "handle_single_rowset_write_inverted_index_data_error");
-                        })
-                if (!status.ok()) {
-                    return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
-                            "failed to write block.");
-                }
-                block->clear_column_data();
-            }
-
-            // finish write inverted index, flush data to compound file
-            for (auto& writer_sign : inverted_index_writer_signs) {
-                try {
-                    if (_inverted_index_builders[writer_sign]) {
-                        RETURN_IF_ERROR(_inverted_index_builders[writer_sign]->finish());
-                    }
-                    DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_index_build_finish_error", {
-                        _CLTHROWA(CL_ERR_IO,
-                                  "debug point: handle_single_rowset_index_build_finish_error");
-                    })
-                } catch (const std::exception& e) {
-                    return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
-                            "CLuceneError occured: {}", e.what());
-                }
-            }
-
-            _olap_data_convertor->reset();
+            build_tasks.push_back({seg_ptr, std::move(return_columns),
+                                   std::move(inverted_index_writer_signs),
+                                   std::move(olap_data_convertor)});
         }
+        RETURN_IF_ERROR(_build_segment_indexes(output_rowset_schema, build_tasks));
         for (auto&& [seg_id, index_file_writer] : _index_file_writers) {
             auto st = index_file_writer->close();
             DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_file_writer_close_error", {
@@ -552,11 +489,142 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
     return Status::OK();
 }
 
-Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema, int32_t segment_idx,
-                                                vectorized::Block* block) {
+Status IndexBuilder::_build_segment_index(const TabletSchemaSPtr& output_rowset_schema,
+                                          const SegmentIndexBuildTask& task) {
+    // create iterator for each segment
+    StorageReadOptions read_options;
+    OlapReaderStatistics stats;
+    read_options.stats = &stats;
+    read_options.tablet_schema = output_rowset_schema;
+    std::shared_ptr<Schema> schema =
+            std::make_shared<Schema>(output_rowset_schema->columns(), task.return_columns);
+    std::unique_ptr<RowwiseIterator> iter;
+    auto res = task.segment->new_iterator(schema, read_options, &iter);
+    DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_create_iterator_error", {
+        res = Status::Error<ErrorCode::INTERNAL_ERROR>(
+                "debug point: handle_single_rowset_create_iterator_error");
+    })
+    if (!res.ok()) {
+        LOG(WARNING) << "failed to create iterator[" << task.segment->id()
+                     << "]: " << res.to_string();
+        return Status::Error<ErrorCode::ROWSET_READER_INIT>(res.to_string());
+    }
+
+    auto block = vectorized::Block::create_unique(
+            output_rowset_schema->create_block(task.return_columns));
+    while (true) {
+        auto status = iter->next_batch(block.get());
+        DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_iterator_next_batch_error", {
+            status = Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
+                    "next_batch fault injection");
+        });
+        if (!status.ok()) {
+            if (status.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            LOG(WARNING) << "failed to read next block when schema change for inverted index."
+                         << ", err=" << status.to_string();
+            return status;
+        }
+
+        // write inverted index data
+        status = _write_inverted_index_data(output_rowset_schema, iter->data_id(), block.get(),
+                                            task.convertor.get());
+        DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_write_inverted_index_data_error", {
+            status = Status::Error<ErrorCode::INTERNAL_ERROR>(
+                    "debug point: "
+                    "handle_single_rowset_write_inverted_index_data_error");
+        })
+        if (!status.ok()) {
+            return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>("failed to write block.");
+        }
+        block->clear_column_data();
+    }
+
+    // finish write inverted index, flush data to compound file
+    for (auto& writer_sign : task.writer_signs) {
+        try {
+            if (_inverted_index_builders.at(writer_sign)) {
+                RETURN_IF_ERROR(_inverted_index_builders.at(writer_sign)->finish());
+            }
+            DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_index_build_finish_error", {
+                _CLTHROWA(CL_ERR_IO, "debug point: handle_single_rowset_index_build_finish_error");
+            })
+        } catch (const std::exception& e) {
+            return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                    "CLuceneError occured: {}", e.what());
+        }
+    }
+    return Status::OK();
+}
+
+Status IndexBuilder::_build_segment_indexes(const TabletSchemaSPtr& output_rowset_schema,
+                                            const std::vector<SegmentIndexBuildTask>& tasks) {
+    // The RAM buffer of every index writer may grow up to inverted_index_ram_buffer_size before it
+    // flushes, so the segments built at the same time are bounded by the shared budget.
+    auto writers_per_segment =
+            static_cast<double>(std::max<size_t>(1, _alter_inverted_indexes.size()));
+    auto budget_segments = static_cast<int64_t>(
+            static_cast<double>(config::alter_index_ram_buffer_budget_mb) /
+            (std::max(config::inverted_index_ram_buffer_size, 1.0) * writers_per_segment));
+    auto parallelism = std::min<int64_t>({config::alter_index_segment_parallelism,
+                                          std::max<int64_t>(budget_segments, 1),
+                                          static_cast<int64_t>(tasks.size())});
+    if (parallelism <= 1) {
+        for (const auto& task : tasks) {
+            RETURN_IF_ERROR(_build_segment_index(output_rowset_schema, task));
+        }
+        return Status::OK();
+    }
+
+    std::unique_ptr<ThreadPool> pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("IndexBuildThreadPool")
+                            .set_min_threads(static_cast<int>(parallelism))
+                            .set_max_threads(static_cast<int>(parallelism))
+                            .build(&pool));
+    // The builds are accounted to the alter index task that runs them, if there is one.
+    auto resource_ctx = thread_context()->resource_ctx();
+    std::mutex result_mtx;
+    Status result;
+    auto build = [&](const SegmentIndexBuildTask& task) {
+        {
+            std::lock_guard lock(result_mtx);
+            if (!result.ok()) { // Some segment has failed
+                return;
+            }
+        }
+        auto st = _build_segment_index(output_rowset_schema, task);
+        if (!st.ok()) {
+            std::lock_guard lock(result_mtx);
+            result = std::move(st);
+        }
+    };
+    for (const auto& task : tasks) {
+        auto st = pool->submit_func([&, task_ptr = &task] {
+            if (resource_ctx != nullptr) {
+                SCOPED_ATTACH_TASK(resource_ctx);
+                build(*task_ptr);
+            } else {
+                SCOPED_INIT_THREAD_CONTEXT();
+                build(*task_ptr);
+            }
+        });
+        if (!st.ok()) {
+            std::lock_guard lock(result_mtx);
+            result = std::move(st);
+            break;
+        }
+    }
+    pool->wait();
+    return result;
+}
+
+Status IndexBuilder::_write_inverted_index_data(
+        TabletSchemaSPtr tablet_schema, int32_t segment_idx, vectorized::Block* block,
+        vectorized::OlapBlockDataConvertor* olap_data_convertor) {
     VLOG_DEBUG << "begin to write inverted index";
     // converter block data
-    _olap_data_convertor->set_source_content(block, 0, block->rows());
+    olap_data_convertor->set_source_content(block, 0, block->rows());
     for (auto i = 0; i < _alter_inverted_indexes.size(); ++i) {
         auto inverted_index = _alter_inverted_indexes[i];
         auto index_id = inverted_index.index_id;
@@ -579,7 +647,7 @@ Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema,
         auto column = tablet_schema->column(column_idx);
         auto writer_sign = std::make_pair(segment_idx, index_id);
         std::unique_ptr<Field> field(FieldFactory::create(column));
-        auto converted_result = _olap_data_convertor->convert_column_data(i);
+        auto converted_result = olap_data_convertor->convert_column_data(i);
         DBUG_EXECUTE_IF("IndexBuilder::_write_inverted_index_data_convert_column_data_error", {
             converted_result.first = Status::Error<ErrorCode::INTERNAL_ERROR>(
                     "debug point: _write_inverted_index_data_convert_column_data_error");
@@ -597,7 +665,7 @@ Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema,
             RETURN_IF_ERROR(_add_data(column_name, writer_sign, field.get(), &ptr, block->rows()));
         }
     }
-    _olap_data_convertor->clear_source_content();
+    olap_data_convertor->clear_source_content();
 
     return Status::OK();
 }
@@ -617,14 +685,14 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
         try {
             auto data = *(data_ptr + 2);
             auto nested_null_map = *(data_ptr + 3);
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_values(
+            RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_array_values(
                     field->get_sub_field(0)->size(), reinterpret_cast<const void*>(data),
                     reinterpret_cast<const uint8_t*>(nested_null_map), offsets_ptr, num_rows));
             DBUG_EXECUTE_IF("IndexBuilder::_add_nullable_add_array_values_error", {
                 _CLTHROWA(CL_ERR_IO, "debug point: _add_nullable_add_array_values_error");
             })
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_nulls(null_map,
-                                                                                         num_rows));
+            RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)
+                                    ->add_array_nulls(null_map, num_rows));
         } catch (const std::exception& e) {
             return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
                     "CLuceneError occured: {}", e.what());
@@ -648,9 +716,9 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
         do {
             auto step = next_run_step();
             if (null_map[offset]) {
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_nulls(step));
+                RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_nulls(step));
             } else {
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_values(
+                RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_values(
                         column_name, *ptr, step));
             }
             *ptr += field->size() * step;
@@ -681,12 +749,12 @@ Status IndexBuilder::_add_data(const std::string& column_name,
             if (element_cnt > 0) {
                 auto data = *(data_ptr + 2);
                 auto nested_null_map = *(data_ptr + 3);
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_values(
+                RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_array_values(
                         field->get_sub_field(0)->size(), reinterpret_cast<const void*>(data),
                         reinterpret_cast<const uint8_t*>(nested_null_map), offsets_ptr, num_rows));
             }
         } else {
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_values(
+            RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_values(
                     column_name, *ptr, num_rows));
         }
         DBUG_EXECUTE_IF("IndexBuilder::_add_data_throw_exception",
@@ -59,8 +59,23 @@ public:
     virtual void gc_output_rowset();
 
 private:
+    // The columns of a segment to read and the index writers to feed them to. All the indexes
+    // of a segment are built from a single scan of it.
+    struct SegmentIndexBuildTask {
+        segment_v2::SegmentSharedPtr segment;
+        std::vector<ColumnId> return_columns;
+        std::vector<std::pair<int64_t, int64_t>> writer_signs;
+        std::unique_ptr<vectorized::OlapBlockDataConvertor> convertor;
+    };
+
+    Status _build_segment_index(const TabletSchemaSPtr& output_rowset_schema,
+                                const SegmentIndexBuildTask& task);
+    // Builds the segments in parallel, as many at a time as the RAM buffer budget allows.
+    Status _build_segment_indexes(const TabletSchemaSPtr& output_rowset_schema,
+                                  const std::vector<SegmentIndexBuildTask>& tasks);
     Status _write_inverted_index_data(TabletSchemaSPtr tablet_schema, int32_t segment_idx,
-                                      vectorized::Block* block);
+                                      vectorized::Block* block,
+                                      vectorized::OlapBlockDataConvertor* olap_data_convertor);
     Status _add_data(const std::string& column_name,
                      const std::pair<int64_t, int64_t>& index_writer_sign, Field* field,
                      const uint8_t** ptr, size_t num_rows);
@@ -80,8 +95,8 @@ private:
     std::vector<RowsetSharedPtr> _output_rowsets;
     std::vector<PendingRowsetGuard> _pending_rs_guards;
     std::vector<RowsetReaderSharedPtr> _input_rs_readers;
-    std::unique_ptr<vectorized::OlapBlockDataConvertor> _olap_data_convertor;
     // "<segment_id, index_id>" -> InvertedIndexColumnWriter
+    // Only filled before the segments are built, so the parallel builds can look it up.
     std::unordered_map<std::pair<int64_t, int64_t>,
                        std::unique_ptr<segment_v2::InvertedIndexColumnWriter>>
             _inverted_index_builders;
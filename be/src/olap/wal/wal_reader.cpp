@@ -31,9 +31,9 @@ WalReader::WalReader(const std::string& file_name) : _file_name(file_name), _off
 
 WalReader::~WalReader() = default;
 
-Status WalReader::_deserialize(PBlock& block, const std::string& buf, size_t block_len,
+Status WalReader::_deserialize(PBlock& block, const char* buf, size_t block_len,
                                size_t bytes_read) {
-    if (UNLIKELY(!block.ParseFromString(buf))) {
+    if (UNLIKELY(!block.ParseFromArray(buf, static_cast<int>(block_len)))) {
         return Status::InternalError(
                 "failed to deserialize row, file_size=" + std::to_string(file_reader->size()) +
                 ", read_offset=" + std::to_string(_offset) + +", block_bytes=" +
@@ -79,19 +79,23 @@ Status WalReader::read_block(PBlock& block) {
                      << ", size=" << file_reader->size() << ")";
         return Status::EndOfFile("end of wal file");
     }
-    // read block
-    std::string block_buf;
-    block_buf.resize(block_len);
-    RETURN_IF_ERROR(file_reader->read_at(_offset, {block_buf.c_str(), block_len}, &bytes_read));
-    RETURN_IF_ERROR(_deserialize(block, block_buf, block_len, bytes_read));
-    _offset += block_len;
-    // checksum
-    uint8_t checksum_len_buf[WalWriter::CHECKSUM_SIZE];
-    RETURN_IF_ERROR(file_reader->read_at(_offset, {checksum_len_buf, WalWriter::CHECKSUM_SIZE},
-                                         &bytes_read));
-    _offset += WalWriter::CHECKSUM_SIZE;
-    uint32_t checksum = decode_fixed32_le(checksum_len_buf);
-    RETURN_IF_ERROR(_check_checksum(block_buf.data(), block_len, checksum));
+    // read the block and its checksum at once
+    size_t read_len = block_len + WalWriter::CHECKSUM_SIZE;
+    if (_block_buf_size < read_len) {
+        _block_buf.reset(new char[read_len]);
+        _block_buf_size = read_len;
+    }
+    RETURN_IF_ERROR(file_reader->read_at(_offset, {_block_buf.get(), read_len}, &bytes_read));
+    if (bytes_read != read_len) {
+        return Status::InternalError(
+                "failed to read block from wal {}, read_offset={}, expected={}, actually={}",
+                _file_name, _offset, read_len, bytes_read);
+    }
+    uint32_t checksum =
+            decode_fixed32_le(reinterpret_cast<const uint8_t*>(_block_buf.get()) + block_len);
+    RETURN_IF_ERROR(_check_checksum(_block_buf.get(), block_len, checksum));
+    RETURN_IF_ERROR(_deserialize(block, _block_buf.get(), block_len, bytes_read));
+    _offset += read_len;
     return Status::OK();
 }
 
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "common/status.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "io/fs/file_reader_writer_fwd.h"
@@ -35,12 +37,15 @@ public:
     Status read_header(uint32_t& version, std::string& col_ids);
 
 private:
-    Status _deserialize(PBlock& block, const std::string& buf, size_t block_len, size_t bytes_read);
+    Status _deserialize(PBlock& block, const char* buf, size_t block_len, size_t bytes_read);
     Status _check_checksum(const char* binary, size_t size, uint32_t checksum);
 
     std::string _file_name;
     size_t _offset;
     io::FileReaderSPtr file_reader;
+    // holds a block and its checksum, reused across read_block() calls
+    std::unique_ptr<char[]> _block_buf;
+    size_t _block_buf_size = 0;
 };
 
 } // namespace doris
\ No newline at end of file
@@ -17,9 +17,18 @@
 
 #include "olap/wal/wal_writer.h"
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+
 #include "common/config.h"
+#include "io/fs/err_utils.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_file_writer.h"
 #include "io/fs/path.h"
 #include "olap/storage_engine.h"
 #include "olap/wal/wal_manager.h"
@@ -30,6 +39,55 @@ namespace doris {
 const char* k_wal_magic = "WAL1";
 const uint32_t k_wal_magic_length = 4;
 
+WalGroupSyncer* WalGroupSyncer::instance(dev_t dev) {
+    static std::mutex lock;
+    static std::unordered_map<dev_t, std::unique_ptr<WalGroupSyncer>> syncers;
+    std::lock_guard l(lock);
+    auto& syncer = syncers[dev];
+    if (syncer == nullptr) {
+        syncer = std::make_unique<WalGroupSyncer>();
+    }
+    return syncer.get();
+}
+
+Status WalGroupSyncer::sync(int fd) {
+    SyncRequest request {fd};
+    std::unique_lock l(_lock);
+    _pending.push_back(&request);
+    while (!request.done) {
+        if (_syncing) {
+            _cond.wait(l);
+            continue;
+        }
+        // become the leader and sync everything queued so far
+        _syncing = true;
+        std::vector<SyncRequest*> batch;
+        batch.swap(_pending);
+        l.unlock();
+
+        std::sort(batch.begin(), batch.end(),
+                  [](const SyncRequest* a, const SyncRequest* b) { return a->fd < b->fd; });
+        Status st;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (i == 0 || batch[i]->fd != batch[i - 1]->fd) {
+                st = Status::OK();
+                if (0 != ::fdatasync(batch[i]->fd)) [[unlikely]] {
+                    st = io::localfs_error(errno, "failed to sync wal");
+                }
+            }
+            batch[i]->status = st;
+        }
+
+        l.lock();
+        for (auto* r : batch) {
+            r->done = true;
+        }
+        _syncing = false;
+        _cond.notify_all();
+    }
+    return request.status;
+}
+
 WalWriter::WalWriter(const std::string& file_name) : _file_name(file_name) {}
 
 WalWriter::~WalWriter() {}
@@ -62,34 +120,52 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
     }
+    // Serialize the blocks with their length and checksum straight into one buffer,
+    // so that they are written with a single call.
+    std::vector<size_t> block_lengths(blocks.size());
     size_t total_size = 0;
-    size_t offset = 0;
-    for (const auto& block : blocks) {
-        uint8_t len_buf[sizeof(uint64_t)];
-        uint64_t block_length = block->ByteSizeLong();
-        total_size += LENGTH_SIZE + block_length + CHECKSUM_SIZE;
-        encode_fixed64_le(len_buf, block_length);
-        RETURN_IF_ERROR(_file_writer->append({len_buf, sizeof(uint64_t)}));
-        offset += LENGTH_SIZE;
-
-        std::string content = block->SerializeAsString();
-        RETURN_IF_ERROR(_file_writer->append(content));
-        offset += block_length;
-
-        uint8_t checksum_buf[sizeof(uint32_t)];
-        uint32_t checksum = crc32c::Value(content.data(), block_length);
-        encode_fixed32_le(checksum_buf, checksum);
-        RETURN_IF_ERROR(_file_writer->append({checksum_buf, sizeof(uint32_t)}));
-        offset += CHECKSUM_SIZE;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        block_lengths[i] = blocks[i]->ByteSizeLong();
+        total_size += LENGTH_SIZE + block_lengths[i] + CHECKSUM_SIZE;
     }
-    if (offset != total_size) {
-        return Status::InternalError(
-                "failed to write block to wal expected= " + std::to_string(total_size) +
-                ",actually=" + std::to_string(offset));
+    std::unique_ptr<uint8_t[]> buf(new uint8_t[total_size]);
+    uint8_t* pos = buf.get();
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        encode_fixed64_le(pos, block_lengths[i]);
+        pos += LENGTH_SIZE;
+        uint8_t* content = pos;
+        pos = blocks[i]->SerializeWithCachedSizesToArray(content);
+        if (static_cast<size_t>(pos - content) != block_lengths[i]) {
+            return Status::InternalError("failed to serialize block to wal expected= " +
+                                         std::to_string(block_lengths[i]) +
+                                         ",actually=" + std::to_string(pos - content));
+        }
+        encode_fixed32_le(pos, crc32c::Value(reinterpret_cast<const char*>(content),
+                                             block_lengths[i]));
+        pos += CHECKSUM_SIZE;
+    }
+    RETURN_IF_ERROR(_file_writer->append({buf.get(), total_size}));
+    if (config::group_commit_wal_sync_on_append) {
+        RETURN_IF_ERROR(_sync());
     }
     return Status::OK();
 }
 
+Status WalWriter::_sync() {
+    auto* local_writer = dynamic_cast<io::LocalFileWriter*>(_file_writer.get());
+    if (local_writer == nullptr) {
+        return Status::InternalError("wal {} is not a local file", _file_name);
+    }
+    if (_syncer == nullptr) {
+        struct stat st;
+        if (0 != ::fstat(local_writer->fd(), &st)) {
+            return io::localfs_error(errno, fmt::format("failed to stat wal {}", _file_name));
+        }
+        _syncer = WalGroupSyncer::instance(st.st_dev);
+    }
+    return _syncer->sync(local_writer->fd());
+}
+
 Status WalWriter::append_header(std::string col_ids) {
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
@@ -17,6 +17,12 @@
 
 #pragma once
 
+#include <sys/types.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 #include "common/status.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "io/fs/file_reader_writer_fwd.h"
@@ -27,6 +33,29 @@ using PBlockArray = std::vector<PBlock*>;
 extern const char* k_wal_magic;
 extern const uint32_t k_wal_magic_length;
 
+// Serializes the fdatasync of WAL files on one disk: while a writer is syncing, other writers
+// queue their files, and the next of them syncs the whole queue, once per distinct file.
+// This bounds the number of concurrent syncs on a (spinning) disk and lets the writers of one
+// file share a sync.
+class WalGroupSyncer {
+public:
+    static WalGroupSyncer* instance(dev_t dev);
+
+    Status sync(int fd);
+
+private:
+    struct SyncRequest {
+        int fd;
+        Status status;
+        bool done = false;
+    };
+
+    std::mutex _lock;
+    std::condition_variable _cond;
+    bool _syncing = false;
+    std::vector<SyncRequest*> _pending;
+};
+
 class WalWriter {
 public:
     explicit WalWriter(const std::string& file_name);
@@ -46,8 +75,11 @@ public:
     static const int64_t VERSION_SIZE = 4;
 
 private:
+    Status _sync();
+
     std::string _file_name;
     io::FileWriterPtr _file_writer;
+    WalGroupSyncer* _syncer = nullptr;
 };
 
 } // namespace doris
\ No newline at end of file
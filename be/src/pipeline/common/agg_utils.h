@@ -252,6 +252,17 @@ public:
 
     [[nodiscard]] uint32_t total_count() const { return _total_count; }
 
+    // Drops all the entries but keeps the sub containers, the states in them must have been
+    // destroyed. The hash table is reset after each spilled partition, appending into the
+    // allocated sub containers avoids freeing and allocating the same memory again.
+    void reset() {
+        _current_keys = nullptr;
+        _current_agg_data = nullptr;
+        _index_in_sub_container = 0;
+        _total_count = 0;
+        _inited = false;
+    }
+
     size_t estimate_memory(size_t rows) const {
         bool need_to_expand = false;
         if (_total_count == 0) {
@@ -266,6 +277,11 @@ public:
         }
 
         size_t count = (rows + SUB_CONTAINER_CAPACITY - 1) / SUB_CONTAINER_CAPACITY;
+        size_t free_count = _key_containers.size() - _num_used_sub_containers();
+        if (count <= free_count) {
+            return 0;
+        }
+        count -= free_count;
         size_t size = _size_of_key * SUB_CONTAINER_CAPACITY;
         size += _size_of_aggregate_states * SUB_CONTAINER_CAPACITY;
         size *= count;
@@ -282,10 +298,21 @@ public:
     Iterator iterator;
 
 private:
+    size_t _num_used_sub_containers() const {
+        return (_total_count + SUB_CONTAINER_CAPACITY - 1) / SUB_CONTAINER_CAPACITY;
+    }
+
     void _expand() {
         _index_in_sub_container = 0;
         _current_keys = nullptr;
         _current_agg_data = nullptr;
+        // reuse the sub containers left by `reset`
+        size_t sub_container_index = _num_used_sub_containers();
+        if (sub_container_index < _key_containers.size()) {
+            _current_keys = _key_containers[sub_container_index];
+            _current_agg_data = _value_containers[sub_container_index];
+            return;
+        }
         try {
             _current_keys = _arena_pool.alloc(_size_of_key * SUB_CONTAINER_CAPACITY);
             _key_containers.emplace_back(_current_keys);
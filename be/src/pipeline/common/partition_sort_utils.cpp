@@ -20,6 +20,32 @@
 namespace doris {
 #include "common/compile_check_begin.h"
 
+Status PartitionSortInfo::get_sort_key_columns(vectorized::Block* block,
+                                               vectorized::Columns* sort_keys) const {
+    auto num_columns = block->columns();
+    for (const auto& ordering_expr : _vsort_exec_exprs->ordering_expr_ctxs()) {
+        int column_id = -1;
+        RETURN_IF_ERROR(ordering_expr->execute(block, &column_id));
+        sort_keys->push_back(
+                block->get_by_position(column_id).column->convert_to_full_column_if_const());
+    }
+    block->erase_tail(num_columns);
+    return Status::OK();
+}
+
+bool PartitionBlocks::after_threshold(const vectorized::Columns& sort_keys, size_t row) const {
+    for (size_t i = 0; i < sort_keys.size(); ++i) {
+        int direction = _partition_sort_info->_is_asc_order[i] ? 1 : -1;
+        int nulls_direction = _partition_sort_info->_nulls_first[i] ? -direction : direction;
+        int res = direction * sort_keys[i]->compare_at(row, 0, *_threshold[i], nulls_direction);
+        if (res != 0) {
+            return res > 0;
+        }
+    }
+    // the rows equal to the threshold are kept for rank() and dense_rank()
+    return false;
+}
+
 Status PartitionBlocks::append_block_by_selector(const vectorized::Block* input_block, bool eos) {
     auto selector_rows = _selector.size();
 
@@ -89,6 +115,17 @@ Status PartitionBlocks::do_partition_topn_sort() {
         }
     }
 
+    if (_partition_sort_info->could_prune_by_threshold() &&
+        _partition_topn_sorter->get_enough_data() && !_blocks.empty()) {
+        auto& last_block = *_blocks.back();
+        vectorized::Columns sort_keys;
+        RETURN_IF_ERROR(_partition_sort_info->get_sort_key_columns(&last_block, &sort_keys));
+        _threshold.clear();
+        for (const auto& sort_key : sort_keys) {
+            _threshold.push_back(sort_key->cut(last_block.rows() - 1, 1));
+        }
+    }
+
     return Status::OK();
 }
 
@@ -53,6 +53,17 @@ struct PartitionSortInfo {
               _top_n_algorithm(top_n_algorithm),
               _topn_phase(topn_phase) {}
 
+    // Whether a partition could skip the input rows that are ordered after its topn rows, the
+    // topn sort is done in the sink and the sort keys are evaluated on the input rows.
+    bool could_prune_by_threshold() const {
+        return _partition_inner_limit != -1 && _topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL &&
+               !_vsort_exec_exprs->need_materialize_tuple() &&
+               !_vsort_exec_exprs->ordering_expr_ctxs().empty();
+    }
+
+    // Evaluates the sort keys on `block`, the columns added to `block` are erased.
+    Status get_sort_key_columns(vectorized::Block* block, vectorized::Columns* sort_keys) const;
+
 public:
     vectorized::VSortExecExprs* _vsort_exec_exprs = nullptr;
     int64_t _limit = -1;
@@ -103,12 +114,22 @@ public:
         return _init_rows <= 0 || _blocks.back()->bytes() > INITIAL_BUFFERED_BLOCK_BYTES;
     }
 
+    bool has_threshold() const { return !_threshold.empty(); }
+
+    // Whether the row of `sort_keys` is ordered after the threshold, it is not in the topn of the
+    // partition then.
+    bool after_threshold(const vectorized::Columns& sort_keys, size_t row) const;
+
     vectorized::IColumn::Selector _selector;
     std::vector<std::unique_ptr<vectorized::Block>> _blocks;
     size_t _current_input_rows = 0;
     int64_t _init_rows = 4096;
     bool _is_first_sorter = false;
 
+    // the sort keys of the last row the sorter keeps after the partition topn sort, set only if
+    // the sorter got enough rows
+    vectorized::Columns _threshold;
+
     std::unique_ptr<vectorized::SortCursorCmp> _previous_row;
     std::unique_ptr<vectorized::PartitionSorter> _partition_topn_sorter = nullptr;
     std::shared_ptr<PartitionSortInfo> _partition_sort_info = nullptr;
@@ -17,14 +17,19 @@
 
 #include "dependency.h"
 
+#include <parallel_hashmap/phmap.h>
+
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/rowid_fetcher.h"
 #include "pipeline/exec/multi_cast_data_streamer.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/pipeline_task.h"
+#include "pipeline/task_queue.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime_filter/runtime_filter_consumer.h"
@@ -82,6 +87,10 @@ void Dependency::set_ready() {
         _ready = true;
         local_block_task.swap(_blocked_task);
     }
+    if (config::enable_pipeline_batch_wake_up && local_block_task.size() > 1) {
+        _wake_up_batch(local_block_task);
+        return;
+    }
     for (auto task : local_block_task) {
         if (auto t = task.lock()) {
             std::unique_lock<std::mutex> lc(_task_lock);
@@ -90,6 +99,34 @@ void Dependency::set_ready() {
     }
 }
 
+void Dependency::_wake_up_batch(const std::vector<std::weak_ptr<PipelineTask>>& blocked_tasks) {
+    // Pushing the tasks one by one wakes up their workers one by one, and for a broadcast join
+    // all probe tasks land on the few workers that ran them before.
+    std::vector<std::pair<MultiCoreTaskQueue*, PipelineTaskSPtr>> tasks;
+    tasks.reserve(blocked_tasks.size());
+    {
+        std::unique_lock<std::mutex> lc(_task_lock);
+        for (const auto& task : blocked_tasks) {
+            if (auto t = task.lock()) {
+                THROW_IF_ERROR(t->prepare_wake_up(this));
+                tasks.emplace_back(t->get_task_queue(), std::move(t));
+            }
+        }
+    }
+    // the tasks of a query are usually in the task queue of the same workload group
+    std::stable_sort(tasks.begin(), tasks.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    std::vector<PipelineTaskSPtr> batch;
+    for (size_t i = 0; i < tasks.size();) {
+        auto* task_queue = tasks[i].first;
+        batch.clear();
+        for (; i < tasks.size() && tasks[i].first == task_queue; ++i) {
+            batch.push_back(std::move(tasks[i].second));
+        }
+        THROW_IF_ERROR(task_queue->push_back(batch));
+    }
+}
+
 Dependency* Dependency::is_blocked_by(std::shared_ptr<PipelineTask> task) {
     std::unique_lock<std::mutex> lc(_task_lock);
     auto ready = _ready.load();
@@ -308,11 +345,7 @@ Status AggSharedState::reset_hash_table() {
                             RETURN_IF_ERROR(st);
                         }
 
-                        aggregate_data_container.reset(new AggregateDataContainer(
-                                sizeof(typename HashTableType::key_type),
-                                ((total_size_of_aggregate_states + align_aggregate_states - 1) /
-                                 align_aggregate_states) *
-                                        align_aggregate_states));
+                        aggregate_data_container->reset();
                         agg_method.hash_table.reset(new HashTableType());
                         return Status::OK();
                     }},
@@ -493,17 +526,29 @@ Status MaterializationSharedState::merge_multi_response(vectorized::Block* block
             }
         }
 
+        static const std::vector<std::pair<uint32_t, uint32_t>> no_duplicate_rows;
+        const auto& duplicates = i < duplicate_rows.size() ? duplicate_rows[i] : no_duplicate_rows;
+        size_t duplicate_pos = 0;
+        // the row of each row in the response of its backend, only needed by duplicates
+        std::vector<int> source_rows(duplicates.empty() ? 0 : block_order_results[i].size());
         for (int j = 0; j < block_order_results[i].size(); ++j) {
             auto backend_id = block_order_results[i][j];
             if (backend_id) {
                 auto& source_block_rows = _block_maps[backend_id];
-                DCHECK(source_block_rows.second < source_block_rows.first.rows());
+                int source_row;
+                if (duplicate_pos < duplicates.size() && duplicates[duplicate_pos].first == j) {
+                    source_row = source_rows[duplicates[duplicate_pos++].second];
+                } else {
+                    source_row = source_block_rows.second++;
+                }
+                if (!duplicates.empty()) {
+                    source_rows[j] = source_row;
+                }
+                DCHECK(source_row < source_block_rows.first.rows());
                 for (int k = 0; k < response_blocks[i].columns(); ++k) {
                     response_blocks[i].get_column_by_position(k)->insert_from(
-                            *source_block_rows.first.get_by_position(k).column,
-                            source_block_rows.second);
+                            *source_block_rows.first.get_by_position(k).column, source_row);
                 }
-                source_block_rows.second++;
             } else {
                 for (int k = 0; k < response_blocks[i].columns(); ++k) {
                     response_blocks[i].get_column_by_position(k)->insert_default();
@@ -583,6 +628,9 @@ Status MaterializationSharedState::create_muiltget_result(const vectorized::Colu
                                                           bool eos, bool gc_id_map) {
     const auto rows = columns.empty() ? 0 : columns[0]->size();
     block_order_results.resize(columns.size());
+    duplicate_rows.resize(columns.size());
+    // <backend id, file id and row id> => the first row of the location
+    phmap::flat_hash_map<std::pair<int64_t, uint64_t>, uint32_t> first_rows;
 
     for (int i = 0; i < columns.size(); ++i) {
         const uint8_t* null_map = nullptr;
@@ -599,12 +647,23 @@ Status MaterializationSharedState::create_muiltget_result(const vectorized::Colu
 
         auto& block_order = block_order_results[i];
         block_order.resize(rows);
+        duplicate_rows[i].clear();
+        first_rows.clear();
 
         for (int j = 0; j < rows; ++j) {
             if (!null_map || !null_map[j]) {
                 DCHECK(column_rowid->get_data_at(j).size == sizeof(GlobalRowLoacationV2));
                 GlobalRowLoacationV2 row_location =
                         *((GlobalRowLoacationV2*)column_rowid->get_data_at(j).data);
+                auto [first_row, inserted] = first_rows.emplace(
+                        std::make_pair(row_location.backend_id,
+                                       (uint64_t(row_location.file_id) << 32) | row_location.row_id),
+                        cast_set<uint32_t>(j));
+                if (!inserted) {
+                    duplicate_rows[i].emplace_back(j, first_row->second);
+                    block_order[j] = row_location.backend_id;
+                    continue;
+                }
                 auto rpc_struct = rpc_struct_map.find(row_location.backend_id);
                 if (UNLIKELY(rpc_struct == rpc_struct_map.end())) {
                     return Status::InternalError(
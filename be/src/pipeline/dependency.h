@@ -152,6 +152,7 @@ public:
 
 protected:
     void _add_block_task(std::shared_ptr<PipelineTask> task);
+    void _wake_up_batch(const std::vector<std::weak_ptr<PipelineTask>>& blocked_tasks);
 
     const int _id;
     const int _node_id;
@@ -842,6 +843,9 @@ public:
     // Register each line in which block to ensure the order of the result.
     // Zero means NULL value.
     std::vector<std::vector<int64_t>> block_order_results;
+    // <row, earlier row> of the rows that repeat the row id of an earlier row of the block,
+    // ordered by row. A join can output the same row many times, it is fetched only once.
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> duplicate_rows;
     // backend id => <rpc profile info string key, rpc profile info string value>.
     std::map<int64_t, std::map<std::string, fmt::memory_buffer>> backend_profile_info_string;
 };
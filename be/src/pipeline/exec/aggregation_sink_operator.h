@@ -165,6 +165,10 @@ public:
                        : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
     }
     bool require_data_distribution() const override { return _is_colocate; }
+    // the intermediate results of a key are merged by the next phase
+    bool allow_split_hot_partitions() const override {
+        return !_needs_finalize && !_probe_expr_ctxs.empty() && !_is_colocate;
+    }
     size_t get_revocable_mem_size(RuntimeState* state) const;
 
     AggregatedDataVariants* get_agg_data(RuntimeState* state) {
@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/runtime_state.h"
 #include "vec/exprs/vectorized_agg_fn.h"
@@ -31,6 +32,90 @@
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 
+SlidingFrameStates::SlidingFrameStates(vectorized::AggregateFunctionPtr function,
+                                       vectorized::Arena& arena)
+        : _function(std::move(function)), _arena(arena) {
+    _tail_state = _arena.aligned_alloc(_function->size_of_data(), _function->align_of_data());
+    _function->create(_tail_state);
+}
+
+SlidingFrameStates::~SlidingFrameStates() {
+    _destroy_head_states();
+    _function->destroy(_tail_state);
+}
+
+void SlidingFrameStates::get_frame_state(int64_t frame_start, int64_t frame_end,
+                                         const vectorized::IColumn** columns,
+                                         vectorized::AggregateDataPtr place) {
+    DCHECK_LT(frame_start, frame_end);
+    if (frame_start >= _frame_end) {
+        // no row of the previous frame is left
+        reset();
+        _head_start = _frame_start = _split = _frame_end = frame_start;
+    }
+    DCHECK_GE(frame_start, _frame_start);
+    DCHECK_GE(frame_end, _frame_end);
+    for (; _frame_end < frame_end; ++_frame_end) {
+        _function->add(_tail_state, columns, _frame_end, _arena);
+    }
+    _frame_start = frame_start;
+    if (_frame_start >= _split) {
+        _split_tail(columns);
+    }
+    _function->reset(place);
+    if (_frame_start < _split) {
+        _function->merge(place, _head_states[static_cast<size_t>(_frame_start - _head_start)],
+                         _arena);
+    }
+    if (_split < _frame_end) {
+        _function->merge(place, _tail_state, _arena);
+    }
+}
+
+void SlidingFrameStates::reset() {
+    _destroy_head_states();
+    _function->reset(_tail_state);
+    _head_start = _frame_start = _split = _frame_end = 0;
+}
+
+void SlidingFrameStates::remove_unused_rows(int64_t cnt) {
+    _head_start -= cnt;
+    _frame_start -= cnt;
+    _split -= cnt;
+    _frame_end -= cnt;
+}
+
+void SlidingFrameStates::_split_tail(const vectorized::IColumn** columns) {
+    _destroy_head_states();
+    auto num_rows = static_cast<size_t>(_frame_end - _frame_start);
+    while (_head_states.size() < num_rows) {
+        _head_states.push_back(
+                _arena.aligned_alloc(_function->size_of_data(), _function->align_of_data()));
+    }
+    for (; _num_head_states < num_rows; ++_num_head_states) {
+        _function->create(_head_states[_num_head_states]);
+    }
+    // the tail may have rows before the frame, so the head states are added from the rows
+    _head_start = _frame_start;
+    for (int64_t row = _frame_end - 1; row >= _frame_start; --row) {
+        auto* state = _head_states[static_cast<size_t>(row - _head_start)];
+        _function->add(state, columns, row, _arena);
+        if (row + 1 < _frame_end) {
+            _function->merge(state, _head_states[static_cast<size_t>(row + 1 - _head_start)],
+                             _arena);
+        }
+    }
+    _function->reset(_tail_state);
+    _split = _frame_end;
+}
+
+void SlidingFrameStates::_destroy_head_states() {
+    for (size_t i = 0; i < _num_head_states; ++i) {
+        _function->destroy(_head_states[i]);
+    }
+    _num_head_states = 0;
+}
+
 Status AnalyticSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
     RETURN_IF_ERROR(PipelineXSinkLocalState<AnalyticSharedState>::init(state, info));
     SCOPED_TIMER(exec_time_counter());
@@ -119,6 +204,7 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
     _result_column_could_resize.resize(_agg_functions_size);
     _use_null_result.resize(_agg_functions_size, 0);
     _could_use_previous_result.resize(_agg_functions_size, 0);
+    _sliding_frame_states.resize(_agg_functions_size);
 
     for (int i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i] = p._agg_functions[i]->clone(state, state->obj_pool());
@@ -137,8 +223,16 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
         if (PARTITION_FUNCTION_SET.contains(_agg_functions[i]->function()->get_name())) {
             _streaming_mode = false;
         }
-        _support_incremental_calculate &=
-                _agg_functions[i]->function()->supported_incremental_mode();
+        if (p._has_window && !p._has_range_window && p._has_window_start && p._has_window_end &&
+            config::enable_analytic_sliding_frame_merge &&
+            _agg_functions[i]->function()->supported_sliding_frame_merge()) {
+            _sliding_frame_states[i] = std::make_unique<SlidingFrameStates>(
+                    _agg_functions[i]->function(), _agg_arena_pool);
+            _has_sliding_frame_states = true;
+        } else {
+            _support_incremental_calculate &=
+                    _agg_functions[i]->function()->supported_incremental_mode();
+        }
     }
 
     _partition_exprs_size = p._partition_by_eq_expr_ctxs.size();
@@ -182,6 +276,7 @@ Status AnalyticSinkLocalState::close(RuntimeState* state, Status exec_status) {
     }
 
     _destroy_agg_status();
+    _sliding_frame_states.clear();
     _fn_place_ptr = nullptr;
     _result_window_columns.clear();
     _agg_input_columns.clear();
@@ -214,6 +309,9 @@ bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_ro
             _execute_for_function(_partition_by_pose.start, _partition_by_pose.end,
                                   current_row_start, current_row_end);
         }
+        if (_has_sliding_frame_states) {
+            _execute_for_sliding_frame(current_row_start, current_row_end);
+        }
 
         int64_t pos = current_pos_in_block();
         _insert_result_info(pos, pos + 1);
@@ -380,6 +478,9 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
                                                    int64_t frame_start, int64_t frame_end) {
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
+        if (_sliding_frame_states[i]) {
+            continue;
+        }
         std::vector<const vectorized::IColumn*> agg_columns;
         for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_agg_input_columns[i][j].get());
@@ -399,6 +500,28 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
     }
 }
 
+void AnalyticSinkLocalState::_execute_for_sliding_frame(int64_t frame_start, int64_t frame_end) {
+    frame_start = std::max(frame_start, _partition_by_pose.start);
+    frame_end = std::min(frame_end, _partition_by_pose.end);
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        if (!_sliding_frame_states[i]) {
+            continue;
+        }
+        auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+        _use_null_result[i] = frame_start >= frame_end;
+        if (_use_null_result[i]) {
+            _agg_functions[i]->reset(place);
+            continue;
+        }
+        std::vector<const vectorized::IColumn*> agg_columns;
+        for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
+            agg_columns.push_back(_agg_input_columns[i][j].get());
+        }
+        _sliding_frame_states[i]->get_frame_state(frame_start, frame_end, agg_columns.data(),
+                                                  place);
+    }
+}
+
 void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
@@ -479,6 +602,11 @@ void AnalyticSinkLocalState::_reset_state_for_next_partition() {
     _partition_by_pose.start = _partition_by_pose.end;
     _current_row_position = _partition_by_pose.start;
     _reset_agg_status();
+    for (auto& sliding_frame_states : _sliding_frame_states) {
+        if (sliding_frame_states) {
+            sliding_frame_states->reset();
+        }
+    }
 }
 
 void AnalyticSinkLocalState::_update_order_by_range() {
@@ -874,6 +1002,11 @@ void AnalyticSinkLocalState::_remove_unused_rows() {
     _current_row_position -= remove_rows;
     _partition_by_pose.remove_unused_rows(remove_rows);
     _order_by_pose.remove_unused_rows(remove_rows);
+    for (auto& sliding_frame_states : _sliding_frame_states) {
+        if (sliding_frame_states) {
+            sliding_frame_states->remove_unused_rows(remove_rows);
+        }
+    }
     int64_t candidate_partition_end_size = _next_partition_ends.size();
     while (--candidate_partition_end_size >= 0) {
         auto peek = _next_partition_ends.front();
@@ -20,6 +20,9 @@
 
 #include <stdint.h>
 
+#include <memory>
+#include <vector>
+
 #include "operator.h"
 #include "pipeline/dependency.h"
 
@@ -62,6 +65,40 @@ public:
 // those function cacluate need partition info, so can't be used in streaming mode
 static const std::set<std::string> PARTITION_FUNCTION_SET {"ntile", "cume_dist", "percent_rank"};
 
+// The states of a rows frame that only slides forward, for the functions that support sliding
+// frame merge. The frame is kept in two parts: each row in [_frame_start, _split) has the state of
+// the rows from it to `_split`, and the rows in [_split, _frame_end) are added to `_tail_state`.
+// The state of a frame is the merge of the two parts, so each row is only added twice and merged
+// once while the frame slides over it, instead of being added again for each frame it is in.
+class SlidingFrameStates {
+public:
+    SlidingFrameStates(vectorized::AggregateFunctionPtr function, vectorized::Arena& arena);
+    ~SlidingFrameStates();
+
+    // Sets `place` to the state of the rows in [frame_start, frame_end), neither bound could be
+    // before that of the previous frame.
+    void get_frame_state(int64_t frame_start, int64_t frame_end, const vectorized::IColumn** columns,
+                         vectorized::AggregateDataPtr place);
+    void reset();
+    void remove_unused_rows(int64_t cnt);
+
+private:
+    void _split_tail(const vectorized::IColumn** columns);
+    void _destroy_head_states();
+
+    vectorized::AggregateFunctionPtr _function;
+    vectorized::Arena& _arena;
+    // the buffers of the head states, reused by the following splits
+    std::vector<vectorized::AggregateDataPtr> _head_states;
+    size_t _num_head_states = 0;
+    vectorized::AggregateDataPtr _tail_state = nullptr;
+    // the row of `_head_states[0]`
+    int64_t _head_start = 0;
+    int64_t _frame_start = 0;
+    int64_t _split = 0;
+    int64_t _frame_end = 0;
+};
+
 class AnalyticSinkLocalState : public PipelineXSinkLocalState<AnalyticSharedState> {
     ENABLE_FACTORY_CREATOR(AnalyticSinkLocalState);
 
@@ -91,6 +128,7 @@ private:
     template <bool incremental = false>
     void _execute_for_function(int64_t partition_start, int64_t partition_end, int64_t frame_start,
                                int64_t frame_end);
+    void _execute_for_sliding_frame(int64_t frame_start, int64_t frame_end);
     void _insert_result_info(int64_t start, int64_t end);
     int64_t current_pos_in_block() {
         return _current_row_position + _have_removed_rows -
@@ -138,6 +176,9 @@ private:
     std::vector<size_t> _offsets_of_aggregate_states;
     std::vector<bool> _result_column_nullable_flags;
     std::vector<bool> _result_column_could_resize;
+    // not null for the functions that calculate a sliding rows frame by merging states
+    std::vector<std::unique_ptr<SlidingFrameStates>> _sliding_frame_states;
+    bool _has_sliding_frame_states = false;
 
     using vectorized_get_next = bool (AnalyticSinkLocalState::*)(int64_t, int64_t);
     struct executor {
@@ -64,11 +64,16 @@ Status CacheSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
             "CacheTabletId", std::to_string(scan_ranges[0].scan_range.palo_scan_range.tablet_id));
 
     // 3. lookup the cache and find proper slot order
-    hit_cache = _global_cache->lookup(_cache_key, _version, &_query_cache_handle);
+    RETURN_IF_ERROR(
+            _global_cache->lookup_once(state, scan_ranges, cache_param, &_query_cache_lookup));
+    hit_cache = _query_cache_lookup->hit;
+    _is_delta = _query_cache_lookup->is_delta;
     custom_profile()->add_info_string("HitCache", std::to_string(hit_cache));
-    if (hit_cache && !cache_param.force_refresh_query_cache) {
-        _hit_cache_results = _query_cache_handle.get_cache_result();
-        auto hit_cache_slot_orders = _query_cache_handle.get_cache_slot_orders();
+    custom_profile()->add_info_string("HitCacheOfOldVersion", std::to_string(_is_delta));
+    if (hit_cache) {
+        auto& query_cache_handle = _query_cache_lookup->handle;
+        _hit_cache_results = query_cache_handle.get_cache_result();
+        auto hit_cache_slot_orders = query_cache_handle.get_cache_slot_orders();
 
         if (_slot_orders != *hit_cache_slot_orders) {
             for (auto slot_id : _slot_orders) {
@@ -116,16 +121,18 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
     block->clear_column_data(_row_descriptor.num_materialized_slots());
     bool need_clone_empty = block->columns() == 0;
 
-    if (local_state._hit_cache_results == nullptr) {
+    if (local_state._hit_cache_results == nullptr ||
+        (local_state._is_delta &&
+         local_state._hit_cache_pos >= local_state._hit_cache_results->size())) {
         Defer insert_cache([&] {
             if (*eos) {
                 local_state.custom_profile()->add_info_string(
                         "InsertCache", std::to_string(local_state._need_insert_cache));
                 if (local_state._need_insert_cache) {
-                    local_state._global_cache->insert(local_state._cache_key, local_state._version,
-                                                      local_state._local_cache_blocks,
-                                                      local_state._slot_orders,
-                                                      local_state._current_query_cache_bytes);
+                    local_state._global_cache->insert(
+                            local_state._cache_key, local_state._version,
+                            local_state._local_cache_blocks, local_state._slot_orders,
+                            local_state._current_query_cache_bytes, _is_partial_result);
                     local_state._local_cache_blocks.clear();
                 }
             }
@@ -149,18 +156,7 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
             }
             RETURN_IF_ERROR(
                     vectorized::MutableBlock::build_mutable_block(block).merge(*output_block));
-            local_state._current_query_cache_rows += output_block->rows();
-            auto mem_consume = output_block->allocated_bytes();
-            local_state._current_query_cache_bytes += mem_consume;
-
-            if (_cache_param.entry_max_bytes < local_state._current_query_cache_bytes ||
-                _cache_param.entry_max_rows < local_state._current_query_cache_rows) {
-                // over the max bytes, pass through the data, no need to do cache
-                local_state._local_cache_blocks.clear();
-                local_state._need_insert_cache = false;
-            } else {
-                local_state._local_cache_blocks.emplace_back(std::move(output_block));
-            }
+            _keep_cache_block(local_state, std::move(output_block));
         } else {
             *block = std::move(*output_block);
         }
@@ -180,6 +176,14 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
                     block->insert(datas[loc]);
                 }
             }
+            if (local_state._is_delta && local_state._need_insert_cache) {
+                // the new entry holds the cached result followed by the result of new rowsets
+                auto cache_block = vectorized::Block::create_unique(block->clone_empty());
+                RETURN_IF_ERROR(
+                        vectorized::MutableBlock::build_mutable_block(cache_block.get())
+                                .merge(*block));
+                _keep_cache_block(local_state, std::move(cache_block));
+            }
         } else {
             *eos = true;
         }
@@ -189,5 +193,19 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
     return Status::OK();
 }
 
+void CacheSourceOperatorX::_keep_cache_block(CacheSourceLocalState& local_state,
+                                             vectorized::BlockUPtr block) const {
+    local_state._current_query_cache_rows += block->rows();
+    local_state._current_query_cache_bytes += block->allocated_bytes();
+    if (_cache_param.entry_max_bytes < local_state._current_query_cache_bytes ||
+        _cache_param.entry_max_rows < local_state._current_query_cache_rows) {
+        // over the max bytes, pass through the data, no need to do cache
+        local_state._local_cache_blocks.clear();
+        local_state._need_insert_cache = false;
+    } else {
+        local_state._local_cache_blocks.emplace_back(std::move(block));
+    }
+}
+
 } // namespace pipeline
 } // namespace doris
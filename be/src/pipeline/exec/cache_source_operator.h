@@ -62,8 +62,10 @@ private:
     size_t _current_query_cache_rows = 0;
     bool _need_insert_cache = true;
 
-    QueryCacheHandle _query_cache_handle;
+    std::shared_ptr<QueryCacheLookup> _query_cache_lookup;
     std::vector<vectorized::BlockUPtr>* _hit_cache_results = nullptr;
+    // the cached result is of an older version, the result of the new rowsets follows it
+    bool _is_delta = false;
     std::vector<int> _hit_cache_column_orders;
     int _hit_cache_pos = 0;
 };
@@ -72,8 +74,10 @@ class CacheSourceOperatorX final : public OperatorX<CacheSourceLocalState> {
 public:
     using Base = OperatorX<CacheSourceLocalState>;
     CacheSourceOperatorX(ObjectPool* pool, int plan_node_id, int operator_id,
-                         const TQueryCacheParam& cache_param)
-            : Base(pool, plan_node_id, operator_id), _cache_param(cache_param) {
+                         const TQueryCacheParam& cache_param, bool is_partial_result = false)
+            : Base(pool, plan_node_id, operator_id),
+              _cache_param(cache_param),
+              _is_partial_result(is_partial_result) {
         _op_name = "CACHE_SOURCE_OPERATOR";
     };
 
@@ -94,6 +98,11 @@ public:
 
 private:
     TQueryCacheParam _cache_param;
+    // The cached aggregation is merged again downstream, so the cached result of an older version
+    // may be reused together with the result of the newer rowsets.
+    bool _is_partial_result = false;
+    // Keep `block` for the cache entry, unless the entry gets too large to be cached.
+    void _keep_cache_block(CacheSourceLocalState& local_state, vectorized::BlockUPtr block) const;
     bool _has_data(RuntimeState* state) const {
         auto& local_state = get_local_state(state);
         return local_state._shared_state->data_queue.remaining_has_data();
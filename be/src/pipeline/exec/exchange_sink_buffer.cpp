@@ -19,6 +19,7 @@
 
 #include <brpc/controller.h>
 #include <butil/errno.h>
+#include <bvar/latency_recorder.h>
 #include <butil/iobuf_inl.h>
 #include <fmt/format.h>
 #include <gen_cpp/Types_types.h>
@@ -89,6 +90,10 @@ void BroadcastPBlockHolderMemLimiter::release(const BroadcastPBlockHolder& holde
 } // namespace vectorized
 
 namespace pipeline {
+
+// the exchange rpcs of all queries, in microseconds
+bvar::LatencyRecorder g_exchange_rpc_queue_wait_latency("exchange_rpc_queue_wait");
+bvar::LatencyRecorder g_exchange_rpc_latency("exchange_rpc");
 ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_id,
                                        PlanNodeId node_id, RuntimeState* state,
                                        const std::vector<InstanceLoId>& sender_ins_ids)
@@ -105,6 +110,10 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
                              state->query_options().exchange_multi_blocks_byte_size > 0) {
     if (_send_multi_blocks) {
         _send_multi_blocks_byte_size = state->query_options().exchange_multi_blocks_byte_size;
+    } else if (config::exchange_sink_multi_blocks_byte_size > 0) {
+        // the blocks queued while the last rpc of an instance is running go in the next one
+        _send_multi_blocks = true;
+        _send_multi_blocks_byte_size = config::exchange_sink_multi_blocks_byte_size;
     }
 }
 
@@ -181,6 +190,7 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel, TransmitInfo&
                     BeExecVersionManager::check_be_exec_version(request.block->be_exec_version()));
             COUNTER_UPDATE(channel->_parent->memory_used_counter(), request.block->ByteSizeLong());
         }
+        request.enqueue_time = MonotonicNanos();
         instance_data.package_queue[channel].emplace(std::move(request));
         _total_queue_size++;
         if (_total_queue_size > _queue_capacity) {
@@ -222,6 +232,7 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel,
             RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(
                     request.block_holder->get_block()->be_exec_version()));
         }
+        request.enqueue_time = MonotonicNanos();
         instance_data.broadcast_package_queue[channel].emplace(request);
     }
     if (send_now) {
@@ -287,6 +298,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
         }
 
+        _update_queue_wait_time(instance_data, requests);
+
         // If we have data to shuffle which is not broadcasted
         auto& request = requests[0];
         auto& brpc_request = instance_data.request;
@@ -407,6 +420,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
         }
 
+        _update_queue_wait_time(instance_data, requests);
+
         auto& request = requests[0];
         auto& brpc_request = instance_data.request;
         brpc_request->set_sender_id(channel->_parent->sender_id());
@@ -624,9 +639,31 @@ void ExchangeSinkBuffer::update_rpc_time(RpcInstance& ins, int64_t start_rpc_tim
         stats.sum_time += rpc_spend_time;
         stats.max_time = std::max(stats.max_time, rpc_spend_time);
         stats.min_time = std::min(stats.min_time, rpc_spend_time);
+        ins.rpc_time_hist.add(static_cast<uint64_t>(rpc_spend_time));
+        g_exchange_rpc_latency << rpc_spend_time / 1000;
     }
 }
 
+template <typename Request>
+void ExchangeSinkBuffer::_update_queue_wait_time(RpcInstance& ins,
+                                                 const std::vector<Request>& requests) {
+    auto now = MonotonicNanos();
+    for (const auto& request : requests) {
+        auto wait_time = std::max<int64_t>(now - request.enqueue_time, 0);
+        ins.queue_wait_hist.add(static_cast<uint64_t>(wait_time));
+        g_exchange_rpc_queue_wait_latency << wait_time / 1000;
+    }
+}
+
+static std::string histogram_summary(const HistogramStat& hist) {
+    auto percentile = [&](double p) {
+        return PrettyPrinter::print(static_cast<int64_t>(hist.percentile(p)), TUnit::TIME_NS);
+    };
+    return fmt::format("P50: {}, P95: {}, P99: {}, Max: {}", percentile(50), percentile(95),
+                       percentile(99),
+                       PrettyPrinter::print(static_cast<int64_t>(hist.max()), TUnit::TIME_NS));
+}
+
 void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* _max_rpc_timer = ADD_TIMER_WITH_LEVEL(profile, "RpcMaxTime", 1);
     auto* _min_rpc_timer = ADD_TIMER(profile, "RpcMinTime");
@@ -644,6 +681,20 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
 
+    HistogramStat queue_wait_hist;
+    HistogramStat rpc_time_hist;
+    for (const auto& [_, ins] : _rpc_instances) {
+        queue_wait_hist.merge(ins->queue_wait_hist);
+        rpc_time_hist.merge(ins->rpc_time_hist);
+    }
+    if (!queue_wait_hist.is_empty()) {
+        profile->add_info_string("RpcQueueWaitTimeDistribution",
+                                 histogram_summary(queue_wait_hist));
+    }
+    if (!rpc_time_hist.is_empty()) {
+        profile->add_info_string("RpcTimeDistribution", histogram_summary(rpc_time_hist));
+    }
+
     auto max_count = _state->rpc_verbose_profile_max_instance_count();
     // This counter will lead to performance degradation.
     // So only collect this information when the profile level is greater than 3.
@@ -663,14 +714,17 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
             }
             std::stringstream out;
             out << "Instance " << std::hex << id;
+            const auto& ins = *_rpc_instances[id];
             auto stats_str = fmt::format(
-                    "Count: {}, MaxTime: {}, MinTime: {}, AvgTime: {}, SumTime: {}",
+                    "Count: {}, MaxTime: {}, MinTime: {}, AvgTime: {}, SumTime: {}, RpcTime: "
+                    "[{}], QueueWaitTime: [{}]",
                     stats.rpc_count, PrettyPrinter::print(stats.max_time, TUnit::TIME_NS),
                     PrettyPrinter::print(stats.min_time, TUnit::TIME_NS),
                     PrettyPrinter::print(
                             stats.sum_time / std::max(static_cast<int64_t>(1), stats.rpc_count),
                             TUnit::TIME_NS),
-                    PrettyPrinter::print(stats.sum_time, TUnit::TIME_NS));
+                    PrettyPrinter::print(stats.sum_time, TUnit::TIME_NS),
+                    histogram_summary(ins.rpc_time_hist), histogram_summary(ins.queue_wait_hist));
             detail_profile->add_info_string(out.str(), stats_str);
             if (++i == count) {
                 break;
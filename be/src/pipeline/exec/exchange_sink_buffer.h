@@ -37,6 +37,7 @@
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 #include "util/brpc_closure.h"
+#include "util/histogram.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -113,11 +114,14 @@ namespace pipeline {
 struct TransmitInfo {
     std::unique_ptr<PBlock> block;
     bool eos;
+    // when the block is queued, to measure how long it waits for the rpc
+    int64_t enqueue_time = 0;
 };
 
 struct BroadcastTransmitInfo {
     std::shared_ptr<vectorized::BroadcastPBlockHolder> block_holder = nullptr;
     bool eos;
+    int64_t enqueue_time = 0;
 };
 
 struct RpcInstanceStatistics {
@@ -162,6 +166,11 @@ struct RpcInstance {
     // Statistics for monitoring RPC performance (latency, counts, etc.)
     RpcInstanceStatistics stats;
 
+    // Distributions of the time a block waits in the queue before its rpc is sent, and of the
+    // time from sending the rpc to its callback, in nanoseconds
+    HistogramStat queue_wait_hist;
+    HistogramStat rpc_time_hist;
+
     // Count of active exchange sinks using this RPC instance
     int64_t running_sink_count = 0;
 };
@@ -331,6 +340,9 @@ private:
 
     void get_max_min_rpc_time(int64_t* max_time, int64_t* min_time);
     int64_t get_sum_rpc_time();
+    // Records how long the requests waited in the queue of `ins` before being sent.
+    template <typename Request>
+    void _update_queue_wait_time(RpcInstance& ins, const std::vector<Request>& requests);
 
     // _total_queue_size is the sum of the sizes of all instance_to_package_queues.
     // Any modification to instance_to_package_queue requires a corresponding modification to _total_queue_size.
@@ -60,6 +60,8 @@ Status ExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& inf
     _local_sent_rows = ADD_COUNTER(custom_profile(), "LocalSentRows", TUnit::UNIT);
     _serialize_batch_timer = ADD_TIMER(custom_profile(), "SerializeBatchTime");
     _compress_timer = ADD_TIMER(custom_profile(), "CompressTime");
+    _uncompressed_blocks_counter =
+            ADD_COUNTER(custom_profile(), "BlocksSentWithoutCompression", TUnit::UNIT);
     _local_send_timer = ADD_TIMER(custom_profile(), "LocalSendTime");
     _split_block_hash_compute_timer = ADD_TIMER(custom_profile(), "SplitBlockHashComputeTime");
     _distribute_rows_into_channels_timer =
@@ -402,6 +404,8 @@ Status ExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block* block
                 }
             }
         } else {
+            // The block is serialized once and the holder is shared by the rpcs of all remote
+            // channels, but each remote receiver instance is still sent its own copy.
             auto block_holder = vectorized::BroadcastPBlockHolder::create_shared();
             {
                 bool serialized = false;
@@ -48,6 +48,9 @@ Status GroupCommitLocalState::init(RuntimeState* state, LocalStateInfo& info) {
             p._table_id, state->fragment_instance_id(), load_block_queue, _get_block_dependency);
     if (st.ok()) {
         DCHECK(load_block_queue != nullptr);
+        custom_profile()->add_info_string(
+                "GroupCommitIntervalMs",
+                std::to_string(load_block_queue->get_group_commit_interval_ms()));
         _runtime_filter_timer = std::make_shared<pipeline::RuntimeFilterTimer>(
                 MonotonicMillis(), load_block_queue->get_group_commit_interval_ms(),
                 _get_block_dependency, true);
@@ -17,12 +17,17 @@
 
 #include "hashjoin_build_sink.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/hashjoin_probe_operator.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline_task.h"
+#include "runtime/exec_env.h"
+#include "util/countdown_latch.h"
 #include "util/pretty_printer.h"
 #include "util/uid_util.h"
 #include "vec/columns/column_nullable.h"
@@ -350,6 +355,42 @@ Status HashJoinBuildSinkLocalState::_extract_join_column(
     return Status::OK();
 }
 
+// Below this many rows a thread inserts the rows faster than the threads are handed the work.
+static constexpr uint32_t MIN_ROWS_PER_BUILD_THREAD = 1 << 20;
+
+size_t HashJoinBuildSinkLocalState::_build_parallelism(uint32_t rows) const {
+    auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    // only a shared hash table keeps the other build tasks idle while one task builds it
+    if (!p._use_shared_hash_table || config::shared_hash_table_build_parallelism <= 1 ||
+        ExecEnv::GetInstance()->join_build_thread_pool() == nullptr) {
+        return 1;
+    }
+    return std::min<size_t>(config::shared_hash_table_build_parallelism,
+                            rows / MIN_ROWS_PER_BUILD_THREAD);
+}
+
+void HashJoinBuildSinkLocalState::_insert_in_parallel(
+        uint32_t rows, size_t parallelism, const std::function<void(uint32_t, uint32_t)>& insert) {
+    // row 0 is the placeholder of the build block
+    auto range_size = cast_set<uint32_t>((rows - 1 + parallelism - 1) / parallelism);
+    CountDownLatch latch(cast_set<int>(parallelism - 1));
+    auto* pool = ExecEnv::GetInstance()->join_build_thread_pool();
+    for (size_t i = 1; i < parallelism; ++i) {
+        auto begin = std::min(rows, cast_set<uint32_t>(1 + i * range_size));
+        auto end = std::min(rows, begin + range_size);
+        auto st = pool->submit_func([&, begin, end]() {
+            insert(begin, end);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            insert(begin, end);
+            latch.count_down();
+        }
+    }
+    insert(1, std::min(rows, 1 + range_size));
+    latch.wait();
+}
+
 Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
                                                         vectorized::Block& block) {
     DCHECK(_should_build_hash_table);
@@ -607,6 +648,9 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
         local_state._shared_state->build_block = std::make_shared<vectorized::Block>(
                 local_state._build_side_mutable_block.to_block());
 
+        // the build exprs are evaluated while merging the input blocks, the first row is mocked
+        local_state._runtime_filter_producer_helper->estimate_filter_ndv(
+                local_state._shared_state->build_block.get(), 1);
         RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
                 state, local_state._shared_state->build_block->rows(),
                 local_state._finish_dependency));
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <functional>
+
+#include "common/config.h"
 #include "join_build_sink_operator.h"
 #include "operator.h"
 #include "runtime_filter/runtime_filter_producer_helper.h"
@@ -60,6 +63,13 @@ protected:
                                 vectorized::ColumnUInt8::MutablePtr& null_map,
                                 vectorized::ColumnRawPtrs& raw_ptrs,
                                 const std::vector<int>& res_col_ids);
+    // The number of threads to insert the `rows` rows of the build side with.
+    size_t _build_parallelism(uint32_t rows) const;
+    // Calls `insert` on [1, rows) split into `parallelism` ranges, in the join build pool and
+    // the calling thread at the same time.
+    void _insert_in_parallel(uint32_t rows, size_t parallelism,
+                             const std::function<void(uint32_t, uint32_t)>& insert);
+
     friend class HashJoinBuildSinkOperatorX;
     friend class PartitionedHashJoinSinkLocalState;
     template <class HashTableContext>
@@ -215,6 +225,9 @@ struct ProcessHashTableBuild {
         hash_table_ctx.init_serialized_keys(_build_raw_ptrs, _rows,
                                             null_map ? null_map->data() : nullptr, true, true,
                                             hash_table_ctx.hash_table->get_bucket_size());
+        if constexpr (requires { hash_table_ctx.hash_table->try_direct_mapping({}, {}); }) {
+            _try_direct_mapping(hash_table_ctx, null_map ? null_map->data() : nullptr);
+        }
         // only 2 cases need to access the null value in hash table
         bool keep_null_key = false;
         if ((JoinOpType == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN ||
@@ -233,8 +246,22 @@ struct ProcessHashTableBuild {
             keep_null_key = true;
         }
 
-        hash_table_ctx.hash_table->build(hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(),
-                                         _rows, keep_null_key);
+        if (auto parallelism = _parent->_build_parallelism(_rows); parallelism > 1) {
+            auto* hash_table = hash_table_ctx.hash_table.get();
+            const auto* bucket_nums = hash_table_ctx.bucket_nums.data();
+            _parent->_insert_in_parallel(_rows, parallelism, [&](uint32_t begin, uint32_t end) {
+                hash_table->build_range(bucket_nums, begin, end);
+            });
+            hash_table->finish_build(hash_table_ctx.keys, keep_null_key);
+        } else {
+            hash_table_ctx.hash_table->build(hash_table_ctx.keys,
+                                             hash_table_ctx.bucket_nums.data(), _rows,
+                                             keep_null_key);
+        }
+        if (config::enable_hash_join_probe_bloom_filter && _rows >= MIN_ROWS_FOR_PROBE_FILTER) {
+            hash_table_ctx.hash_table->build_probe_filter(hash_table_ctx.bucket_nums.data(),
+                                                          _rows);
+        }
         hash_table_ctx.bucket_nums.resize(_batch_size);
         hash_table_ctx.bucket_nums.shrink_to_fit();
 
@@ -246,6 +273,30 @@ struct ProcessHashTableBuild {
     }
 
 private:
+    // Maps the keys straight to the buckets if they span a small range, see
+    // `JoinHashTable::try_direct_mapping`.
+    void _try_direct_mapping(HashTableContext& hash_table_ctx, const uint8_t* null_map) {
+        const auto* keys = hash_table_ctx.keys;
+        using Key = std::remove_cv_t<std::remove_pointer_t<decltype(keys)>>;
+        auto min_key = std::numeric_limits<Key>::max();
+        auto max_key = std::numeric_limits<Key>::min();
+        // the first row is not from the build side
+        for (uint32_t i = 1; i < _rows; i++) {
+            if (null_map && null_map[i]) {
+                continue;
+            }
+            min_key = std::min(min_key, keys[i]);
+            max_key = std::max(max_key, keys[i]);
+        }
+        if (hash_table_ctx.hash_table->try_direct_mapping(min_key, max_key)) {
+            hash_table_ctx.init_join_bucket_num(_rows, hash_table_ctx.hash_table->get_bucket_size(),
+                                                null_map);
+        }
+    }
+
+    // Below this many rows the table stays in the cache and the probe filter does not pay off.
+    static constexpr uint32_t MIN_ROWS_FOR_PROBE_FILTER = 1 << 16;
+
     const uint32_t _rows;
     vectorized::ColumnRawPtrs& _build_raw_ptrs;
     HashJoinBuildSinkLocalState* _parent = nullptr;
@@ -66,6 +66,7 @@ Status HashJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo& info)
     _non_equal_join_conjuncts_timer =
             ADD_TIMER(custom_profile(), "NonEqualJoinConjunctEvaluationTime");
     _init_probe_side_timer = ADD_TIMER(custom_profile(), "InitProbeSideTime");
+    _probe_filter_rows = ADD_COUNTER(custom_profile(), "ProbeBloomFilterFilteredRows", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -115,6 +115,7 @@ private:
     RuntimeProfile::Counter* _init_probe_side_timer = nullptr;
     RuntimeProfile::Counter* _build_side_output_timer = nullptr;
     RuntimeProfile::Counter* _non_equal_join_conjuncts_timer = nullptr;
+    RuntimeProfile::Counter* _probe_filter_rows = nullptr;
 };
 
 class HashJoinProbeOperatorX MOCK_REMOVE(final)
@@ -113,6 +113,13 @@ struct ProcessHashTableProbe {
     std::vector<bool> _build_column_has_null;
     bool _need_calculate_build_index_has_zero = true;
 
+    // The probe filter of the hash table is given up on if it drops less than a quarter of the
+    // first this many probe rows.
+    static constexpr uint64_t PROBE_FILTER_SAMPLE_ROWS = 1 << 16;
+    bool _use_probe_filter = true;
+    uint64_t _probe_filter_checked_rows = 0;
+    uint64_t _probe_filter_filtered_rows = 0;
+
     RuntimeProfile::Counter* _search_hashtable_timer = nullptr;
     RuntimeProfile::Counter* _init_probe_side_timer = nullptr;
     RuntimeProfile::Counter* _build_side_output_timer = nullptr;
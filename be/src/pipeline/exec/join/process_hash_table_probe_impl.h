@@ -181,6 +181,18 @@ typename HashTableType::State ProcessHashTableProbe<JoinOpType>::_init_probe_sid
 
         hash_table_ctx.init_serialized_keys(_parent->_probe_columns, probe_rows, null_map, true,
                                             false, hash_table_ctx.hash_table->get_bucket_size());
+        if (_use_probe_filter && hash_table_ctx.hash_table->has_probe_filter()) {
+            auto filtered_rows = hash_table_ctx.hash_table->apply_probe_filter(
+                    hash_table_ctx.keys, hash_table_ctx.bucket_nums);
+            COUNTER_UPDATE(_parent->_probe_filter_rows, filtered_rows);
+            _probe_filter_checked_rows += probe_rows;
+            _probe_filter_filtered_rows += filtered_rows;
+            // the filter costs more than it saves when most of the probe rows have a match
+            if (_probe_filter_checked_rows >= PROBE_FILTER_SAMPLE_ROWS &&
+                _probe_filter_filtered_rows * 4 < _probe_filter_checked_rows) {
+                _use_probe_filter = false;
+            }
+        }
         hash_table_ctx.hash_table->pre_build_idxs(hash_table_ctx.bucket_nums);
         int64_t arena_memory_usage = hash_table_ctx.serialized_keys_size(false);
         COUNTER_SET(_parent->_probe_arena_memory_usage, arena_memory_usage);
@@ -19,6 +19,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 
@@ -200,6 +201,8 @@ Status OlapScanLocalState::_init_profile() {
     _total_segment_counter = ADD_COUNTER(_segment_profile, "NumSegmentTotal", TUnit::UNIT);
     _tablet_counter = ADD_COUNTER(custom_profile(), "TabletNum", TUnit::UNIT);
     _key_range_counter = ADD_COUNTER(custom_profile(), "KeyRangesNum", TUnit::UNIT);
+    _synchronized_scan_tablets =
+            ADD_COUNTER(custom_profile(), "SynchronizedScanTablets", TUnit::UNIT);
     _tablet_reader_init_timer = ADD_TIMER(_scanner_profile, "TabletReaderInitTimer");
     _tablet_reader_capture_rs_readers_timer =
             ADD_TIMER(_scanner_profile, "TabletReaderCaptureRsReadersTimer");
@@ -325,6 +328,35 @@ bool OlapScanLocalState::_storage_no_merge() {
              p._olap_scan_node.enable_unique_key_merge_on_write));
 }
 
+void OlapScanLocalState::_synchronize_scanners(std::list<vectorized::ScannerSPtr>* scanners) {
+    auto tablet_of = [](const vectorized::ScannerSPtr& scanner) {
+        return assert_cast<vectorized::OlapScanner*>(scanner.get())->tablet().get();
+    };
+    // The scanners of a tablet are adjacent and in the order of its segments, and the scanner
+    // context runs them from the back. Moving the scanners up to the one at the position to the
+    // back makes it run first, followed by those before it and then those after it.
+    auto begin = scanners->begin();
+    while (begin != scanners->end()) {
+        auto* tablet = tablet_of(*begin);
+        auto end = std::find_if(begin, scanners->end(), [&](const vectorized::ScannerSPtr& s) {
+            return tablet_of(s) != tablet;
+        });
+        RowsetId rowset_id;
+        int64_t segment_id = 0;
+        if (tablet->get_scan_position(&rowset_id, &segment_id)) {
+            auto it = std::find_if(begin, end, [&](const vectorized::ScannerSPtr& s) {
+                return assert_cast<vectorized::OlapScanner*>(s.get())->reads_segment(rowset_id,
+                                                                                   segment_id);
+            });
+            if (it != end && std::next(it) != end) {
+                scanners->splice(end, *scanners, begin, std::next(it));
+                COUNTER_UPDATE(_synchronized_scan_tablets, 1);
+            }
+        }
+        begin = end;
+    }
+}
+
 Status OlapScanLocalState::_init_scanners(std::list<vectorized::ScannerSPtr>* scanners) {
     if (_scan_ranges.empty()) {
         _eos = true;
@@ -399,6 +431,9 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::ScannerSPtr>* sc
         scanner_builder.set_min_rows_per_scanner(min_rows_per_scanner);
 
         RETURN_IF_ERROR(scanner_builder.build_scanners(*scanners));
+        if (config::enable_synchronized_scan) {
+            _synchronize_scanners(scanners);
+        }
         for (auto& scanner : *scanners) {
             auto* olap_scanner = assert_cast<vectorized::OlapScanner*>(scanner.get());
             RETURN_IF_ERROR(olap_scanner->prepare(state(), _conjuncts));
@@ -601,9 +636,16 @@ Status OlapScanLocalState::prepare(RuntimeState* state) {
     }
 
     for (size_t i = 0; i < _scan_ranges.size(); i++) {
-        RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers({0, _tablets[i].version},
-                                                               &_read_sources[i].rs_splits,
-                                                               _state->skip_missing_version()));
+        if (_query_cache_lookup != nullptr && _query_cache_lookup->is_delta) {
+            // only read the rowsets loaded since the version of the reused query cache entry
+            for (const auto& rs_split : _query_cache_lookup->delta_rs_splits) {
+                _read_sources[i].rs_splits.emplace_back(rs_split.rs_reader->clone());
+            }
+        } else {
+            RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers(
+                    {0, _tablets[i].version}, &_read_sources[i].rs_splits,
+                    _state->skip_missing_version()));
+        }
         if (!PipelineXLocalState<>::_state->skip_delete_predicate()) {
             _read_sources[i].fill_delete_predicates();
         }
@@ -635,15 +677,14 @@ void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
                                          const std::vector<TScanRangeParams>& scan_ranges) {
     const auto& cache_param = _parent->cast<OlapScanOperatorX>()._cache_param;
     bool hit_cache = false;
-    if (!cache_param.digest.empty() && !cache_param.force_refresh_query_cache) {
-        std::string cache_key;
-        int64_t version = 0;
-        auto status = QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version);
+    if (!cache_param.digest.empty()) {
+        auto status = QueryCache::instance()->lookup_once(state, scan_ranges, cache_param,
+                                                          &_query_cache_lookup);
         if (!status.ok()) {
             throw doris::Exception(doris::ErrorCode::INTERNAL_ERROR, status.msg());
         }
-        doris::QueryCacheHandle handle;
-        hit_cache = QueryCache::instance()->lookup(cache_key, version, &handle);
+        // an entry of an older version still needs the rowsets loaded since then
+        hit_cache = _query_cache_lookup->hit && !_query_cache_lookup->is_delta;
     }
 
     if (!hit_cache) {
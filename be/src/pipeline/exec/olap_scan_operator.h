@@ -26,6 +26,7 @@
 #include "olap/tablet_reader.h"
 #include "operator.h"
 #include "pipeline/exec/scan_operator.h"
+#include "pipeline/query_cache/query_cache.h"
 
 namespace doris::vectorized {
 class OlapScanner;
@@ -93,6 +94,9 @@ private:
     }
 
     Status _init_scanners(std::list<vectorized::ScannerSPtr>* scanners) override;
+    // Reorders the scanners of every tablet to start at the segment another scan of the
+    // tablet is reading, see enable_synchronized_scan.
+    void _synchronize_scanners(std::list<vectorized::ScannerSPtr>* scanners);
 
     Status _build_key_ranges_and_filters();
 
@@ -115,6 +119,8 @@ private:
 
     RuntimeProfile::Counter* _tablet_counter = nullptr;
     RuntimeProfile::Counter* _key_range_counter = nullptr;
+    // tablets whose scan started at the position of another scan
+    RuntimeProfile::Counter* _synchronized_scan_tablets = nullptr;
     RuntimeProfile::Counter* _reader_init_timer = nullptr;
     RuntimeProfile::Counter* _scanner_init_timer = nullptr;
     RuntimeProfile::Counter* _process_conjunct_timer = nullptr;
@@ -241,6 +247,8 @@ private:
 
     std::vector<TabletWithVersion> _tablets;
     std::vector<TabletReader::ReadSource> _read_sources;
+    // The query cache entry reused for the tablet, null if the query cache is not used.
+    std::shared_ptr<QueryCacheLookup> _query_cache_lookup;
 };
 
 class OlapScanOperatorX final : public ScanOperatorX<OlapScanLocalState> {
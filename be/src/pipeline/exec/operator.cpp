@@ -96,6 +96,21 @@ class RuntimeState;
 
 namespace doris::pipeline {
 
+static void update_perf_counters(RuntimeProfile* profile,
+                                 const ThreadPerfCounters::Values* values) {
+    if (values == nullptr || values->cpu_cycles == 0) {
+        return;
+    }
+    COUNTER_SET(ADD_COUNTER_WITH_LEVEL(profile, "CpuCycles", TUnit::UNIT, 2), values->cpu_cycles);
+    COUNTER_SET(ADD_COUNTER_WITH_LEVEL(profile, "Instructions", TUnit::UNIT, 2),
+                values->instructions);
+    COUNTER_SET(ADD_COUNTER_WITH_LEVEL(profile, "CacheMisses", TUnit::UNIT, 2),
+                values->cache_misses);
+    profile->add_info_string(
+            "IPC", fmt::format("{:.2f}", static_cast<double>(values->instructions) /
+                                                 static_cast<double>(values->cpu_cycles)));
+}
+
 Status OperatorBase::close(RuntimeState* state) {
     if (_is_closed) {
         return Status::OK();
@@ -246,6 +261,12 @@ Status OperatorXBase::prepare(RuntimeState* state) {
     for (auto& projections : _intermediate_projections) {
         RETURN_IF_ERROR(vectorized::VExpr::open(projections, state));
     }
+    _equal_projections = vectorized::VExprContext::find_equal_exprs(_projections);
+    _equal_intermediate_projections.clear();
+    for (const auto& projections : _intermediate_projections) {
+        _equal_intermediate_projections.push_back(
+                vectorized::VExprContext::find_equal_exprs(projections));
+    }
     if (_child && !is_source()) {
         RETURN_IF_ERROR(_child->prepare(state));
     }
@@ -299,9 +320,15 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
 
     std::vector<int> result_column_ids;
     size_t bytes_usage = 0;
-    for (const auto& projections : local_state->_intermediate_projections) {
+    for (size_t level = 0; level < local_state->_intermediate_projections.size(); ++level) {
+        const auto& projections = local_state->_intermediate_projections[level];
+        const auto& equal_projections = _equal_intermediate_projections[level];
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
+            if (equal_projections[i] != -1) {
+                result_column_ids[i] = result_column_ids[equal_projections[i]];
+                continue;
+            }
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
         }
 
@@ -338,9 +365,15 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
         auto& mutable_columns = mutable_block.mutable_columns();
         const size_t origin_columns_count = input_block.columns();
         DCHECK_EQ(mutable_columns.size(), local_state->_projections.size()) << debug_string();
+        result_column_ids.resize(mutable_columns.size());
         for (int i = 0; i < mutable_columns.size(); ++i) {
-            auto result_column_id = -1;
-            RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
+            auto& result_column_id = result_column_ids[i];
+            if (_equal_projections[i] != -1) {
+                result_column_id = result_column_ids[_equal_projections[i]];
+            } else {
+                RETURN_IF_ERROR(
+                        local_state->_projections[i]->execute(&input_block, &result_column_id));
+            }
             auto column_ptr = input_block.get_by_position(result_column_id)
                                       .column->convert_to_full_column_if_const();
             if (result_column_id >= origin_columns_count) {
@@ -372,6 +405,7 @@ Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::
 
     Status status;
     auto* local_state = state->get_local_state(operator_id());
+    ScopedThreadPerfCounters perf_scope(local_state->perf_counter_values());
     Defer defer([&]() {
         if (status.ok()) {
             if (auto rows = block->rows()) {
@@ -550,6 +584,9 @@ Status PipelineXLocalState<SharedStateArg>::init(RuntimeState* state, LocalState
     _exec_timer = ADD_TIMER_WITH_LEVEL(_common_profile, "ExecTime", 1);
     _memory_used_counter =
             _common_profile->AddHighWaterMarkCounter("MemoryUsage", TUnit::BYTES, "", 1);
+    if (config::enable_pipeline_operator_perf_counters) {
+        _perf_counter_values = std::make_unique<ThreadPerfCounters::Values>();
+    }
     return Status::OK();
 }
 
@@ -591,6 +628,7 @@ Status PipelineXLocalState<SharedStateArg>::close(RuntimeState* state) {
     if constexpr (!std::is_same_v<SharedStateArg, FakeSharedState>) {
         COUNTER_SET(_wait_for_dependency_timer, _dependency->watcher_elapse_time());
     }
+    update_perf_counters(_common_profile.get(), _perf_counter_values.get());
     _closed = true;
     return Status::OK();
 }
@@ -648,6 +686,9 @@ Status PipelineXSinkLocalState<SharedState>::init(RuntimeState* state, LocalSink
     _exec_timer = ADD_TIMER_WITH_LEVEL(_common_profile, "ExecTime", 1);
     _memory_used_counter =
             _common_profile->AddHighWaterMarkCounter("MemoryUsage", TUnit::BYTES, "", 1);
+    if (config::enable_pipeline_operator_perf_counters) {
+        _perf_counter_values = std::make_unique<ThreadPerfCounters::Values>();
+    }
     return Status::OK();
 }
 
@@ -659,6 +700,7 @@ Status PipelineXSinkLocalState<SharedState>::close(RuntimeState* state, Status e
     if constexpr (!std::is_same_v<SharedState, FakeSharedState>) {
         COUNTER_SET(_wait_for_dependency_timer, _dependency->watcher_elapse_time());
     }
+    update_perf_counters(_common_profile, _perf_counter_values.get());
     _closed = true;
     return Status::OK();
 }
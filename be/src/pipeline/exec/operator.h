@@ -39,6 +39,7 @@
 #include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/runtime/vdata_stream_recvr.h"
@@ -143,6 +144,9 @@ public:
         _followed_by_shuffled_operator = followed_by_shuffled_operator;
     }
     [[nodiscard]] virtual bool is_shuffled_operator() const { return false; }
+    // Whether the rows of a key may go to different tasks although a hash distribution is
+    // required, because the results of the tasks are merged later.
+    [[nodiscard]] virtual bool allow_split_hot_partitions() const { return false; }
     [[nodiscard]] virtual DataDistribution required_data_distribution() const;
     [[nodiscard]] virtual bool require_shuffled_data_distribution() const;
 
@@ -198,6 +202,8 @@ public:
 
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
     RuntimeProfile::Counter* memory_used_counter() { return _memory_used_counter; }
+    // nullptr unless enable_pipeline_operator_perf_counters
+    ThreadPerfCounters::Values* perf_counter_values() { return _perf_counter_values.get(); }
     OperatorXBase* parent() { return _parent; }
     RuntimeState* state() { return _state; }
     vectorized::VExprContextSPtrs& conjuncts() { return _conjuncts; }
@@ -268,6 +274,8 @@ protected:
     RuntimeProfile::Counter* _init_timer = nullptr;
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _close_timer = nullptr;
+    // hardware counters of this operator alone, without the operators it pulls from
+    std::unique_ptr<ThreadPerfCounters::Values> _perf_counter_values;
 
     OperatorXBase* _parent = nullptr;
     RuntimeState* _state = nullptr;
@@ -510,6 +518,8 @@ public:
     RuntimeProfile::Counter* rows_input_counter() { return _rows_input_counter; }
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
     RuntimeProfile::Counter* memory_used_counter() { return _memory_used_counter; }
+    // nullptr unless enable_pipeline_operator_perf_counters
+    ThreadPerfCounters::Values* perf_counter_values() { return _perf_counter_values.get(); }
 
     virtual std::vector<Dependency*> dependencies() const { return {nullptr}; }
 
@@ -544,6 +554,7 @@ protected:
     RuntimeProfile::Counter* _wait_for_finish_dependency_timer = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _memory_used_counter = nullptr;
+    std::unique_ptr<ThreadPerfCounters::Values> _perf_counter_values;
 };
 
 template <typename SharedStateArg = FakeSharedState>
@@ -982,6 +993,10 @@ private:
     vectorized::VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The earlier projection with the same expr of each projection, whose result is reused
+    // rather than computed again, or -1. See VExprContext::find_equal_exprs.
+    std::vector<int> _equal_projections;
+    std::vector<std::vector<int>> _equal_intermediate_projections;
 
 protected:
     RowDescriptor _row_descriptor;
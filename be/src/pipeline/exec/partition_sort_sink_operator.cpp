@@ -54,6 +54,8 @@ Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
             ADD_COUNTER(custom_profile(), "PassThroughRowsCounter", TUnit::UNIT);
     _sorted_partition_input_rows_counter =
             ADD_COUNTER(custom_profile(), "SortedPartitionInputRows", TUnit::UNIT);
+    _pruned_rows_counter =
+            ADD_COUNTER(custom_profile(), "PrunedRowsByTopNThreshold", TUnit::UNIT);
     _partition_sort_info = std::make_shared<PartitionSortInfo>(
             &_vsort_exec_exprs, p._limit, 0, p._pool, p._is_asc_order, p._nulls_first,
             p._child->row_desc(), state, custom_profile(), p._has_global_limit,
@@ -239,19 +241,35 @@ Status PartitionSortSinkOperatorX::_emplace_into_hash_table(
                             local_state._num_partition++;
                         };
 
+                        // the rows ordered after the topn rows of their partition are skipped
+                        vectorized::Columns sort_keys;
+                        if (local_state._has_topn_threshold) {
+                            RETURN_IF_ERROR(
+                                    local_state._partition_sort_info->get_sort_key_columns(
+                                            input_block, &sort_keys));
+                        }
+
                         SCOPED_TIMER(local_state._emplace_key_timer);
+                        int64_t pruned_rows = 0;
                         int64_t row = num_rows;
                         for (row = row - 1; row >= 0 && !local_state._is_need_passthrough; --row) {
                             auto& mapped = *agg_method.lazy_emplace(state, row, creator,
                                                                     creator_for_null_key);
-                            mapped->add_row_idx(row);
+                            if (!sort_keys.empty() && mapped->has_threshold() &&
+                                mapped->after_threshold(sort_keys, row)) {
+                                pruned_rows++;
+                            } else {
+                                mapped->add_row_idx(row);
+                            }
                             local_state._sorted_partition_input_rows++;
                             local_state._is_need_passthrough =
                                     local_state.check_whether_need_passthrough();
                         }
+                        COUNTER_UPDATE(local_state._pruned_rows_counter, pruned_rows);
                         for (auto* place : local_state._value_places) {
                             SCOPED_TIMER(local_state._selector_block_timer);
                             RETURN_IF_ERROR(place->append_block_by_selector(input_block, eos));
+                            local_state._has_topn_threshold |= place->has_threshold();
                         }
                         //Perform passthrough for the range [0, row] of input_block
                         if (local_state._is_need_passthrough && row >= 0) {
@@ -54,6 +54,8 @@ private:
     std::shared_ptr<PartitionSortInfo> _partition_sort_info = nullptr;
     TPartTopNPhase::type _topn_phase;
     bool _is_need_passthrough = false;
+    // some partition has the threshold of its topn rows
+    bool _has_topn_threshold = false;
 
     RuntimeProfile::Counter* _build_timer = nullptr;
     RuntimeProfile::Counter* _emplace_key_timer = nullptr;
@@ -61,6 +63,7 @@ private:
     RuntimeProfile::Counter* _sorted_data_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_size_counter = nullptr;
     RuntimeProfile::Counter* _passthrough_rows_counter = nullptr;
+    RuntimeProfile::Counter* _pruned_rows_counter = nullptr;
     RuntimeProfile::Counter* _sorted_partition_input_rows_counter = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _serialize_key_arena_memory_usage = nullptr;
@@ -52,6 +52,9 @@ Status ResultSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info)
     for (size_t i = 0; i < _output_vexpr_ctxs.size(); i++) {
         RETURN_IF_ERROR(p._output_vexpr_ctxs[i]->clone(state, _output_vexpr_ctxs[i]));
     }
+    // The instances serialize their rows in their own tasks either way. With a parallel result
+    // sink they share the buffer of the query, otherwise each instance owns a buffer keyed by
+    // its instance id, which the client can fetch from as one of several endpoints.
     if (state->query_options().enable_parallel_result_sink) {
         _sender = _parent->cast<ResultSinkOperatorX>()._sender;
     } else {
@@ -19,6 +19,7 @@
 
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/query_context.h"
 #include "vec/common/sort/heap_sorter.h"
@@ -47,9 +48,13 @@ Status SortSinkLocalState::open(RuntimeState* state) {
     RETURN_IF_ERROR(p._vsort_exec_exprs.clone(state, _vsort_exec_exprs));
     switch (p._algorithm) {
     case TSortAlgorithm::HEAP_SORT: {
-        _shared_state->sorter = vectorized::HeapSorter::create_shared(
+        auto sorter = vectorized::HeapSorter::create_shared(
                 _vsort_exec_exprs, p._limit, p._offset, p._pool, p._is_asc_order, p._nulls_first,
                 p._child->row_desc());
+        if (p._heap_sort_threshold != nullptr) {
+            sorter->set_threshold(p._heap_sort_threshold);
+        }
+        _shared_state->sorter = std::move(sorter);
         break;
     }
     case TSortAlgorithm::TOPN_SORT: {
@@ -118,6 +123,10 @@ Status SortSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* state) {
     if (query_ctx->has_runtime_predicate(_node_id) && _algorithm == TSortAlgorithm::HEAP_SORT) {
         query_ctx->get_runtime_predicate(_node_id).set_detected_source();
     }
+    if (_algorithm == TSortAlgorithm::HEAP_SORT && !_is_analytic_sort &&
+        config::enable_heap_sort_shared_threshold) {
+        _heap_sort_threshold = vectorized::HeapSortThreshold::create_shared();
+    }
     return Status::OK();
 }
 
@@ -22,6 +22,10 @@
 #include "operator.h"
 #include "vec/core/field.h"
 
+namespace doris::vectorized {
+class HeapSortThreshold;
+} // namespace doris::vectorized
+
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 
@@ -124,6 +128,8 @@ private:
     const TSortAlgorithm::type _algorithm;
     const bool _reuse_mem;
     const int64_t _max_buffered_bytes;
+    // shared by the heap sorters of all tasks of the node
+    std::shared_ptr<vectorized::HeapSortThreshold> _heap_sort_threshold;
 };
 
 #include "common/compile_check_end.h"
@@ -19,6 +19,8 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
+
 #include "common/status.h"
 #include "pipeline/exec/spill_utils.h"
 #include "pipeline/pipeline_task.h"
@@ -41,6 +43,10 @@ Status SpillSortLocalState::init(RuntimeState* state, LocalStateInfo& info) {
                                                   "SortSourceSpillDependency", true);
     _internal_runtime_profile = std::make_unique<RuntimeProfile>("internal_profile");
     _spill_merge_sort_timer = ADD_TIMER_WITH_LEVEL(Base::custom_profile(), "SpillMergeSortTime", 1);
+    _spill_intermediate_merge_count = ADD_COUNTER_WITH_LEVEL(
+            Base::custom_profile(), "SpillIntermediateMergeCount", TUnit::UNIT, 1);
+    _spill_intermediate_merge_bytes = ADD_COUNTER_WITH_LEVEL(
+            Base::custom_profile(), "SpillIntermediateMergeBytes", TUnit::BYTES, 1);
     return Status::OK();
 }
 
@@ -65,6 +71,22 @@ int SpillSortLocalState::_calc_spill_blocks_to_merge(RuntimeState* state) const
     int count = state->spill_sort_mem_limit() / state->spill_sort_batch_bytes();
     return std::max(2, count);
 }
+
+// The number of streams to merge next. If there are more streams than could be merged at once,
+// the smallest streams are merged first, and the first merge takes just enough streams so that
+// every following merge, the final one included, merges `max_stream_count` streams. That keeps
+// the rows written again by the intermediate merges to the least.
+int SpillSortLocalState::_calc_streams_to_merge(int max_stream_count) {
+    auto& streams = _shared_state->sorted_streams;
+    auto num_streams = static_cast<int>(streams.size());
+    if (num_streams <= max_stream_count) {
+        return max_stream_count;
+    }
+    std::stable_sort(streams.begin(), streams.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->get_written_bytes() < rhs->get_written_bytes();
+    });
+    return (num_streams - 2) % (max_stream_count - 1) + 2;
+}
 Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* state) {
     auto& parent = Base::_parent->template cast<Parent>();
     VLOG_DEBUG << fmt::format("Query:{}, sort source:{}, task:{}, merge spill data",
@@ -98,15 +120,16 @@ Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* stat
         vectorized::SpillStreamSPtr tmp_stream;
         while (!state->is_cancelled()) {
             int max_stream_count = _calc_spill_blocks_to_merge(state);
+            int merge_stream_count = _calc_streams_to_merge(max_stream_count);
             VLOG_DEBUG << fmt::format(
                     "Query:{}, sort source:{}, task:{}, merge spill streams, streams count:{}, "
-                    "curren merge max stream count:{}",
+                    "curren merge max stream count:{}, merge stream count:{}",
                     print_id(query_id), _parent->node_id(), state->task_id(),
-                    _shared_state->sorted_streams.size(), max_stream_count);
+                    _shared_state->sorted_streams.size(), max_stream_count, merge_stream_count);
             {
                 SCOPED_TIMER(Base::_spill_recover_time);
                 status = _create_intermediate_merger(
-                        max_stream_count,
+                        merge_stream_count,
                         parent._sort_source_operator->get_sort_description(_runtime_state.get()));
             }
             RETURN_IF_ERROR(status);
@@ -150,6 +173,8 @@ Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* stat
                     }
                     RETURN_IF_ERROR(status);
                 }
+                COUNTER_UPDATE(_spill_intermediate_merge_count, 1);
+                COUNTER_UPDATE(_spill_intermediate_merge_bytes, tmp_stream->get_written_bytes());
             }
             for (auto& stream : _current_merging_streams) {
                 (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
@@ -48,6 +48,7 @@ public:
 
 protected:
     int _calc_spill_blocks_to_merge(RuntimeState* state) const;
+    int _calc_streams_to_merge(int max_stream_count);
     Status _create_intermediate_merger(int num_blocks,
                                        const vectorized::SortDescription& sort_description);
     friend class SpillSortSourceOperatorX;
@@ -61,6 +62,8 @@ protected:
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
     // counters for spill merge sort
     RuntimeProfile::Counter* _spill_merge_sort_timer = nullptr;
+    RuntimeProfile::Counter* _spill_intermediate_merge_count = nullptr;
+    RuntimeProfile::Counter* _spill_intermediate_merge_bytes = nullptr;
 };
 class SortSourceOperatorX;
 class SpillSortSourceOperatorX : public OperatorX<SpillSortLocalState> {
@@ -24,6 +24,7 @@
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
@@ -109,6 +110,8 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(custom_profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(custom_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
+    _merged_pass_through_rows_counter =
+            ADD_COUNTER(custom_profile(), "MergedPassThroughRows", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -337,6 +340,68 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     return ret_flag;
 }
 
+// Once the hash table stops expanding, the rows are passed through. The groups in the table are
+// the ones seen first, the frequent groups if the keys are skewed, so the rows of these groups
+// are still merged into them at the cost of one lookup. The lookups are given up on for a while
+// if few rows hit, and the table is allowed to expand again if most rows hit, since the input is
+// then reduced more than the expansion decision assumed.
+static constexpr size_t EXISTING_GROUPS_SAMPLE_ROWS = 64 * 1024;
+static constexpr double EXISTING_GROUPS_MIN_HIT_RATE = 0.1;
+static constexpr double EXISTING_GROUPS_EXPAND_HIT_RATE = 0.5;
+static constexpr size_t PASS_THROUGH_BLOCKS_BEFORE_RESAMPLE = 64;
+
+bool StreamingAggLocalState::_should_merge_into_existing_groups() {
+    if (!config::enable_streaming_agg_merge_existing_groups || _get_hash_table_size() == 0) {
+        return false;
+    }
+    if (_pass_through_blocks_to_skip > 0) {
+        --_pass_through_blocks_to_skip;
+        return false;
+    }
+    if (_existing_groups_probe_rows < EXISTING_GROUPS_SAMPLE_ROWS) {
+        return true;
+    }
+    auto hit_rate = static_cast<double>(_existing_groups_hit_rows) /
+                    static_cast<double>(_existing_groups_probe_rows);
+    _existing_groups_probe_rows = 0;
+    _existing_groups_hit_rows = 0;
+    if (hit_rate < EXISTING_GROUPS_MIN_HIT_RATE) {
+        _pass_through_blocks_to_skip = PASS_THROUGH_BLOCKS_BEFORE_RESAMPLE;
+        return false;
+    }
+    if (hit_rate > EXISTING_GROUPS_EXPAND_HIT_RATE) {
+        _should_expand_hash_table = true;
+    }
+    return true;
+}
+
+Status StreamingAggLocalState::_merge_into_existing_groups(vectorized::Block* in_block,
+                                                           vectorized::ColumnRawPtrs& key_columns,
+                                                           uint32_t rows) {
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    _find_in_hash_table(_places.data(), key_columns, rows);
+
+    vectorized::IColumn::Filter pass_through_filter(rows);
+    size_t hit_rows = 0;
+    for (uint32_t i = 0; i < rows; ++i) {
+        pass_through_filter[i] = _places[i] == nullptr;
+        hit_rows += _places[i] != nullptr;
+    }
+    _existing_groups_probe_rows += rows;
+    _existing_groups_hit_rows += hit_rows;
+    if (hit_rows == 0) {
+        return Status::OK();
+    }
+
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add_selected(
+                in_block, p._offsets_of_aggregate_states[i], _places.data(), _agg_arena_pool));
+    }
+    COUNTER_UPDATE(_merged_pass_through_rows_counter, hit_rows);
+    vectorized::Block::filter_block_internal(in_block, pass_through_filter);
+    return Status::OK();
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -346,6 +411,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
 
     size_t key_size = _probe_expr_ctxs.size();
     vectorized::ColumnRawPtrs key_columns(key_size);
+    std::vector<int> key_column_ids(key_size);
     {
         SCOPED_TIMER(_expr_timer);
         for (size_t i = 0; i < key_size; ++i) {
@@ -355,6 +421,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     in_block->get_by_position(result_column_id)
                             .column->convert_to_full_column_if_const();
             key_columns[i] = in_block->get_by_position(result_column_id).column.get();
+            key_column_ids[i] = result_column_id;
         }
     }
 
@@ -362,6 +429,13 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
     _places.resize(rows);
 
     if (_should_not_do_pre_agg(rows)) {
+        if (_should_merge_into_existing_groups()) {
+            RETURN_IF_ERROR(_merge_into_existing_groups(in_block, key_columns, rows));
+            rows = (uint32_t)in_block->rows();
+            for (size_t i = 0; i < key_size; ++i) {
+                key_columns[i] = in_block->get_by_position(key_column_ids[i]).column.get();
+            }
+        }
         bool mem_reuse = p._make_nullable_keys.empty() && out_block->mem_reuse();
 
         std::vector<vectorized::DataTypePtr> data_types;
@@ -608,6 +682,30 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
                _agg_data->method_variant);
 }
 
+void StreamingAggLocalState::_find_in_hash_table(vectorized::AggregateDataPtr* places,
+                                                 vectorized::ColumnRawPtrs& key_columns,
+                                                 uint32_t num_rows) {
+    std::visit(vectorized::Overload {[&](std::monostate& arg) -> void {
+                                         throw doris::Exception(ErrorCode::INTERNAL_ERROR,
+                                                                "uninited hash table");
+                                     },
+                                     [&](auto& agg_method) -> void {
+                                         SCOPED_TIMER(_hash_table_compute_timer);
+                                         using HashMethodType = std::decay_t<decltype(agg_method)>;
+                                         using AggState = typename HashMethodType::State;
+                                         AggState state(key_columns);
+                                         agg_method.init_serialized_keys(key_columns, num_rows);
+
+                                         for (size_t i = 0; i < num_rows; ++i) {
+                                             auto find_result = agg_method.find(state, i);
+                                             places[i] = find_result.is_found()
+                                                                 ? find_result.get_mapped()
+                                                                 : nullptr;
+                                         }
+                                     }},
+               _agg_data->method_variant);
+}
+
 StreamingAggOperatorX::StreamingAggOperatorX(ObjectPool* pool, int operator_id,
                                              const TPlanNode& tnode, const DescriptorTbl& descs)
         : StatefulOperatorX<StreamingAggLocalState>(pool, tnode, operator_id, descs),
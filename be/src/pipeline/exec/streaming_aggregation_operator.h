@@ -68,6 +68,13 @@ private:
                                             bool* eos);
     void _emplace_into_hash_table(vectorized::AggregateDataPtr* places,
                                   vectorized::ColumnRawPtrs& key_columns, const uint32_t num_rows);
+    void _find_in_hash_table(vectorized::AggregateDataPtr* places,
+                             vectorized::ColumnRawPtrs& key_columns, uint32_t num_rows);
+    bool _should_merge_into_existing_groups();
+    // Aggregates the rows of the groups already in the hash table and removes them from
+    // `in_block`, the other rows are left to pass through.
+    Status _merge_into_existing_groups(vectorized::Block* in_block,
+                                       vectorized::ColumnRawPtrs& key_columns, uint32_t rows);
     Status _create_agg_status(vectorized::AggregateDataPtr data);
     size_t _get_hash_table_size();
 
@@ -86,8 +93,15 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _merged_pass_through_rows_counter = nullptr;
 
     bool _should_expand_hash_table = true;
+    // Stats of the rows looked up in the hash table once it stops expanding, in the current
+    // sample, see `_should_merge_into_existing_groups`.
+    size_t _existing_groups_probe_rows = 0;
+    size_t _existing_groups_hit_rows = 0;
+    // blocks to pass through without looking up the hash table
+    size_t _pass_through_blocks_to_skip = 0;
     int64_t _cur_num_rows_returned = 0;
     vectorized::Arena _agg_arena_pool;
     AggregatedDataVariantsUPtr _agg_data = nullptr;
@@ -17,7 +17,10 @@
 
 #include "pipeline/local_exchange/local_exchanger.h"
 
+#include <algorithm>
+
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
@@ -165,6 +168,25 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
     if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
                       source_info.channel_id)) {
         SCOPED_TIMER(profile.copy_data_timer);
+        auto& data_block = partitioned_block.first->_data_block;
+        if (block->rows() == 0 && partitioned_block.second.length == data_block.rows()) {
+            // All rows of the block are in this partition, in their order, and no other source
+            // references the block. Take its columns instead of copying the rows.
+            block->swap(data_block);
+            // the block goes back to the free blocks and is swapped into a sink again
+            if (data_block.columns() != block->columns()) {
+                data_block = block->clone_empty();
+            }
+            // Appending rows mutates the columns in place only if nothing else references them.
+            bool exclusive = std::all_of(block->begin(), block->end(), [](const auto& column) {
+                return column.column->use_count() == 1;
+            });
+            if (!exclusive || block->rows() >= state->batch_size() || *eos ||
+                !_dequeue_data(source_info.local_state, partitioned_block, eos, block,
+                               source_info.channel_id)) {
+                return Status::OK();
+            }
+        }
         mutable_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
                 block, partitioned_block.first->_data_block);
         RETURN_IF_ERROR(get_data());
@@ -215,6 +237,7 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
      */
     DCHECK(shuffle_idx_to_instance_idx && shuffle_idx_to_instance_idx->size() > 0);
     const auto& map = *shuffle_idx_to_instance_idx;
+    int64_t total_rows = _split_hot_partitions ? _total_rows.fetch_add(rows) + rows : 0;
     int32_t enqueue_rows = 0;
     for (const auto& it : map) {
         DCHECK(it.second >= 0 && it.second < _num_partitions)
@@ -223,6 +246,10 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
         uint32_t size = partition_rows_histogram[it.first + 1] - start;
         if (size > 0) {
             enqueue_rows += size;
+            if (_split_hot_partitions && _is_hot_partition(it.first, size, total_rows)) {
+                _enqueue_hot_partition(local_state, {new_block_wrapper, {row_idx, start, size}});
+                continue;
+            }
             _enqueue_data_and_set_ready(it.second, local_state,
                                         {new_block_wrapper, {row_idx, start, size}});
         }
@@ -243,6 +270,34 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     return Status::OK();
 }
 
+bool ShuffleExchanger::_is_hot_partition(int partition, uint32_t rows, int64_t total_rows) {
+    int64_t partition_rows = _partition_rows[partition].fetch_add(rows) + rows;
+    if (total_rows < config::local_exchange_hot_partition_min_rows) {
+        return false;
+    }
+    // compared with the rows each source would get if the partitions were even
+    return static_cast<double>(partition_rows) * _num_sources >
+           static_cast<double>(total_rows) * config::local_exchange_hot_partition_factor;
+}
+
+void ShuffleExchanger::_enqueue_hot_partition(LocalExchangeSinkLocalState* local_state,
+                                              const PartitionedBlock& partitioned_block) {
+    const auto& [block_wrapper, row_idxs] = partitioned_block;
+    // slices of at least HOT_PARTITION_MIN_SLICE_ROWS rows, one per source at most
+    constexpr uint32_t HOT_PARTITION_MIN_SLICE_ROWS = 256;
+    auto num_slices = std::clamp<uint32_t>(row_idxs.length / HOT_PARTITION_MIN_SLICE_ROWS, 1,
+                                           cast_set<uint32_t>(_num_sources));
+    uint32_t slice_rows = (row_idxs.length + num_slices - 1) / num_slices;
+    for (uint32_t offset = 0; offset < row_idxs.length; offset += slice_rows) {
+        auto channel_id = cast_set<int>(_next_hot_channel.fetch_add(1) % _num_sources);
+        _enqueue_data_and_set_ready(
+                channel_id, local_state,
+                {block_wrapper,
+                 {row_idxs.row_idxs, row_idxs.offset_start + offset,
+                  std::min(slice_rows, row_idxs.length - offset)}});
+    }
+}
+
 Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                                      vectorized::Block* block, int channel_id) {
     const auto rows = cast_set<int32_t>(block->rows());
@@ -283,6 +338,38 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     return Status::OK();
 }
 
+PassthroughExchanger::PassthroughExchanger(int running_sink_operators, int num_partitions,
+                                           int free_block_limit)
+        : Exchanger<BlockWrapperSPtr>(running_sink_operators, num_partitions, free_block_limit),
+          _num_active_channels(num_partitions) {
+    if (config::local_exchange_passthrough_initial_channels > 0) {
+        _num_active_channels =
+                std::min(config::local_exchange_passthrough_initial_channels, num_partitions);
+    }
+}
+
+int PassthroughExchanger::_next_channel(int* sink_channel_id, size_t rows) {
+    int num_active_channels = _num_active_channels.load(std::memory_order_relaxed);
+    int channel_id = ((*sink_channel_id)++) % num_active_channels;
+    if (num_active_channels == _num_partitions) {
+        return channel_id;
+    }
+    size_t num_rows = _num_rows.fetch_add(rows, std::memory_order_relaxed) + rows;
+    // the sources of the active channels do not keep up
+    bool backlogged = _data_queue[channel_id].data_queue.size_approx() >=
+                      static_cast<size_t>(config::local_exchange_passthrough_channel_max_blocks);
+    if (backlogged || num_rows > static_cast<size_t>(num_active_channels) *
+                                         config::local_exchange_passthrough_rows_per_channel) {
+        int new_num_active_channels = std::min(num_active_channels * 2, _num_partitions);
+        if (_num_active_channels.compare_exchange_strong(num_active_channels,
+                                                         new_num_active_channels)) {
+            // start filling the new channels
+            channel_id = num_active_channels;
+        }
+    }
+    return channel_id;
+}
+
 Status PassthroughExchanger::sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                                   Profile&& profile, SinkInfo&& sink_info) {
     if (in_block->empty()) {
@@ -293,7 +380,7 @@ Status PassthroughExchanger::sink(RuntimeState* state, vectorized::Block* in_blo
         new_block = {in_block->clone_empty()};
     }
     new_block.swap(*in_block);
-    auto channel_id = ((*sink_info.channel_id)++) % _num_partitions;
+    auto channel_id = _next_channel(sink_info.channel_id, new_block.rows());
     BlockWrapperSPtr wrapper = BlockWrapper::create_shared(
             std::move(new_block),
             sink_info.local_state ? sink_info.local_state->_shared_state : nullptr, channel_id);
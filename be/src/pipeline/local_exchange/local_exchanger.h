@@ -289,6 +289,14 @@ public:
     void close(SourceInfo&& source_info) override;
     ExchangeType get_type() const override { return ExchangeType::HASH_SHUFFLE; }
 
+    // Called if the downstream operator merges the rows of a key from different tasks anyway,
+    // e.g. a partial aggregation. A partition that gets far more rows than the others is spread
+    // over all sources then, instead of making one task the long tail.
+    void set_split_hot_partitions() {
+        _split_hot_partitions = true;
+        _partition_rows = std::vector<std::atomic<int64_t>>(_num_partitions);
+    }
+
 protected:
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id,
@@ -297,6 +305,15 @@ protected:
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id);
     std::vector<std::vector<uint32_t>> _partition_rows_histogram;
+
+    bool _is_hot_partition(int partition, uint32_t rows, int64_t total_rows);
+    void _enqueue_hot_partition(LocalExchangeSinkLocalState* local_state,
+                                const PartitionedBlock& partitioned_block);
+
+    bool _split_hot_partitions = false;
+    std::vector<std::atomic<int64_t>> _partition_rows;
+    std::atomic<int64_t> _total_rows = 0;
+    std::atomic<uint32_t> _next_hot_channel = 0;
 };
 
 class BucketShuffleExchanger final : public ShuffleExchanger {
@@ -312,9 +329,7 @@ class BucketShuffleExchanger final : public ShuffleExchanger {
 class PassthroughExchanger final : public Exchanger<BlockWrapperSPtr> {
 public:
     ENABLE_FACTORY_CREATOR(PassthroughExchanger);
-    PassthroughExchanger(int running_sink_operators, int num_partitions, int free_block_limit)
-            : Exchanger<BlockWrapperSPtr>(running_sink_operators, num_partitions,
-                                          free_block_limit) {}
+    PassthroughExchanger(int running_sink_operators, int num_partitions, int free_block_limit);
     ~PassthroughExchanger() override = default;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos, Profile&& profile,
                 SinkInfo&& sink_info) override;
@@ -323,6 +338,15 @@ public:
                      SourceInfo&& source_info) override;
     ExchangeType get_type() const override { return ExchangeType::PASSTHROUGH; }
     void close(SourceInfo&& source_info) override;
+
+private:
+    int _next_channel(int* sink_channel_id, size_t rows);
+
+    // The blocks go to the first `_num_active_channels` sources only. It starts from
+    // `local_exchange_passthrough_initial_channels` and doubles when the rows passed or the
+    // blocks queued in a channel exceed the limits, the other sources finish without any data.
+    std::atomic<int> _num_active_channels;
+    std::atomic<size_t> _num_rows = 0;
 };
 
 class PassToOneExchanger final : public Exchanger<BlockWrapperSPtr> {
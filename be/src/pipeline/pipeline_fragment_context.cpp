@@ -744,6 +744,11 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
     const bool followed_by_shuffled_operator =
             operators.size() > idx ? operators[idx]->followed_by_shuffled_operator()
                                    : cur_pipe->sink()->followed_by_shuffled_operator();
+    const bool split_hot_partitions =
+            config::enable_local_exchange_split_hot_partitions &&
+            data_distribution.distribution_type == ExchangeType::HASH_SHUFFLE &&
+            (operators.size() > idx ? operators[idx]->allow_split_hot_partitions()
+                                    : cur_pipe->sink()->allow_split_hot_partitions());
     const bool use_global_hash_shuffle =
             bucket_seq_to_instance_idx.empty() &&
             shuffle_idx_to_instance_idx.find(-1) == shuffle_idx_to_instance_idx.end() &&
@@ -771,6 +776,10 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
                         ? cast_set<int>(
                                   _runtime_state->query_options().local_exchange_free_blocks_limit)
                         : 0);
+        if (split_hot_partitions) {
+            static_cast<ShuffleExchanger*>(shared_state->exchanger.get())
+                    ->set_split_hot_partitions();
+        }
         break;
     case ExchangeType::BUCKET_HASH_SHUFFLE:
         shared_state->exchanger = BucketShuffleExchanger::create_unique(
@@ -887,6 +896,11 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
 
     // 7. Inherit properties from current pipeline.
     _inherit_pipeline_properties(data_distribution, cur_pipe, new_pip);
+    if (split_hot_partitions) {
+        // The rows of a key are not in one task any more, the operators after that need a hash
+        // distribution get their own local exchange.
+        cur_pipe->set_data_distribution(DataDistribution(ExchangeType::PASSTHROUGH));
+    }
     return Status::OK();
 }
 
@@ -1257,7 +1271,8 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
             auto cache_node_id = request.local_params[0].per_node_scan_ranges.begin()->first;
             auto cache_source_id = next_operator_id();
             op.reset(new CacheSourceOperatorX(pool, cache_node_id, cache_source_id,
-                                              request.fragment.query_cache_param));
+                                              request.fragment.query_cache_param,
+                                              !tnode.agg_node.need_finalize));
             RETURN_IF_ERROR(cur_pipe->add_operator(
                     op, request.__isset.parallel_instances ? request.parallel_instances : 0));
 
@@ -225,6 +225,7 @@ void PipelineTask::_init_profile() {
     _close_timer = ADD_CHILD_TIMER(_task_profile, "CloseTime", exec_time);
 
     _wait_worker_timer = ADD_TIMER_WITH_LEVEL(_task_profile, "WaitWorkerTime", 1);
+    _wake_up_to_run_timer = ADD_TIMER_WITH_LEVEL(_task_profile, "WakeUpToRunTime", 1);
 
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
@@ -237,6 +238,7 @@ void PipelineTask::_init_profile() {
 void PipelineTask::_fresh_profile_counter() {
     COUNTER_SET(_schedule_counts, (int64_t)_schedule_time);
     COUNTER_SET(_wait_worker_timer, (int64_t)_wait_worker_watcher.elapsed_time());
+    COUNTER_SET(_wake_up_to_run_timer, _wake_up_to_run_time);
 }
 
 Status PipelineTask::_open() {
@@ -363,6 +365,14 @@ void PipelineTask::terminate() {
  * @param done
  * @return
  */
+uint64_t PipelineTask::get_level_runtime_ns() const {
+    if (!config::enable_pipeline_task_level_by_query_cost) {
+        return _runtime;
+    }
+    int64_t query_cost_ms = _state->get_query_ctx()->resource_ctx()->cpu_context()->cpu_cost_ms();
+    return std::max<uint64_t>(_runtime, query_cost_ms * NANOS_PER_MILLIS);
+}
+
 Status PipelineTask::execute(bool* done) {
     if (_exec_state != State::RUNNABLE || _blocked_dep != nullptr) [[unlikely]] {
         return Status::InternalError("Pipeline task is not runnable! Task info: {}",
@@ -443,6 +453,12 @@ Status PipelineTask::execute(bool* done) {
         RETURN_IF_ERROR(_open());
     }
 
+    // The top levels hold the tasks of cheap queries. Short slices let a new query there wait
+    // less behind the others, the levels below keep the full slice to switch less.
+    auto exec_time_slice = _exec_time_slice;
+    if (config::enable_pipeline_task_level_by_query_cost && _queue_level < 2) {
+        exec_time_slice >>= 2 - _queue_level;
+    }
     while (!fragment_context->is_canceled()) {
         SCOPED_RAW_TIMER(&time_spent);
         Defer defer {[&]() {
@@ -463,7 +479,7 @@ Status PipelineTask::execute(bool* done) {
             break;
         }
 
-        if (time_spent > _exec_time_slice) {
+        if (time_spent > exec_time_slice) {
             COUNTER_UPDATE(_yield_counts, 1);
             break;
         }
@@ -572,7 +588,11 @@ Status PipelineTask::execute(bool* done) {
                 }
             });
             RETURN_IF_ERROR(block->check_type_and_column());
-            status = _sink->sink(_state, block, _eos);
+            {
+                ScopedThreadPerfCounters perf_scope(
+                        _state->get_sink_local_state()->perf_counter_values());
+                status = _sink->sink(_state, block, _eos);
+            }
 
             if (status.is<ErrorCode::END_OF_FILE>()) {
                 set_wake_up_early();
@@ -626,6 +646,19 @@ bool PipelineTask::_try_to_reserve_memory(const size_t reserve_size, OperatorBas
                     _state->get_query_ctx()->resource_ctx()->shared_from_this(), reserve_size, st);
             _spilling = true;
             return false;
+        } else if (static_cast<int64_t>(reserve_size) >= config::paused_query_min_reserve_bytes) {
+            // Nothing could be spilled, but the reservation is large, such as the hash table of a
+            // join build at eos. Allocating it anyway is likely to get the query cancelled, so
+            // queue the query until memory is released instead. The paused query is resumed once
+            // its reservation fits, or with reserving disabled when the wait times out.
+            LOG(INFO) << fmt::format(
+                    "Query: {} {}: {}, node id: {}, task id: {}, pause to wait for {} memory",
+                    print_id(_query_id), op == _sink.get() ? "sink" : "operator", op->get_name(),
+                    op->node_id(), _state->task_id(), PrettyPrinter::print_bytes(reserve_size));
+            ExecEnv::GetInstance()->workload_group_mgr()->add_paused_query(
+                    _state->get_query_ctx()->resource_ctx()->shared_from_this(), reserve_size, st);
+            _spilling = true;
+            return false;
         } else {
             // If reserve failed, not add this query to paused list, because it is very small, will not
             // consume a lot of memory. But need set low memory mode to indicate that the system should
@@ -807,15 +840,20 @@ Status PipelineTask::revoke_memory(const std::shared_ptr<SpillContext>& spill_co
 }
 
 Status PipelineTask::wake_up(Dependency* dep) {
-    // call by dependency
-    DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
-    _blocked_dep = nullptr;
     auto holder = std::dynamic_pointer_cast<PipelineTask>(shared_from_this());
-    RETURN_IF_ERROR(_state_transition(PipelineTask::State::RUNNABLE));
+    RETURN_IF_ERROR(prepare_wake_up(dep));
     RETURN_IF_ERROR(get_task_queue()->push_back(holder));
     return Status::OK();
 }
 
+Status PipelineTask::prepare_wake_up(Dependency* dep) {
+    // call by dependency
+    DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
+    _blocked_dep = nullptr;
+    _woken_up = true;
+    return _state_transition(PipelineTask::State::RUNNABLE);
+}
+
 Status PipelineTask::_state_transition(State new_state) {
     if (_exec_state != new_state) {
         _state_change_watcher.reset();
@@ -28,6 +28,7 @@
 #include "pipeline/pipeline.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/time.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -112,11 +113,15 @@ public:
     }
 
     Status wake_up(Dependency* dep);
+    // Makes the task runnable like `wake_up` but leaves pushing it to the task queue to the
+    // caller, so the tasks woken up by one dependency are pushed together.
+    Status prepare_wake_up(Dependency* dep);
 
     DataSinkOperatorPtr sink() const { return _sink; }
 
     int task_id() const { return _index; };
     bool is_finalized() const { return _exec_state == State::FINALIZED; }
+    bool is_blocked() const { return _exec_state == State::BLOCKED; }
 
     void set_wake_up_early() { _wake_up_early = true; }
 
@@ -134,6 +139,9 @@ public:
     // 1.1 pipeline task
     void inc_runtime_ns(uint64_t delta_time) { this->_runtime += delta_time; }
     uint64_t get_runtime_ns() const { return this->_runtime; }
+    // The runtime that decides the queue level. A query with many tasks costs as much as all
+    // of them, so that it does not stay in the top levels by splitting the work.
+    uint64_t get_level_runtime_ns() const;
 
     // 1.2 priority queue's queue level
     void update_queue_level(int queue_level) { this->_queue_level = queue_level; }
@@ -141,10 +149,21 @@ public:
 
     void put_in_runnable_queue() {
         _schedule_time++;
+        _runnable_time_ns = MonotonicNanos();
         _wait_worker_watcher.start();
     }
 
-    void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
+    void pop_out_runnable_queue() {
+        _wait_worker_watcher.stop();
+        _last_wait_worker_time = MonotonicNanos() - _runnable_time_ns;
+        if (_woken_up) {
+            _wake_up_to_run_time += _last_wait_worker_time;
+            _woken_up = false;
+        }
+    }
+
+    // Time the task waited in the runnable queue the last time it was scheduled.
+    int64_t last_wait_worker_ns() const { return _last_wait_worker_time; }
 
     bool is_running() { return _running.load(); }
     bool is_revoking() const;
@@ -223,6 +242,13 @@ private:
     RuntimeProfile::Counter* _schedule_counts = nullptr;
     MonotonicStopWatch _wait_worker_watcher;
     RuntimeProfile::Counter* _wait_worker_timer = nullptr;
+    int64_t _runnable_time_ns = 0;
+    int64_t _last_wait_worker_time = 0;
+    // set if the task is runnable because its dependency got ready
+    bool _woken_up = false;
+    // the part of the wait worker time after the dependency got ready
+    int64_t _wake_up_to_run_time = 0;
+    RuntimeProfile::Counter* _wake_up_to_run_timer = nullptr;
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
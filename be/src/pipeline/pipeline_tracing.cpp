@@ -19,8 +19,11 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
 #include <chrono>
 #include <cstdint>
@@ -32,6 +35,7 @@
 #include "common/status.h"
 #include "io/fs/local_file_writer.h"
 #include "util/time.h"
+#include "util/uid_util.h"
 
 namespace doris::pipeline {
 
@@ -180,4 +184,102 @@ void PipelineTracerContext::_dump_timeslice() {
 
     _id_to_workload_group.clear();
 }
+
+void TaskTraceRing::snapshot(int64_t since_ns, std::vector<TaskTraceEvent>* events) const {
+    const uint64_t capacity = _events.size();
+    auto end = _next.load(std::memory_order_acquire);
+    auto begin = end > capacity ? end - capacity : 0;
+    std::vector<TaskTraceEvent> copied;
+    copied.reserve(end - begin);
+    for (auto pos = begin; pos < end; ++pos) {
+        copied.push_back(_events[pos % capacity]);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // the owner may have overwritten the oldest slots meanwhile, and be writing the next one
+    auto next = _next.load(std::memory_order_relaxed);
+    auto valid_begin = std::max(begin, next >= capacity ? next - capacity + 1 : 0);
+    for (auto pos = valid_begin; pos < end; ++pos) {
+        const auto& event = copied[pos - begin];
+        if (event.end_ns >= since_ns) {
+            events->push_back(event);
+        }
+    }
+}
+
+void PipelineTracerContext::trace(const TaskTraceEvent& event) {
+    // the context is the one of ExecEnv except in tests
+    thread_local uint64_t ring_owner = 0;
+    thread_local std::shared_ptr<TaskTraceRing> ring;
+    if (ring_owner != _id) [[unlikely]] {
+        ring = std::make_shared<TaskTraceRing>(
+                std::max(config::pipeline_task_trace_ring_capacity, 1));
+        ring_owner = _id;
+        std::lock_guard<std::mutex> l(_rings_lock);
+        _rings.push_back(ring);
+    }
+    ring->push(event);
+}
+
+std::vector<TaskTraceEvent> PipelineTracerContext::snapshot(int64_t seconds) {
+    auto since_ns = MonotonicNanos() - seconds * NANOS_PER_SEC;
+    std::vector<std::shared_ptr<TaskTraceRing>> rings;
+    {
+        std::lock_guard<std::mutex> l(_rings_lock);
+        rings = _rings;
+    }
+    std::vector<TaskTraceEvent> events;
+    for (const auto& ring : rings) {
+        ring->snapshot(since_ns, &events);
+    }
+    std::sort(events.begin(), events.end(),
+              [](const TaskTraceEvent& lhs, const TaskTraceEvent& rhs) {
+                  return lhs.start_ns < rhs.start_ns;
+              });
+    return events;
+}
+
+std::string PipelineTracerContext::to_chrome_trace(const std::vector<TaskTraceEvent>& events) {
+    static constexpr const char* OUTCOMES[] = {"yield", "block", "finish", "error"};
+    rapidjson::StringBuffer buf;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buf);
+    writer.StartObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.Key("traceEvents");
+    writer.StartArray();
+    for (const auto& event : events) {
+        auto query_id = print_id(event.query_id);
+        auto name = fmt::format("{} p{} t{}", query_id, event.pipeline_id, event.task_id);
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str());
+        writer.Key("cat");
+        writer.String(OUTCOMES[static_cast<int>(event.outcome)]);
+        writer.Key("ph");
+        writer.String("X");
+        // microseconds
+        writer.Key("ts");
+        writer.Double(static_cast<double>(event.start_ns) / 1000);
+        writer.Key("dur");
+        writer.Double(static_cast<double>(event.end_ns - event.start_ns) / 1000);
+        writer.Key("pid");
+        writer.Uint(0);
+        writer.Key("tid");
+        writer.Uint64(event.thread_id);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("query_id");
+        writer.String(query_id.c_str());
+        writer.Key("core_id");
+        writer.Uint(event.core_id);
+        writer.Key("wait_us");
+        writer.Double(static_cast<double>(event.wait_ns) / 1000);
+        writer.EndObject();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buf.GetString();
+}
+
 } // namespace doris::pipeline
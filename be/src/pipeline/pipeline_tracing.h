@@ -22,8 +22,12 @@
 #include <gen_cpp/Types_types.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
@@ -39,11 +43,14 @@ struct ScheduleRecord {
     uint64_t thread_id;
     uint64_t start_time;
     uint64_t end_time;
+    // microseconds the task waited in the runnable queue before `start_time`, e.g. since its
+    // dependency got ready
+    uint64_t wait_time = 0;
 
     bool operator<(const ScheduleRecord& rhs) const { return start_time < rhs.start_time; }
     std::string to_string(uint64_t append_value) const {
-        return fmt::format("{}|{}|{}|{}|{}|{}|{}\n", doris::to_string(query_id), task_id, core_id,
-                           thread_id, start_time, end_time, append_value);
+        return fmt::format("{}|{}|{}|{}|{}|{}|{}|{}\n", doris::to_string(query_id), task_id,
+                           core_id, thread_id, start_time, end_time, append_value, wait_time);
     }
 };
 
@@ -56,6 +63,44 @@ struct QueryID {
     bool operator==(const QueryID& query_id_) const { return query_id == query_id_.query_id; }
 };
 
+// One run of a pipeline task on a worker thread.
+struct TaskTraceEvent {
+    // why the run ended
+    enum class Outcome : uint8_t { YIELD, BLOCK, FINISH, ERROR };
+
+    TUniqueId query_id;
+    int32_t pipeline_id = 0;
+    int32_t task_id = 0;
+    uint32_t core_id = 0;
+    Outcome outcome = Outcome::YIELD;
+    uint64_t thread_id = 0;
+    // MonotonicNanos
+    int64_t start_ns = 0;
+    int64_t end_ns = 0;
+    // nanoseconds in the runnable queue before `start_ns`
+    int64_t wait_ns = 0;
+};
+
+// The last task runs of one thread. Only the owner thread pushes, readers copy the ring without
+// locking and drop the slots that may have been overwritten during the copy.
+class TaskTraceRing {
+public:
+    explicit TaskTraceRing(size_t capacity) : _events(capacity) {}
+
+    void push(const TaskTraceEvent& event) {
+        auto pos = _next.load(std::memory_order_relaxed);
+        _events[pos % _events.size()] = event;
+        _next.store(pos + 1, std::memory_order_release);
+    }
+
+    // Appends the runs that ended at or after `since_ns`.
+    void snapshot(int64_t since_ns, std::vector<TaskTraceEvent>* events) const;
+
+private:
+    std::vector<TaskTraceEvent> _events;
+    std::atomic<uint64_t> _next = 0;
+};
+
 // all tracing datas of ONE specific query
 using OneQueryTraces = moodycamel::ConcurrentQueue<ScheduleRecord>;
 using OneQueryTracesSPtr = std::shared_ptr<moodycamel::ConcurrentQueue<ScheduleRecord>>;
@@ -77,6 +122,14 @@ public:
 
     bool enabled() const { return !(_dump_type == RecordType::None); }
 
+    // Keeps the run in the trace ring of the calling thread, independent of the record type.
+    void trace(const TaskTraceEvent& event);
+    // The runs of all threads that ended in the last `seconds`, ordered by start time.
+    std::vector<TaskTraceEvent> snapshot(int64_t seconds);
+    // Trace Event Format of chrome://tracing and Perfetto, a slice per run on the track of its
+    // worker thread.
+    static std::string to_chrome_trace(const std::vector<TaskTraceEvent>& events);
+
 private:
     // dump data to disk. one query or all.
     void _dump_query(TUniqueId query_id);
@@ -94,5 +147,11 @@ private:
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
+
+    inline static std::atomic<uint64_t> _next_id = 1;
+    const uint64_t _id = _next_id++;
+    std::mutex _rings_lock;
+    // a ring per thread that ran tasks, kept after the thread exits
+    std::vector<std::shared_ptr<TaskTraceRing>> _rings;
 };
 } // namespace doris::pipeline
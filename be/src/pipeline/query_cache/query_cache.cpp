@@ -17,6 +17,11 @@
 
 #include "query_cache.h"
 
+#include "olap/base_tablet.h"
+#include "olap/rowset/rowset.h"
+#include "runtime/query_context.h"
+#include "runtime/runtime_state.h"
+
 namespace doris {
 
 std::vector<int>* QueryCacheHandle::get_cache_slot_orders() {
@@ -37,8 +42,15 @@ int64_t QueryCacheHandle::get_cache_version() {
     return ((QueryCache::CacheValue*)(result_ptr))->version;
 }
 
+bool QueryCacheHandle::is_partial_result() {
+    DCHECK(_handle);
+    auto result_ptr = reinterpret_cast<LRUHandle*>(_handle)->value;
+    return ((QueryCache::CacheValue*)(result_ptr))->is_partial_result;
+}
+
 void QueryCache::insert(const CacheKey& key, int64_t version, CacheResult& res,
-                        const std::vector<int>& slot_orders, int64_t cache_size) {
+                        const std::vector<int>& slot_orders, int64_t cache_size,
+                        bool is_partial_result) {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->query_cache_mem_tracker());
     CacheResult cache_result;
     for (auto& block_data : res) {
@@ -46,8 +58,8 @@ void QueryCache::insert(const CacheKey& key, int64_t version, CacheResult& res,
                 ->swap(block_data->clone_empty());
         (void)vectorized::MutableBlock(cache_result.back().get()).merge(*block_data);
     }
-    auto cache_value_ptr =
-            std::make_unique<QueryCache::CacheValue>(version, std::move(cache_result), slot_orders);
+    auto cache_value_ptr = std::make_unique<QueryCache::CacheValue>(
+            version, std::move(cache_result), slot_orders, is_partial_result);
 
     QueryCacheHandle(this, LRUCachePolicy::insert(key, (void*)cache_value_ptr.release(), cache_size,
                                                   cache_size, CachePriority::NORMAL));
@@ -66,4 +78,65 @@ bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheH
     return false;
 }
 
+Status QueryCache::lookup_once(RuntimeState* state,
+                               const std::vector<TScanRangeParams>& scan_ranges,
+                               const TQueryCacheParam& cache_param,
+                               std::shared_ptr<QueryCacheLookup>* result) {
+    std::string cache_key;
+    int64_t version = 0;
+    RETURN_IF_ERROR(build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+    auto tablet_id = scan_ranges[0].scan_range.palo_scan_range.tablet_id;
+
+    auto lookup = [&]() {
+        auto lookup_result = std::make_shared<QueryCacheLookup>();
+        if (cache_param.force_refresh_query_cache) {
+            return lookup_result;
+        }
+        QueryCacheHandle handle;
+        {
+            SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
+                    ExecEnv::GetInstance()->query_cache_mem_tracker());
+            auto* lru_handle = LRUCachePolicy::lookup(cache_key);
+            if (lru_handle == nullptr) {
+                return lookup_result;
+            }
+            handle = QueryCacheHandle(this, lru_handle);
+        }
+        int64_t cached_version = handle.get_cache_version();
+        if (cached_version == version) {
+            lookup_result->handle = std::move(handle);
+            lookup_result->hit = true;
+            return lookup_result;
+        }
+        if (!config::enable_query_cache_delta_reuse || cached_version > version ||
+            !handle.is_partial_result()) {
+            return lookup_result;
+        }
+        // The rows of a duplicate key tablet are never changed by the new rowsets, unless they
+        // carry delete predicates, so the cached result stays valid for the old rowsets.
+        auto tablet = ExecEnv::get_tablet(tablet_id);
+        if (!tablet.has_value() || tablet.value()->keys_type() != KeysType::DUP_KEYS) {
+            return lookup_result;
+        }
+        std::vector<RowSetSplits> rs_splits;
+        if (!tablet.value()
+                     ->capture_rs_readers({cached_version + 1, version}, &rs_splits, false)
+                     .ok()) {
+            return lookup_result;
+        }
+        for (const auto& rs_split : rs_splits) {
+            if (rs_split.rs_reader->rowset()->rowset_meta()->has_delete_predicate()) {
+                return lookup_result;
+            }
+        }
+        lookup_result->handle = std::move(handle);
+        lookup_result->hit = true;
+        lookup_result->is_delta = true;
+        lookup_result->delta_rs_splits = std::move(rs_splits);
+        return lookup_result;
+    };
+    *result = state->get_query_ctx()->get_query_cache_lookup(cache_key, lookup);
+    return Status::OK();
+}
+
 } // namespace doris
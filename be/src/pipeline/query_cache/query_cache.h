@@ -32,6 +32,7 @@
 #include "io/fs/file_system.h"
 #include "io/fs/path.h"
 #include "olap/lru_cache.h"
+#include "olap/rowset/rowset_reader.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "runtime/memory/mem_tracker.h"
@@ -40,6 +41,7 @@
 #include "vec/core/block.h"
 
 namespace doris {
+class RuntimeState;
 
 using CacheResult = std::vector<vectorized::BlockUPtr>;
 // A handle for mid-result from query lru cache.
@@ -79,6 +81,8 @@ public:
 
     int64_t get_cache_version();
 
+    bool is_partial_result();
+
 private:
     LRUCachePolicy* _cache = nullptr;
     Cache::Handle* _handle = nullptr;
@@ -87,6 +91,18 @@ private:
     DISALLOW_COPY_AND_ASSIGN(QueryCacheHandle);
 };
 
+// The query cache entry reused for a tablet. It is looked up once per query, so that the scan and
+// the cache source of the tablet agree on it even if the entry is replaced meanwhile.
+struct QueryCacheLookup {
+    QueryCacheHandle handle;
+    bool hit = false;
+    // The entry is of an older version of the tablet: the scan reads only the rowsets loaded
+    // since then, whose readers are captured here, and the cache source outputs the cached
+    // result before the result of the new rowsets.
+    bool is_delta = false;
+    std::vector<RowSetSplits> delta_rs_splits;
+};
+
 class QueryCache : public LRUCachePolicy {
 public:
     using LRUCachePolicy::insert;
@@ -95,9 +111,16 @@ public:
         int64_t version;
         CacheResult result;
         std::vector<int> slot_orders;
-
-        CacheValue(int64_t v, CacheResult&& r, const std::vector<int>& so)
-                : LRUCacheValueBase(), version(v), result(std::move(r)), slot_orders(so) {}
+        // The result is a partial aggregation, which may be merged with the result of newer
+        // rowsets by the aggregation downstream.
+        bool is_partial_result;
+
+        CacheValue(int64_t v, CacheResult&& r, const std::vector<int>& so, bool partial)
+                : LRUCacheValueBase(),
+                  version(v),
+                  result(std::move(r)),
+                  slot_orders(so),
+                  is_partial_result(partial) {}
     };
 
     // Create global instance of this class
@@ -146,7 +169,15 @@ public:
 
     bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
 
+    // Lookup the entry of the tablet scanned by `scan_ranges` once for the query of `state`.
+    // Besides an entry of `version`, an entry of an older version is reused if only new rowsets
+    // without delete predicates were loaded into the duplicate key tablet since then.
+    Status lookup_once(RuntimeState* state, const std::vector<TScanRangeParams>& scan_ranges,
+                       const TQueryCacheParam& cache_param,
+                       std::shared_ptr<QueryCacheLookup>* result);
+
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
-                const std::vector<int>& solt_orders, int64_t cache_size);
+                const std::vector<int>& solt_orders, int64_t cache_size,
+                bool is_partial_result = false);
 };
 } // namespace doris
@@ -18,6 +18,7 @@
 #include "task_queue.h"
 
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
@@ -25,6 +26,7 @@
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -93,11 +95,21 @@ int PriorityTaskQueue::_compute_level(uint64_t runtime) {
 }
 
 PipelineTaskSPtr PriorityTaskQueue::try_take(bool is_steal) {
-    // TODO other efficient lock? e.g. if get lock fail, return null_ptr
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     return _try_take_unprotected(is_steal);
 }
 
+PipelineTaskSPtr PriorityTaskQueue::try_steal(bool* busy) {
+    // The owner and the other idle workers take the lock of a busy queue all the time, do not
+    // wait in line with them.
+    std::unique_lock<std::mutex> lock(_work_size_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        *busy = true;
+        return nullptr;
+    }
+    return _try_take_unprotected(true);
+}
+
 PipelineTaskSPtr PriorityTaskQueue::take(uint32_t timeout_ms) {
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     auto task = _try_take_unprotected(false);
@@ -117,8 +129,26 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
     if (_closed) {
         return Status::InternalError("WorkTaskQueue closed");
     }
-    auto level = _compute_level(task->get_runtime_ns());
     std::unique_lock<std::mutex> lock(_work_size_mutex);
+    _push_unprotected(std::move(task));
+    _wait_task.notify_one();
+    return Status::OK();
+}
+
+Status PriorityTaskQueue::push(const std::vector<PipelineTaskSPtr>& tasks) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    for (const auto& task : tasks) {
+        _push_unprotected(task);
+    }
+    _wait_task.notify_one();
+    return Status::OK();
+}
+
+void PriorityTaskQueue::_push_unprotected(PipelineTaskSPtr task) {
+    auto level = _compute_level(task->get_level_runtime_ns());
 
     // update empty queue's  runtime, to avoid too high priority
     if (_sub_queues[level].empty() &&
@@ -126,17 +156,22 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
         _sub_queues[level].adjust_runtime(_queue_level_min_vruntime);
     }
 
-    _sub_queues[level].push_back(task);
+    _sub_queues[level].push_back(std::move(task));
     _total_task_size++;
     DorisMetrics::instance()->pipeline_task_queue_size->increment(1);
-    _wait_task.notify_one();
-    return Status::OK();
 }
 
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+        : _prio_task_queues(core_size),
+          _queue_numa_nodes(core_size),
+          _closed(false),
+          _core_size(core_size) {
+    for (auto& numa_node : _queue_numa_nodes) {
+        numa_node = -1;
+    }
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -154,6 +189,11 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
         DCHECK(_prio_task_queues.size() > core_id)
                 << " list size: " << _prio_task_queues.size() << " core_id: " << core_id
                 << " _core_size: " << _core_size << " _next_core: " << _next_core.load();
+        if (CpuInfo::get_max_num_numa_nodes() > 1) {
+            _queue_numa_nodes[core_id].store(
+                    CpuInfo::get_numa_node_of_core(CpuInfo::get_current_core()),
+                    std::memory_order_relaxed);
+        }
         task = _prio_task_queues[core_id].try_take(false);
         if (task) {
             break;
@@ -175,6 +215,25 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
 
 PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     DCHECK(core_id < _core_size);
+    int numa_node = _queue_numa_nodes[core_id].load(std::memory_order_relaxed);
+    bool busy = false;
+    PipelineTaskSPtr task;
+    if (numa_node >= 0) {
+        task = _steal_take(core_id, numa_node, true, false, &busy);
+        if (task) {
+            return task;
+        }
+    }
+    task = _steal_take(core_id, numa_node, false, false, &busy);
+    if (task || !busy) {
+        return task;
+    }
+    // Only locked queues have tasks, wait for their locks rather than go to sleep.
+    return _steal_take(core_id, -1, false, true, &busy);
+}
+
+PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id, int numa_node, bool same_node,
+                                                 bool wait_lock, bool* busy) {
     int next_id = core_id;
     for (int i = 1; i < _core_size; ++i) {
         ++next_id;
@@ -182,7 +241,16 @@ PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
             next_id = 0;
         }
         DCHECK(next_id < _core_size);
-        auto task = _prio_task_queues[next_id].try_take(true);
+        if (numa_node >= 0 &&
+            (_queue_numa_nodes[next_id].load(std::memory_order_relaxed) == numa_node) !=
+                    same_node) {
+            continue;
+        }
+        auto& queue = _prio_task_queues[next_id];
+        if (queue.empty()) {
+            continue;
+        }
+        auto task = wait_lock ? queue.try_take(true) : queue.try_steal(busy);
         if (task) {
             return task;
         }
@@ -204,6 +272,39 @@ Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task, int core_id) {
     return _prio_task_queues[core_id].push(task);
 }
 
+Status MultiCoreTaskQueue::push_back(const std::vector<PipelineTaskSPtr>& tasks) {
+    std::vector<std::pair<int, PipelineTaskSPtr>> core_tasks;
+    core_tasks.reserve(tasks.size());
+    // e.g. the probe tasks of a broadcast join woken up by the build, at most an even share of
+    // them goes to each queue
+    auto num_cores = static_cast<size_t>(_core_size);
+    size_t max_tasks_per_core = (tasks.size() + num_cores - 1) / num_cores;
+    std::vector<size_t> num_tasks(num_cores, 0);
+    for (const auto& task : tasks) {
+        int core_id = task->get_core_id();
+        while (core_id < 0 || num_tasks[core_id] >= max_tasks_per_core) {
+            core_id = _next_core.fetch_add(1) % _core_size;
+        }
+        num_tasks[core_id]++;
+        core_tasks.emplace_back(core_id, task);
+    }
+    std::stable_sort(core_tasks.begin(), core_tasks.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    std::vector<PipelineTaskSPtr> batch;
+    for (size_t i = 0; i < core_tasks.size();) {
+        int core_id = core_tasks[i].first;
+        DCHECK(core_id < _core_size);
+        batch.clear();
+        for (; i < core_tasks.size() && core_tasks[i].first == core_id; ++i) {
+            core_tasks[i].second->put_in_runnable_queue();
+            batch.push_back(std::move(core_tasks[i].second));
+        }
+        RETURN_IF_ERROR(_prio_task_queues[core_id].push(batch));
+    }
+    return Status::OK();
+}
+
 void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
     // if the task not execute but exception early close, core_id == -1
     // should not do update_statistics
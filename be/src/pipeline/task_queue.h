@@ -74,16 +74,26 @@ public:
 
     PipelineTaskSPtr try_take(bool is_steal);
 
+    // Like try_take(true), but gives up and sets `*busy` if another thread holds the lock.
+    PipelineTaskSPtr try_steal(bool* busy);
+
     PipelineTaskSPtr take(uint32_t timeout_ms = 0);
 
     Status push(PipelineTaskSPtr task);
 
+    // Pushes `tasks` under one lock and wakes up the worker once.
+    Status push(const std::vector<PipelineTaskSPtr>& tasks);
+
     void inc_sub_queue_runtime(int level, uint64_t runtime) {
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    // May be stale, only to skip empty queues without taking the lock.
+    bool empty() const { return _total_task_size == 0; }
+
 private:
     PipelineTaskSPtr _try_take_unprotected(bool is_steal);
+    void _push_unprotected(PipelineTaskSPtr task);
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
     SubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
@@ -102,7 +112,8 @@ private:
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// One queue per worker thread. An idle worker steals from the queues of the workers on the
+// same NUMA node first, the tasks there run on memory close to it.
 class MultiCoreTaskQueue {
 public:
     explicit MultiCoreTaskQueue(int core_size);
@@ -122,14 +133,24 @@ public:
 
     Status push_back(PipelineTaskSPtr task, int core_id);
 
+    // Pushes the tasks woken up by one dependency. The tasks are spread over the queues instead
+    // of all going back to the few workers that ran them, and each queue is locked once.
+    Status push_back(const std::vector<PipelineTaskSPtr>& tasks);
+
     void update_statistics(PipelineTask* task, int64_t time_spent);
 
     int cores() const { return _core_size; }
 
 private:
     PipelineTaskSPtr _steal_take(int core_id);
+    // Steals from the queues on the NUMA node `numa_node` if `same_node`, or the other ones.
+    // Locked queues are skipped and set `*busy` unless `wait_lock`.
+    PipelineTaskSPtr _steal_take(int core_id, int numa_node, bool same_node, bool wait_lock,
+                                 bool* busy);
 
     std::vector<PriorityTaskQueue> _prio_task_queues;
+    // NUMA node the worker of each queue last ran on, -1 if unknown
+    std::vector<std::atomic<int>> _queue_numa_nodes;
     std::atomic<uint32_t> _next_core = 0;
     std::atomic<bool> _closed;
 
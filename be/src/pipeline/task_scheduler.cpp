@@ -95,6 +95,28 @@ void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext*
     }
 }
 
+void TaskScheduler::_trace_task_run(PipelineTask* task, const TUniqueId& query_id, int index,
+                                    int64_t start_ns, bool done, const Status& status) {
+    TaskTraceEvent event;
+    event.query_id = query_id;
+    event.pipeline_id = task->pipeline_id();
+    event.task_id = task->task_id();
+    event.core_id = static_cast<uint32_t>(index);
+    if (!status.ok()) {
+        event.outcome = TaskTraceEvent::Outcome::ERROR;
+    } else if (done) {
+        event.outcome = TaskTraceEvent::Outcome::FINISH;
+    } else if (task->is_blocked()) {
+        event.outcome = TaskTraceEvent::Outcome::BLOCK;
+    }
+    std::thread::id tid = std::this_thread::get_id();
+    event.thread_id = *reinterpret_cast<uint64_t*>(&tid);
+    event.start_ns = start_ns;
+    event.end_ns = MonotonicNanos();
+    event.wait_ns = task->last_wait_worker_ns();
+    ExecEnv::GetInstance()->pipeline_tracer_context()->trace(event);
+}
+
 void TaskScheduler::_do_work(int index) {
     while (!_need_to_stop) {
         auto task = _task_queue.take(index);
@@ -140,6 +162,7 @@ void TaskScheduler::_do_work(int index) {
             continue;
         }
 
+        int64_t trace_start_ns = config::enable_pipeline_task_trace_ring ? MonotonicNanos() : 0;
         // Main logics of execution
         ASSIGN_STATUS_IF_CATCH_EXCEPTION(
                 //TODO: use a better enclose to abstracting these
@@ -156,9 +179,14 @@ void TaskScheduler::_do_work(int index) {
                     uint64_t end_time = MonotonicMicros();
                     ExecEnv::GetInstance()->pipeline_tracer_context()->record(
                             {query_id, task_name, static_cast<uint32_t>(index), thread_id,
-                             start_time, end_time});
+                             start_time, end_time,
+                             static_cast<uint64_t>(task->last_wait_worker_ns() / 1000)});
                 } else { status = task->execute(&done); },
                 status);
+        if (trace_start_ns != 0) {
+            _trace_task_run(task.get(), fragment_context->get_query_id(), index, trace_start_ns,
+                            done, status);
+        }
         fragment_context->trigger_report_if_necessary();
     }
 }
@@ -67,5 +67,8 @@ private:
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
 
     void _do_work(int index);
+    // Keeps the run that `_do_work` just finished in the trace ring of the worker.
+    static void _trace_task_run(PipelineTask* task, const TUniqueId& query_id, int index,
+                                int64_t start_ns, bool done, const Status& status);
 };
 } // namespace doris::pipeline
\ No newline at end of file
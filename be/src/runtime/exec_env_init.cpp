@@ -279,6 +279,14 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_min_threads(config::min_s3_file_system_thread_num)
                               .set_max_threads(config::max_s3_file_system_thread_num)
                               .build(&_s3_file_system_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("JoinBuildThreadPool")
+                              .set_min_threads(1)
+                              .set_max_threads(std::max(config::join_build_thread_num, 1))
+                              .build(&_join_build_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("VerticalCompactionThreadPool")
+                              .set_min_threads(1)
+                              .set_max_threads(config::vertical_compaction_value_group_thread_num)
+                              .build(&_vertical_compaction_thread_pool));
     RETURN_IF_ERROR(_init_mem_env());
 
     // NOTE: runtime query statistics mgr could be visited by query and daemon thread
@@ -516,7 +524,8 @@ Status ExecEnv::_init_mem_env() {
         pk_storage_page_cache_limit = storage_cache_limit / 2;
     }
     _storage_page_cache = StoragePageCache::create_global_cache(
-            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards);
+            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards,
+            config::compressed_page_cache_percentage, config::row_store_page_cache_percentage);
     LOG(INFO) << "Storage page cache memory limit: "
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
@@ -776,6 +785,8 @@ void ExecEnv::destroy() {
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
+    SAFE_SHUTDOWN(_vertical_compaction_thread_pool);
+    SAFE_SHUTDOWN(_join_build_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
 
@@ -828,6 +839,8 @@ void ExecEnv::destroy() {
     _lazy_release_obj_pool.reset(nullptr);
     _non_block_close_thread_pool.reset(nullptr);
     _s3_file_system_thread_pool.reset(nullptr);
+    _vertical_compaction_thread_pool.reset(nullptr);
+    _join_build_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
@@ -21,6 +21,7 @@
 #include <glog/logging.h>
 
 #include <chrono>
+#include <cmath>
 
 #include "client_cache.h"
 #include "cloud/config.h"
@@ -32,12 +33,55 @@
 #include "runtime/fragment_mgr.h"
 #include "util/debug_points.h"
 #include "util/thrift_rpc_helper.h"
+#include "util/time.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
 
 bvar::Adder<uint64_t> group_commit_block_by_memory_counter("group_commit_block_by_memory_counter");
 
+void GroupCommitIntervalEstimator::Ewma::update(double sample) {
+    constexpr double ALPHA = 0.2;
+    if (!inited) {
+        inited = true;
+        mean = sample;
+        deviation = 0;
+        return;
+    }
+    deviation = (1 - ALPHA) * deviation + ALPHA * std::abs(sample - mean);
+    mean = (1 - ALPHA) * mean + ALPHA * sample;
+}
+
+void GroupCommitIntervalEstimator::update_load_arrival(int64_t now_ms) {
+    std::lock_guard l(_lock);
+    if (_last_arrival_ms >= 0 && now_ms >= _last_arrival_ms) {
+        _arrival_interval_ms.update(static_cast<double>(now_ms - _last_arrival_ms));
+    }
+    _last_arrival_ms = now_ms;
+}
+
+void GroupCommitIntervalEstimator::update_wal_write_latency(int64_t latency_us) {
+    std::lock_guard l(_lock);
+    _wal_write_latency_us.update(static_cast<double>(latency_us));
+}
+
+void GroupCommitIntervalEstimator::update_commit_latency(int64_t latency_ms) {
+    std::lock_guard l(_lock);
+    _commit_latency_ms.update(static_cast<double>(latency_ms));
+}
+
+int64_t GroupCommitIntervalEstimator::interval_ms(int64_t target_latency_ms,
+                                                  int64_t min_interval_ms) {
+    std::lock_guard l(_lock);
+    double cost_ms = (_wal_write_latency_us.mean + 3 * _wal_write_latency_us.deviation) / 1000 +
+                     _commit_latency_ms.mean + 3 * _commit_latency_ms.deviation;
+    auto interval = static_cast<int64_t>(static_cast<double>(target_latency_ms) - cost_ms);
+    if (_arrival_interval_ms.inited && _arrival_interval_ms.mean >= static_cast<double>(interval)) {
+        interval = min_interval_ms;
+    }
+    return std::max(interval, min_interval_ms);
+}
+
 std::string LoadBlockQueue::_get_load_ids() {
     std::stringstream ss;
     ss << "[";
@@ -76,11 +120,18 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                        << ", instance_id=" << load_instance_id << ", load_ids=" << _get_load_ids();
         }
         if (write_wal || config::group_commit_wait_replay_wal_finish) {
+            auto write_start = std::chrono::steady_clock::now();
             auto st = _v_wal_writer->write_wal(block.get());
             if (!st.ok()) {
                 _cancel_without_lock(st);
                 return st;
             }
+            if (_interval_estimator != nullptr) {
+                _interval_estimator->update_wal_write_latency(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - write_start)
+                                .count());
+            }
         }
         if (!runtime_state->is_cancelled() && status.ok() &&
             _all_block_queues_bytes->load(std::memory_order_relaxed) >=
@@ -97,7 +148,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
         if (_data_bytes >= _group_commit_data_bytes) {
             VLOG_DEBUG << "group commit meets commit condition for data size, label=" << label
                        << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
-            _need_commit = true;
+            _set_need_commit();
             data_size_condition = true;
         }
         if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
@@ -105,7 +156,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                     .count() >= _group_commit_interval_ms) {
             VLOG_DEBUG << "group commit meets commit condition for time interval, label=" << label
                        << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
-            _need_commit = true;
+            _set_need_commit();
         }
     }
     for (auto read_dep : _read_deps) {
@@ -130,7 +181,7 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
                             std::chrono::steady_clock::now() - _start_time)
                             .count();
     if (!_need_commit && duration >= _group_commit_interval_ms) {
-        _need_commit = true;
+        _set_need_commit();
     }
     if (_block_queue.empty()) {
         if (_need_commit && duration >= 10 * _group_commit_interval_ms) {
@@ -179,6 +230,21 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
     return Status::OK();
 }
 
+void LoadBlockQueue::_set_need_commit() {
+    _need_commit = true;
+    _need_commit_time = std::chrono::steady_clock::now();
+}
+
+int64_t LoadBlockQueue::commit_latency_ms() {
+    std::unique_lock l(mutex);
+    if (!_need_commit) {
+        return 0;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                 _need_commit_time)
+            .count();
+}
+
 Status LoadBlockQueue::remove_load_id(const UniqueId& load_id) {
     std::unique_lock l(mutex);
     if (_load_ids_to_write_dep.find(load_id) != _load_ids_to_write_dep.end()) {
@@ -250,6 +316,7 @@ Status GroupCommitTable::get_first_block_load_queue(
         std::shared_ptr<pipeline::Dependency> create_plan_dep,
         std::shared_ptr<pipeline::Dependency> put_block_dep) {
     DCHECK(table_id == _table_id);
+    _interval_estimator->update_load_arrival(MonotonicMillis());
     std::unique_lock l(_lock);
     auto try_to_get_matched_queue = [&]() -> Status {
         for (const auto& [_, inner_block_queue] : _load_block_queues) {
@@ -386,10 +453,20 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                    << ", label=" << label << ", txn_id=" << txn_id
                    << ", instance_id=" << print_id(instance_id);
         {
+            int64_t group_commit_interval_ms = result.group_commit_interval_ms;
+            std::shared_ptr<GroupCommitIntervalEstimator> interval_estimator;
+            if (config::group_commit_enable_adaptive_interval) {
+                interval_estimator = _interval_estimator;
+                group_commit_interval_ms = interval_estimator->interval_ms(
+                        config::group_commit_adaptive_target_latency_ms,
+                        config::group_commit_adaptive_min_interval_ms);
+                VLOG_DEBUG << "adaptive group commit interval=" << group_commit_interval_ms
+                           << "ms, table=" << _table_id << ", label=" << label;
+            }
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, index_size, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
-                    result.group_commit_data_bytes);
+                    result.wait_internal_group_commit_finish, group_commit_interval_ms,
+                    result.group_commit_data_bytes, interval_estimator);
             RETURN_IF_ERROR(load_block_queue->create_wal(
                     _db_id, _table_id, txn_id, label, _exec_env->wal_mgr(),
                     pipeline_params.fragment.output_sink.olap_table_sink.schema.slot_descs,
@@ -517,6 +594,8 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
             load_block_queue = it->second;
             if (!status.ok()) {
                 load_block_queue->cancel(status);
+            } else if (st.ok()) {
+                _interval_estimator->update_commit_latency(load_block_queue->commit_latency_ms());
             }
             //close wal
             RETURN_IF_ERROR(load_block_queue->close_wal());
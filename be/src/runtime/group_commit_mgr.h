@@ -52,13 +52,44 @@ struct BlockData {
     size_t block_bytes;
 };
 
+// Chooses the commit interval of a table's group commit loads from what it observed, so that
+// the visibility latency of a row stays around `group_commit_adaptive_target_latency_ms`:
+//  - a row may wait the whole interval, then the WAL write and the commit, so the interval is
+//    the target minus a high estimate (mean + 3 * mean deviation) of those costs;
+//  - if loads arrive further apart than that, waiting would not batch anything, so commit
+//    after `group_commit_adaptive_min_interval_ms`.
+// The data size condition still commits early when loads arrive fast.
+class GroupCommitIntervalEstimator {
+public:
+    void update_load_arrival(int64_t now_ms);
+    void update_wal_write_latency(int64_t latency_us);
+    void update_commit_latency(int64_t latency_ms);
+
+    int64_t interval_ms(int64_t target_latency_ms, int64_t min_interval_ms);
+
+private:
+    struct Ewma {
+        void update(double sample);
+        bool inited = false;
+        double mean = 0;
+        double deviation = 0;
+    };
+
+    std::mutex _lock;
+    int64_t _last_arrival_ms = -1;
+    Ewma _arrival_interval_ms;
+    Ewma _wal_write_latency_us;
+    Ewma _commit_latency_ms;
+};
+
 class LoadBlockQueue {
 public:
     LoadBlockQueue(const UniqueId& load_instance_id, std::string& label, int64_t txn_id,
                    int64_t schema_version, int64_t index_size,
                    std::shared_ptr<std::atomic_size_t> all_block_queues_bytes,
                    bool wait_internal_group_commit_finish, int64_t group_commit_interval_ms,
-                   int64_t group_commit_data_bytes)
+                   int64_t group_commit_data_bytes,
+                   std::shared_ptr<GroupCommitIntervalEstimator> interval_estimator = nullptr)
             : load_instance_id(load_instance_id),
               label(label),
               txn_id(txn_id),
@@ -69,7 +100,8 @@ public:
               _start_time(std::chrono::steady_clock::now()),
               _last_print_time(_start_time),
               _group_commit_data_bytes(group_commit_data_bytes),
-              _all_block_queues_bytes(all_block_queues_bytes) {};
+              _all_block_queues_bytes(all_block_queues_bytes),
+              _interval_estimator(std::move(interval_estimator)) {};
 
     Status add_block(RuntimeState* runtime_state, std::shared_ptr<vectorized::Block> block,
                      bool write_wal, UniqueId& load_id);
@@ -90,6 +122,8 @@ public:
     void append_dependency(std::shared_ptr<pipeline::Dependency> finish_dep);
     void append_read_dependency(std::shared_ptr<pipeline::Dependency> read_dep);
     int64_t get_group_commit_interval_ms() { return _group_commit_interval_ms; };
+    // Time since this queue met a commit condition, or 0 if it has not.
+    int64_t commit_latency_ms();
 
     std::string debug_string() const {
         fmt::memory_buffer debug_string_buffer;
@@ -124,6 +158,7 @@ public:
 private:
     void _cancel_without_lock(const Status& st);
     std::string _get_load_ids();
+    void _set_need_commit();
 
     // the set of load ids of all blocks in this queue
     std::map<UniqueId, std::shared_ptr<pipeline::Dependency>> _load_ids_to_write_dep;
@@ -136,6 +171,7 @@ private:
 
     // commit
     bool _need_commit = false;
+    std::chrono::steady_clock::time_point _need_commit_time;
     // commit by time interval, can be changed by 'ALTER TABLE my_table SET ("group_commit_interval_ms"="1000");'
     int64_t _group_commit_interval_ms;
     std::chrono::steady_clock::time_point _start_time;
@@ -147,6 +183,9 @@ private:
     // memory back pressure, memory consumption of all tables' load block queues
     std::shared_ptr<std::atomic_size_t> _all_block_queues_bytes;
     std::condition_variable _get_cond;
+
+    // not null if the commit interval is adaptive, fed with the WAL write latency
+    std::shared_ptr<GroupCommitIntervalEstimator> _interval_estimator;
 };
 
 class GroupCommitTable {
@@ -157,7 +196,8 @@ public:
               _thread_pool(thread_pool),
               _all_block_queues_bytes(all_block_queue_bytes),
               _db_id(db_id),
-              _table_id(table_id) {};
+              _table_id(table_id),
+              _interval_estimator(std::make_shared<GroupCommitIntervalEstimator>()) {};
     Status get_first_block_load_queue(int64_t table_id, int64_t base_schema_version,
                                       int64_t index_size, const UniqueId& load_id,
                                       std::shared_ptr<LoadBlockQueue>& load_block_queue,
@@ -197,6 +237,7 @@ private:
                                   std::shared_ptr<pipeline::Dependency>, int64_t, int64_t>>
             _create_plan_deps;
     std::string _create_plan_failed_reason;
+    std::shared_ptr<GroupCommitIntervalEstimator> _interval_estimator;
 };
 
 class GroupCommitMgr {
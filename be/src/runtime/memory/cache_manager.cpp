@@ -17,7 +17,11 @@
 
 #include "runtime/memory/cache_manager.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "runtime/memory/cache_policy.h"
+#include "runtime/memory/lru_cache_policy.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -68,8 +72,15 @@ int64_t CacheManager::for_each_cache_refresh_capacity(double adjust_weighted,
                                                       RuntimeProfile* profile) {
     int64_t freed_size = 0;
     std::lock_guard<std::mutex> l(_caches_lock);
-    for (const auto& pair : _caches) {
-        auto* cache_policy = pair.second;
+    // Adjust the caches whose evicted keys are inserted again the least per byte first, they are
+    // the cheapest to shrink, so the memory freed first costs the least to rebuild.
+    std::vector<std::pair<double, CachePolicy*>> caches;
+    for (const auto& [type, cache_policy] : _caches) {
+        caches.emplace_back(_recreation_cost_per_byte(cache_policy), cache_policy);
+    }
+    std::stable_sort(caches.begin(), caches.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    for (const auto& [cost, cache_policy] : caches) {
         if (!cache_policy->enable_prune()) {
             continue;
         }
@@ -82,6 +93,18 @@ int64_t CacheManager::for_each_cache_refresh_capacity(double adjust_weighted,
     return freed_size;
 }
 
+double CacheManager::_recreation_cost_per_byte(CachePolicy* cache_policy) {
+    auto* lru_cache_policy = dynamic_cast<LRUCachePolicy*>(cache_policy);
+    if (lru_cache_policy == nullptr || lru_cache_policy->lru_cache_type() != LRUCacheType::SIZE ||
+        lru_cache_policy->get_capacity() == 0) {
+        // not comparable by bytes, adjust them last
+        return std::numeric_limits<double>::max();
+    }
+    // without ghost keys (cache_rebalance_interval_sec is 0) all of them are 0, keep the order
+    return static_cast<double>(lru_cache_policy->get_ghost_hit_count()) /
+           static_cast<double>(lru_cache_policy->get_capacity());
+}
+
 void CacheManager::for_each_cache_reset_initial_capacity(double adjust_weighted) {
     std::lock_guard<std::mutex> l(_caches_lock);
     for (const auto& pair : _caches) {
@@ -89,5 +112,71 @@ void CacheManager::for_each_cache_reset_initial_capacity(double adjust_weighted)
     }
 }
 
+void CacheManager::for_each_cache_rebalance_capacity() {
+    // the share of capacity moved by one rebalance
+    static constexpr double kRebalanceStep = 0.05;
+    // the receiver must gain at least twice the ghost hits per byte that the donor does
+    static constexpr double kRebalanceMinGain = 2.0;
+
+    struct Candidate {
+        LRUCachePolicy* cache;
+        double weighted;
+        // ghost hits per byte of capacity since the last rebalance
+        double ghost_hit_rate;
+    };
+    std::lock_guard<std::mutex> l(_caches_lock);
+    std::vector<Candidate> candidates;
+    for (const auto& [type, cache_policy] : _caches) {
+        auto* lru_cache_policy = dynamic_cast<LRUCachePolicy*>(cache_policy);
+        if (lru_cache_policy == nullptr || !lru_cache_policy->enable_prune() ||
+            lru_cache_policy->lru_cache_type() != LRUCacheType::SIZE ||
+            lru_cache_policy->initial_capacity() == 0 || lru_cache_policy->get_capacity() == 0) {
+            continue;
+        }
+        uint64_t ghost_hit_count = lru_cache_policy->get_ghost_hit_count();
+        uint64_t& last_ghost_hit_count = _last_ghost_hit_counts[type];
+        uint64_t ghost_hits = ghost_hit_count - last_ghost_hit_count;
+        last_ghost_hit_count = ghost_hit_count;
+        candidates.push_back({lru_cache_policy, lru_cache_policy->rebalance_weighted(),
+                              static_cast<double>(ghost_hits) /
+                                      static_cast<double>(lru_cache_policy->get_capacity())});
+    }
+
+    const double max_ratio = std::clamp(config::cache_rebalance_max_ratio, 0.0, 1.0);
+    Candidate* receiver = nullptr;
+    Candidate* donor = nullptr;
+    for (auto& candidate : candidates) {
+        if (candidate.weighted < 1 + max_ratio &&
+            (receiver == nullptr || candidate.ghost_hit_rate > receiver->ghost_hit_rate)) {
+            receiver = &candidate;
+        }
+    }
+    for (auto& candidate : candidates) {
+        if (&candidate != receiver && candidate.weighted > 1 - max_ratio &&
+            (donor == nullptr || candidate.ghost_hit_rate < donor->ghost_hit_rate)) {
+            donor = &candidate;
+        }
+    }
+    if (receiver == nullptr || donor == nullptr || receiver->ghost_hit_rate == 0 ||
+        receiver->ghost_hit_rate < kRebalanceMinGain * donor->ghost_hit_rate) {
+        return;
+    }
+
+    auto receiver_initial = static_cast<double>(receiver->cache->initial_capacity());
+    auto donor_initial = static_cast<double>(donor->cache->initial_capacity());
+    double bytes = std::min({kRebalanceStep * std::min(receiver_initial, donor_initial),
+                             (1 + max_ratio - receiver->weighted) * receiver_initial,
+                             (donor->weighted - (1 - max_ratio)) * donor_initial});
+    LOG(INFO) << fmt::format(
+            "[MemoryGC] rebalance {} bytes of cache capacity from {} (ghost hit rate {}) to {} "
+            "(ghost hit rate {})",
+            static_cast<int64_t>(bytes), CachePolicy::type_string(donor->cache->type()),
+            donor->ghost_hit_rate, CachePolicy::type_string(receiver->cache->type()),
+            receiver->ghost_hit_rate);
+    // shrink first so the sum of capacities is never exceeded
+    donor->cache->set_rebalance_weighted(donor->weighted - bytes / donor_initial);
+    receiver->cache->set_rebalance_weighted(receiver->weighted + bytes / receiver_initial);
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris
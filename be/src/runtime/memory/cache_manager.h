@@ -88,9 +88,19 @@ public:
 
     void for_each_cache_reset_initial_capacity(double adjust_weighted);
 
+    // Moves capacity from the lru cache whose recently evicted keys are inserted again the least
+    // per byte to the one whose are the most, keeping the sum of their capacities. Only caches
+    // limited by bytes take part, each within `cache_rebalance_max_ratio` of its initial capacity.
+    void for_each_cache_rebalance_capacity();
+
 private:
+    // ghost hits per byte of capacity of the cache, the larger the more it costs to shrink it
+    static double _recreation_cost_per_byte(CachePolicy* cache_policy);
+
     std::mutex _caches_lock;
     std::unordered_map<CachePolicy::CacheType, CachePolicy*> _caches;
+    // ghost hits of each cache at the last rebalance
+    std::unordered_map<CachePolicy::CacheType, uint64_t> _last_ghost_hit_counts;
     int64_t _last_prune_stale_timestamp = 0;
     int64_t _last_prune_all_timestamp = 0;
 };
@@ -48,7 +48,7 @@ static bvar::Adder<int64_t> memory_arbitrator_reserve_memory_bytes(
 static bvar::Adder<int64_t> memory_arbitrator_refresh_interval_growth_bytes(
         "memory_arbitrator_refresh_interval_growth_bytes");
 
-std::atomic<int64_t> GlobalMemoryArbitrator::_process_reserved_memory = 0;
+alignas(CACHE_LINE_SIZE) std::atomic<int64_t> GlobalMemoryArbitrator::_process_reserved_memory = 0;
 std::atomic<int64_t> GlobalMemoryArbitrator::refresh_interval_memory_growth = 0;
 std::mutex GlobalMemoryArbitrator::cache_adjust_capacity_lock;
 std::condition_variable GlobalMemoryArbitrator::cache_adjust_capacity_cv;
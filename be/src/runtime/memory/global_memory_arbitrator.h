@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "common/compiler_util.h"
 #include "runtime/process_profile.h"
 #include "util/mem_info.h"
 
@@ -182,7 +183,9 @@ public:
     }
 
 private:
-    static std::atomic<int64_t> _process_reserved_memory;
+    // Every reservation of every thread updates it, keep it off the cache line of the
+    // read-mostly statics checked on each allocation.
+    alignas(CACHE_LINE_SIZE) static std::atomic<int64_t> _process_reserved_memory;
 };
 
 #include "common/compile_check_end.h"
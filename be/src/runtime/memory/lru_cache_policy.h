@@ -242,8 +242,9 @@ public:
     }
 
     int64_t adjust_capacity_weighted_unlocked(double adjust_weighted) {
-        auto capacity =
-                static_cast<size_t>(static_cast<double>(_initial_capacity) * adjust_weighted);
+        _last_adjust_weighted = adjust_weighted;
+        auto capacity = static_cast<size_t>(static_cast<double>(_initial_capacity) *
+                                            adjust_weighted * _rebalance_weighted);
         COUNTER_SET(_freed_entrys_counter, (int64_t)0);
         COUNTER_SET(_freed_memory_counter, (int64_t)0);
         COUNTER_SET(_cost_timer, (int64_t)0);
@@ -256,9 +257,20 @@ public:
         int64_t old_usage = get_usage();
         {
             SCOPED_TIMER(_cost_timer);
-            PrunedInfo pruned_info = _cache->set_capacity(capacity);
-            COUNTER_SET(_freed_entrys_counter, pruned_info.pruned_count);
-            COUNTER_SET(_freed_memory_counter, pruned_info.pruned_size);
+            // Evict step by step, queries looking up the cache in between only wait for one step.
+            size_t step = old_capacity;
+            if (_lru_cache_type == LRUCacheType::SIZE &&
+                config::cache_capacity_shrink_step_bytes > 0) {
+                step = static_cast<size_t>(config::cache_capacity_shrink_step_bytes);
+            }
+            size_t target_capacity = old_capacity;
+            do {
+                target_capacity = capacity + step < target_capacity ? target_capacity - step
+                                                                    : capacity;
+                PrunedInfo pruned_info = _cache->set_capacity(target_capacity);
+                COUNTER_UPDATE(_freed_entrys_counter, pruned_info.pruned_count);
+                COUNTER_UPDATE(_freed_memory_counter, pruned_info.pruned_size);
+            } while (target_capacity != capacity);
         }
         COUNTER_UPDATE(_adjust_capacity_weighted_number_counter, 1);
         LOG(INFO) << fmt::format(
@@ -284,6 +296,7 @@ public:
         size_t old_capacity = _initial_capacity;
         _initial_capacity =
                 static_cast<size_t>(static_cast<double>(_initial_capacity) * adjust_weighted);
+        _last_adjust_weighted = 1.0;
         LOG(INFO) << fmt::format(
                 "[MemoryGC] {} reset initial capacity, new capacity {}, old capacity {}, prune num "
                 "{}",
@@ -291,6 +304,23 @@ public:
         return prune_num;
     };
 
+    LRUCacheType lru_cache_type() const { return _lru_cache_type; }
+
+    uint64_t get_ghost_hit_count() { return _cache->get_ghost_hit_count(); }
+
+    double rebalance_weighted() {
+        std::lock_guard<std::mutex> l(_lock);
+        return _rebalance_weighted;
+    }
+
+    // Scales the capacity by `rebalance_weighted` on top of the weight of memory gc, used by
+    // CacheManager to move capacity between caches.
+    int64_t set_rebalance_weighted(double rebalance_weighted) {
+        std::lock_guard<std::mutex> l(_lock);
+        _rebalance_weighted = rebalance_weighted;
+        return adjust_capacity_weighted_unlocked(_last_adjust_weighted);
+    }
+
 protected:
     void _init_mem_tracker(const std::string& type_name) {
         if (std::find(CachePolicy::MetadataCache.begin(), CachePolicy::MetadataCache.end(),
@@ -312,6 +342,9 @@ protected:
     std::shared_ptr<Cache> _cache;
     std::mutex _lock;
     LRUCacheType _lru_cache_type;
+    // the weight of the last capacity adjustment by memory gc
+    double _last_adjust_weighted = 1.0;
+    double _rebalance_weighted = 1.0;
 
     std::shared_ptr<MemTrackerLimiter> _mem_tracker;
     std::shared_ptr<MemTracker> _value_mem_tracker;
@@ -252,11 +252,14 @@ private:
     // For generate runtime profile, profile name must be unique.
     UniqueId _uid;
 
-    MemCounter _mem_counter;
-    MemCounter _reserved_counter;
+    // The counters are updated by every thread attached to this tracker, each of them and the
+    // read-mostly fields after them live on their own cache line, so that flushing consumption
+    // and reserving memory from different cores do not invalidate each other.
+    alignas(CACHE_LINE_SIZE) MemCounter _mem_counter;
+    alignas(CACHE_LINE_SIZE) MemCounter _reserved_counter;
 
     // Limit on memory consumption, in bytes.
-    std::atomic<int64_t> _limit;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _limit;
     bool _enable_check_limit = true;
 
     // Group number in mem_tracker_limiter_pool and mem_tracker_pool, generated by the timestamp.
@@ -264,7 +267,7 @@ private:
 
     // Consume size smaller than mem_tracker_consume_min_size_bytes will continue to accumulate
     // to avoid frequent calls to consume/release of MemTracker.
-    std::atomic<int64_t> _untracked_mem = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _untracked_mem = 0;
 
     // Avoid frequent printing.
     bool _enable_print_log_usage = false;
@@ -26,7 +26,9 @@
 #include "runtime/memory/jemalloc_control.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "util/mem_info.h"
+#include "util/pretty_printer.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -283,6 +285,71 @@ void MemoryProfile::refresh_tasks_memory_profile() {
     _tasks_memory_profile.set(std::move(tasks_memory_profile));
 }
 
+void MemoryProfile::refresh_memory_growth_window() {
+    TrackersSnapshot snapshot;
+    snapshot.timestamp_s = UnixSeconds();
+    snapshot.process_memory = PerfCounters::get_vm_rss();
+    for (auto& group : ExecEnv::GetInstance()->mem_tracker_limiter_pool) {
+        std::lock_guard<std::mutex> l(group.group_lock);
+        for (const auto& tracker_wptr : group.trackers) {
+            auto tracker = tracker_wptr.lock();
+            if (tracker != nullptr && tracker->consumption() != 0) {
+                snapshot.consumptions[fmt::format("{}: {}",
+                                                  MemTrackerLimiter::type_string(tracker->type()),
+                                                  tracker->label())] += tracker->consumption();
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> l(_growth_window_lock);
+    _growth_window.push_back(std::move(snapshot));
+    while (_growth_window.size() >
+           static_cast<size_t>(std::max(config::memory_growth_window_snapshots, 2))) {
+        _growth_window.pop_front();
+    }
+}
+
+std::string MemoryProfile::print_memory_growth(size_t top_n) const {
+    std::lock_guard<std::mutex> l(_growth_window_lock);
+    if (_growth_window.size() < 2) {
+        return "Not enough memory tracker snapshots yet, see "
+               "config::memory_growth_snapshot_interval_s.\n";
+    }
+    const auto& oldest = _growth_window.front();
+    const auto& newest = _growth_window.back();
+
+    // label -> (consumption in oldest, consumption in newest)
+    std::unordered_map<std::string, std::pair<int64_t, int64_t>> consumptions;
+    for (const auto& [label, bytes] : oldest.consumptions) {
+        consumptions[label].first = bytes;
+    }
+    for (const auto& [label, bytes] : newest.consumptions) {
+        consumptions[label].second = bytes;
+    }
+    std::vector<std::pair<std::string, std::pair<int64_t, int64_t>>> growths(
+            consumptions.begin(), consumptions.end());
+    std::sort(growths.begin(), growths.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.second - lhs.second.first > rhs.second.second - rhs.second.first;
+    });
+
+    fmt::memory_buffer buf;
+    fmt::format_to(buf, "Memory growth in the last {}s, process memory: {} -> {}\n",
+                   newest.timestamp_s - oldest.timestamp_s,
+                   PrettyPrinter::print_bytes(oldest.process_memory),
+                   PrettyPrinter::print_bytes(newest.process_memory));
+    for (size_t i = 0; i < std::min(top_n, growths.size()); ++i) {
+        const auto& [label, bytes] = growths[i];
+        if (bytes.second <= bytes.first) {
+            break;
+        }
+        fmt::format_to(buf, "    +{} ({} -> {}) {}\n",
+                       PrettyPrinter::print_bytes(bytes.second - bytes.first),
+                       PrettyPrinter::print_bytes(bytes.first),
+                       PrettyPrinter::print_bytes(bytes.second), label);
+    }
+    return fmt::to_string(buf);
+}
+
 void MemoryProfile::make_memory_profile(RuntimeProfile* profile) const {
     RuntimeProfile* memory_profile_snapshot = profile->create_child("MemoryProfile", true, false);
 
@@ -19,6 +19,11 @@
 
 #include <common/multi_version.h>
 
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -57,6 +62,12 @@ public:
         return _tasks_memory_profile.get()->pretty_print();
     }
 
+    // Snapshot the consumption of all memory trackers into a sliding window, so that the
+    // trackers whose memory grows can be found without dumping the heap.
+    void refresh_memory_growth_window();
+    // The `top_n` trackers that grew the most between the oldest and the newest snapshot.
+    std::string print_memory_growth(size_t top_n) const;
+
     static int64_t query_current_usage();
     static int64_t load_current_usage();
     static int64_t compaction_current_usage();
@@ -69,6 +80,13 @@ public:
     std::string process_memory_detail_str() const;
 
 private:
+    struct TrackersSnapshot {
+        int64_t timestamp_s = 0;
+        int64_t process_memory = 0;
+        // key is "type: label"
+        std::unordered_map<std::string, int64_t> consumptions;
+    };
+
     void init_memory_overview_counter();
 
     std::unique_ptr<RuntimeProfile> _memory_overview_profile;
@@ -108,6 +126,9 @@ private:
     RuntimeProfile::HighWaterMarkCounter* _other_usage_counter;
 
     std::atomic<bool> _enable_print_log_process_usage {true};
+
+    mutable std::mutex _growth_window_lock;
+    std::deque<TrackersSnapshot> _growth_window;
 };
 
 #include "common/compile_check_end.h"
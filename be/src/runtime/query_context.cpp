@@ -35,6 +35,7 @@
 #include "olap/olap_common.h"
 #include "pipeline/dependency.h"
 #include "pipeline/pipeline_fragment_context.h"
+#include "pipeline/query_cache/query_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/memory/heap_profiler.h"
@@ -317,6 +318,17 @@ std::string QueryContext::get_load_error_url() {
     return _load_error_url;
 }
 
+std::shared_ptr<QueryCacheLookup> QueryContext::get_query_cache_lookup(
+        const std::string& cache_key,
+        const std::function<std::shared_ptr<QueryCacheLookup>()>& lookup) {
+    std::lock_guard<std::mutex> lock(_query_cache_lookup_lock);
+    auto& result = _query_cache_lookups[cache_key];
+    if (result == nullptr) {
+        result = lookup();
+    }
+    return result;
+}
+
 void QueryContext::cancel_all_pipeline_context(const Status& reason, int fragment_id) {
     std::vector<std::weak_ptr<pipeline::PipelineFragmentContext>> ctx_to_cancel;
     {
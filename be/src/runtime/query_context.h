@@ -24,6 +24,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -43,6 +44,7 @@
 #include "workload_group/workload_group.h"
 
 namespace doris {
+struct QueryCacheLookup;
 
 namespace pipeline {
 class PipelineFragmentContext;
@@ -268,6 +270,17 @@ public:
     void set_load_error_url(std::string error_url);
     std::string get_load_error_url();
 
+    // Bytes of the segment pages being prefetched into the file cache for the query. The
+    // prefetches may outlive the query, so they hold the counter.
+    std::shared_ptr<std::atomic<int64_t>> file_cache_prefetch_bytes() {
+        return _file_cache_prefetch_bytes;
+    }
+
+    // Return the query cache entry looked up for `cache_key`, calling `lookup` on the first call.
+    std::shared_ptr<QueryCacheLookup> get_query_cache_lookup(
+            const std::string& cache_key,
+            const std::function<std::shared_ptr<QueryCacheLookup>()>& lookup);
+
 private:
     friend class QueryTaskController;
 
@@ -315,6 +328,12 @@ private:
     std::mutex _brpc_stubs_mutex;
     std::unordered_map<TNetworkAddress, std::shared_ptr<PBackendService_Stub>> _using_brpc_stubs;
 
+    std::shared_ptr<std::atomic<int64_t>> _file_cache_prefetch_bytes =
+            std::make_shared<std::atomic<int64_t>>(0);
+
+    std::mutex _query_cache_lookup_lock;
+    std::unordered_map<std::string, std::shared_ptr<QueryCacheLookup>> _query_cache_lookups;
+
     // when fragment of pipeline is closed, it will register its profile to this map by using add_fragment_profile
     // flatten profile of one fragment:
     // Pipeline 0
@@ -189,7 +189,7 @@ Status KafkaDataConsumer::assign_topic_partitions(
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
+Status KafkaDataConsumer::group_consume(BlockingQueue<KafkaMessageBatchPtr>* queue,
                                         int64_t max_running_time_ms) {
     static constexpr int MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE = 3;
     int64_t left_time = max_running_time_ms;
@@ -203,6 +203,23 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
     watch.start();
+    // msgs are handed to the group in batches to save a queue round trip per msg
+    const auto max_batch_size =
+            static_cast<size_t>(std::max(1, config::routine_load_consumer_batch_size));
+    auto batch = std::make_shared<KafkaMessageBatch>();
+    // return false if the queue is shutdown
+    auto flush_batch = [&]() {
+        if (batch->empty()) {
+            return true;
+        }
+        size_t batch_size = batch->size();
+        if (!queue->controlled_blocking_put(batch, config::blocking_queue_cv_wait_timeout_ms)) {
+            return false;
+        }
+        put_rows += batch_size;
+        batch = std::make_shared<KafkaMessageBatch>();
+        return true;
+    };
     while (true) {
         {
             std::unique_lock<std::mutex> l(_lock);
@@ -216,9 +233,10 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         }
 
         bool done = false;
-        // consume 1 message at a time
+        // consume 1 message at a time, only wait for the first message of a batch
         consumer_watch.start();
-        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(1000 /* timeout, ms */));
+        std::unique_ptr<RdKafka::Message> msg(
+                _k_consumer->consume(batch->empty() ? 1000 : 0 /* timeout, ms */));
         consumer_watch.stop();
         DorisMetrics::instance()->routine_load_get_msg_count->increment(1);
         DorisMetrics::instance()->routine_load_get_msg_latency->increment(
@@ -243,13 +261,12 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
                 // ignore msg with length 0.
                 // put empty msg into queue will cause the load process shutting down.
                 break;
-            } else if (!queue->controlled_blocking_put(msg.get(),
-                                                       config::blocking_queue_cv_wait_timeout_ms)) {
+            }
+            // msg will be deleted after being processed
+            batch->push_back(std::move(msg));
+            if (batch->size() >= max_batch_size && !flush_batch()) {
                 // queue is shutdown
                 done = true;
-            } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
             }
             ++received_rows;
             DorisMetrics::instance()->routine_load_consume_rows->increment(1);
@@ -257,6 +274,11 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         case RdKafka::ERR__TIMED_OUT:
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
+            if (!batch->empty()) {
+                // no more fetched msgs for now, hand the batch over
+                done = !flush_batch();
+                break;
+            }
             LOG(INFO) << "kafka consume timeout: " << _id;
             break;
         case RdKafka::ERR__TRANSPORT:
@@ -271,15 +293,12 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             VLOG_NOTICE << "consumer meet partition eof: " << _id
                         << " partition offset: " << msg->offset();
             _consuming_partition_ids.erase(msg->partition());
-            if (!queue->controlled_blocking_put(msg.get(),
-                                                config::blocking_queue_cv_wait_timeout_ms)) {
+            batch->push_back(std::move(msg));
+            if (!flush_batch()) {
                 done = true;
             } else if (_consuming_partition_ids.size() <= 0) {
                 LOG(INFO) << "all partitions meet eof: " << _id;
-                msg.release();
                 done = true;
-            } else {
-                msg.release();
             }
             break;
         }
@@ -304,6 +323,8 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             break;
         }
     }
+    // the msgs are not committed if the queue is already shutdown, just drop them
+    static_cast<void>(flush_batch());
 
     LOG(INFO) << "kafka consumer done: " << _id << ", grp: " << _grp_id
               << ". cancelled: " << _cancelled << ", left time(ms): " << left_time
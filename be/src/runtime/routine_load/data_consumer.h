@@ -39,6 +39,10 @@ namespace doris {
 template <typename T>
 class BlockingQueue;
 
+// Messages consumed by a KafkaDataConsumer and handed to its consumer group at once.
+using KafkaMessageBatch = std::vector<std::unique_ptr<RdKafka::Message>>;
+using KafkaMessageBatchPtr = std::shared_ptr<KafkaMessageBatch>;
+
 class DataConsumer {
 public:
     DataConsumer()
@@ -144,8 +148,8 @@ public:
                                    const std::string& topic,
                                    std::shared_ptr<StreamLoadContext> ctx);
 
-    // start the consumer and put msgs to queue
-    Status group_consume(BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put batches of msgs to queue
+    Status group_consume(BlockingQueue<KafkaMessageBatchPtr>* queue, int64_t max_running_time_ms);
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids);
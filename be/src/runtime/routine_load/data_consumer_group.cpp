@@ -61,11 +61,8 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
-        if (_queue.blocking_get(&msg)) {
-            delete msg;
-            msg = nullptr;
-        } else {
+        KafkaMessageBatchPtr batch;
+        if (!_queue.blocking_get(&batch)) {
             break;
         }
     }
@@ -124,6 +121,9 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
     MonotonicStopWatch watch;
     watch.start();
     bool eos = false;
+    // the batch being appended to the pipe, msgs in it are handled one by one
+    KafkaMessageBatchPtr batch;
+    size_t batch_pos = 0;
     while (true) {
         if (eos || left_time <= 0 || left_rows <= 0 || left_bytes <= 0) {
             LOG(INFO) << "consumer group done: " << _grp_id
@@ -156,11 +156,15 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
             return Status::OK();
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.controlled_blocking_get(&msg, config::blocking_queue_cv_wait_timeout_ms);
+        bool res = true;
+        if (batch == nullptr || batch_pos == batch->size()) {
+            batch_pos = 0;
+            batch.reset();
+            res = _queue.controlled_blocking_get(&batch, config::blocking_queue_cv_wait_timeout_ms);
+        }
         if (res) {
-            // conf has to be deleted finally
-            Defer delete_msg {[msg]() { delete msg; }};
+            // the msg is deleted with its batch
+            RdKafka::Message* msg = (*batch)[batch_pos++].get();
             VLOG_NOTICE << "get kafka message"
                         << ", partition: " << msg->partition() << ", offset: " << msg->offset()
                         << ", len: " << msg->len();
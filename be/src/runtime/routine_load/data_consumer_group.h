@@ -19,12 +19,14 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/kafka_consumer_pipe.h"
 #include "runtime/routine_load/data_consumer.h"
@@ -87,7 +89,10 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup(size_t consumer_num) : DataConsumerGroup(consumer_num), _queue(500) {}
+    KafkaDataConsumerGroup(size_t consumer_num)
+            : DataConsumerGroup(consumer_num),
+              _queue(doris::cast_set<uint32_t>(
+                      std::max(1, 500 / std::max(1, config::routine_load_consumer_batch_size)))) {}
 
     virtual ~KafkaDataConsumerGroup();
 
@@ -99,12 +104,12 @@ public:
 private:
     // start a single consumer
     void actual_consume(std::shared_ptr<DataConsumer> consumer,
-                        BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
+                        BlockingQueue<KafkaMessageBatchPtr>* queue, int64_t max_running_time_ms,
                         ConsumeFinishCallback cb);
 
 private:
-    // blocking queue to receive msgs from all consumers
-    BlockingQueue<RdKafka::Message*> _queue;
+    // blocking queue to receive batches of msgs from all consumers
+    BlockingQueue<KafkaMessageBatchPtr> _queue;
 };
 #include "common/compile_check_end.h"
 
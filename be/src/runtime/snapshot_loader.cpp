@@ -258,7 +258,10 @@ Status SnapshotHttpDownloader::_download_http_file(DataDir* data_dir,
                         file_size](HttpClient* client) {
         RETURN_IF_ERROR(client->init(remote_file_url));
         client->set_timeout_ms(estimate_timeout * 1000);
-        RETURN_IF_ERROR(client->download(local_file_path));
+        // the md5 is computed while downloading, to avoid reading the file again
+        std::string local_file_md5;
+        RETURN_IF_ERROR(client->download(local_file_path,
+                                         remote_file_md5.empty() ? nullptr : &local_file_md5));
 
         std::error_code ec;
         // Check file length
@@ -276,9 +279,6 @@ Status SnapshotHttpDownloader::_download_http_file(DataDir* data_dir,
         }
 
         if (!remote_file_md5.empty()) { // keep compatibility
-            std::string local_file_md5;
-            RETURN_IF_ERROR(
-                    io::global_local_filesystem()->md5sum(local_file_path, &local_file_md5));
             if (local_file_md5 != remote_file_md5) {
                 LOG(WARNING) << "download file md5 error"
                              << ", remote_file_url=" << remote_file_url
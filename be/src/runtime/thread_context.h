@@ -101,13 +101,16 @@
         __VA_ARGS__;                                                                    \
     } while (0)
 
-#define LIMIT_LOCAL_SCAN_IO(data_dir, bytes_read)                                            \
+// Index and footer reads (`io_ctx->is_index_data`) are small and on the critical path of
+// every scan, they do not wait for the throttle of the workload group but are still charged
+// to it, so that the bulk data reads of the group absorb their cost.
+#define LIMIT_LOCAL_SCAN_IO(data_dir, bytes_read, io_ctx)                                    \
     std::shared_ptr<IOThrottle> iot = nullptr;                                               \
     auto* t_ctx = doris::thread_context();                                                   \
     if (t_ctx->is_attach_task() && t_ctx->resource_ctx()->workload_group() != nullptr) {     \
         iot = t_ctx->resource_ctx()->workload_group()->get_local_scan_io_throttle(data_dir); \
     }                                                                                        \
-    if (iot) {                                                                               \
+    if (iot && ((io_ctx) == nullptr || !(io_ctx)->is_index_data)) {                         \
         iot->acquire(-1);                                                                    \
     }                                                                                        \
     Defer defer {                                                                            \
@@ -120,13 +123,13 @@
         }                                                                                    \
     }
 
-#define LIMIT_REMOTE_SCAN_IO(bytes_read)                                                     \
+#define LIMIT_REMOTE_SCAN_IO(bytes_read, io_ctx)                                             \
     std::shared_ptr<IOThrottle> iot = nullptr;                                               \
     auto* t_ctx = doris::thread_context();                                                   \
     if (t_ctx->is_attach_task() && t_ctx->resource_ctx()->workload_group() != nullptr) {     \
         iot = t_ctx->resource_ctx()->workload_group()->get_remote_scan_io_throttle();        \
     }                                                                                        \
-    if (iot) {                                                                               \
+    if (iot && ((io_ctx) == nullptr || !(io_ctx)->is_index_data)) {                         \
         iot->acquire(-1);                                                                    \
     }                                                                                        \
     Defer defer {                                                                            \
@@ -42,6 +42,7 @@
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
 #include "util/runtime_profile.h"
+#include "util/string_util.h"
 #include "util/threadpool.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 
@@ -610,6 +611,17 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
     return upsert_ret;
 }
 
+std::string WorkloadGroup::get_cpuset(const std::string& cpuset_conf,
+                                      const std::string& wg_name) {
+    for (const auto& entry : split(cpuset_conf, ";")) {
+        auto pos = entry.find(':');
+        if (pos != std::string::npos && trim(entry.substr(0, pos)) == wg_name) {
+            return std::string(trim(entry.substr(pos + 1)));
+        }
+    }
+    return "";
+}
+
 void WorkloadGroup::upsert_cgroup_cpu_ctl_no_lock(WorkloadGroupInfo* wg_info) {
     int cpu_hard_limit = wg_info->cpu_hard_limit;
     int cpu_share = static_cast<int>(wg_info->cpu_share);
@@ -618,6 +630,7 @@ void WorkloadGroup::upsert_cgroup_cpu_ctl_no_lock(WorkloadGroupInfo* wg_info) {
     if (_cgroup_cpu_ctl) {
         _cgroup_cpu_ctl->update_cpu_hard_limit(cpu_hard_limit);
         _cgroup_cpu_ctl->update_cpu_soft_limit(cpu_share);
+        _cgroup_cpu_ctl->update_cpuset(get_cpuset(config::workload_group_cpuset, wg_info->name));
         _cgroup_cpu_ctl->get_cgroup_cpu_info(&(wg_info->cgroup_cpu_shares),
                                              &(wg_info->cgroup_cpu_hard_limit));
     }
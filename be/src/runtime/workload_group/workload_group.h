@@ -219,6 +219,10 @@ public:
 
     std::weak_ptr<CgroupCpuCtl> get_cgroup_cpu_ctl_wptr();
 
+    // Returns the cpu list of `wg_name` in `cpuset_conf`, see config::workload_group_cpuset,
+    // empty if the group is not listed.
+    static std::string get_cpuset(const std::string& cpuset_conf, const std::string& wg_name);
+
     std::shared_ptr<WorkloadGroupMetrics> get_metrics() { return _wg_metrics; }
 
     friend class WorkloadGroupMetrics;
@@ -19,6 +19,7 @@
 
 #include "pipeline/pipeline_fragment_context.h"
 #include "runtime/query_context.h"
+#include "runtime/workload_management/spill_arbiter.h"
 #include "runtime/workload_management/task_controller.h"
 
 namespace doris {
@@ -140,26 +141,26 @@ Status QueryTaskController::revoke_memory() {
         fragments.emplace_back(std::move(fragment_ctx));
     }
 
-    std::sort(tasks.begin(), tasks.end(), [](auto&& l, auto&& r) { return l.first > r.first; });
-
     // Do not use memlimit, use current memory usage.
     // For example, if current limit is 1.6G, but current used is 1G, if reserve failed
     // should free 200MB memory, not 300MB
-    const auto target_revoking_size = static_cast<int64_t>(
-            static_cast<double>(query_ctx->query_mem_tracker()->consumption()) * 0.2);
+    const auto target_revoking_size = static_cast<size_t>(
+            static_cast<double>(std::max<int64_t>(query_ctx->query_mem_tracker()->consumption(),
+                                                  0)) *
+            0.2);
     size_t revoked_size = 0;
     size_t total_revokable_size = 0;
 
-    std::vector<pipeline::PipelineTask*> chosen_tasks;
+    std::vector<size_t> revocable_sizes;
     for (auto&& [revocable_size, task] : tasks) {
-        // Only revoke the largest task to ensure memory is used as much as possible
-        // break;
-        if (revoked_size < target_revoking_size) {
-            chosen_tasks.emplace_back(task);
-            revoked_size += revocable_size;
-        }
+        revocable_sizes.emplace_back(revocable_size);
         total_revokable_size += revocable_size;
     }
+    std::vector<pipeline::PipelineTask*> chosen_tasks;
+    for (auto index : SpillArbiter::choose(revocable_sizes, target_revoking_size)) {
+        chosen_tasks.emplace_back(tasks[index].second);
+        revoked_size += tasks[index].first;
+    }
 
     std::weak_ptr<QueryContext> this_ctx = query_ctx;
     auto spill_context = std::make_shared<pipeline::SpillContext>(
@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "runtime/workload_management/spill_arbiter.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+std::vector<size_t> SpillArbiter::choose(const std::vector<size_t>& revocable_sizes,
+                                         size_t target_size) {
+    // candidates by revocable size, the smallest first
+    std::vector<size_t> candidates(revocable_sizes.size());
+    std::iota(candidates.begin(), candidates.end(), 0);
+    std::stable_sort(candidates.begin(), candidates.end(), [&](size_t l, size_t r) {
+        return revocable_sizes[l] < revocable_sizes[r];
+    });
+
+    std::vector<size_t> chosen;
+    size_t freed_size = 0;
+    while (freed_size < target_size && !candidates.empty()) {
+        auto remaining = target_size - freed_size;
+        auto it = std::lower_bound(
+                candidates.begin(), candidates.end(), remaining,
+                [&](size_t index, size_t size) { return revocable_sizes[index] < size; });
+        if (it == candidates.end()) {
+            // no task is large enough alone
+            --it;
+        }
+        chosen.push_back(*it);
+        freed_size += revocable_sizes[*it];
+        candidates.erase(it);
+    }
+    return chosen;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,40 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Chooses the tasks to spill when a query has to free memory.
+// Spilling a task writes and later reads back all of its revocable memory, so the cost of a
+// choice is the bytes it spills. Instead of spilling the largest tasks until the target is freed,
+// the arbiter takes the smallest task that frees the rest of the target by itself, and falls back
+// to the largest task only when no single task is enough.
+class SpillArbiter {
+public:
+    // Returns the indexes of the chosen ones of the tasks with `revocable_sizes`.
+    static std::vector<size_t> choose(const std::vector<size_t>& revocable_sizes,
+                                      size_t target_size);
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
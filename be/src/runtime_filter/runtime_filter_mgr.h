@@ -108,6 +108,9 @@ private:
      *
      * If `_is_global` is false, a RF will be produced and consumed by a single-producer-single-consumer mode.
      * This is usually happened in a co-located join and scan operators are not serial.
+     * Such a RF only covers the buckets built by its own instance, which are the same buckets
+     * its scan reads, so it is sized by the local build and never merged. Only serial scans and
+     * remote targets fall back to the merged RF sized for the whole build.
      *
      * `_local_merge_map` is used only if `_is_global` is true. It is said, RFs produced by
      * different producers need to be merged only if it is a global RF.
@@ -45,6 +45,12 @@ Status RuntimeFilterProducer::_send_to_local_targets(RuntimeState* state, Runtim
     return Status::OK();
 };
 
+bool RuntimeFilterProducer::publishes_locally(RuntimeState* state) {
+    std::unique_lock<std::recursive_mutex> l(_rmtx);
+    return !_has_remote_target &&
+           state->global_runtime_filter_mgr()->get_consume_filters(_wrapper->filter_id()).empty();
+}
+
 Status RuntimeFilterProducer::publish(RuntimeState* state, bool build_hash_table) {
     std::unique_lock<std::recursive_mutex> l(_rmtx);
     _check_state({State::READY_TO_PUBLISH});
@@ -53,9 +59,7 @@ Status RuntimeFilterProducer::publish(RuntimeState* state, bool build_hash_table
         // two case we need do local merge:
         // 1. has remote target
         // 2. has local target and has global consumer (means target scan has local shuffle)
-        if (!_has_remote_target && state->global_runtime_filter_mgr()
-                                           ->get_consume_filters(_wrapper->filter_id())
-                                           .empty()) {
+        if (publishes_locally(state)) {
             // when global consumer not exist, send_to_local_targets will do nothing, so merge rf is useless
             return Status::OK();
         }
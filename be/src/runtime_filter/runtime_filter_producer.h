@@ -72,6 +72,10 @@ public:
 
     Status publish(RuntimeState* state, bool build_hash_table);
 
+    // Whether the filter is only sent to the local consumers, i.e. it is never merged or
+    // serialized.
+    bool publishes_locally(RuntimeState* state);
+
     std::string debug_string() override {
         std::unique_lock<std::recursive_mutex> l(_rmtx);
         auto result =
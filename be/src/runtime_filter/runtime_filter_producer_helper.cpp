@@ -19,8 +19,16 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "common/exception.h"
+#include "olap/hll.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime_filter/runtime_filter_wrapper.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/assert_cast.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -45,6 +53,60 @@ Status RuntimeFilterProducerHelper::init(
     return Status::OK();
 }
 
+void RuntimeFilterProducerHelper::estimate_filter_ndv(const vectorized::Block* block,
+                                                      size_t start) {
+    if (_skip_runtime_filters_process) {
+        return;
+    }
+    SCOPED_TIMER(_runtime_filter_compute_timer.get());
+    _filter_ndvs.assign(_producers.size(), -1);
+    const size_t rows = block->rows();
+    if (rows <= start) {
+        return;
+    }
+
+    std::vector<uint64_t> hashes;
+    for (size_t i = 0; i < _producers.size(); i++) {
+        auto wrapper = _producers[i]->wrapper();
+        // only IN and runtime sized BLOOM filters depend on the build size
+        auto type = wrapper->get_real_type();
+        if (type != RuntimeFilterType::IN_FILTER && type != RuntimeFilterType::BLOOM_FILTER) {
+            continue;
+        }
+        if (type == RuntimeFilterType::BLOOM_FILTER && !wrapper->build_bf_by_runtime_size()) {
+            continue;
+        }
+        int result_column_id = _filter_expr_contexts[i]->get_last_result_column_id();
+        if (result_column_id == -1) {
+            continue;
+        }
+
+        hashes.assign(rows, 0);
+        try {
+            block->get_by_position(result_column_id)
+                    .column->update_hashes_with_value(hashes.data(), nullptr);
+        } catch (const Exception&) {
+            // column type without hashes, keep sizing by the build rows
+            continue;
+        }
+        HyperLogLog hll;
+        for (size_t row = start; row < rows; row++) {
+            hll.update(hashes[row]);
+        }
+        // leave some room for the estimate error, so that an IN filter does not overflow
+        int64_t ndv = std::max<int64_t>(hll.estimate_cardinality(), 1);
+        _filter_ndvs[i] = ndv + ndv / 10;
+    }
+}
+
+uint64_t RuntimeFilterProducerHelper::_filter_size(size_t filter_idx,
+                                                   uint64_t hash_table_size) const {
+    if (filter_idx < _filter_ndvs.size() && _filter_ndvs[filter_idx] >= 0) {
+        return std::min(static_cast<uint64_t>(_filter_ndvs[filter_idx]), hash_table_size);
+    }
+    return hash_table_size;
+}
+
 Status RuntimeFilterProducerHelper::send_filter_size(
         RuntimeState* state, uint64_t hash_table_size,
         const std::shared_ptr<pipeline::CountedFinishDependency>& dependency) {
@@ -54,8 +116,8 @@ Status RuntimeFilterProducerHelper::send_filter_size(
     for (const auto& filter : _producers) {
         filter->latch_dependency(dependency);
     }
-    for (const auto& filter : _producers) {
-        RETURN_IF_ERROR(filter->send_size(state, hash_table_size));
+    for (size_t i = 0; i < _producers.size(); i++) {
+        RETURN_IF_ERROR(_producers[i]->send_size(state, _filter_size(i, hash_table_size)));
     }
     return Status::OK();
 }
@@ -63,12 +125,80 @@ Status RuntimeFilterProducerHelper::send_filter_size(
 Status RuntimeFilterProducerHelper::_init_filters(RuntimeState* state,
                                                   uint64_t local_hash_table_size) {
     // process IN_OR_BLOOM_FILTER's real type
-    for (const auto& filter : _producers) {
-        RETURN_IF_ERROR(filter->init(local_hash_table_size));
+    for (size_t i = 0; i < _producers.size(); i++) {
+        RETURN_IF_ERROR(_producers[i]->init(_filter_size(i, local_hash_table_size)));
     }
     return Status::OK();
 }
 
+template <PrimitiveType type>
+static bool get_key_range(const vectorized::IColumn& column, const uint8_t* null_map, size_t start,
+                          uint64_t* key_range) {
+    const auto& data =
+            assert_cast<const typename PrimitiveTypeTraits<type>::ColumnType&>(column).get_data();
+    using CppType = typename PrimitiveTypeTraits<type>::CppType;
+    auto min = std::numeric_limits<CppType>::max();
+    auto max = std::numeric_limits<CppType>::min();
+    for (size_t i = start; i < data.size(); i++) {
+        if (null_map == nullptr || !null_map[i]) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+    if (min > max || min < 0) {
+        return false;
+    }
+    *key_range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+    return true;
+}
+
+void RuntimeFilterProducerHelper::_set_dense_key_ranges(RuntimeState* state,
+                                                        const vectorized::Block* block,
+                                                        size_t start) {
+    SCOPED_TIMER(_runtime_filter_compute_timer.get());
+    for (size_t i = 0; i < _producers.size(); i++) {
+        auto wrapper = _producers[i]->wrapper();
+        // a merged or serialized filter has to stay a bloom filter
+        if (!wrapper->can_use_bitmap_filter() || !_producers[i]->publishes_locally(state)) {
+            continue;
+        }
+        int result_column_id = _filter_expr_contexts[i]->get_last_result_column_id();
+        if (result_column_id == -1) {
+            continue;
+        }
+
+        const auto& column = block->get_by_position(result_column_id).column;
+        const vectorized::IColumn* nested = column.get();
+        const uint8_t* null_map = nullptr;
+        if (column->is_nullable()) {
+            const auto* nullable = assert_cast<const vectorized::ColumnNullable*>(column.get());
+            nested = &nullable->get_nested_column();
+            null_map = nullable->get_null_map_data().data();
+        }
+        uint64_t key_range = 0;
+        bool valid = false;
+        switch (wrapper->column_type()) {
+        case TYPE_TINYINT:
+            valid = get_key_range<TYPE_TINYINT>(*nested, null_map, start, &key_range);
+            break;
+        case TYPE_SMALLINT:
+            valid = get_key_range<TYPE_SMALLINT>(*nested, null_map, start, &key_range);
+            break;
+        case TYPE_INT:
+            valid = get_key_range<TYPE_INT>(*nested, null_map, start, &key_range);
+            break;
+        case TYPE_BIGINT:
+            valid = get_key_range<TYPE_BIGINT>(*nested, null_map, start, &key_range);
+            break;
+        default:
+            break;
+        }
+        if (valid) {
+            wrapper->set_dense_key_range(key_range);
+        }
+    }
+}
+
 Status RuntimeFilterProducerHelper::_insert(const vectorized::Block* block, size_t start) {
     SCOPED_TIMER(_runtime_filter_compute_timer.get());
     for (int i = 0; i < _producers.size(); i++) {
@@ -99,9 +229,12 @@ Status RuntimeFilterProducerHelper::build(
     if (_should_build_hash_table) {
         // Hash table is completed and runtime filter has a global size now.
         uint64_t hash_table_size = block ? block->rows() : 0;
+        constexpr int HASH_JOIN_INSERT_OFFSET = 1; // the first row is mocked on hash join sink
+        if (hash_table_size > 1) {
+            _set_dense_key_ranges(state, block, HASH_JOIN_INSERT_OFFSET);
+        }
         RETURN_IF_ERROR(_init_filters(state, hash_table_size));
         if (hash_table_size > 1) {
-            constexpr int HASH_JOIN_INSERT_OFFSET = 1; // the first row is mocked on hash join sink
             RETURN_IF_ERROR(_insert(block, HASH_JOIN_INSERT_OFFSET));
         }
     }
@@ -50,6 +50,11 @@ public:
     Status init(RuntimeState* state, const vectorized::VExprContextSPtrs& build_expr_ctxs,
                 const std::vector<TRuntimeFilterDesc>& runtime_filter_descs);
 
+    // estimate the distinct count of every filter's build column with a hll sketch, which is used
+    // instead of the build rows to size the filters and to choose IN or BLOOM. The build exprs
+    // must have been evaluated on block already.
+    void estimate_filter_ndv(const vectorized::Block* block, size_t start);
+
     // send local size to remote to sync global rf size if needed
     MOCK_FUNCTION Status
     send_filter_size(RuntimeState* state, uint64_t hash_table_size,
@@ -72,8 +77,11 @@ protected:
     virtual void _init_expr(const vectorized::VExprContextSPtrs& build_expr_ctxs,
                             const std::vector<TRuntimeFilterDesc>& runtime_filter_descs);
     Status _init_filters(RuntimeState* state, uint64_t local_hash_table_size);
+    // let the IN_OR_BLOOM filters on dense non-negative integer keys be built as bitmaps
+    void _set_dense_key_ranges(RuntimeState* state, const vectorized::Block* block, size_t start);
     Status _insert(const vectorized::Block* block, size_t start);
     Status _publish(RuntimeState* state);
+    uint64_t _filter_size(size_t filter_idx, uint64_t hash_table_size) const;
 
     std::vector<std::shared_ptr<RuntimeFilterProducer>> _producers;
     const bool _should_build_hash_table;
@@ -88,6 +96,8 @@ protected:
     const bool _is_broadcast_join;
 
     std::vector<std::shared_ptr<vectorized::VExprContext>> _filter_expr_contexts;
+    // estimated distinct count of each filter's build column, -1 means not estimated
+    std::vector<int64_t> _filter_ndvs;
 };
 #include "common/compile_check_end.h"
 } // namespace doris
@@ -25,6 +25,7 @@ namespace doris {
 RuntimeFilterWrapper::RuntimeFilterWrapper(const RuntimeFilterParams* params)
         : RuntimeFilterWrapper(params->column_return_type, params->filter_type, params->filter_id,
                                State::UNINITED, params->max_in_num) {
+    _null_aware = params->null_aware;
     switch (_filter_type) {
     case RuntimeFilterType::IN_FILTER: {
         _hybrid_set.reset(create_set(_column_return_type, params->null_aware));
@@ -71,9 +72,34 @@ Status RuntimeFilterWrapper::_change_to_bloom_filter() {
     return Status::OK();
 }
 
+Status RuntimeFilterWrapper::_change_to_bitmap_filter() {
+    if (!can_use_bitmap_filter()) {
+        return Status::InternalError("Can not change to bitmap filter, {}", debug_string());
+    }
+    _bitmap_filter_func.reset(create_bitmap_filter(_column_return_type));
+
+    // release in and bloom filter to change real type to bitmap
+    _hybrid_set.reset();
+    _bloom_filter_func.reset();
+    return Status::OK();
+}
+
+bool RuntimeFilterWrapper::can_use_bitmap_filter() const {
+    return _filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER && !_null_aware &&
+           (_column_return_type == TYPE_TINYINT || _column_return_type == TYPE_SMALLINT ||
+            _column_return_type == TYPE_INT || _column_return_type == TYPE_BIGINT);
+}
+
 Status RuntimeFilterWrapper::init(const size_t real_size) {
     if (_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER && real_size > _max_in_num) {
-        RETURN_IF_ERROR(_change_to_bloom_filter());
+        // a bitmap costs about one bit per key in the range, where a bloom filter has false
+        // positives at the same size
+        if (_dense_key_range > 0 && can_use_bitmap_filter() &&
+            _dense_key_range / 8 <= _bloom_filter_func->get_length(real_size)) {
+            RETURN_IF_ERROR(_change_to_bitmap_filter());
+        } else {
+            RETURN_IF_ERROR(_change_to_bloom_filter());
+        }
     }
     if (get_real_type() == RuntimeFilterType::IN_FILTER && real_size > _max_in_num) {
         set_state(RuntimeFilterWrapper::State::DISABLED, "reach max in num");
@@ -111,6 +137,8 @@ Status RuntimeFilterWrapper::insert(const vectorized::ColumnPtr& column, size_t
     case RuntimeFilterType::IN_OR_BLOOM_FILTER: {
         if (get_real_type() == RuntimeFilterType::BLOOM_FILTER) {
             _bloom_filter_func->insert_fixed_len(column, start);
+        } else if (get_real_type() == RuntimeFilterType::BITMAP_FILTER) {
+            RETURN_IF_ERROR(_insert_bitmap_keys(column, start));
         } else {
             _hybrid_set->insert_fixed_len(column, start);
         }
@@ -146,6 +174,64 @@ Status RuntimeFilterWrapper::insert(const vectorized::ColumnPtr& column, size_t
     return Status::OK();
 }
 
+template <PrimitiveType type>
+static bool collect_bitmap_keys(const vectorized::IColumn& column, const uint8_t* null_map,
+                                size_t start, std::vector<uint64_t>& keys) {
+    const auto& data =
+            assert_cast<const typename PrimitiveTypeTraits<type>::ColumnType&>(column).get_data();
+    for (size_t i = start; i < data.size(); i++) {
+        if (null_map != nullptr && null_map[i]) {
+            continue;
+        }
+        if (data[i] < 0) {
+            return false;
+        }
+        keys.push_back(static_cast<uint64_t>(data[i]));
+    }
+    return true;
+}
+
+Status RuntimeFilterWrapper::_insert_bitmap_keys(const vectorized::ColumnPtr& column,
+                                                 size_t start) {
+    const vectorized::IColumn* nested = column.get();
+    const uint8_t* null_map = nullptr;
+    if (column->is_nullable()) {
+        const auto* nullable = assert_cast<const vectorized::ColumnNullable*>(column.get());
+        nested = &nullable->get_nested_column();
+        null_map = nullable->get_null_map_data().data();
+    }
+
+    std::vector<uint64_t> keys;
+    keys.reserve(column->size() - start);
+    bool valid = false;
+    switch (_column_return_type) {
+    case TYPE_TINYINT:
+        valid = collect_bitmap_keys<TYPE_TINYINT>(*nested, null_map, start, keys);
+        break;
+    case TYPE_SMALLINT:
+        valid = collect_bitmap_keys<TYPE_SMALLINT>(*nested, null_map, start, keys);
+        break;
+    case TYPE_INT:
+        valid = collect_bitmap_keys<TYPE_INT>(*nested, null_map, start, keys);
+        break;
+    case TYPE_BIGINT:
+        valid = collect_bitmap_keys<TYPE_BIGINT>(*nested, null_map, start, keys);
+        break;
+    default:
+        return Status::InternalError("Bitmap filter do not support type {}",
+                                     type_to_string(_column_return_type));
+    }
+    if (!valid) {
+        // the key range is checked before `init`, but keep the result correct anyway
+        set_state(State::DISABLED, "negative key in bitmap filter");
+        return Status::OK();
+    }
+
+    BitmapValue bitmap(keys);
+    _bitmap_filter_func->insert_many({&bitmap});
+    return Status::OK();
+}
+
 bool RuntimeFilterWrapper::build_bf_by_runtime_size() const {
     return _bloom_filter_func ? _bloom_filter_func->build_bf_by_runtime_size() : false;
 }
@@ -191,6 +277,12 @@ Status RuntimeFilterWrapper::merge(const RuntimeFilterWrapper* other) {
         if (other_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER) {
             other_filter_type = other->get_real_type();
         }
+        if (real_filter_type == RuntimeFilterType::BITMAP_FILTER ||
+            other_filter_type == RuntimeFilterType::BITMAP_FILTER) {
+            // dense key filters are only built for the filters which are never merged
+            set_state(State::DISABLED, "can not merge bitmap filter built by dense keys");
+            return Status::OK();
+        }
 
         if (real_filter_type == RuntimeFilterType::IN_FILTER) {
             // when we meet base rf is in-filter, threre only have two case:
@@ -68,11 +68,22 @@ public:
             if (_hybrid_set) {
                 return RuntimeFilterType::IN_FILTER;
             }
+            if (_bitmap_filter_func) {
+                return RuntimeFilterType::BITMAP_FILTER;
+            }
             return RuntimeFilterType::BLOOM_FILTER;
         }
         return _filter_type;
     }
 
+    // Whether the build keys can be kept in a bitmap instead of a bloom filter, see
+    // `set_dense_key_range`.
+    bool can_use_bitmap_filter() const;
+    // `key_range` is the range of the non-negative build keys. If the bitmap of such keys is
+    // not larger than the bloom filter, an IN_OR_BLOOM filter which exceeds `max_in_num` is
+    // built as an exact BITMAP filter. Only for the filters never merged or serialized.
+    void set_dense_key_range(uint64_t key_range) { _dense_key_range = key_range; }
+
     std::shared_ptr<MinMaxFuncBase> minmax_func() const { return _minmax_func; }
     std::shared_ptr<HybridSetBase> hybrid_set() const { return _hybrid_set; }
     std::shared_ptr<BloomFilterFuncBase> bloom_filter_func() const { return _bloom_filter_func; }
@@ -128,11 +139,15 @@ private:
                    bool contain_null);
     Status _assign(const PMinMaxFilter& minmax_filter, bool contain_null);
     Status _change_to_bloom_filter();
+    Status _change_to_bitmap_filter();
+    Status _insert_bitmap_keys(const vectorized::ColumnPtr& column, size_t start);
     // When a runtime filter received from remote and it is a bloom filter, _column_return_type will be invalid.
     const PrimitiveType _column_return_type; // column type
     const RuntimeFilterType _filter_type;
     const uint32_t _filter_id;
     const int32_t _max_in_num;
+    bool _null_aware = false;
+    uint64_t _dense_key_range = 0;
 
     std::shared_ptr<MinMaxFuncBase> _minmax_func;
     std::shared_ptr<HybridSetBase> _hybrid_set;
@@ -153,6 +153,9 @@ Status HttpService::start() {
     auto* adjust_tracing_dump = _pool.add(new AdjustTracingDump(_env));
     _ev_http_server->register_handler(HttpMethod::POST, "api/pipeline/tracing",
                                       adjust_tracing_dump);
+    auto* tracing_snapshot_action = _pool.add(new TracingSnapshotAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "api/pipeline/tracing/snapshot",
+                                      tracing_snapshot_action);
 
     // Register BE version action
     VersionAction* version_action =
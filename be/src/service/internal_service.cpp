@@ -152,6 +152,9 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(arrow_flight_work_active_threads, MetricUnit:
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(arrow_flight_work_pool_max_queue_size, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(arrow_flight_work_max_threads, MetricUnit::NOUNIT);
 
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(load_work_pool_queue_size, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(load_work_active_threads, MetricUnit::NOUNIT);
+
 bthread_key_t btls_key;
 
 static void thread_context_deleter(void* d) {
@@ -226,7 +229,14 @@ PInternalService::PInternalService(ExecEnv* exec_env)
                                   config::brpc_arrow_flight_work_pool_max_queue_size != -1
                                           ? config::brpc_arrow_flight_work_pool_max_queue_size
                                           : std::max(20480, CpuInfo::num_cores() * 640),
-                                  "brpc_arrow_flight") {
+                                  "brpc_arrow_flight"),
+          _load_work_pool(config::brpc_load_work_pool_threads != -1
+                                  ? config::brpc_load_work_pool_threads
+                                  : std::max(64, CpuInfo::num_cores() * 2),
+                          config::brpc_load_work_pool_max_queue_size != -1
+                                  ? config::brpc_load_work_pool_max_queue_size
+                                  : std::max(10240, CpuInfo::num_cores() * 320),
+                          "brpc_load") {
     REGISTER_HOOK_METRIC(heavy_work_pool_queue_size,
                          [this]() { return _heavy_work_pool.get_queue_size(); });
     REGISTER_HOOK_METRIC(light_work_pool_queue_size,
@@ -254,6 +264,11 @@ PInternalService::PInternalService(ExecEnv* exec_env)
     REGISTER_HOOK_METRIC(arrow_flight_work_max_threads,
                          []() { return config::brpc_arrow_flight_work_pool_threads; });
 
+    REGISTER_HOOK_METRIC(load_work_pool_queue_size,
+                         [this]() { return _load_work_pool.get_queue_size(); });
+    REGISTER_HOOK_METRIC(load_work_active_threads,
+                         [this]() { return _load_work_pool.get_active_threads(); });
+
     _exec_env->load_stream_mgr()->set_heavy_work_pool(&_heavy_work_pool);
 
     CHECK_EQ(0, bthread_key_create(&btls_key, thread_context_deleter));
@@ -281,6 +296,9 @@ PInternalService::~PInternalService() {
     DEREGISTER_HOOK_METRIC(arrow_flight_work_pool_max_queue_size);
     DEREGISTER_HOOK_METRIC(arrow_flight_work_max_threads);
 
+    DEREGISTER_HOOK_METRIC(load_work_pool_queue_size);
+    DEREGISTER_HOOK_METRIC(load_work_active_threads);
+
     CHECK_EQ(0, bthread_key_delete(btls_key));
     CHECK_EQ(0, bthread_key_delete(AsyncIO::btls_io_ctx_key));
 }
@@ -289,7 +307,7 @@ void PInternalService::tablet_writer_open(google::protobuf::RpcController* contr
                                           const PTabletWriterOpenRequest* request,
                                           PTabletWriterOpenResult* response,
                                           google::protobuf::Closure* done) {
-    bool ret = _heavy_work_pool.try_offer([this, request, response, done]() {
+    bool ret = _load_work_pool.try_offer([this, request, response, done]() {
         VLOG_RPC << "tablet writer open, id=" << request->id()
                  << ", index_id=" << request->index_id() << ", txn_id=" << request->txn_id();
         signal::SignalTaskIdKeeper keeper(request->id());
@@ -303,7 +321,7 @@ void PInternalService::tablet_writer_open(google::protobuf::RpcController* contr
         st.to_protobuf(response->mutable_status());
     });
     if (!ret) {
-        offer_failed(response, done, _heavy_work_pool);
+        offer_failed(response, done, _load_work_pool);
         return;
     }
 }
@@ -472,7 +490,7 @@ void PInternalService::tablet_writer_add_block(google::protobuf::RpcController*
                                                PTabletWriterAddBlockResult* response,
                                                google::protobuf::Closure* done) {
     int64_t submit_task_time_ns = MonotonicNanos();
-    bool ret = _heavy_work_pool.try_offer([request, response, done, submit_task_time_ns, this]() {
+    bool ret = _load_work_pool.try_offer([request, response, done, submit_task_time_ns, this]() {
         int64_t wait_execution_time_ns = MonotonicNanos() - submit_task_time_ns;
         brpc::ClosureGuard closure_guard(done);
         int64_t execution_time_ns = 0;
@@ -492,7 +510,7 @@ void PInternalService::tablet_writer_add_block(google::protobuf::RpcController*
         response->set_wait_execution_time_us(wait_execution_time_ns / NANOS_PER_MICRO);
     });
     if (!ret) {
-        offer_failed(response, done, _heavy_work_pool);
+        offer_failed(response, done, _load_work_pool);
         return;
     }
 }
@@ -256,6 +256,8 @@ protected:
     FifoThreadPool _heavy_work_pool;
     FifoThreadPool _light_work_pool;
     FifoThreadPool _arrow_flight_work_pool;
+    // the tablet writer interfaces of load channels, which may block on the memtable memory limit
+    FifoThreadPool _load_work_pool;
 };
 
 // `StorageEngine` mixin for `PInternalService`
@@ -26,8 +26,10 @@
 #include <google/protobuf/extension_set.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <climits>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -421,7 +423,14 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Probe the primary key indexes in key order, so that close keys hit the index pages loaded
+    // for the previous key. The rows are still returned in the order of the request.
+    std::vector<size_t> lookup_order(_row_read_ctxs.size());
+    std::iota(lookup_order.begin(), lookup_order.end(), 0);
+    std::sort(lookup_order.begin(), lookup_order.end(), [this](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    for (size_t i : lookup_order) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
@@ -457,6 +466,29 @@ Status PointQueryExecutor::_lookup_row_key() {
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    // Read the row store values in the order of their locations, so that the rows of one page
+    // are read one after another while the page is cached.
+    std::vector<std::string> row_store_values(_row_read_ctxs.size());
+    if (_reusable->rs_column_uid() != -1) {
+        std::vector<size_t> read_order;
+        for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+            if (!_row_read_ctxs[i]._cached_row_data.valid() &&
+                _row_read_ctxs[i]._row_location.has_value()) {
+                read_order.push_back(i);
+            }
+        }
+        std::sort(read_order.begin(), read_order.end(), [this](size_t lhs, size_t rhs) {
+            return _row_read_ctxs[lhs]._row_location.value() <
+                   _row_read_ctxs[rhs]._row_location.value();
+        });
+        bool use_row_cache = !config::disable_storage_row_cache;
+        for (size_t i : read_order) {
+            RETURN_IF_ERROR(_tablet->lookup_row_data(
+                    _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
+                    *(_row_read_ctxs[i]._rowset_ptr), _profile_metrics.read_stats,
+                    row_store_values[i], use_row_cache));
+        }
+    }
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -470,14 +502,9 @@ Status PointQueryExecutor::_lookup_row_data() {
         if (!_row_read_ctxs[i]._row_location.has_value()) {
             continue;
         }
-        std::string value;
         // fill block by row store
         if (_reusable->rs_column_uid() != -1) {
-            bool use_row_cache = !config::disable_storage_row_cache;
-            RETURN_IF_ERROR(_tablet->lookup_row_data(
-                    _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
-                    *(_row_read_ctxs[i]._rowset_ptr), _profile_metrics.read_stats, value,
-                    use_row_cache));
+            const std::string& value = row_store_values[i];
             // serilize value to block, currently only jsonb row formt
             RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
                     _reusable->get_data_type_serdes(), value.data(), value.size(),
@@ -22,6 +22,9 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
+#include <arrow/buffer.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
@@ -40,6 +43,8 @@
 #include "util/arrow/row_batch.h"
 #include "util/arrow/utils.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_array.h"
@@ -52,21 +57,46 @@ class Array;
 
 namespace doris {
 
+// A buffer on the data of a column, holding the column while arrow uses it.
+class ColumnDataBuffer : public arrow::Buffer {
+public:
+    ColumnDataBuffer(vectorized::ColumnPtr column, StringRef data)
+            : arrow::Buffer(reinterpret_cast<const uint8_t*>(data.data),
+                            static_cast<int64_t>(data.size)),
+              _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
+template <PrimitiveType T>
+bool is_vector_column(const vectorized::IColumn& column) {
+    return vectorized::check_and_get_column<vectorized::ColumnVector<T>>(column) != nullptr;
+}
+
 class FromBlockConverter {
 public:
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
-                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj)
+                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj,
+                       bool share_column_buffers)
             : _block(block),
               _schema(schema),
               _pool(pool),
               _cur_field_idx(-1),
-              _timezone_obj(timezone_obj) {}
+              _timezone_obj(timezone_obj),
+              _share_column_buffers(share_column_buffers) {}
 
     ~FromBlockConverter() = default;
 
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    // Makes the array of a fixed width numeric column on its data, returns false for the other
+    // columns.
+    Status _share_column(const vectorized::ColumnPtr& column,
+                         const std::shared_ptr<arrow::DataType>& arrow_type,
+                         std::shared_ptr<arrow::Array>* array, bool* shared);
+
     const vectorized::Block& _block;
     const std::shared_ptr<arrow::Schema>& _schema;
     arrow::MemoryPool* _pool;
@@ -79,10 +109,79 @@ private:
     arrow::ArrayBuilder* _cur_builder = nullptr;
 
     const cctz::time_zone& _timezone_obj;
+    const bool _share_column_buffers;
 
     std::vector<std::shared_ptr<arrow::Array>> _arrays;
 };
 
+Status FromBlockConverter::_share_column(const vectorized::ColumnPtr& column,
+                                         const std::shared_ptr<arrow::DataType>& arrow_type,
+                                         std::shared_ptr<arrow::Array>* array, bool* shared) {
+    *shared = false;
+    vectorized::ColumnPtr data_column = column;
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(
+                *column)) {
+        data_column = nullable->get_nested_column_ptr();
+        null_map = &nullable->get_null_map_data();
+    }
+    bool same_layout = false;
+    switch (arrow_type->id()) {
+    case arrow::Type::INT8:
+        same_layout = is_vector_column<TYPE_TINYINT>(*data_column);
+        break;
+    case arrow::Type::INT16:
+        same_layout = is_vector_column<TYPE_SMALLINT>(*data_column);
+        break;
+    case arrow::Type::INT32:
+        same_layout = is_vector_column<TYPE_INT>(*data_column);
+        break;
+    case arrow::Type::INT64:
+        same_layout = is_vector_column<TYPE_BIGINT>(*data_column);
+        break;
+    case arrow::Type::FLOAT:
+        same_layout = is_vector_column<TYPE_FLOAT>(*data_column);
+        break;
+    case arrow::Type::DOUBLE:
+        same_layout = is_vector_column<TYPE_DOUBLE>(*data_column);
+        break;
+    default:
+        break;
+    }
+    if (!same_layout) {
+        return Status::OK();
+    }
+
+    auto num_rows = static_cast<int64_t>(data_column->size());
+    std::shared_ptr<arrow::Buffer> validity;
+    int64_t null_count = 0;
+    if (null_map != nullptr) {
+        // arrow marks the valid rows, doris marks the null rows
+        auto bitmap = arrow::AllocateEmptyBitmap(num_rows, _pool);
+        if (!bitmap.ok()) {
+            return to_doris_status(bitmap.status());
+        }
+        validity = std::move(bitmap).ValueUnsafe();
+        auto* bits = validity->mutable_data();
+        for (int64_t i = 0; i < num_rows; ++i) {
+            if ((*null_map)[i]) {
+                ++null_count;
+            } else {
+                bits[i >> 3] |= static_cast<uint8_t>(1U << (i & 7));
+            }
+        }
+        if (null_count == 0) {
+            validity = nullptr;
+        }
+    }
+    auto values = std::make_shared<ColumnDataBuffer>(data_column, data_column->get_raw_data());
+    *array = arrow::MakeArray(arrow::ArrayData::Make(arrow_type, num_rows,
+                                                     {std::move(validity), std::move(values)},
+                                                     null_count));
+    *shared = true;
+    return Status::OK();
+}
+
 Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     size_t num_fields = _schema->num_fields();
     if (_block.columns() != num_fields) {
@@ -99,6 +198,13 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
         _cur_type = _block.get_by_position(idx).type;
         auto column = _cur_col->convert_to_full_column_if_const();
         auto arrow_type = _schema->field(idx)->type();
+        if (_share_column_buffers) {
+            bool shared = false;
+            RETURN_IF_ERROR(_share_column(column, arrow_type, &_arrays[idx], &shared));
+            if (shared) {
+                continue;
+            }
+        }
         if (arrow_type->name() == "utf8" && column->byte_size() >= MAX_ARROW_UTF8) {
             arrow_type = arrow::large_utf8();
         }
@@ -129,8 +235,8 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj) {
-    FromBlockConverter converter(block, schema, pool, timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool share_column_buffers) {
+    FromBlockConverter converter(block, schema, pool, timezone_obj, share_column_buffers);
     return converter.convert(result);
 }
 
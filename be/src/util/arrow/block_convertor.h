@@ -38,9 +38,13 @@ class Schema;
 
 namespace doris {
 
+// If `share_column_buffers` is true, the arrays of the fixed width numeric columns use the data
+// of the columns without copying it and keep the columns alive, the caller must not modify the
+// columns of `block` in place afterwards.
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj);
+                              const cctz::time_zone& timezone_obj,
+                              bool share_column_buffers = false);
 
 } // namespace doris
@@ -19,6 +19,14 @@
 
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include <array>
+
 #include "util/bit_packing.h"
 
 namespace doris {
@@ -232,6 +240,84 @@ void DecodeValue(OutType* __restrict__ dict, int64_t dict_len, uint32_t idx,
     }
 }
 
+#if defined(__AVX2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+// The SIMD unpacking of 32 bit values. Eight packed values take BIT_WIDTH bytes, they are
+// unpacked as two halves of four values. Each 32 bit lane gathers the four bytes its value
+// starts in from the 16 bytes of its half, then shifts the value down and masks it. A value
+// and its shift fit in the four bytes for bit widths up to 25, wider values are unpacked by
+// the scalar code.
+constexpr int MAX_SIMD_UNPACK_BITWIDTH = 25;
+
+struct SimdUnpackTable {
+    // byte shuffle of the low half, then of the high half
+    std::array<uint8_t, 32> shuffle {};
+    std::array<uint32_t, 8> shift {};
+};
+
+template <int BIT_WIDTH>
+constexpr SimdUnpackTable make_simd_unpack_table() {
+    SimdUnpackTable table;
+    for (int value = 0; value < 8; ++value) {
+        int half = value / 4;
+        int half_first_byte = half * 4 * BIT_WIDTH / CHAR_BIT;
+        int first_bit = value * BIT_WIDTH;
+        int first_byte = first_bit / CHAR_BIT - half_first_byte;
+        for (int byte = 0; byte < 4; ++byte) {
+            table.shuffle[value * 4 + byte] = static_cast<uint8_t>(first_byte + byte);
+        }
+        table.shift[value] = first_bit % CHAR_BIT;
+    }
+    return table;
+}
+
+template <int BIT_WIDTH>
+inline constexpr SimdUnpackTable SIMD_UNPACK_TABLE = make_simd_unpack_table<BIT_WIDTH>();
+
+// The end of the last 16 byte load, relative to the first byte of the 32 values.
+template <int BIT_WIDTH>
+constexpr int64_t simd_unpack_bytes_to_read() {
+    return 3 * BIT_WIDTH + 4 * BIT_WIDTH / CHAR_BIT + 16;
+}
+
+template <int BIT_WIDTH>
+void simd_unpack_32_values(const uint8_t* __restrict__ in, uint32_t* __restrict__ out) {
+    constexpr const SimdUnpackTable& table = SIMD_UNPACK_TABLE<BIT_WIDTH>;
+    constexpr int HIGH_HALF_BYTE = 4 * BIT_WIDTH / CHAR_BIT;
+#if defined(__AVX2__)
+    const __m256i shuffle =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.shuffle.data()));
+    const __m256i shift =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.shift.data()));
+    const __m256i mask = _mm256_set1_epi32(static_cast<int32_t>(GetMask(BIT_WIDTH)));
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t* pos = in + i * BIT_WIDTH;
+        __m256i bytes = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos + HIGH_HALF_BYTE)), 1);
+        bytes = _mm256_and_si256(_mm256_srlv_epi32(_mm256_shuffle_epi8(bytes, shuffle), shift),
+                                 mask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 8), bytes);
+    }
+#else
+    const uint8x16_t low_shuffle = vld1q_u8(table.shuffle.data());
+    const uint8x16_t high_shuffle = vld1q_u8(table.shuffle.data() + 16);
+    // a negative shift is a right shift
+    const int32x4_t low_shift = vnegq_s32(vreinterpretq_s32_u32(vld1q_u32(table.shift.data())));
+    const int32x4_t high_shift =
+            vnegq_s32(vreinterpretq_s32_u32(vld1q_u32(table.shift.data() + 4)));
+    const uint32x4_t mask = vdupq_n_u32(static_cast<uint32_t>(GetMask(BIT_WIDTH)));
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t* pos = in + i * BIT_WIDTH;
+        uint32x4_t low = vreinterpretq_u32_u8(vqtbl1q_u8(vld1q_u8(pos), low_shuffle));
+        uint32x4_t high =
+                vreinterpretq_u32_u8(vqtbl1q_u8(vld1q_u8(pos + HIGH_HALF_BYTE), high_shuffle));
+        vst1q_u32(out + i * 8, vandq_u32(vshlq_u32(low, low_shift), mask));
+        vst1q_u32(out + i * 8 + 4, vandq_u32(vshlq_u32(high, high_shift), mask));
+    }
+#endif
+}
+#endif
+
 template <typename OutType, int BIT_WIDTH>
 const uint8_t* BitPacking::Unpack32Values(const uint8_t* __restrict__ in, int64_t in_bytes,
                                           OutType* __restrict__ out) {
@@ -241,6 +327,18 @@ const uint8_t* BitPacking::Unpack32Values(const uint8_t* __restrict__ in, int64_
     constexpr int BYTES_TO_READ = BitUtil::RoundUpNumBytes(32 * BIT_WIDTH);
     DCHECK_GE(in_bytes, BYTES_TO_READ);
 
+#if defined(__AVX2__) || (defined(__ARM_NEON) && defined(__aarch64__))
+    if constexpr (std::is_same_v<OutType, uint32_t> && BIT_WIDTH > 0 &&
+                  BIT_WIDTH <= MAX_SIMD_UNPACK_BITWIDTH) {
+        // the loads read past the 32 values, the last batches of a buffer are left to the
+        // scalar code
+        if (in_bytes >= simd_unpack_bytes_to_read<BIT_WIDTH>()) {
+            simd_unpack_32_values<BIT_WIDTH>(in, out);
+            return in + BYTES_TO_READ;
+        }
+    }
+#endif
+
     // Call UnpackValue for 0 <= i < 32.
 #pragma push_macro("UNPACK_VALUE_CALL")
 #define UNPACK_VALUE_CALL(ignore1, i, ignore2) \
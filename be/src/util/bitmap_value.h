@@ -664,10 +664,23 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // The 32-bit bitmaps of a high key are unioned all at once, which ORs their containers
+        // lazily and repairs the cardinalities only at the end.
+        phmap::btree_map<uint32_t, std::vector<const roaring::Roaring*>> key_bitmaps;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& [key, bitmap] : inputs[lcv]->roarings) {
+                key_bitmaps[key].push_back(&bitmap);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [key, bitmaps] : key_bitmaps) {
+            if (bitmaps.size() == 1) {
+                auto& bitmap = ans.roarings.emplace(key, *bitmaps[0]).first->second;
+                bitmap.setCopyOnWrite(ans.copyOnWrite);
+            } else {
+                ans.roarings.emplace(key,
+                                     roaring::Roaring::fastunion(bitmaps.size(), bitmaps.data()));
+            }
         }
         return ans;
     }
@@ -1278,8 +1291,11 @@ public:
                 _bitmap->add(_sv);
                 break;
             case BITMAP:
-                for (const auto* bitmap : bitmaps) {
-                    *_bitmap |= *bitmap;
+                if (bitmaps.size() == 1) {
+                    *_bitmap |= *bitmaps[0];
+                } else {
+                    bitmaps.push_back(_bitmap.get());
+                    *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
                 }
                 break;
             case SET: {
@@ -240,6 +240,9 @@ public:
     UIntGauge* arrow_flight_work_pool_max_queue_size = nullptr;
     UIntGauge* arrow_flight_work_max_threads = nullptr;
 
+    UIntGauge* load_work_pool_queue_size = nullptr;
+    UIntGauge* load_work_active_threads = nullptr;
+
     IntCounter* num_io_bytes_read_total = nullptr;
     IntCounter* num_io_bytes_read_from_cache = nullptr;
     IntCounter* num_io_bytes_read_from_remote = nullptr;
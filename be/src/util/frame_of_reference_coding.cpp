@@ -25,6 +25,7 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <type_traits>
 
 #include "common/cast_set.h"
 #include "gutil/endian.h"
@@ -606,19 +607,23 @@ void ForDecoder<T>::decode_current_frame(T* output) {
     if (is_original_value) {
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
     } else {
+        // unpack the deltas in place, then add the min value (prefix sum for ascending frames)
         bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
-        std::vector<T> delta_values(current_frame_size);
-        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, delta_values.data());
+        if (bit_width == 0) {
+            // all deltas are 0 and nothing is packed
+            std::fill(output, output + current_frame_size, T(0));
+        } else {
+            bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
+        }
         if (is_ascending) {
             T pre_value = min;
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                T value = delta_values[i] + pre_value;
-                output[i] = value;
-                pre_value = value;
+                pre_value += output[i];
+                output[i] = pre_value;
             }
         } else {
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                output[i] = delta_values[i] + min;
+                output[i] += min;
             }
         }
     }
@@ -671,6 +676,10 @@ bool ForDecoder<T>::get_batch(T* val, size_t count) {
         _current_index += _max_frame_size;
         val += _max_frame_size;
     }
+    if (frame_count > 0) {
+        // the frames above were not decoded into _out_buffer
+        _current_decoded_frame = -1;
+    }
 
     // 3. process remaining value
     size_t remaining_num = (count - padding_num) % _max_frame_size;
@@ -691,6 +700,34 @@ bool ForDecoder<T>::skip(int32_t skip_num) {
     return true;
 }
 
+template <typename T>
+bool ForDecoder<T>::frame_value_range(uint32_t frame_index, uint32_t* first, uint32_t* count,
+                                      T* min, T* max) {
+    *first = frame_index * _max_frame_size;
+    *count = frame_size(frame_index);
+    // 24-bit and 128-bit frames are not bounded
+    if constexpr (!std::is_integral_v<T> || sizeof(T) > 8) {
+        return false;
+    } else {
+        uint8_t storage_format = _storage_formats[frame_index];
+        uint8_t bit_width = _bit_widths[frame_index];
+        if (storage_format == 2 || bit_width >= 64) {
+            return false;
+        }
+        *min = decode_frame_min_value(frame_index);
+        // a frame stores value - min, an ascending frame stores the delta to the previous
+        // value and the first value is the min
+        __int128 max_delta = (static_cast<__int128>(1) << bit_width) - 1;
+        __int128 num_deltas = storage_format == 1 ? *count - 1 : 1;
+        __int128 bound = static_cast<__int128>(*min) + max_delta * num_deltas;
+        if (bound > static_cast<__int128>(std::numeric_limits<T>::max())) {
+            bound = std::numeric_limits<T>::max();
+        }
+        *max = static_cast<T>(bound);
+        return true;
+    }
+}
+
 template <typename T>
 uint32_t ForDecoder<T>::seek_last_frame_before_value(T target) {
     // first of all, find the first frame >= target
@@ -164,6 +164,15 @@ public:
 
     uint32_t count() const { return _values_num; }
 
+    uint32_t frame_count() const { return _frame_count; }
+
+    // Gets the values range [*first, *first + *count) of `frame_index`, its min value and an
+    // upper bound of its max value, from the frame metadata only.
+    // Returns false without the min and max if the frame keeps original values or is too wide
+    // to bound.
+    bool frame_value_range(uint32_t frame_index, uint32_t* first, uint32_t* count, T* min,
+                           T* max);
+
 private:
     void bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output);
 
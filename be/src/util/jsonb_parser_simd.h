@@ -61,6 +61,7 @@
 
 #include <cmath>
 #include <limits>
+#include <string>
 
 #include "common/status.h"
 #include "jsonb_document.h"
@@ -71,6 +72,10 @@ namespace doris {
 #include "common/compile_check_begin.h"
 using int128_t = __int128;
 struct JsonbParser {
+    // Documents up to this size reuse a per thread simdjson parser and padded input buffer,
+    // larger ones get their own so that a thread does not keep huge buffers alive.
+    static constexpr size_t MAX_REUSED_BUFFER_SIZE = 1 << 20;
+
     // parse a UTF-8 JSON string with length
     // will reset writer before parse
     static Status parse(const char* pch, size_t len, JsonbWriter& writer) {
@@ -78,47 +83,73 @@ struct JsonbParser {
             return Status::InternalError("Empty JSON document");
         }
         writer.reset();
+        // the jsonb of a document is about as long as its text
+        writer.getOutput()->reserve(len);
         try {
-            simdjson::ondemand::parser simdjson_parser;
-            simdjson::padded_string json_str {pch, len};
-            simdjson::ondemand::document doc = simdjson_parser.iterate(json_str);
-
-            // simdjson process top level primitive types specially
-            // so some repeated code here
-            switch (doc.type()) {
-            case simdjson::ondemand::json_type::object:
-            case simdjson::ondemand::json_type::array: {
-                RETURN_IF_ERROR(parse(doc.get_value(), writer));
-                break;
-            }
-            case simdjson::ondemand::json_type::null: {
-                if (writer.writeNull() == 0) {
-                    return Status::InternalError("writeNull failed");
-                }
-                break;
-            }
-            case simdjson::ondemand::json_type::boolean: {
-                if (writer.writeBool(doc.get_bool()) == 0) {
-                    return Status::InternalError("writeBool failed");
-                }
-                break;
-            }
-            case simdjson::ondemand::json_type::string: {
-                RETURN_IF_ERROR(write_string(doc.get_string(), writer));
-                break;
-            }
-            case simdjson::ondemand::json_type::number: {
-                RETURN_IF_ERROR(write_number(doc.get_number(), doc.raw_json_token(), writer));
-                break;
-            }
+            if (len > MAX_REUSED_BUFFER_SIZE) {
+                simdjson::ondemand::parser simdjson_parser;
+                simdjson::padded_string json_str {pch, len};
+                simdjson::ondemand::document doc = simdjson_parser.iterate(json_str);
+                return parse_document(doc, writer);
             }
+            thread_local simdjson::ondemand::parser simdjson_parser;
+            thread_local std::string json_str;
+            json_str.assign(pch, len);
+            json_str.resize(len + simdjson::SIMDJSON_PADDING);
+            simdjson::ondemand::document doc = simdjson_parser.iterate(
+                    simdjson::padded_string_view(json_str.data(), len, json_str.size()));
+            return parse_document(doc, writer);
+        } catch (simdjson::simdjson_error& e) {
+            return Status::InternalError(fmt::format("simdjson parse exception: {}", e.what()));
+        }
+    }
+
+    // Serializes a value that is being iterated by simdjson, so that a caller which already
+    // holds it, e.g. the json reader, does not need to turn it back into text and parse it again.
+    // will reset writer before parse
+    static Status parse_value(simdjson::ondemand::value value, JsonbWriter& writer) {
+        writer.reset();
+        try {
+            return parse(value, writer);
         } catch (simdjson::simdjson_error& e) {
             return Status::InternalError(fmt::format("simdjson parse exception: {}", e.what()));
         }
-        return Status::OK();
     }
 
 private:
+    static Status parse_document(simdjson::ondemand::document& doc, JsonbWriter& writer) {
+        // simdjson process top level primitive types specially
+        // so some repeated code here
+        switch (doc.type()) {
+        case simdjson::ondemand::json_type::object:
+        case simdjson::ondemand::json_type::array: {
+            RETURN_IF_ERROR(parse(doc.get_value(), writer));
+            break;
+        }
+        case simdjson::ondemand::json_type::null: {
+            if (writer.writeNull() == 0) {
+                return Status::InternalError("writeNull failed");
+            }
+            break;
+        }
+        case simdjson::ondemand::json_type::boolean: {
+            if (writer.writeBool(doc.get_bool()) == 0) {
+                return Status::InternalError("writeBool failed");
+            }
+            break;
+        }
+        case simdjson::ondemand::json_type::string: {
+            RETURN_IF_ERROR(write_string(doc.get_string(), writer));
+            break;
+        }
+        case simdjson::ondemand::json_type::number: {
+            RETURN_IF_ERROR(write_number(doc.get_number(), doc.raw_json_token(), writer));
+            break;
+        }
+        }
+        return Status::OK();
+    }
+
     // parse json, recursively if necessary, by simdjson
     //  and serialize to binary format by writer
     static Status parse(simdjson::ondemand::value value, JsonbWriter& writer) {
@@ -156,6 +156,13 @@ public:
         size_ += len;
     }
 
+    // make room for at least `len` more bytes, so a writer of known size does not grow step by step
+    void reserve(uint64_t len) {
+        if (size_ + len > capacity_) {
+            realloc(len);
+        }
+    }
+
     pos_type tellp() const { return size_; }
 
     void seekp(pos_type pos) { size_ = (uint64_t)pos; }
@@ -560,6 +560,26 @@ char* MysqlRowBuffer<is_binary_format>::reserved(int64_t size) {
     return old_buf;
 }
 
+template <typename T>
+void encode_int_fields(const T* data, const uint8_t* null_map, size_t num_rows, std::string* buf,
+                       std::vector<size_t>* offsets) {
+    // 1 for length, 1 for sign, other for digits
+    buf->resize(num_rows * (2 + MAX_BIGINT_WIDTH));
+    offsets->resize(num_rows + 1);
+    char* begin = buf->data();
+    char* pos = begin;
+    for (size_t i = 0; i < num_rows; ++i) {
+        (*offsets)[i] = pos - begin;
+        if (null_map != nullptr && null_map[i]) {
+            int1store(pos++, 251);
+        } else {
+            pos = add_int(data[i], pos, false);
+        }
+    }
+    (*offsets)[num_rows] = pos - begin;
+    buf->resize(pos - begin);
+}
+
 template class MysqlRowBuffer<true>;
 template class MysqlRowBuffer<false>;
 
@@ -576,4 +596,17 @@ template int MysqlRowBuffer<false>::push_vec_datetime<DateV2Value<DateTimeV2Valu
 template int MysqlRowBuffer<false>::push_vec_datetime<VecDateTimeValue>(VecDateTimeValue& value,
                                                                         int scale);
 
+template void encode_int_fields<int8_t>(const int8_t* data, const uint8_t* null_map,
+                                        size_t num_rows, std::string* buf,
+                                        std::vector<size_t>* offsets);
+template void encode_int_fields<int16_t>(const int16_t* data, const uint8_t* null_map,
+                                         size_t num_rows, std::string* buf,
+                                         std::vector<size_t>* offsets);
+template void encode_int_fields<int32_t>(const int32_t* data, const uint8_t* null_map,
+                                         size_t num_rows, std::string* buf,
+                                         std::vector<size_t>* offsets);
+template void encode_int_fields<int64_t>(const int64_t* data, const uint8_t* null_map,
+                                         size_t num_rows, std::string* buf,
+                                         std::vector<size_t>* offsets);
+
 } // namespace doris
@@ -19,6 +19,9 @@
 
 #include <stdint.h>
 
+#include <string>
+#include <vector>
+
 namespace doris {
 
 /**
@@ -147,4 +150,11 @@ private:
     uint32_t _field_count = 0;
 };
 
+// Encodes the integers of a column as text protocol fields one after another, the field of
+// row i is [offsets[i], offsets[i + 1]) of `buf`. The rows set in `null_map` are null, it may be
+// nullptr. The result writer copies the fields into the rows instead of formatting cell by cell.
+template <typename T>
+void encode_int_fields(const T* data, const uint8_t* null_map, size_t num_rows, std::string* buf,
+                       std::vector<size_t>* offsets);
+
 } // namespace doris
@@ -89,12 +89,14 @@ public:
 
     bool lookup(const ObjKey& key, CacheHandle* handle);
 
+    // `tracking_bytes` is the memory the value holds, which is tracked by the cache.
     template <typename T>
-    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle) {
+    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle,
+                size_t tracking_bytes = sizeof(T)) {
         if (_enabled) {
             const std::string& encoded_key = key.key;
             auto* obj_value = new ObjValue<T>(value);
-            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, 1, sizeof(T),
+            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, 1, tracking_bytes,
                                                   CachePriority::NORMAL);
             *cache_handle = CacheHandle {this, handle};
         } else {
@@ -599,4 +599,62 @@ void PerfCounters::get_proc_status(ProcStatus* out) {
     out->vm_hwm = parse_bytes("status/VmHWM");
 }
 
+namespace {
+// The hardware counters of a thread in one group, so they are read with one syscall.
+struct ThreadPerfEventGroup {
+    ThreadPerfEventGroup() {
+        // in the order of ThreadPerfCounters::Values
+        for (auto config : {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                            PERF_COUNT_HW_CACHE_MISSES}) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(perf_event_attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.read_format = PERF_FORMAT_GROUP;
+            // allowed without privileges unless perf_event_paranoid is 3
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            auto fd = sys_perf_event_open(&attr, 0, -1, group_fd, 0);
+            if (fd < 0) {
+                close_all();
+                return;
+            }
+            if (group_fd == -1) {
+                group_fd = static_cast<int>(fd);
+            }
+            fds.push_back(static_cast<int>(fd));
+        }
+    }
+
+    ~ThreadPerfEventGroup() { close_all(); }
+
+    void close_all() {
+        for (auto fd : fds) {
+            close(fd);
+        }
+        fds.clear();
+        group_fd = -1;
+    }
+
+    int group_fd = -1;
+    std::vector<int> fds;
+};
+} // namespace
+
+bool ThreadPerfCounters::read(Values* values) {
+    static thread_local ThreadPerfEventGroup group;
+    if (group.group_fd < 0) {
+        return false;
+    }
+    // the number of counters followed by their values
+    uint64_t buffer[4];
+    if (::read(group.group_fd, buffer, sizeof(buffer)) != sizeof(buffer)) {
+        return false;
+    }
+    values->cpu_cycles = static_cast<int64_t>(buffer[1]);
+    values->instructions = static_cast<int64_t>(buffer[2]);
+    values->cache_misses = static_cast<int64_t>(buffer[3]);
+    return true;
+}
+
 } // namespace doris
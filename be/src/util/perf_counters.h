@@ -173,4 +173,74 @@ private:
     static int64_t _vm_peak;
 };
 
+// Hardware counters of the calling thread, e.g. for the code of one operator running in it.
+class ThreadPerfCounters {
+public:
+    struct Values {
+        int64_t cpu_cycles = 0;
+        int64_t instructions = 0;
+        int64_t cache_misses = 0;
+
+        Values& operator+=(const Values& other) {
+            cpu_cycles += other.cpu_cycles;
+            instructions += other.instructions;
+            cache_misses += other.cache_misses;
+            return *this;
+        }
+        Values& operator-=(const Values& other) {
+            cpu_cycles -= other.cpu_cycles;
+            instructions -= other.instructions;
+            cache_misses -= other.cache_misses;
+            return *this;
+        }
+    };
+
+    // Opens the counters of the thread on the first call. Returns false if they are not
+    // available, e.g. perf_event_open is not permitted.
+    static bool read(Values* values);
+};
+
+// Adds the counters of the calling thread from construction to destruction to `*values`,
+// except for the scopes nested in it which count for themselves. Does nothing if `values` is
+// nullptr.
+class ScopedThreadPerfCounters {
+public:
+    explicit ScopedThreadPerfCounters(ThreadPerfCounters::Values* values) : _values(values) {
+        if (_values == nullptr) {
+            return;
+        }
+        if (!ThreadPerfCounters::read(&_start)) {
+            _values = nullptr;
+            return;
+        }
+        _parent = _current;
+        _current = this;
+    }
+
+    ~ScopedThreadPerfCounters() {
+        if (_values == nullptr) {
+            return;
+        }
+        ThreadPerfCounters::Values end;
+        _current = _parent;
+        if (!ThreadPerfCounters::read(&end)) {
+            return;
+        }
+        end -= _start;
+        if (_parent != nullptr) {
+            _parent->_nested += end;
+        }
+        end -= _nested;
+        *_values += end;
+    }
+
+private:
+    ThreadPerfCounters::Values* _values;
+    ThreadPerfCounters::Values _start;
+    ThreadPerfCounters::Values _nested;
+    ScopedThreadPerfCounters* _parent = nullptr;
+
+    static inline thread_local ScopedThreadPerfCounters* _current = nullptr;
+};
+
 } // namespace doris
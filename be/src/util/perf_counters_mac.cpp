@@ -27,4 +27,8 @@ int64_t PerfCounters::_vm_size = 0;
 
 void PerfCounters::refresh_proc_status() {}
 
+bool ThreadPerfCounters::read(Values* values) {
+    return false;
+}
+
 } // namespace doris
@@ -125,6 +125,34 @@ void iterate_through_bits_mask(Func func, decltype(bytes_mask_to_bits_mask(nullp
 #endif
 }
 
+// Bits mask of the bytes equal to `c` in data[0, 16), walk it with iterate_through_bits_mask
+// or find_first_in_bits_mask.
+inline auto bytes16_eq_mask(const char* data, char c)
+        -> decltype(bytes_mask_to_bits_mask(nullptr)) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return get_nibble_mask(vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data)),
+                                    vdupq_n_u8(static_cast<uint8_t>(c))));
+#elif defined(__SSE2__)
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_set1_epi8(c))));
+#else
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < 16; ++i) {
+        mask |= static_cast<uint32_t>(data[i] == c) << i;
+    }
+    return mask;
+#endif
+}
+
+// Index of the first byte set in a non-zero mask from bytes16_eq_mask.
+inline std::size_t find_first_in_bits_mask(decltype(bytes_mask_to_bits_mask(nullptr)) mask) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return __builtin_ctzll(mask) >> 2;
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
 template <typename T>
     requires requires { std::is_unsigned_v<T>; }
 inline T count_zero_num(const int8_t* __restrict data, T size) {
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/timezone_transition_cache.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+static cctz::time_point<cctz::seconds> to_time_point(int64_t utc_seconds) {
+    return std::chrono::time_point_cast<cctz::seconds>(std::chrono::system_clock::from_time_t(0)) +
+           cctz::seconds(utc_seconds);
+}
+
+static int64_t to_unix_seconds(const cctz::time_point<cctz::seconds>& tp) {
+    return tp.time_since_epoch().count();
+}
+
+int64_t TimezoneTransitionCache::_lookup_local(int64_t local_seconds) {
+    const auto cl = _ctz.lookup(to_civil(local_seconds));
+    if (cl.kind == cctz::time_zone::civil_lookup::SKIPPED) {
+        return to_unix_seconds(cl.trans);
+    }
+    const int64_t utc_seconds = to_unix_seconds(cl.pre);
+    if (cl.kind != cctz::time_zone::civil_lookup::UNIQUE) {
+        return utc_seconds;
+    }
+
+    // Local times stay unique with this offset until the civil times around the neighbour
+    // transitions, whichever side of a gap or an overlap comes first.
+    cctz::time_zone::civil_transition trans;
+    _local_offset = local_seconds - utc_seconds;
+    _local_begin = std::numeric_limits<int64_t>::min();
+    if (_ctz.prev_transition(cl.pre + cctz::seconds(1), &trans)) {
+        _local_begin = std::max(to_local_seconds(trans.from), to_local_seconds(trans.to));
+    }
+    _local_end = std::numeric_limits<int64_t>::max();
+    if (_ctz.next_transition(cl.pre, &trans)) {
+        _local_end = std::min(to_local_seconds(trans.from), to_local_seconds(trans.to));
+    }
+    return utc_seconds;
+}
+
+int64_t TimezoneTransitionCache::_lookup_utc(int64_t utc_seconds) {
+    const auto tp = to_time_point(utc_seconds);
+    const auto al = _ctz.lookup(tp);
+    const int64_t local_seconds = to_local_seconds(al.cs);
+
+    // civil_transition.to of the previous transition and civil_transition.from of the next
+    // one are both expressed in the current offset
+    cctz::time_zone::civil_transition trans;
+    _utc_offset = local_seconds - utc_seconds;
+    _utc_begin = std::numeric_limits<int64_t>::min();
+    if (_ctz.prev_transition(tp + cctz::seconds(1), &trans)) {
+        _utc_begin = to_local_seconds(trans.to) - _utc_offset;
+    }
+    _utc_end = std::numeric_limits<int64_t>::max();
+    if (_ctz.next_transition(tp, &trans)) {
+        _utc_end = to_local_seconds(trans.from) - _utc_offset;
+    }
+    return local_seconds;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Converts between unix seconds and local seconds (seconds since the civil epoch
+// 1970-01-01 00:00:00) of one time zone, remembering the transition-free range of the last
+// cctz lookup. Values of a batch are mostly close to each other, so after the first row the
+// conversion is a range check and an add. Not thread safe, create one per batch.
+class TimezoneTransitionCache {
+public:
+    explicit TimezoneTransitionCache(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    static int64_t to_local_seconds(const cctz::civil_second& cs) {
+        return cs - cctz::civil_second();
+    }
+
+    static cctz::civil_second to_civil(int64_t local_seconds) {
+        return cctz::civil_second() + local_seconds;
+    }
+
+    // same as cctz::convert(civil_second, ctz)
+    int64_t local_to_utc(int64_t local_seconds) {
+        if (local_seconds >= _local_begin && local_seconds < _local_end) [[likely]] {
+            return local_seconds - _local_offset;
+        }
+        return _lookup_local(local_seconds);
+    }
+
+    // same as cctz::convert(time_point, ctz)
+    int64_t utc_to_local(int64_t utc_seconds) {
+        if (utc_seconds >= _utc_begin && utc_seconds < _utc_end) [[likely]] {
+            return utc_seconds + _utc_offset;
+        }
+        return _lookup_utc(utc_seconds);
+    }
+
+private:
+    int64_t _lookup_local(int64_t local_seconds);
+    int64_t _lookup_utc(int64_t utc_seconds);
+
+    const cctz::time_zone& _ctz;
+
+    // local seconds in [_local_begin, _local_end) map to exactly one instant at _local_offset
+    int64_t _local_begin = std::numeric_limits<int64_t>::max();
+    int64_t _local_end = std::numeric_limits<int64_t>::min();
+    int64_t _local_offset = 0;
+
+    // unix seconds in [_utc_begin, _utc_end) are shown at _utc_offset
+    int64_t _utc_begin = std::numeric_limits<int64_t>::max();
+    int64_t _utc_end = std::numeric_limits<int64_t>::min();
+    int64_t _utc_offset = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
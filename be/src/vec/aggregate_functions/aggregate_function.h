@@ -252,6 +252,11 @@ public:
     /// sum[i] = sum[i-1] - col[x] + col[y]
     virtual bool supported_incremental_mode() const { return false; }
 
+    /// some agg function like count/min/max could calculate a sliding frame by merging the states
+    /// of its parts in order, eg max(col) over (rows between 3 preceding and 3 following),
+    /// the result of merging the parts must be the same as adding all rows of the frame
+    virtual bool supported_sliding_frame_merge() const { return false; }
+
     /**
     * Executes the aggregate function in incremental mode.
     * This is a virtual function that should be overridden by aggregate functions supporting incremental calculation.
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -186,14 +187,11 @@ public:
     }
 
     void deserialize_and_merge_from_column(AggregateDataPtr __restrict place, const IColumn& column,
-                                           Arena&) const override {
-        auto& col = assert_cast<const ColumnBitmap&>(column);
-        const size_t num_rows = column.size();
-        auto* data = col.get_data().data();
-
-        for (size_t i = 0; i != num_rows; ++i) {
-            this->data(place).merge(data[i]);
+                                           Arena& arena) const override {
+        if (column.empty()) {
+            return;
         }
+        deserialize_and_merge_from_column_range(place, column, 0, column.size() - 1, arena);
     }
 
     void deserialize_and_merge_from_column_range(AggregateDataPtr __restrict place,
@@ -203,8 +201,16 @@ public:
                 << ", begin:" << begin << ", end:" << end << ", column.size():" << column.size();
         auto& col = assert_cast<const ColumnBitmap&>(column);
         auto* data = col.get_data().data();
-        for (size_t i = begin; i <= end; ++i) {
-            this->data(place).merge(data[i]);
+        if constexpr (is_union) {
+            std::vector<const BitmapValue*> values(end - begin + 1);
+            for (size_t i = begin; i <= end; ++i) {
+                values[i - begin] = &data[i];
+            }
+            this->data(place).add_batch(values);
+        } else {
+            for (size_t i = begin; i <= end; ++i) {
+                this->data(place).merge(data[i]);
+            }
         }
     }
 
@@ -248,6 +254,18 @@ public:
 
 protected:
     using IAggregateFunction::version;
+
+    static constexpr bool is_union =
+            std::is_same_v<Data, AggregateFunctionBitmapData<AggregateFunctionBitmapUnionOp>>;
+
+    // Unions the bitmaps of the rows [begin, end] all at once rather than one row at a time.
+    void add_range_by_batch(AggregateDataPtr __restrict place, const IColumn** columns,
+                            size_t begin, size_t end, Arena& arena) const {
+        std::vector<int> rows(end - begin + 1);
+        std::iota(rows.begin(), rows.end(), static_cast<int>(begin));
+        assert_cast<const Derived*, TypeCheckOnRelease::DISABLE>(this)->add_many(place, columns,
+                                                                                rows, arena);
+    }
 };
 
 template <typename Op>
@@ -287,6 +305,30 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena& arena) const override {
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            if (batch_size > 0) {
+                this->add_range_by_batch(place, columns, 0, batch_size - 1, arena);
+            }
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, i, arena);
+            }
+        }
+    }
+
+    void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                         const IColumn** columns, Arena& arena, bool has_null) override {
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            this->add_range_by_batch(place, columns, batch_begin, batch_end, arena);
+        } else {
+            for (size_t i = batch_begin; i <= batch_end; ++i) {
+                add(place, columns, i, arena);
+            }
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         this->data(place).merge(
@@ -368,6 +410,30 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena& arena) const override {
+        if constexpr (std::is_same_v<ColVecType, ColumnBitmap>) {
+            if (batch_size > 0) {
+                this->add_range_by_batch(place, columns, 0, batch_size - 1, arena);
+            }
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, i, arena);
+            }
+        }
+    }
+
+    void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                         const IColumn** columns, Arena& arena, bool has_null) override {
+        if constexpr (std::is_same_v<ColVecType, ColumnBitmap>) {
+            this->add_range_by_batch(place, columns, batch_begin, batch_end, arena);
+        } else {
+            for (size_t i = batch_begin; i <= batch_end; ++i) {
+                add(place, columns, i, arena);
+            }
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         this->data(place).merge(const_cast<AggFunctionData&>(this->data(rhs)).get());
@@ -37,6 +37,7 @@
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_fixed_length_object.h"
 #include "vec/data_types/data_type_number.h"
+#include "util/simd/bits.h"
 #include "vec/io/var_int.h"
 
 namespace doris::vectorized {
@@ -64,10 +65,17 @@ public:
         ++data(place).count;
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn**,
+                                Arena&) const override {
+        data(place).count += batch_size;
+    }
+
     void reset(AggregateDataPtr place) const override {
         AggregateFunctionCount::data(place).count = 0;
     }
 
+    bool supported_sliding_frame_merge() const override { return true; }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         data(place).count += data(rhs).count;
@@ -213,8 +221,19 @@ public:
                          .is_null_at(row_num);
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena&) const override {
+        const auto& null_map =
+                assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_null_map_data();
+        data(place).count +=
+                simd::count_zero_num(reinterpret_cast<const int8_t*>(null_map.data()), batch_size);
+    }
+
     void reset(AggregateDataPtr place) const override { data(place).count = 0; }
 
+    bool supported_sliding_frame_merge() const override { return true; }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         data(place).count += data(rhs).count;
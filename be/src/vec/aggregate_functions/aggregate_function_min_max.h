@@ -94,6 +94,27 @@ public:
                                 value);
     }
 
+    // change_if over the rows [0, batch_size), with the running value out of the state so that
+    // the loop is a plain reduction that vectorizes
+    void change_if_batch(const IColumn& column, size_t batch_size, bool less) {
+        const auto* __restrict data = assert_cast<const typename PrimitiveTypeTraits<T>::ColumnType&,
+                                                  TypeCheckOnRelease::DISABLE>(column)
+                                              .get_data()
+                                              .data();
+        auto result = value;
+        if (less) {
+            for (size_t i = 0; i < batch_size; ++i) {
+                result = std::min(data[i], result);
+            }
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                result = std::max(data[i], result);
+            }
+        }
+        has_value |= batch_size > 0;
+        value = result;
+    }
+
     void insert_result_into(IColumn& to) const {
         if (has()) {
             assert_cast<typename PrimitiveTypeTraits<T>::ColumnType&>(to).get_data().push_back(
@@ -529,6 +550,13 @@ struct AggregateFunctionMaxData : public Data {
         }
     }
 
+    static constexpr bool HAS_BATCH_CHANGE = requires(Data data, const IColumn& column) {
+        data.change_if_batch(column, 0, false);
+    };
+    void change_if_better_batch(const IColumn& column, size_t batch_size) {
+        this->change_if_batch(column, batch_size, false);
+    }
+
     void change_if_better(const Self& to, Arena& arena) { this->change_if_greater(to, arena); }
 
     void reset() {
@@ -556,6 +584,13 @@ struct AggregateFunctionMinData : Data {
             this->change_if_less(column, row_num, arena);
         }
     }
+
+    static constexpr bool HAS_BATCH_CHANGE = requires(Data data, const IColumn& column) {
+        data.change_if_batch(column, 0, true);
+    };
+    void change_if_better_batch(const IColumn& column, size_t batch_size) {
+        this->change_if_batch(column, batch_size, true);
+    }
     void change_if_better(const Self& to, Arena& arena) { this->change_if_less(to, arena); }
 
     void reset() {
@@ -715,6 +750,8 @@ public:
         if constexpr (Data::IS_ANY) {
             DCHECK_GT(batch_size, 0);
             this->data(place).change_if_better(*columns[0], 0, arena);
+        } else if constexpr (Data::HAS_BATCH_CHANGE) {
+            this->data(place).change_if_better_batch(*columns[0], batch_size);
         } else {
             Base::add_batch_single_place(batch_size, place, columns, arena);
         }
@@ -858,6 +895,8 @@ public:
 
     bool supported_incremental_mode() const override { return !(Data::IS_ANY); }
 
+    bool supported_sliding_frame_merge() const override { return true; }
+
     void execute_function_with_incremental(int64_t partition_start, int64_t partition_end,
                                            int64_t frame_start, int64_t frame_end,
                                            AggregateDataPtr place, const IColumn** columns,
@@ -323,6 +323,10 @@ public:
         return this->nested_function->supported_incremental_mode();
     }
 
+    bool supported_sliding_frame_merge() const override {
+        return this->nested_function->supported_sliding_frame_merge();
+    }
+
     void execute_function_with_incremental(int64_t partition_start, int64_t partition_end,
                                            int64_t frame_start, int64_t frame_end,
                                            AggregateDataPtr place, const IColumn** columns,
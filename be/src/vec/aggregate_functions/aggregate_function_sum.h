@@ -100,6 +100,36 @@ public:
                 typename PrimitiveTypeTraits<TResult>::ColumnItemType(column.get_data()[row_num]));
     }
 
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn** columns, Arena&, bool /*agg_many*/) const override {
+        const auto* __restrict data =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_data()
+                        .data();
+        for (size_t i = 0; i < batch_size; ++i) {
+            this->data(places[i] + place_offset)
+                    .add(typename PrimitiveTypeTraits<TResult>::ColumnItemType(data[i]));
+        }
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena&) const override {
+        const auto* __restrict data =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_data()
+                        .data();
+        // the running sum is kept out of the state, the loop is then a plain reduction that
+        // vectorizes
+        typename PrimitiveTypeTraits<TResult>::ColumnItemType sum {};
+        for (size_t i = 0; i < batch_size; ++i) {
+#ifdef __clang__
+#pragma clang fp reassociate(on)
+#endif
+            sum += typename PrimitiveTypeTraits<TResult>::ColumnItemType(data[i]);
+        }
+        this->data(place).add(sum);
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).sum = {}; }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
@@ -623,11 +623,21 @@ void ColumnVariant::Subcolumn::finalize(FinalizeMode mode) {
                               : std::make_shared<MostCommonType>();
         least_common_type = LeastCommonType {to_type};
     }
-    auto result_column = to_type->create_column();
-    if (num_of_defaults_in_prefix) {
+    const size_t total_rows = size();
+    MutableColumnPtr result_column;
+    size_t i = 0;
+    if (num_of_defaults_in_prefix == 0 && !data.empty() && data_types[0]->equals(*to_type)) {
+        // the first part is usually the largest, append the others to it instead of copying it
+        ColumnPtr first = data[0]->convert_to_full_column_if_const();
+        data[0] = ColumnPtr();
+        result_column = IColumn::mutate(std::move(first));
+        i = 1;
+    } else {
+        result_column = to_type->create_column();
         result_column->insert_many_defaults(num_of_defaults_in_prefix);
     }
-    for (size_t i = 0; i < data.size(); ++i) {
+    result_column->reserve(total_rows);
+    for (; i < data.size(); ++i) {
         auto& part = data[i];
         auto from_type = data_types[i];
         part = part->convert_to_full_column_if_const();
@@ -826,9 +836,34 @@ void ColumnVariant::insert_from(const IColumn& src, size_t n) {
         ++num_rows;
         return;
     }
+    if (src_v != nullptr && has_same_finalized_subcolumns(*src_v)) {
+        for (const auto& entry : src_v->subcolumns) {
+            get_subcolumn(entry->path)
+                    ->get_finalized_column()
+                    .insert_from(entry->data.get_finalized_column(), n);
+        }
+        ++num_rows;
+        return;
+    }
     return try_insert(src[n]);
 }
 
+bool ColumnVariant::has_same_finalized_subcolumns(const ColumnVariant& src) const {
+    if (subcolumns.size() != src.subcolumns.size() || !sparse_columns.empty() ||
+        !src.sparse_columns.empty()) {
+        return false;
+    }
+    for (const auto& entry : src.subcolumns) {
+        const auto* subcolumn = get_subcolumn(entry->path);
+        if (subcolumn == nullptr || subcolumn->data.size() != 1 || entry->data.data.size() != 1 ||
+            !subcolumn->is_finalized() || !entry->data.is_finalized() ||
+            !subcolumn->get_least_common_type()->equals(*entry->data.get_least_common_type())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void ColumnVariant::try_insert(const Field& field) {
     if (field.get_type() != PrimitiveType::TYPE_VARIANT) {
         if (field.is_null()) {
@@ -1869,6 +1904,14 @@ void ColumnVariant::insert_indices_from(const IColumn& src, const uint32_t* indi
                src_v->get_root_type()->equals(*get_root_type())) {
         get_root()->insert_indices_from(*src_v->get_root(), indices_begin, indices_end);
         num_rows += indices_end - indices_begin;
+    } else if (src_v != nullptr && has_same_finalized_subcolumns(*src_v)) {
+        for (const auto& entry : src_v->subcolumns) {
+            get_subcolumn(entry->path)
+                    ->get_finalized_column()
+                    .insert_indices_from(entry->data.get_finalized_column(), indices_begin,
+                                         indices_end);
+        }
+        num_rows += indices_end - indices_begin;
     } else {
         for (const auto* x = indices_begin; x != indices_end; ++x) {
             try_insert(src[*x]);
@@ -485,6 +485,10 @@ private:
     // May throw execption
     void try_insert(const Field& field);
 
+    // Whether both columns are finalized with the same subcolumn paths and types, so that rows
+    // can be appended subcolumn by subcolumn instead of through `Field`s.
+    bool has_same_finalized_subcolumns(const ColumnVariant& src) const;
+
     /// It's used to get shared sized of Nested to insert correct default values.
     const Subcolumns::Node* get_leaf_of_the_same_nested(const Subcolumns::NodePtr& entry) const;
 
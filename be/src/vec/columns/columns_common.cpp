@@ -149,15 +149,28 @@ void filter_arrays_impl_generic(const PaddedPODArray<T>& src_elems,
     const size_t size = src_offsets.size();
     column_match_filter_size(size, filt.size());
 
-    constexpr int ASSUME_STRING_LENGTH = 5;
+    // Above this average size of arrays, the exact size of the result is counted before copying,
+    // reallocating or over-reserving large values costs far more than a pass over the offsets.
+    constexpr size_t EXACT_RESERVE_ARRAY_SIZE = 256;
     ResultOffsetsBuilder result_offsets_builder(res_offsets);
 
     result_offsets_builder.reserve(result_size_hint, size);
 
-    if (result_size_hint < 0) {
-        res_elems.reserve(src_elems.size() * ASSUME_STRING_LENGTH);
+    if (size == 0) {
+        // nothing to reserve
+    } else if (src_elems.size() / size >= EXACT_RESERVE_ARRAY_SIZE) {
+        size_t res_elems_size = 0;
+        OT prev_offset = 0;
+        for (size_t i = 0; i < size; ++i) {
+            res_elems_size += filt[i] ? src_offsets[i] - prev_offset : 0;
+            prev_offset = src_offsets[i];
+        }
+        res_elems.reserve(res_elems.size() + res_elems_size);
+    } else if (result_size_hint < 0) {
+        res_elems.reserve(src_elems.size());
     } else if (result_size_hint < 1000000000 && src_elems.size() < 1000000000) { /// Avoid overflow.
-        res_elems.reserve(result_size_hint * ASSUME_STRING_LENGTH);
+        res_elems.reserve((static_cast<size_t>(result_size_hint) * src_elems.size() + size - 1) /
+                          size);
     }
 
     const UInt8* filt_pos = filt.data();
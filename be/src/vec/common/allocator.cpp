@@ -18,6 +18,11 @@
 #include "vec/common/allocator.h"
 
 #include <glog/logging.h>
+#if defined(OS_LINUX)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <atomic>
 // IWYU pragma: no_include <bits/chrono.h>
@@ -26,6 +31,7 @@
 #include <new>
 #include <random>
 #include <thread>
+#include <vector>
 
 // Allocator is used by too many files. For compilation speed, put dependencies in `.cpp` as much as possible.
 #include "common/compiler_util.h"
@@ -36,6 +42,7 @@
 #include "runtime/memory/thread_mem_tracker_mgr.h"
 #include "runtime/process_profile.h"
 #include "runtime/thread_context.h"
+#include "util/cpu_info.h"
 #include "util/mem_info.h"
 #include "util/pretty_printer.h"
 #include "util/stack_util.h"
@@ -45,6 +52,36 @@ namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+// mbind(2) without libnuma. It only places the pages faulted later, and a failure leaves the range
+// on the node of the first touch, so the result is ignored.
+static void interleave_numa_nodes(void* buf, size_t size) {
+#if defined(OS_LINUX)
+    if (doris::config::numa_interleave_alloc_threshold <= 0 ||
+        static_cast<int64_t>(size) < doris::config::numa_interleave_alloc_threshold) {
+        return;
+    }
+    constexpr int BITS_PER_WORD = sizeof(unsigned long) * 8;
+    const int num_nodes = CpuInfo::get_max_num_numa_nodes();
+    if (num_nodes <= 1) {
+        return;
+    }
+    std::vector<unsigned long> nodemask((num_nodes + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+    for (int node = 0; node < num_nodes; ++node) {
+        nodemask[node / BITS_PER_WORD] |= 1UL << (node % BITS_PER_WORD);
+    }
+    // only the pages entirely inside the range, the others may be shared with other allocations
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    auto begin = (reinterpret_cast<uintptr_t>(buf) + page_size - 1) / page_size * page_size;
+    auto end = (reinterpret_cast<uintptr_t>(buf) + size) / page_size * page_size;
+    if (begin >= end) {
+        return;
+    }
+    // the kernel takes one bit less than maxnode
+    static_cast<void>(syscall(SYS_mbind, begin, end - begin, MPOL_INTERLEAVE, nodemask.data(),
+                              static_cast<unsigned long>(num_nodes) + 1, 0));
+#endif
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator,
           bool check_and_tracking_memory>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
@@ -327,6 +364,13 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
         if constexpr (MemoryAllocator::need_record_actual_size()) {
             record_size = MemoryAllocator::allocated_size(buf);
         }
+#if defined(OS_LINUX)
+        // A failure only leaves the range on normal pages, so the result is ignored. The advice
+        // is kept by the range when it is moved by mremap.
+        if (doris::config::enable_huge_page_for_mmap_alloc) {
+            static_cast<void>(madvise(buf, size, MADV_HUGEPAGE));
+        }
+#endif
 
         /// No need for zero-fill, because mmap guarantees it.
     } else {
@@ -367,6 +411,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
     if constexpr (MemoryAllocator::need_record_actual_size()) {
         consume_memory(record_size - size);
     }
+    interleave_numa_nodes(buf, size);
     return buf;
 }
 
@@ -457,6 +502,9 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
         release_memory(old_size);
     }
 
+    if (new_size > old_size) {
+        interleave_numa_nodes(buf, new_size);
+    }
     return buf;
 }
 
@@ -69,6 +69,16 @@ struct MethodBaseInner {
     void init_join_bucket_num(uint32_t num_rows, uint32_t bucket_size, const uint8_t* null_map) {
         bucket_nums.resize(num_rows);
 
+        if constexpr (requires { hash_table->direct_bucket_num(keys[0]); }) {
+            if (hash_table->is_direct_mapping()) {
+                for (uint32_t k = 0; k < num_rows; ++k) {
+                    bucket_nums[k] = null_map && null_map[k]
+                                             ? bucket_size
+                                             : hash_table->direct_bucket_num(keys[k]);
+                }
+                return;
+            }
+        }
         if (null_map == nullptr) {
             init_join_bucket_num(num_rows, bucket_size);
             return;
@@ -234,14 +244,7 @@ struct MethodSerialized : public MethodBase<TData> {
             max_one_row_byte_size += column->get_max_row_byte_size();
         }
         size_t total_bytes = max_one_row_byte_size * num_rows;
-        if (total_bytes > config::pre_serialize_keys_limit_bytes) {
-            // reach mem limit, don't serialize in batch
-            size_t keys_size = key_columns.size();
-            for (size_t i = 0; i < num_rows; ++i) {
-                input_keys[i] =
-                        serialize_keys_to_pool_contiguous(i, keys_size, key_columns, input_arena);
-            }
-        } else {
+        if (total_bytes <= config::pre_serialize_keys_limit_bytes) {
             auto* serialized_key_buffer =
                     reinterpret_cast<uint8_t*>(input_arena.alloc(total_bytes));
 
@@ -254,10 +257,53 @@ struct MethodSerialized : public MethodBase<TData> {
             for (const auto& column : key_columns) {
                 column->serialize_vec(input_keys.data(), num_rows);
             }
+        } else if (serialize_keys_with_exact_sizes(key_columns, num_rows, input_keys,
+                                                    input_arena)) {
+            // a few long strings make the longest row much longer than the others
+        } else {
+            // reach mem limit, don't serialize in batch
+            size_t keys_size = key_columns.size();
+            for (size_t i = 0; i < num_rows; ++i) {
+                input_keys[i] =
+                        serialize_keys_to_pool_contiguous(i, keys_size, key_columns, input_arena);
+            }
         }
         Base::keys = input_keys.data();
     }
 
+    // Serializes the keys in batch into a buffer of the exact size of all the rows, returns false
+    // if even that reaches the limit.
+    bool serialize_keys_with_exact_sizes(const ColumnRawPtrs& key_columns, uint32_t num_rows,
+                                          DorisVector<StringRef>& input_keys, Arena& input_arena) {
+        // the sizes of the rows are kept in `size` of the keys until the buffer is allocated
+        for (size_t i = 0; i < num_rows; ++i) {
+            input_keys[i].size = 0;
+        }
+        for (const auto& column : key_columns) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                input_keys[i].size += column->serialize_size_at(i);
+            }
+        }
+        size_t total_bytes = 0;
+        for (size_t i = 0; i < num_rows; ++i) {
+            total_bytes += input_keys[i].size;
+        }
+        if (total_bytes > config::pre_serialize_keys_limit_bytes) {
+            return false;
+        }
+
+        auto* pos = input_arena.alloc(total_bytes);
+        for (size_t i = 0; i < num_rows; ++i) {
+            input_keys[i].data = pos;
+            pos += input_keys[i].size;
+            input_keys[i].size = 0;
+        }
+        for (const auto& column : key_columns) {
+            column->serialize_vec(input_keys.data(), num_rows);
+        }
+        return true;
+    }
+
     size_t serialized_keys_size(bool is_build) const override {
         if (is_build) {
             return build_stored_keys.size() * sizeof(StringRef) + build_arena.size();
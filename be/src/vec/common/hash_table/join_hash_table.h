@@ -19,10 +19,16 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <type_traits>
 
+#include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/exception.h"
 #include "common/status.h"
+#include "exprs/block_bloom_filter.hpp"
+#include "util/bit_util.h"
 #include "vec/columns/column_filter_helper.h"
 #include "vec/common/custom_allocator.h"
 #include "vec/common/hash_table/hash.h"
@@ -45,7 +51,8 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               (_probe_filter ? _probe_filter->directory().size : 0);
     }
 
     template <int JoinOpType>
@@ -69,6 +76,34 @@ public:
 
     uint32_t get_bucket_size() const { return bucket_size; }
 
+    // Gives each integer key in [min_key, max_key] a bucket of its own when the range is at most
+    // a few times the number of buckets. The keys then need no hashing and the chains hold the
+    // rows of one key only. Bucket 0 is left empty for the probe keys out of the range. Must be
+    // called after `prepare_build` and before the bucket numbers are computed.
+    bool try_direct_mapping(Key min_key, Key max_key)
+        requires std::is_integral_v<Key>
+    {
+        uint64_t range = static_cast<uint64_t>(max_key) - static_cast<uint64_t>(min_key) + 1;
+        if (max_key < min_key || range >= uint64_t(bucket_size) * DIRECT_MAPPING_MAX_EXPANSION) {
+            return false;
+        }
+        _direct_mapping = true;
+        _direct_mapping_min_key = min_key;
+        bucket_size = static_cast<uint32_t>(range + 1);
+        first.resize(bucket_size + 1);
+        return true;
+    }
+
+    bool is_direct_mapping() const { return _direct_mapping; }
+
+    uint32_t direct_bucket_num(Key key) const
+        requires std::is_integral_v<Key>
+    {
+        // a key below the range wraps around to beyond it
+        auto offset = static_cast<uint64_t>(key) - static_cast<uint64_t>(_direct_mapping_min_key);
+        return offset < bucket_size - 1 ? static_cast<uint32_t>(offset + 1) : 0;
+    }
+
     size_t size() const { return next.size(); }
 
     DorisVector<uint8_t>& get_visited() { return visited; }
@@ -77,18 +112,80 @@ public:
 
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
                uint32_t num_elem, bool keep_null_key) {
-        build_keys = keys;
         for (uint32_t i = 1; i < num_elem; i++) {
+            // the buckets of a large build side are far apart, fetch the one a few rows ahead so
+            // that its miss overlaps with the inserts before it
+            if (LIKELY(i + HASH_MAP_PREFETCH_DIST < num_elem)) {
+                __builtin_prefetch(&first[bucket_nums[i + HASH_MAP_PREFETCH_DIST]], 1, 1);
+            }
             uint32_t bucket_num = bucket_nums[i];
             next[i] = first[bucket_num];
             first[bucket_num] = i;
         }
+        finish_build(keys, keep_null_key);
+    }
+
+    // Inserts the rows [begin, end), at the same time as other ranges of the same build. The
+    // rows of a bucket are chained in any order then, `finish_build` completes the build.
+    void build_range(const uint32_t* __restrict bucket_nums, uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            if (LIKELY(i + HASH_MAP_PREFETCH_DIST < end)) {
+                __builtin_prefetch(&first[bucket_nums[i + HASH_MAP_PREFETCH_DIST]], 1, 1);
+            }
+            std::atomic_ref<uint32_t> head(first[bucket_nums[i]]);
+            uint32_t old_head = head.load(std::memory_order_relaxed);
+            do {
+                next[i] = old_head;
+            } while (!head.compare_exchange_weak(old_head, i, std::memory_order_relaxed));
+        }
+    }
+
+    void finish_build(const Key* __restrict keys, bool keep_null_key) {
+        build_keys = keys;
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
         }
         _keep_null_key = keep_null_key;
     }
 
+    // Builds a bloom filter of the build keys, a fraction of the size of the table, that drops
+    // the probe rows without a match before they read the buckets and the build rows, which
+    // miss the cache once the table is large.
+    void build_probe_filter(const uint32_t* __restrict bucket_nums, uint32_t num_elem) {
+        // the rejected probe rows are pointed at the null bucket, which must be empty then
+        if (_keep_null_key) {
+            return;
+        }
+        auto filter = std::make_unique<BlockBloomFilter>();
+        // 16 bits per key, about 0.1% false positives
+        if (!filter->init(BitUtil::Log2Ceiling64(uint64_t(num_elem) * 2), 0).ok()) {
+            return;
+        }
+        for (uint32_t i = 1; i < num_elem; i++) {
+            if (bucket_nums[i] != bucket_size) {
+                filter->insert(_probe_filter_hash(build_keys[i]));
+            }
+        }
+        _probe_filter = std::move(filter);
+    }
+
+    bool has_probe_filter() const { return _probe_filter != nullptr; }
+
+    // Points the probe rows that the probe filter tells have no match at the empty null bucket,
+    // returns the number of them. Must be called before `pre_build_idxs`.
+    uint32_t apply_probe_filter(const Key* __restrict keys, DorisVector<uint32_t>& buckets) const {
+        DCHECK(_probe_filter);
+        uint32_t filtered = 0;
+        const size_t num_buckets = buckets.size();
+        for (size_t i = 0; i < num_buckets; ++i) {
+            if (buckets[i] != bucket_size && !_probe_filter->find(_probe_filter_hash(keys[i]))) {
+                buckets[i] = bucket_size;
+                ++filtered;
+            }
+        }
+        return filtered;
+    }
+
     template <int JoinOpType>
     auto find_batch(const Key* __restrict keys, const uint32_t* __restrict build_idx_map,
                     int probe_idx, uint32_t build_idx, int probe_rows,
@@ -211,12 +308,32 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
-        for (unsigned int& bucket : buckets) {
-            bucket = first[bucket];
+        const size_t num_buckets = buckets.size();
+        for (size_t i = 0; i < num_buckets; ++i) {
+            if (LIKELY(i + HASH_MAP_PREFETCH_DIST < num_buckets)) {
+                __builtin_prefetch(&first[buckets[i + HASH_MAP_PREFETCH_DIST]], 0, 1);
+            }
+            buckets[i] = first[buckets[i]];
         }
     }
 
 private:
+    uint32_t _probe_filter_hash(const Key& key) const {
+        size_t hash_value = hash(key);
+        return static_cast<uint32_t>(hash_value ^ (hash_value >> 32));
+    }
+
+    // Fetches the key and chain link of the first build row of the probe row
+    // HASH_MAP_PREFETCH_DIST rows ahead, so the probe does not wait on memory when it gets there.
+    ALWAYS_INLINE void _prefetch_build_row(const uint32_t* __restrict build_idx_map, int probe_idx,
+                                           int probe_rows) const {
+        if (LIKELY(probe_idx + static_cast<int>(HASH_MAP_PREFETCH_DIST) < probe_rows)) {
+            auto build_idx = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST];
+            __builtin_prefetch(&build_keys[build_idx], 0, 1);
+            __builtin_prefetch(&next[build_idx], 0, 1);
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -243,6 +360,7 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
@@ -272,6 +390,7 @@ private:
                 }
             }
 
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -328,6 +447,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -382,6 +502,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -441,6 +562,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
 
             /// If the probe key is null
@@ -460,6 +582,9 @@ private:
         return std::tuple {probe_idx, build_idx, matched_cnt, picking_null_keys};
     }
 
+    // see `try_direct_mapping`
+    static constexpr uint64_t DIRECT_MAPPING_MAX_EXPANSION = 2;
+
     const Key* __restrict build_keys;
     DorisVector<uint8_t> visited;
 
@@ -474,6 +599,9 @@ private:
     bool _has_null_key = false;
     bool _keep_null_key = false;
     bool _empty_build_side = true;
+    bool _direct_mapping = false;
+    Key _direct_mapping_min_key {};
+    std::unique_ptr<BlockBloomFilter> _probe_filter;
 };
 
 template <typename Key, typename Hash = DefaultHash<Key>>
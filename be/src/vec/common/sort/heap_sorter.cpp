@@ -20,6 +20,31 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+void HeapSortThreshold::update(const ColumnRawPtrs& sort_columns, size_t row,
+                               const SortDescription& desc) {
+    std::lock_guard l(_lock);
+    if (!_columns.empty() && compare(sort_columns, row, _columns, desc) <= 0) {
+        return;
+    }
+    Columns columns;
+    for (const auto* column : sort_columns) {
+        columns.push_back(column->cut(row, 1));
+    }
+    _columns = std::move(columns);
+}
+
+int HeapSortThreshold::compare(const ColumnRawPtrs& sort_columns, size_t row,
+                               const Columns& threshold, const SortDescription& desc) {
+    for (size_t i = 0; i < desc.size(); ++i) {
+        int res = desc[i].direction *
+                  sort_columns[i]->compare_at(row, 0, *threshold[i], desc[i].nulls_direction);
+        if (res != 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
 HeapSorter::HeapSorter(VSortExecExprs& vsort_exec_exprs, int64_t limit, int64_t offset,
                        ObjectPool* pool, std::vector<bool>& is_asc_order,
                        std::vector<bool>& nulls_first, const RowDescriptor& row_desc)
@@ -30,6 +55,9 @@ HeapSorter::HeapSorter(VSortExecExprs& vsort_exec_exprs, int64_t limit, int64_t
 Status HeapSorter::append_block(Block* block) {
     auto tmp_block = std::make_shared<Block>(block->clone_empty());
     RETURN_IF_ERROR(partial_sort(*block, *tmp_block, true));
+    if (tmp_block->rows() == 0) {
+        return Status::OK();
+    }
     _queue.push(
             MergeSortCursor(std::make_shared<MergeSortCursorImpl>(tmp_block, _sort_description)));
     _queue_row_num += tmp_block->rows();
@@ -48,9 +76,39 @@ Status HeapSorter::append_block(Block* block) {
         _queue_row_num -= current_rows;
     }
 
+    if (_threshold != nullptr && _heap_size > 0 && _queue_row_num >= _heap_size) {
+        auto [current, current_rows] = _queue.current();
+        _threshold->update(current->impl->sort_columns, current->impl->pos, _sort_description);
+    }
     return Status::OK();
 }
 
+void HeapSorter::prune_before_sort(Block& block) {
+    if (_threshold == nullptr) {
+        return;
+    }
+    auto threshold = _threshold->get();
+    if (threshold.empty()) {
+        return;
+    }
+    ColumnRawPtrs sort_columns;
+    for (const auto& desc : _sort_description) {
+        sort_columns.push_back(block.get_by_position(desc.column_number).column.get());
+    }
+    size_t rows = block.rows();
+    IColumn::Filter filter(rows);
+    size_t num_pruned = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        // in the reversed order of the heap, the rows equal to the threshold are kept
+        filter[i] = HeapSortThreshold::compare(sort_columns, i, threshold, _sort_description) >= 0;
+        num_pruned += !filter[i];
+    }
+    if (num_pruned > 0) {
+        Block::filter_block_internal(&block, filter);
+        COUNTER_UPDATE(_pruned_rows_counter, static_cast<int64_t>(num_pruned));
+    }
+}
+
 Status HeapSorter::prepare_for_read() {
     while (_queue.is_valid()) {
         auto [current, current_rows] = _queue.current();
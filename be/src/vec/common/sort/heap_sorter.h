@@ -17,11 +17,41 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include "vec/common/sort/sorter.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+// The threshold row of the HeapSorters of the parallel tasks of one sort node.
+// The heap of a task keeps limit + offset rows that go no later than its top row, so a row going
+// after the top row of any full heap can not be in the result. The threshold is the earliest of
+// the top rows, and every task drops the input rows after it before sorting them.
+class HeapSortThreshold {
+    ENABLE_FACTORY_CREATOR(HeapSortThreshold);
+
+public:
+    // The sort columns of the threshold row, empty if no heap is full yet.
+    Columns get() const {
+        std::lock_guard l(_lock);
+        return _columns;
+    }
+
+    // Sets the threshold to row `row` of `sort_columns` if it goes after the threshold in the
+    // order of `desc`, which is the reversed sort order of the heaps.
+    void update(const ColumnRawPtrs& sort_columns, size_t row, const SortDescription& desc);
+
+    // Compares row `row` of `sort_columns` with the threshold row in the order of `desc`.
+    static int compare(const ColumnRawPtrs& sort_columns, size_t row, const Columns& threshold,
+                       const SortDescription& desc);
+
+private:
+    mutable std::mutex _lock;
+    Columns _columns;
+};
+
 class HeapSorter final : public Sorter {
     ENABLE_FACTORY_CREATOR(HeapSorter);
 
@@ -42,6 +72,19 @@ public:
 
     Field get_top_value() override;
 
+    void init_profile(RuntimeProfile* runtime_profile) override {
+        Sorter::init_profile(runtime_profile);
+        _pruned_rows_counter =
+                ADD_COUNTER(runtime_profile, "PrunedRowsByHeapThreshold", TUnit::UNIT);
+    }
+
+    void set_threshold(std::shared_ptr<HeapSortThreshold> threshold) {
+        _threshold = std::move(threshold);
+    }
+
+protected:
+    void prune_before_sort(Block& block) override;
+
 private:
     Status _prepare_sort_descs(Block* block);
 
@@ -51,6 +94,8 @@ private:
     MergeSorterQueue _queue;
     std::unique_ptr<MergeSorterState> _state;
     IColumn::Permutation _reverse_buffer;
+    std::shared_ptr<HeapSortThreshold> _threshold;
+    RuntimeProfile::Counter* _pruned_rows_counter = nullptr;
 };
 
 #include "common/compile_check_end.h"
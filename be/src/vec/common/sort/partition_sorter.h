@@ -95,6 +95,8 @@ public:
     size_t data_size() const override { return _state->data_size(); }
     int64_t get_output_rows() const { return _output_total_rows; }
     void reset_sorter_state(RuntimeState* runtime_state);
+    // whether the sorter has output all rows of the partition topn
+    bool get_enough_data() const { return _get_enough_data(); }
     bool prepared_finish() { return _prepared_finish; }
     void set_prepared_finish() { _prepared_finish = true; }
 
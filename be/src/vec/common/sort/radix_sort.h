@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace doris::vectorized {
+
+// A normalized, byte-comparable key with the position of its row.
+// Comparing two `key`s as unsigned integers gives the same order as the original values.
+struct RadixSortElement {
+    uint64_t key;
+    uint32_t index;
+};
+
+// Stable LSD radix sort of `data[0, size)` by the low `key_bytes` bytes of `key`.
+// `buffer` must hold at least `size` elements. Passes on a byte that has the same value
+// for every element are skipped, so narrow or low-cardinality keys only pay for the bytes
+// that actually differ.
+inline void radix_sort_lsd(RadixSortElement* data, RadixSortElement* buffer, size_t size,
+                           size_t key_bytes) {
+    constexpr size_t HISTOGRAM_SIZE = 256;
+    if (size <= 1 || key_bytes == 0) {
+        return;
+    }
+    DCHECK_LE(key_bytes, sizeof(uint64_t));
+
+    // Build all histograms in one pass over the data.
+    uint32_t histograms[sizeof(uint64_t)][HISTOGRAM_SIZE];
+    memset(histograms, 0, sizeof(histograms[0]) * key_bytes);
+    for (size_t i = 0; i < size; ++i) {
+        uint64_t key = data[i].key;
+        for (size_t pass = 0; pass < key_bytes; ++pass) {
+            ++histograms[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    RadixSortElement* src = data;
+    RadixSortElement* dst = buffer;
+    for (size_t pass = 0; pass < key_bytes; ++pass) {
+        uint32_t* histogram = histograms[pass];
+        if (histogram[(src[0].key >> (pass * 8)) & 0xFF] == size) {
+            continue;
+        }
+        uint32_t sum = 0;
+        for (size_t bucket = 0; bucket < HISTOGRAM_SIZE; ++bucket) {
+            uint32_t count = histogram[bucket];
+            histogram[bucket] = sum;
+            sum += count;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            dst[histogram[(src[i].key >> (pass * 8)) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        memcpy(data, src, size * sizeof(RadixSortElement));
+    }
+}
+
+} // namespace doris::vectorized
@@ -179,6 +179,8 @@ Status Sorter::partial_sort(Block& src_block, Block& dest_block, bool reversed)
         }
     }
 
+    prune_before_sort(*result_block);
+
     {
         SCOPED_TIMER(_partial_sort_timer);
         uint64_t limit = reversed ? 0 : (_offset + _limit);
@@ -152,6 +152,9 @@ public:
 
 protected:
     Status partial_sort(Block& src_block, Block& dest_block, bool reversed = false);
+    // Drops the rows of `block` that can not be in the result, called by `partial_sort` when
+    // the sort columns of `_sort_description` are in `block` and before it is sorted.
+    virtual void prune_before_sort(Block& block) {}
 
     bool _enable_spill = false;
     SortDescription _sort_description;
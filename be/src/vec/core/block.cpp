@@ -112,12 +112,17 @@ Block::Block(const std::vector<SlotDescriptor>& slots, size_t block_size,
 }
 
 Status Block::deserialize(const PBlock& pblock) {
+    // Keep the columns of the previous content, a block reused across calls deserializes into
+    // the memory they already own instead of allocating every column again.
+    ColumnsWithTypeAndName reusable_columns;
+    reusable_columns.swap(data);
     swap(Block());
     int be_exec_version = pblock.has_be_exec_version() ? pblock.be_exec_version() : 0;
     RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(be_exec_version));
 
     const char* buf = nullptr;
-    std::string compression_scratch;
+    // not zero-filled, all of it is written by the decompression
+    std::unique_ptr<char[]> compression_scratch;
     if (pblock.compressed()) {
         // Decompress
         SCOPED_RAW_TIMER(&_decompress_time_ns);
@@ -129,8 +134,8 @@ Status Block::deserialize(const PBlock& pblock) {
             RETURN_IF_ERROR(get_block_compression_codec(pblock.compression_type(), &codec));
             uncompressed_size = pblock.uncompressed_size();
             // Should also use allocator to allocate memory here.
-            compression_scratch.resize(uncompressed_size);
-            Slice decompressed_slice(compression_scratch);
+            compression_scratch.reset(new char[uncompressed_size]);
+            Slice decompressed_slice(compression_scratch.get(), uncompressed_size);
             RETURN_IF_ERROR(codec->decompress(Slice(compressed_data, compressed_size),
                                               &decompressed_slice));
             DCHECK(uncompressed_size == decompressed_slice.size);
@@ -138,20 +143,28 @@ Status Block::deserialize(const PBlock& pblock) {
             bool success = snappy::GetUncompressedLength(compressed_data, compressed_size,
                                                          &uncompressed_size);
             DCHECK(success) << "snappy::GetUncompressedLength failed";
-            compression_scratch.resize(uncompressed_size);
+            compression_scratch.reset(new char[uncompressed_size]);
             success = snappy::RawUncompress(compressed_data, compressed_size,
-                                            compression_scratch.data());
+                                            compression_scratch.get());
             DCHECK(success) << "snappy::RawUncompress failed";
         }
         _decompressed_bytes = uncompressed_size;
-        buf = compression_scratch.data();
+        buf = compression_scratch.get();
     } else {
         buf = pblock.column_values().data();
     }
 
     for (const auto& pcol_meta : pblock.column_metas()) {
         DataTypePtr type = DataTypeFactory::instance().create_data_type(pcol_meta);
-        MutableColumnPtr data_column = type->create_column();
+        MutableColumnPtr data_column;
+        const size_t position = data.size();
+        if (position < reusable_columns.size() &&
+            _can_reuse_column(reusable_columns[position], type)) {
+            data_column = IColumn::mutate(std::move(reusable_columns[position].column));
+            data_column->clear();
+        } else {
+            data_column = type->create_column();
+        }
         // Here will try to allocate large memory, should return error if failed.
         RETURN_IF_CATCH_EXCEPTION(
                 buf = type->deserialize(buf, &data_column, pblock.be_exec_version()));
@@ -162,6 +175,14 @@ Status Block::deserialize(const PBlock& pblock) {
     return Status::OK();
 }
 
+bool Block::_can_reuse_column(const ColumnWithTypeAndName& column, const DataTypePtr& type) {
+    // a column still referenced by someone else must not be cleared, and a variant column
+    // rebuilds its subcolumns on every deserialization, there is no memory to keep
+    return column.column && column.type && column.column->is_exclusive() &&
+           !is_column_const(*column.column) && column.type->equals(*type) &&
+           type->get_primitive_type() != TYPE_VARIANT;
+}
+
 void Block::reserve(size_t count) {
     index_by_name.reserve(count);
     data.reserve(count);
@@ -1043,14 +1064,19 @@ Status MutableBlock::add_rows(const Block* block, const uint32_t* row_begin,
     return Status::OK();
 }
 
-Status MutableBlock::add_rows(const Block* block, size_t row_begin, size_t length) {
+Status MutableBlock::add_rows(const Block* block, size_t row_begin, size_t length,
+                              const std::vector<int>* column_offset) {
     RETURN_IF_CATCH_EXCEPTION({
         DCHECK_LE(columns(), block->columns());
+        if (column_offset != nullptr) {
+            DCHECK_EQ(columns(), column_offset->size());
+        }
         const auto& block_data = block->get_columns_with_type_and_name();
         for (size_t i = 0; i < _columns.size(); ++i) {
-            DCHECK_EQ(_data_types[i]->get_name(), block_data[i].type->get_name());
+            const auto& src_col = column_offset ? block_data[(*column_offset)[i]] : block_data[i];
+            DCHECK_EQ(_data_types[i]->get_name(), src_col.type->get_name());
             auto& dst = _columns[i];
-            const auto& src = *block_data[i].column.get();
+            const auto& src = *src_col.column.get();
             dst->insert_range_from(src, row_begin, length);
         }
     });
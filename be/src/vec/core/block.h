@@ -390,6 +390,7 @@ public:
 
 private:
     void erase_impl(size_t position);
+    static bool _can_reuse_column(const ColumnWithTypeAndName& column, const DataTypePtr& type);
 };
 
 using Blocks = std::vector<Block>;
@@ -610,7 +611,8 @@ public:
     // Batch add row should return error status if allocate memory failed.
     Status add_rows(const Block* block, const uint32_t* row_begin, const uint32_t* row_end,
                     const std::vector<int>* column_offset = nullptr);
-    Status add_rows(const Block* block, size_t row_begin, size_t length);
+    Status add_rows(const Block* block, size_t row_begin, size_t length,
+                    const std::vector<int>* column_offset = nullptr);
     Status add_rows(const Block* block, const std::vector<int64_t>& rows);
 
     /// remove the column with the specified name
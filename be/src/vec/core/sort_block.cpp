@@ -20,10 +20,188 @@
 
 #include "vec/core/sort_block.h"
 
+#include <limits>
+
+#include "common/config.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/custom_allocator.h"
+#include "vec/common/sort/radix_sort.h"
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/data_types/data_type_nullable.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+
+namespace {
+// Sorting a few rows by comparator is cheaper than building the radix prefix.
+constexpr size_t MIN_ROWS_FOR_RADIX_SORT = 256;
+
+struct SortPrefixColumn {
+    const IColumn* nested = nullptr;
+    const uint8_t* null_map = nullptr;
+    PrimitiveType type;
+    size_t bytes = 0;
+    bool descending = false;
+    bool nulls_first = false;
+};
+
+// Byte width of the order-preserving encoding of a fixed-width sort column type, 0 if it has none.
+size_t sort_prefix_width(PrimitiveType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+        return 1;
+    case TYPE_SMALLINT:
+        return 2;
+    case TYPE_INT:
+    case TYPE_DATEV2:
+    case TYPE_IPV4:
+        return 4;
+    case TYPE_BIGINT:
+    case TYPE_DATETIMEV2:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+template <PrimitiveType PT>
+void append_sort_prefix(const SortPrefixColumn& column, DorisVector<RadixSortElement>& elements) {
+    using ValueType = typename PrimitiveTypeTraits<PT>::ColumnItemType;
+    using UnsignedType = std::make_unsigned_t<ValueType>;
+    constexpr size_t VALUE_BITS = sizeof(ValueType) * 8;
+    constexpr uint64_t VALUE_MASK =
+            VALUE_BITS == 64 ? ~uint64_t(0) : (uint64_t(1) << VALUE_BITS) - 1;
+    const auto& data =
+            assert_cast<const ColumnVector<PT>&, TypeCheckOnRelease::DISABLE>(*column.nested)
+                    .get_data();
+    for (size_t i = 0; i < elements.size(); ++i) {
+        // flip the sign bit so that signed values compare correctly as unsigned
+        uint64_t encoded = static_cast<UnsignedType>(data[i]);
+        if constexpr (std::is_signed_v<ValueType>) {
+            encoded ^= uint64_t(1) << (VALUE_BITS - 1);
+        }
+        if (column.descending) {
+            encoded = ~encoded & VALUE_MASK;
+        }
+        if constexpr (VALUE_BITS < 64) {
+            if (column.null_map != nullptr) {
+                uint64_t null_bit = uint64_t(1) << VALUE_BITS;
+                if (column.null_map[i]) {
+                    encoded = column.nulls_first ? 0 : null_bit;
+                } else if (column.nulls_first) {
+                    encoded |= null_bit;
+                }
+            }
+        }
+        auto& key = elements[i].key;
+        key = column.bytes == sizeof(uint64_t) ? encoded : (key << (column.bytes * 8)) | encoded;
+    }
+}
+
+// Radix sorts the rows by the normalized prefix of the leading fixed-width sort columns, sets
+// `flags` of the rows that have the same prefix as the previous one. Returns the number of the
+// sort columns in the prefix, 0 if the rows are not sorted.
+size_t sort_by_prefix(const Block& block, const SortDescription& description,
+                      IColumn::Permutation& perm, EqualFlags& flags) {
+    size_t rows = block.rows();
+    if (rows < MIN_ROWS_FOR_RADIX_SORT || rows > std::numeric_limits<uint32_t>::max()) {
+        return 0;
+    }
+    // pack as many leading sort columns as fit into one 64-bit prefix
+    std::vector<SortPrefixColumn> prefix_columns;
+    size_t prefix_bytes = 0;
+    for (const auto& sort_column : description) {
+        const auto& column_with_type =
+                !sort_column.column_name.empty()
+                        ? block.get_by_name(sort_column.column_name)
+                        : block.safe_get_by_position(sort_column.column_number);
+        const auto* column = column_with_type.column.get();
+        SortPrefixColumn prefix_column;
+        prefix_column.type = remove_nullable(column_with_type.type)->get_primitive_type();
+        prefix_column.bytes = sort_prefix_width(prefix_column.type);
+        if (prefix_column.bytes == 0 || is_column_const(*column)) {
+            break;
+        }
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*column)) {
+            prefix_column.nested = &nullable->get_nested_column();
+            prefix_column.null_map = nullable->get_null_map_data().data();
+            prefix_column.bytes += 1;
+        } else {
+            prefix_column.nested = column;
+        }
+        if (prefix_bytes + prefix_column.bytes > sizeof(uint64_t)) {
+            break;
+        }
+        prefix_column.descending = sort_column.direction < 0;
+        // the same as ColumnSorter
+        prefix_column.nulls_first = sort_column.nulls_direction * sort_column.direction < 0;
+        prefix_bytes += prefix_column.bytes;
+        prefix_columns.push_back(prefix_column);
+    }
+    if (prefix_columns.empty()) {
+        return 0;
+    }
+
+    DorisVector<RadixSortElement> elements(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        elements[i] = {0, static_cast<uint32_t>(i)};
+    }
+    for (const auto& prefix_column : prefix_columns) {
+        switch (prefix_column.type) {
+#define APPEND_SORT_PREFIX(PT)                          \
+    case PT:                                            \
+        append_sort_prefix<PT>(prefix_column, elements); \
+        break;
+            APPEND_SORT_PREFIX(TYPE_BOOLEAN)
+            APPEND_SORT_PREFIX(TYPE_TINYINT)
+            APPEND_SORT_PREFIX(TYPE_SMALLINT)
+            APPEND_SORT_PREFIX(TYPE_INT)
+            APPEND_SORT_PREFIX(TYPE_DATEV2)
+            APPEND_SORT_PREFIX(TYPE_IPV4)
+            APPEND_SORT_PREFIX(TYPE_BIGINT)
+            APPEND_SORT_PREFIX(TYPE_DATETIMEV2)
+#undef APPEND_SORT_PREFIX
+        default:
+            DCHECK(false) << "unexpected sort prefix type " << type_to_string(prefix_column.type);
+            return 0;
+        }
+    }
+
+    {
+        DorisVector<RadixSortElement> buffer(rows);
+        radix_sort_lsd(elements.data(), buffer.data(), rows, prefix_bytes);
+    }
+
+    // only rows with the same prefix need to be sorted by the remaining sort columns
+    perm[0] = elements[0].index;
+    flags[0] = 0;
+    for (size_t i = 1; i < rows; ++i) {
+        perm[i] = elements[i].index;
+        flags[i] = elements[i - 1].key == elements[i].key;
+    }
+    return prefix_columns.size();
+}
+
+// Whether the rows are already in the sort order, as the rows of a scan that reads in the order
+// of the sort keys. It stops at the first pair of rows out of order, so an unsorted block is
+// usually found after a few rows.
+bool is_sorted(const ColumnsWithSortDescriptions& columns, size_t rows) {
+    for (size_t row = 1; row < rows; ++row) {
+        for (const auto& [column, desc] : columns) {
+            int res = desc.direction *
+                      column->compare_at(row - 1, row, *column, desc.nulls_direction);
+            if (res < 0) {
+                break;
+            }
+            if (res > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description) {
     size_t size = description.size();
@@ -48,6 +226,16 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
         return;
     }
 
+    size_t rows = src_block.rows();
+    if (is_sorted(get_columns_with_sort_description(src_block, description), rows)) {
+        // the columns are copied, the caller may clear the columns of `src_block`
+        size_t length = limit == 0 ? rows : std::min<size_t>(limit, rows);
+        for (size_t i = 0; i < src_block.columns(); ++i) {
+            dest_block.replace_by_position(i, src_block.get_by_position(i).column->cut(0, length));
+        }
+        return;
+    }
+
     /// If only one column to sort by
     if (description.size() == 1) {
         bool reverse = description[0].direction == -1;
@@ -82,8 +270,12 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
+            size_t sorted_columns = 0;
+            if (limit == 0 && config::enable_sort_block_radix_sort) {
+                sorted_columns = sort_by_prefix(src_block, description, perm, flags);
+            }
             // TODO: ColumnSorter should be constructed only once.
-            for (size_t i = 0; i < columns_with_sort_desc.size(); i++) {
+            for (size_t i = sorted_columns; i < columns_with_sort_desc.size(); i++) {
                 ColumnSorter sorter(columns_with_sort_desc[i], limit);
                 sorter.operator()(flags, perm, range, i == columns_with_sort_desc.size() - 1);
             }
@@ -99,7 +99,20 @@ Status DataTypeJsonbSerDe::deserialize_column_from_json_vector(IColumn& column,
                                                                std::vector<Slice>& slices,
                                                                uint64_t* num_deserialized,
                                                                const FormatOptions& options) const {
-    DESERIALIZE_COLUMN_FROM_JSON_VECTOR();
+    // share one writer by all the rows rather than allocate a new one per row
+    auto& column_string = assert_cast<ColumnString&>(column);
+    size_t total_size = 0;
+    for (const auto& slice : slices) {
+        total_size += slice.size;
+    }
+    column_string.get_chars().reserve(column_string.get_chars().size() + total_size);
+    column_string.get_offsets().reserve(column_string.size() + slices.size());
+    JsonBinaryValue value;
+    for (auto& slice : slices) {
+        RETURN_IF_ERROR(value.from_json_string(slice.data, slice.size));
+        column_string.insert_data(value.value(), value.size());
+        ++*num_deserialized;
+    }
     return Status::OK();
 }
 
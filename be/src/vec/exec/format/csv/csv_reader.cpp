@@ -41,6 +41,7 @@
 #include "io/fs/s3_file_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/core/block.h"
@@ -84,9 +85,22 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
                                                          std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const size_t size = line.size;
+    const char sep = _value_sep[0];
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
-        if (data[i] == _value_sep[0]) {
+    size_t i = 0;
+    // compare 16 bytes at a time and walk the separators found in them
+    for (; i + 16 <= size; i += 16) {
+        simd::iterate_through_bits_mask(
+                [&](auto pos) {
+                    size_t sep_pos = i + pos;
+                    process_value_func(data, value_start, sep_pos - value_start, _trimming_char,
+                                       splitted_values);
+                    value_start = sep_pos + _value_sep_len;
+                },
+                simd::bytes16_eq_mask(data + i, sep));
+    }
+    for (; i < size; ++i) {
+        if (data[i] == sep) {
             process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
             value_start = i + _value_sep_len;
         }
@@ -175,8 +189,8 @@ CsvReader::CsvReader(RuntimeState* state, RuntimeProfile* profile, ScannerCounte
         : _profile(profile),
           _params(params),
           _file_reader(nullptr),
-          _line_reader(nullptr),
           _decompressor(nullptr),
+          _line_reader(nullptr),
           _state(state),
           _counter(counter),
           _range(range),
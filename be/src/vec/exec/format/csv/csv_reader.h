@@ -217,8 +217,9 @@ protected:
     int64_t _start_offset;
     int64_t _size;
     io::FileReaderSPtr _file_reader;
-    std::unique_ptr<LineReader> _line_reader;
+    // declared before _line_reader, which may decompress on a worker until it's destroyed
     std::unique_ptr<Decompressor> _decompressor;
+    std::unique_ptr<LineReader> _line_reader;
 
 private:
     Status _create_decompressor();
@@ -0,0 +1,241 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/file_reader/decompress_pipeline.h"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "exec/decompressor.h"
+#include "io/fs/file_reader.h"
+#include "util/slice.h"
+#include "util/threadpool.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Same as the input chunk of NewPlainTextLineReader, large enough for lz4 and lzo headers.
+static constexpr size_t PIPELINE_INPUT_CHUNK = 2 * 1024 * 1024;
+
+DecompressPipeline::DecompressPipeline(io::FileReaderSPtr file_reader, Decompressor* decompressor,
+                                       size_t current_offset, const io::IOContext* io_ctx,
+                                       size_t chunk_size, size_t num_chunks,
+                                       RuntimeProfile::Counter* bytes_read_counter,
+                                       RuntimeProfile::Counter* bytes_decompress_counter,
+                                       RuntimeProfile::Counter* decompress_timer)
+        : _file_reader(std::move(file_reader)),
+          _decompressor(decompressor),
+          _current_offset(current_offset),
+          _io_ctx(io_ctx),
+          _input_buf(new uint8_t[PIPELINE_INPUT_CHUNK]),
+          _input_buf_size(PIPELINE_INPUT_CHUNK),
+          _chunks(std::max<size_t>(num_chunks, 2)),
+          _bytes_read_counter(bytes_read_counter),
+          _bytes_decompress_counter(bytes_decompress_counter),
+          _decompress_timer(decompress_timer) {
+    DCHECK(_decompressor != nullptr);
+    for (auto& chunk : _chunks) {
+        chunk.data.reset(new uint8_t[chunk_size]);
+        chunk.capacity = chunk_size;
+    }
+}
+
+DecompressPipeline::~DecompressPipeline() {
+    close();
+}
+
+Status DecompressPipeline::start(ThreadPool* pool) {
+    RETURN_IF_ERROR(pool->submit_func([this]() { _run(); }));
+    std::lock_guard l(_lock);
+    _started = true;
+    return Status::OK();
+}
+
+void DecompressPipeline::close() {
+    std::unique_lock l(_lock);
+    _closed = true;
+    _cond.notify_all();
+    if (_started) {
+        _cond.wait(l, [this]() { return _finished; });
+    }
+}
+
+Status DecompressPipeline::read(uint8_t* buf, size_t len, size_t* bytes_read) {
+    *bytes_read = 0;
+    if (len == 0) {
+        return Status::OK();
+    }
+    Chunk* chunk = nullptr;
+    {
+        std::unique_lock l(_lock);
+        _cond.wait(l, [this]() { return _num_filled > 0 || _finished; });
+        if (!_status.ok() || _num_filled == 0) {
+            return _status;
+        }
+        chunk = &_chunks[_head];
+    }
+
+    // The head chunk is not touched by the worker until it is released below.
+    size_t copy_size = std::min(len, chunk->size - _head_read_pos);
+    memcpy(buf, chunk->data.get() + _head_read_pos, copy_size);
+    _head_read_pos += copy_size;
+    *bytes_read = copy_size;
+    if (_head_read_pos == chunk->size) {
+        std::lock_guard l(_lock);
+        _head = (_head + 1) % _chunks.size();
+        --_num_filled;
+        _head_read_pos = 0;
+        _cond.notify_all();
+    }
+    return Status::OK();
+}
+
+void DecompressPipeline::_run() {
+    Status st = _decompress();
+    if (!st.ok()) {
+        LOG(WARNING) << "pipelined decompress of " << _file_reader->path().native()
+                     << " failed: " << st.to_string();
+    }
+    std::lock_guard l(_lock);
+    _status = std::move(st);
+    _finished = true;
+    _cond.notify_all();
+}
+
+Status DecompressPipeline::_decompress() {
+    bool stream_end = true;
+    bool eof = false;
+    while (!eof) {
+        Chunk* chunk = nullptr;
+        {
+            std::unique_lock l(_lock);
+            _cond.wait(l, [this]() { return _closed || _num_filled < _chunks.size(); });
+            if (_closed) {
+                return Status::OK();
+            }
+            chunk = &_chunks[(_head + _num_filled) % _chunks.size()];
+        }
+        RETURN_IF_ERROR(_fill_chunk(chunk, &stream_end, &eof));
+        if (chunk->size > 0) {
+            std::lock_guard l(_lock);
+            ++_num_filled;
+            _cond.notify_all();
+        }
+    }
+    return Status::OK();
+}
+
+Status DecompressPipeline::_fill_chunk(Chunk* chunk, bool* stream_end, bool* eof) {
+    chunk->size = 0;
+    while (true) {
+        if (_input_buf_pos == _input_buf_limit || _more_input_bytes > 0) {
+            if (_more_input_bytes > 0) {
+                _reserve_input(_more_input_bytes);
+            } else {
+                _input_buf_pos = 0;
+                _input_buf_limit = 0;
+            }
+            size_t read_len = 0;
+            Slice file_slice(_input_buf.get() + _input_buf_limit,
+                             _input_buf_size - _input_buf_limit);
+            RETURN_IF_ERROR(_file_reader->read_at(_current_offset, file_slice, &read_len, _io_ctx));
+            _current_offset += read_len;
+            COUNTER_UPDATE(_bytes_read_counter, read_len);
+            if (read_len == 0) {
+                if (!*stream_end) {
+                    return Status::InternalError(
+                            "Compressed file has been truncated, which is not allowed");
+                }
+                *eof = true;
+                return Status::OK();
+            }
+            _input_buf_limit += read_len;
+            if (read_len < _more_input_bytes) {
+                _more_input_bytes -= read_len;
+                continue;
+            }
+        }
+
+        // The decompressor asked for more output space than this chunk has left.
+        // Hand out what we have, and grow an empty chunk to fit a whole block.
+        if (_more_output_bytes > chunk->capacity - chunk->size) {
+            if (chunk->size > 0) {
+                return Status::OK();
+            }
+            chunk->capacity = std::max(chunk->capacity * 2, _more_output_bytes);
+            chunk->data.reset(new uint8_t[chunk->capacity]);
+        }
+
+        size_t input_read_bytes = 0;
+        size_t decompressed_len = 0;
+        size_t more_output_bytes = 0;
+        _more_input_bytes = 0;
+        {
+            SCOPED_TIMER(_decompress_timer);
+            RETURN_IF_ERROR(_decompressor->decompress(
+                    _input_buf.get() + _input_buf_pos, _input_buf_limit - _input_buf_pos,
+                    &input_read_bytes, chunk->data.get() + chunk->size,
+                    chunk->capacity - chunk->size, &decompressed_len, stream_end,
+                    &_more_input_bytes, &more_output_bytes));
+        }
+        _input_buf_pos += input_read_bytes;
+        chunk->size += decompressed_len;
+        COUNTER_UPDATE(_bytes_decompress_counter, decompressed_len);
+        // Keep the total output space the pending block needs, not the shortfall.
+        _more_output_bytes =
+                more_output_bytes > 0 ? chunk->capacity - chunk->size + more_output_bytes : 0;
+
+        if (input_read_bytes == 0 && _more_input_bytes == 0 && more_output_bytes == 0) {
+            if (chunk->size > 0) {
+                // Output space is too small to make progress, continue with the next chunk.
+                return Status::OK();
+            }
+            return Status::InternalError(
+                    "decompress made no progress. decompressed_len: {}, input len: {}",
+                    decompressed_len, _input_buf_limit - _input_buf_pos);
+        }
+        if (chunk->size == chunk->capacity) {
+            return Status::OK();
+        }
+    }
+}
+
+// Make sure at least `bytes` can be read after the unconsumed input.
+void DecompressPipeline::_reserve_input(size_t bytes) {
+    if (_input_buf_size - _input_buf_limit >= bytes) {
+        return;
+    }
+    size_t remaining = _input_buf_limit - _input_buf_pos;
+    if (_input_buf_size - remaining < bytes) {
+        while (_input_buf_size - remaining < bytes) {
+            _input_buf_size *= 2;
+        }
+        auto* new_input_buf = new uint8_t[_input_buf_size];
+        memcpy(new_input_buf, _input_buf.get() + _input_buf_pos, remaining);
+        _input_buf.reset(new_input_buf);
+    } else {
+        memmove(_input_buf.get(), _input_buf.get() + _input_buf_pos, remaining);
+    }
+    _input_buf_pos = 0;
+    _input_buf_limit = remaining;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/status.h"
+#include "io/fs/file_reader_writer_fwd.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+namespace io {
+struct IOContext;
+}
+
+class Decompressor;
+class ThreadPool;
+
+// Reads a compressed file and decompresses it on a worker thread, handing the decompressed
+// data to the consumer through a bounded ring of chunks. This lets decompression of the next
+// chunks overlap with parsing the current one, instead of both running on the scanner thread.
+//
+// The worker owns `file_reader` and `decompressor` until close() returns, so the caller must
+// not touch either of them in the meantime and must keep them alive until then.
+class DecompressPipeline {
+public:
+    DecompressPipeline(io::FileReaderSPtr file_reader, Decompressor* decompressor,
+                       size_t current_offset, const io::IOContext* io_ctx, size_t chunk_size,
+                       size_t num_chunks, RuntimeProfile::Counter* bytes_read_counter,
+                       RuntimeProfile::Counter* bytes_decompress_counter,
+                       RuntimeProfile::Counter* decompress_timer);
+
+    ~DecompressPipeline();
+
+    // Submits the decompress worker to `pool`.
+    Status start(ThreadPool* pool);
+
+    // Copies up to `len` decompressed bytes to `buf`, blocking until some data is ready.
+    // `*bytes_read` is 0 only at the end of the stream.
+    Status read(uint8_t* buf, size_t len, size_t* bytes_read);
+
+    // Stops the worker and waits for it to exit.
+    void close();
+
+private:
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity = 0;
+        size_t size = 0;
+    };
+
+    void _run();
+    Status _decompress();
+    // Decompresses into `chunk` until it is full or the input is exhausted.
+    Status _fill_chunk(Chunk* chunk, bool* stream_end, bool* eof);
+    void _reserve_input(size_t bytes);
+
+    io::FileReaderSPtr _file_reader;
+    Decompressor* _decompressor = nullptr;
+    size_t _current_offset;
+    const io::IOContext* _io_ctx = nullptr;
+
+    // Only accessed by the worker.
+    std::unique_ptr<uint8_t[]> _input_buf;
+    size_t _input_buf_size;
+    size_t _input_buf_pos = 0;
+    size_t _input_buf_limit = 0;
+    size_t _more_input_bytes = 0;
+    size_t _more_output_bytes = 0;
+
+    // Chunks [_head, _head + _num_filled) are ready for the consumer, the rest are free
+    // for the worker.
+    std::vector<Chunk> _chunks;
+    size_t _head = 0;
+    size_t _num_filled = 0;
+    // Bytes of the head chunk already consumed.
+    size_t _head_read_pos = 0;
+
+    std::mutex _lock;
+    std::condition_variable _cond;
+    bool _started = false;
+    bool _finished = false;
+    bool _closed = false;
+    Status _status;
+
+    RuntimeProfile::Counter* _bytes_read_counter = nullptr;
+    RuntimeProfile::Counter* _bytes_decompress_counter = nullptr;
+    RuntimeProfile::Counter* _decompress_timer = nullptr;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -35,6 +35,7 @@ struct IOContext;
 }
 
 class Decompressor;
+class DecompressPipeline;
 class Status;
 
 class TextLineReaderContextIf {
@@ -300,6 +301,8 @@ private:
 
     void extend_input_buf();
     void extend_output_buf();
+    // Moves decompression to a worker thread if enabled, see DecompressPipeline.
+    void init_decompress_pipeline(const io::IOContext* io_ctx);
 
     RuntimeProfile* _profile = nullptr;
     io::FileReaderSPtr _file_reader;
@@ -331,6 +334,11 @@ private:
 
     size_t _current_offset;
 
+    // Set when decompression runs on a worker, which then owns `_file_reader` and
+    // `_decompressor`, and `_input_buf` is unused.
+    std::unique_ptr<DecompressPipeline> _decompress_pipeline;
+    bool _decompress_pipeline_inited = false;
+
     // Profile counters
     RuntimeProfile::Counter* _bytes_read_counter = nullptr;
     RuntimeProfile::Counter* _read_timer = nullptr;
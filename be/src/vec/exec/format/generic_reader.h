@@ -73,6 +73,12 @@ public:
         return Status::OK();
     }
 
+    /// The runtime filters that arrived after the reader was initialized. The reader may use them
+    /// to skip the data it has not read yet, the rows it returns are still filtered by the caller.
+    virtual Status on_late_runtime_filters(const VExprContextSPtrs& conjuncts) {
+        return Status::OK();
+    }
+
     virtual Status close() { return Status::OK(); }
 
     Status set_read_lines_mode(const std::list<int64_t>& read_lines) {
@@ -49,6 +49,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/jsonb_parser_simd.h"
 #include "util/slice.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
@@ -87,9 +88,9 @@ NewJsonReader::NewJsonReader(RuntimeState* state, RuntimeProfile* profile, Scann
           _range(range),
           _file_slot_descs(file_slot_descs),
           _file_reader(nullptr),
+          _decompressor(nullptr),
           _line_reader(nullptr),
           _reader_eof(false),
-          _decompressor(nullptr),
           _skip_first_line(false),
           _next_row(0),
           _total_rows(0),
@@ -122,9 +123,9 @@ NewJsonReader::NewJsonReader(RuntimeProfile* profile, const TFileScanRangeParams
           _params(params),
           _range(range),
           _file_slot_descs(file_slot_descs),
+          _decompressor(nullptr),
           _line_reader(nullptr),
           _reader_eof(false),
-          _decompressor(nullptr),
           _skip_first_line(false),
           _next_row(0),
           _total_rows(0),
@@ -226,6 +227,7 @@ Status NewJsonReader::get_next_block(Block* block, size_t* read_rows, bool* eof)
     }
 
     const int batch_size = std::max(_state->batch_size(), (int)_MIN_BATCH_SIZE);
+    _prepare_batch_columns(*block);
 
     while (block->rows() < batch_size && !_reader_eof) {
         if (UNLIKELY(_read_json_by_line && _skip_first_line)) {
@@ -1588,6 +1590,13 @@ Status NewJsonReader::_simdjson_handle_nested_complex_json(
     return Status::OK();
 }
 
+void NewJsonReader::_prepare_batch_columns(Block& block) {
+    _batch_columns.resize(block.columns());
+    for (size_t i = 0; i < block.columns(); ++i) {
+        _batch_columns[i] = block.get_by_position(i).column->assume_mutable().get();
+    }
+}
+
 size_t NewJsonReader::_column_index(const StringRef& name, size_t key_index) {
     /// Optimization by caching the order of fields (which is almost always the same)
     /// and a quick check to match the next expected field, instead of searching the hash table.
@@ -1609,6 +1618,9 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
                                                  bool* valid) {
     // set
     _seen_columns.assign(block.columns(), false);
+    if (UNLIKELY(_batch_columns.size() != block.columns())) {
+        _prepare_batch_columns(block);
+    }
     size_t cur_row_count = block.rows();
     bool has_valid_value = false;
     // iterate through object, simdjson::ondemond will parsing on the fly
@@ -1634,13 +1646,13 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
             if (_is_hive_table) {
                 //Since value can only be traversed once,
                 // we can only insert the original value first, then delete it, and then reinsert the new value
-                block.get_by_position(column_index).column->assume_mutable()->pop_back(1);
+                _batch_columns[column_index]->pop_back(1);
             } else {
                 continue;
             }
         }
         simdjson::ondemand::value val = field.value();
-        auto* column_ptr = block.get_by_position(column_index).column->assume_mutable().get();
+        auto* column_ptr = _batch_columns[column_index];
         RETURN_IF_ERROR(_simdjson_write_data_to_column(
                 val, slot_descs[column_index]->type(), column_ptr,
                 slot_descs[column_index]->col_name(), _serdes[column_index], valid));
@@ -1680,7 +1692,7 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
         }
 
         auto* slot_desc = slot_descs[i];
-        auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+        auto* column_ptr = _batch_columns[i];
 
         // Quick path to insert default value, instead of using default values in the value map.
         if (!_should_process_skip_bitmap_col() &&
@@ -1766,7 +1778,13 @@ Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value&
     }
 
     auto primitive_type = type_desc->get_primitive_type();
-    if (_is_load || !is_complex_type(primitive_type)) {
+    if (primitive_type == TYPE_JSONB && value.type() != simdjson::ondemand::json_type::string) {
+        // write the jsonb from the parsed value instead of parsing its json text once more
+        RETURN_IF_ERROR(JsonbParser::parse_value(value, _jsonb_writer));
+        assert_cast<ColumnString*>(data_column_ptr)
+                ->insert_data(_jsonb_writer.getOutput()->getBuffer(),
+                              _jsonb_writer.getOutput()->getSize());
+    } else if (_is_load || !is_complex_type(primitive_type)) {
         if (value.type() == simdjson::ondemand::json_type::string) {
             std::string_view value_string = value.get_string();
             Slice slice {value_string.data(), value_string.size()};
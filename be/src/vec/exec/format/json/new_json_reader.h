@@ -36,6 +36,7 @@
 #include "exprs/json_functions.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "util/jsonb_writer.h"
 #include "util/runtime_profile.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/types.h"
@@ -188,6 +189,8 @@ private:
 
     size_t _column_index(const StringRef& name, size_t key_index);
 
+    void _prepare_batch_columns(Block& block);
+
     Status (NewJsonReader::*_vhandle_json_callback)(RuntimeState* state, Block& block,
                                                     const std::vector<SlotDescriptor*>& slot_descs,
                                                     bool* is_empty_row, bool* eof);
@@ -217,9 +220,10 @@ private:
     const std::vector<SlotDescriptor*>& _file_slot_descs;
 
     io::FileReaderSPtr _file_reader;
+    // declared before _line_reader, which may decompress on a worker until it's destroyed
+    std::unique_ptr<Decompressor> _decompressor;
     std::unique_ptr<LineReader> _line_reader;
     bool _reader_eof;
-    std::unique_ptr<Decompressor> _decompressor;
     TFileCompressType::type _file_compress_type;
 
     // When we fetch range doesn't start from 0 will always skip the first line
@@ -272,6 +276,8 @@ private:
     std::vector<NameMap::iterator> _prev_positions;
     /// Set of columns which already met in row. Exception is thrown if there are more than one column with the same name.
     std::vector<UInt8> _seen_columns;
+    /// Mutable columns of the block being filled, resolved once per batch instead of per value.
+    std::vector<IColumn*> _batch_columns;
     // simdjson
     std::unique_ptr<uint8_t[]> _json_str_ptr;
     const uint8_t* _json_str = nullptr;
@@ -288,6 +294,8 @@ private:
     simdjson::ondemand::array_iterator _array_iter;
     simdjson::ondemand::array _array;
     std::unique_ptr<simdjson::ondemand::parser> _ondemand_json_parser;
+    // serializes json values of jsonb columns straight from the simdjson iterator
+    JsonbWriter _jsonb_writer;
     // column to default value string map
     std::unordered_map<std::string, std::string> _col_default_value_map;
 
@@ -305,8 +305,27 @@ Status OrcReader::_create_file_reader() {
         orc::ReaderOptions options;
         options.setMemoryPool(*ExecEnv::GetInstance()->orc_memory_pool());
         options.setReaderMetrics(&_reader_metrics);
+        io::FileReaderSPtr file_reader = _file_input_stream->get_file_reader();
+        ObjLRUCache::CacheHandle file_tail_handle;
+        bool file_tail_cached =
+                _meta_cache != nullptr &&
+                _meta_cache->lookup_orc_file_tail(file_reader, _file_description.mtime,
+                                                  &file_tail_handle);
+        if (file_tail_cached) {
+            options.setSerializedFileTail(
+                    *static_cast<const std::string*>(file_tail_handle.data<std::string>()));
+        }
         _reader = orc::createReader(
                 std::unique_ptr<ORCFileInputStream>(_file_input_stream.release()), options);
+        if (_meta_cache != nullptr && !file_tail_cached) {
+            auto file_tail = std::make_unique<std::string>(_reader->getSerializedFileTail());
+            _meta_cache->insert_orc_file_tail(file_reader, _file_description.mtime,
+                                              file_tail.get(), &file_tail_handle);
+            if (file_tail_handle.valid()) {
+                // owned by the cache now
+                static_cast<void>(file_tail.release());
+            }
+        }
     } catch (std::exception& e) {
         // invoker maybe just skip Status.NotFound and continue
         // so we need distinguish between it and other kinds of errors
@@ -1597,12 +1616,13 @@ Status OrcReader::_decode_int32_column(const std::string& col_name,
                                                                    num_values);
     } else if (dynamic_cast<const orc::EncodedStringVectorBatch*>(cvb) != nullptr) {
         const auto* data = static_cast<const orc::EncodedStringVectorBatch*>(cvb);
-        const auto* cvb_data = data->index.data();
+        const auto* __restrict cvb_data = data->index.data();
         auto& column_data = static_cast<ColumnInt32&>(*data_column).get_data();
         auto origin_size = column_data.size();
         column_data.resize(origin_size + num_values);
-        for (int i = 0; i < num_values; ++i) {
-            column_data[origin_size + i] = (Int32)cvb_data[i];
+        Int32* __restrict dst = column_data.data() + origin_size;
+        for (size_t i = 0; i < num_values; ++i) {
+            dst[i] = (Int32)cvb_data[i];
         }
         return Status::OK();
     } else {
@@ -21,10 +21,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <orc/OrcFile.hh>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -35,6 +37,7 @@
 #include "exec/olap_common.h"
 #include "io/file_factory.h"
 #include "io/fs/buffered_reader.h"
+#include "io/fs/file_meta_cache.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "olap/olap_common.h"
@@ -218,6 +221,10 @@ public:
         _row_id_column_iterator_pair = iterator_pair;
     }
 
+    // The serialized file tail of the file is cached in `meta_cache`, and the reader is
+    // created from the cached one if there is.
+    void set_file_meta_cache(FileMetaCache* meta_cache) { _meta_cache = meta_cache; }
+
     static bool inline is_hive1_col_name(const orc::Type* orc_type_ptr) {
         for (uint64_t idx = 0; idx < orc_type_ptr->getSubtypeCount(); idx++) {
             if (!_is_hive1_col_name(orc_type_ptr->getFieldName(idx))) {
@@ -356,13 +363,20 @@ private:
             return Status::InternalError("Wrong data type for column '{}', expected {}", col_name,
                                          cvb->toString());
         }
-        auto* cvb_data = data->data.data();
+        using CppType = typename PrimitiveTypeTraits<PType>::CppType;
+        const auto* __restrict cvb_data = data->data.data();
         auto& column_data = static_cast<ColumnVector<PType>&>(*data_column).get_data();
         auto origin_size = column_data.size();
         column_data.resize(origin_size + num_values);
-        for (int i = 0; i < num_values; ++i) {
-            column_data[origin_size + i] =
-                    (typename PrimitiveTypeTraits<PType>::CppType)cvb_data[i];
+        CppType* __restrict dst = column_data.data() + origin_size;
+        if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(cvb_data)>>,
+                                     CppType>) {
+            // BIGINT and DOUBLE have the layout of the orc batch
+            memcpy(dst, cvb_data, num_values * sizeof(CppType));
+        } else {
+            for (size_t i = 0; i < num_values; ++i) {
+                dst[i] = (CppType)cvb_data[i];
+            }
         }
         return Status::OK();
     }
@@ -665,6 +679,7 @@ private:
     std::shared_ptr<io::FileSystem> _file_system;
 
     io::IOContext* _io_ctx = nullptr;
+    FileMetaCache* _meta_cache = nullptr;
     bool _enable_lazy_mat = true;
     bool _enable_filter_by_min_max = true;
 
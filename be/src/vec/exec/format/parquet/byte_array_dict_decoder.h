@@ -60,6 +60,8 @@ protected:
     std::vector<StringRef> _dict_items;
     std::vector<uint8_t> _dict_data;
     size_t _max_value_length;
+    // The dictionary items of the rows being expanded, reused across the runs and batches.
+    std::vector<StringRef> _string_values;
 };
 #include "common/compile_check_end.h"
 
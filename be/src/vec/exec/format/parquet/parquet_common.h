@@ -104,7 +104,7 @@ public:
 
     Status init(const std::vector<uint16_t>& run_length_null_map, size_t num_values,
                 NullMap* null_map, FilterMap* filter_map, size_t filter_map_index,
-                const std::unordered_set<size_t>* skipped_indices = nullptr) {
+                const std::vector<size_t>* skipped_indices = nullptr) {
         _num_values = num_values;
         _num_nulls = 0;
         _read_index = 0;
@@ -133,12 +133,19 @@ public:
             size_t num_read = 0;
             size_t i = 0;
             size_t valid_count = 0;
+            // `skipped_indices` is sorted, and the indexes are visited in order
+            size_t skipped_pos = 0;
+            size_t num_skipped = skipped_indices == nullptr ? 0 : skipped_indices->size();
 
             while (valid_count < num_values) {
                 DCHECK_LT(filter_map_index + i, filter_map->filter_map_size());
 
-                if (skipped_indices != nullptr &&
-                    skipped_indices->count(filter_map_index + i) > 0) {
+                while (skipped_pos < num_skipped &&
+                       (*skipped_indices)[skipped_pos] < filter_map_index + i) {
+                    ++skipped_pos;
+                }
+                if (skipped_pos < num_skipped &&
+                    (*skipped_indices)[skipped_pos] == filter_map_index + i) {
                     ++i;
                     continue;
                 }
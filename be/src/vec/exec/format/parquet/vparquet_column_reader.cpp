@@ -358,16 +358,30 @@ Status ScalarColumnReader::_read_nested_column(ColumnPtr& doris_column, DataType
         LevelDecoder& rep_decoder = _chunk_reader->rep_level_decoder();
         // Read repetition levels until batch is full or no more values
         while (parsed_rows <= batch_size && remaining_values > 0) {
-            level_t rep_level = rep_decoder.get_next();
-            if (rep_level == 0) { // rep_level 0 indicates start of new row
-                if (parsed_rows == batch_size) {
+            level_t rep_level = 0;
+            if (parsed_rows == batch_size) {
+                // a level 0 would start a row past the batch, so look at one level at a time
+                rep_level = rep_decoder.get_next();
+                if (rep_level == 0) {
                     rep_decoder.rewind_one();
                     break;
                 }
-                parsed_rows++;
+                _rep_levels.emplace_back(rep_level);
+                remaining_values--;
+                continue;
             }
-            _rep_levels.emplace_back(rep_level);
-            remaining_values--;
+            // rep_level 0 indicates start of new row, a run of them starts at most the rows
+            // left in the batch
+            size_t run_length = rep_decoder.get_next_run(
+                    &rep_level, std::min(remaining_values, batch_size - parsed_rows));
+            if (run_length == 0) {
+                return Status::Corruption("Not enough repetition levels in parquet page");
+            }
+            if (rep_level == 0) {
+                parsed_rows += run_length;
+            }
+            _rep_levels.resize(_rep_levels.size() + run_length, rep_level);
+            remaining_values -= run_length;
         }
 
         // Generate nested filter map
@@ -421,7 +435,7 @@ Status ScalarColumnReader::_read_nested_column(ColumnPtr& doris_column, DataType
     size_t nonnull_size = 0;
     null_map.emplace_back(0);
     bool prev_is_null = false;
-    std::unordered_set<size_t> ancestor_null_indices;
+    std::vector<size_t> ancestor_null_indices;
 
     while (has_read < origin_size + parsed_values) {
         level_t def_level = _def_levels[has_read++];
@@ -433,7 +447,7 @@ Status ScalarColumnReader::_read_nested_column(ColumnPtr& doris_column, DataType
 
         if (def_level < _field_schema->repeated_parent_def_level) {
             for (size_t i = 0; i < loop_read; i++) {
-                ancestor_null_indices.insert(has_read - loop_read + i);
+                ancestor_null_indices.push_back(has_read - loop_read + i);
             }
             ancestor_nulls += loop_read;
             continue;
@@ -24,27 +24,35 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <boost/iterator/iterator_facade.hpp>
+#include <condition_variable>
+#include <mutex>
 #include <ostream>
 
 #include "common/config.h"
+#include "common/exception.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exprs/create_predicate_function.h"
 #include "exprs/hybrid_set.h"
+#include "io/fs/buffered_reader.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "runtime/types.h"
 #include "schema_desc.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/pod_array.h"
+#include "vec/common/typeid_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/types.h"
@@ -119,6 +127,13 @@ Status RowGroupReader::init(
     const size_t MAX_COLUMN_BUF_SIZE = config::parquet_column_max_buffer_mb << 20;
     size_t max_buf_size =
             std::min(MAX_COLUMN_BUF_SIZE, MAX_GROUP_BUF_SIZE / _read_table_columns.size());
+    // MergeRangeFileReader and InMemoryFileReader can not be read concurrently
+    int parallel_decode_min_columns = config::parquet_parallel_decode_min_columns;
+    _parallel_decode = parallel_decode_min_columns > 0 &&
+                       _read_table_columns.size() >=
+                               static_cast<size_t>(std::max(parallel_decode_min_columns, 2)) &&
+                       typeid_cast<io::MergeRangeFileReader*>(_file_reader.get()) == nullptr &&
+                       typeid_cast<io::InMemoryFileReader*>(_file_reader.get()) == nullptr;
     for (const auto& read_table_col : _read_table_columns) {
         auto read_file_col = _table_info_node_ptr->children_file_column_name(read_table_col);
 
@@ -129,8 +144,18 @@ Status RowGroupReader::init(
         const tparquet::OffsetIndex* offset_index =
                 col_offsets.find(physical_index) != col_offsets.end() ? &col_offsets[physical_index]
                                                                       : nullptr;
+        io::IOContext* column_io_ctx = _io_ctx;
+        if (_parallel_decode && _io_ctx != nullptr) {
+            auto& ctx = _column_io_ctxs[read_table_col];
+            ctx = std::make_unique<ColumnIOContext>();
+            ctx->io_ctx = *_io_ctx;
+            if (_io_ctx->file_cache_stats != nullptr) {
+                ctx->io_ctx.file_cache_stats = &ctx->file_cache_stats;
+            }
+            column_io_ctx = &ctx->io_ctx;
+        }
         RETURN_IF_ERROR(ParquetColumnReader::create(_file_reader, field, _row_group_meta,
-                                                    _read_ranges, _ctz, _io_ctx, reader,
+                                                    _read_ranges, _ctz, column_io_ctx, reader,
                                                     max_buf_size, offset_index));
         if (reader == nullptr) {
             VLOG_DEBUG << "Init row group(" << _row_group_id << ") reader failed";
@@ -389,13 +414,14 @@ Status RowGroupReader::_read_column_data(Block* block,
                                          const std::vector<std::string>& table_columns,
                                          size_t batch_size, size_t* read_rows, bool* batch_eof,
                                          FilterMap& filter_map) {
-    size_t batch_read_rows = 0;
-    bool has_eof = false;
-    for (auto& read_col_name : table_columns) {
-        auto& column_with_type_and_name = block->get_by_name(read_col_name);
-        auto& column_ptr = column_with_type_and_name.column;
-        auto& column_type = column_with_type_and_name.type;
-        bool is_dict_filter = false;
+    // The block is changed for the dict filter columns before any column is decoded, so the
+    // columns can be decoded concurrently.
+    std::vector<ColumnWithTypeAndName*> columns(table_columns.size());
+    std::vector<ParquetColumnReader*> column_readers(table_columns.size());
+    std::vector<uint8_t> is_dict_filter(table_columns.size(), false);
+    for (size_t i = 0; i < table_columns.size(); ++i) {
+        const auto& read_col_name = table_columns[i];
+        auto& column_type = block->get_by_name(read_col_name).type;
         for (auto& _dict_filter_col : _dict_filter_cols) {
             if (_dict_filter_col.first == read_col_name) {
                 MutableColumnPtr dict_column = ColumnInt32::create();
@@ -411,28 +437,54 @@ Status RowGroupReader::_read_column_data(Block* block,
                     block->get_by_position(pos).type = std::make_shared<DataTypeInt32>();
                     block->replace_by_position(pos, std::move(dict_column));
                 }
-                is_dict_filter = true;
+                is_dict_filter[i] = true;
                 break;
             }
         }
+        column_readers[i] = _column_readers[read_col_name].get();
+    }
+    for (size_t i = 0; i < table_columns.size(); ++i) {
+        columns[i] = &block->get_by_name(table_columns[i]);
+    }
 
-        size_t col_read_rows = 0;
+    std::vector<size_t> col_read_rows(table_columns.size(), 0);
+    std::vector<uint8_t> col_eofs(table_columns.size(), false);
+    auto decode_column = [&](size_t i) -> Status {
         bool col_eof = false;
         // Should reset _filter_map_index to 0 when reading next column.
         //        select_vector.reset();
-        _column_readers[read_col_name]->reset_filter_map_index();
-        while (!col_eof && col_read_rows < batch_size) {
+        column_readers[i]->reset_filter_map_index();
+        while (!col_eof && col_read_rows[i] < batch_size) {
             size_t loop_rows = 0;
-            RETURN_IF_ERROR(_column_readers[read_col_name]->read_column_data(
-                    column_ptr, column_type, _table_info_node_ptr->get_children_node(read_col_name),
-                    filter_map, batch_size - col_read_rows, &loop_rows, &col_eof, is_dict_filter));
-            col_read_rows += loop_rows;
+            RETURN_IF_ERROR(column_readers[i]->read_column_data(
+                    columns[i]->column, columns[i]->type,
+                    _table_info_node_ptr->get_children_node(table_columns[i]), filter_map,
+                    batch_size - col_read_rows[i], &loop_rows, &col_eof, is_dict_filter[i]));
+            col_read_rows[i] += loop_rows;
         }
-        if (batch_read_rows > 0 && batch_read_rows != col_read_rows) {
+        col_eofs[i] = col_eof;
+        return Status::OK();
+    };
+    int parallel_decode_min_columns = config::parquet_parallel_decode_min_columns;
+    if (_parallel_decode && parallel_decode_min_columns > 0 &&
+        table_columns.size() >= std::max<size_t>(parallel_decode_min_columns, 2)) {
+        Status st = _decode_columns_in_parallel(table_columns.size(), decode_column);
+        _merge_column_io_stats();
+        RETURN_IF_ERROR(st);
+    } else {
+        for (size_t i = 0; i < table_columns.size(); ++i) {
+            RETURN_IF_ERROR(decode_column(i));
+        }
+    }
+
+    size_t batch_read_rows = 0;
+    bool has_eof = false;
+    for (size_t i = 0; i < table_columns.size(); ++i) {
+        if (batch_read_rows > 0 && batch_read_rows != col_read_rows[i]) {
             return Status::Corruption("Can't read the same number of rows among parquet columns");
         }
-        batch_read_rows = col_read_rows;
-        if (col_eof) {
+        batch_read_rows = col_read_rows[i];
+        if (col_eofs[i]) {
             has_eof = true;
         }
     }
@@ -443,6 +495,66 @@ Status RowGroupReader::_read_column_data(Block* block,
     return Status::OK();
 }
 
+Status RowGroupReader::_decode_columns_in_parallel(
+        size_t num_columns, const std::function<Status(size_t)>& decode_column) {
+    struct DecodeContext {
+        // the columns are claimed by the scanner thread and the pool tasks, so a task still
+        // queued when all columns are claimed does nothing and the scanner never waits for it
+        std::atomic<size_t> next_column = 0;
+        std::mutex lock;
+        std::condition_variable cv;
+        size_t finished_columns = 0;
+        Status status;
+    };
+    auto ctx = std::make_shared<DecodeContext>();
+    auto decode_columns = [ctx, num_columns, &decode_column](RuntimeState* attach_state) {
+        size_t i;
+        while ((i = ctx->next_column++) < num_columns) {
+            auto decode = [&]() -> Status {
+                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(decode_column(i));
+                return Status::OK();
+            };
+            Status st;
+            if (attach_state != nullptr) {
+                SCOPED_ATTACH_TASK(attach_state);
+                st = decode();
+            } else {
+                st = decode();
+            }
+            std::lock_guard l(ctx->lock);
+            if (!st.ok() && ctx->status.ok()) {
+                ctx->status = std::move(st);
+            }
+            if (++ctx->finished_columns == num_columns) {
+                ctx->cv.notify_one();
+            }
+        }
+    };
+
+    auto* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    for (size_t i = 1; pool != nullptr && i < num_columns; ++i) {
+        if (!pool->submit_func([decode_columns, state = _state]() { decode_columns(state); })
+                     .ok()) {
+            // the scanner thread decodes the rest
+            break;
+        }
+    }
+    decode_columns(nullptr);
+    std::unique_lock l(ctx->lock);
+    ctx->cv.wait(l, [&]() { return ctx->finished_columns == num_columns; });
+    return ctx->status;
+}
+
+void RowGroupReader::_merge_column_io_stats() {
+    if (_io_ctx == nullptr || _io_ctx->file_cache_stats == nullptr) {
+        return;
+    }
+    for (auto& [_, ctx] : _column_io_ctxs) {
+        _io_ctx->file_cache_stats->merge(ctx->file_cache_stats);
+        ctx->file_cache_stats = io::FileCacheStatistics();
+    }
+}
+
 Status RowGroupReader::_do_lazy_read(Block* block, size_t batch_size, size_t* read_rows,
                                      bool* batch_eof) {
     std::unique_ptr<FilterMap> filter_map_ptr = nullptr;
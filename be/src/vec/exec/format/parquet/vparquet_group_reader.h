@@ -19,6 +19,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string>
@@ -28,6 +29,7 @@
 #include <vector>
 
 #include "io/fs/file_reader_writer_fwd.h"
+#include "io/io_common.h"
 #include "olap/id_manager.h"
 #include "olap/utils.h"
 #include "vec/columns/column.h"
@@ -191,6 +193,11 @@ private:
     Status _read_column_data(Block* block, const std::vector<std::string>& columns,
                              size_t batch_size, size_t* read_rows, bool* batch_eof,
                              FilterMap& filter_map);
+    // Runs `decode_column` for the columns [0, num_columns) on the scanner thread and the
+    // buffered reader prefetch pool.
+    Status _decode_columns_in_parallel(size_t num_columns,
+                                       const std::function<Status(size_t)>& decode_column);
+    void _merge_column_io_stats();
     Status _do_lazy_read(Block* block, size_t batch_size, size_t* read_rows, bool* batch_eof);
     Status _rebuild_filter_map(FilterMap& filter_map, std::unique_ptr<uint8_t[]>& filter_map_data,
                                size_t pre_read_rows) const;
@@ -226,6 +233,15 @@ private:
     int64_t _remaining_rows;
     cctz::time_zone* _ctz = nullptr;
     io::IOContext* _io_ctx = nullptr;
+    // The columns are decoded concurrently, see config::parquet_parallel_decode_min_columns.
+    // Each column then reads with its own copy of `_io_ctx`, whose file cache statistics are
+    // merged into `_io_ctx` after each batch.
+    bool _parallel_decode = false;
+    struct ColumnIOContext {
+        io::IOContext io_ctx;
+        io::FileCacheStatistics file_cache_stats;
+    };
+    std::unordered_map<std::string, std::unique_ptr<ColumnIOContext>> _column_io_ctxs;
     PositionDeleteContext _position_delete_ctx;
     // merge the row ranges generated from page index and position delete.
     std::vector<RowRange> _read_ranges;
@@ -27,6 +27,8 @@
 #include <utility>
 
 #include "common/status.h"
+#include "exec/olap_common.h"
+#include "exec/olap_utils.h"
 #include "exec/schema_scanner.h"
 #include "io/file_factory.h"
 #include "io/fs/buffered_reader.h"
@@ -41,10 +43,12 @@
 #include "util/string_util.h"
 #include "util/timezone_utils.h"
 #include "vec/columns/column.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/typeid_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/exec/format/parquet/parquet_common.h"
 #include "vec/exec/format/parquet/schema_desc.h"
 #include "vec/exec/format/parquet/vparquet_file_metadata.h"
@@ -52,9 +56,11 @@
 #include "vec/exec/format/parquet/vparquet_page_index.h"
 #include "vec/exec/scan/file_scanner.h"
 #include "vec/exprs/vbloom_predicate.h"
+#include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vin_predicate.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/exprs/vruntimefilter_wrapper.h"
 #include "vec/exprs/vslot_ref.h"
 
@@ -133,6 +139,8 @@ void ParquetReader::_init_profile() {
                 _profile, "FilteredRowsByGroup", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_page_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredRowsByPage", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.position_delete_skipped_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "SkippedRowsByPositionDelete", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.lazy_read_filtered_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredRowsByLazyRead", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(
@@ -582,6 +590,60 @@ RowGroupReader::PositionDeleteContext ParquetReader::_get_position_delete_ctx(
                                                  row_group_index.first_row, start_index, end_index);
 }
 
+// The runs of deleted rows shorter than this are left to the position delete filter, as cutting
+// them out of the read ranges costs more seeks than decoding them.
+static constexpr int64_t MIN_SKIPPED_POSITION_DELETE_RUN = 1024;
+
+void ParquetReader::_skip_position_deleted_ranges(
+        const RowGroupReader::PositionDeleteContext& position_delete_ctx,
+        std::vector<RowRange>& candidate_row_ranges) {
+    // the runs of consecutive deleted rows, relative to the row group
+    std::vector<RowRange> deleted_runs;
+    int64_t index = position_delete_ctx.start_index;
+    while (index < position_delete_ctx.end_index) {
+        int64_t run_start = position_delete_ctx.delete_rows[index++];
+        int64_t run_end = run_start + 1;
+        // the delete rows are sorted, but may be duplicated across delete files
+        while (index < position_delete_ctx.end_index &&
+               position_delete_ctx.delete_rows[index] <= run_end) {
+            run_end = std::max(run_end, position_delete_ctx.delete_rows[index++] + 1);
+        }
+        if (run_end - run_start >= MIN_SKIPPED_POSITION_DELETE_RUN) {
+            deleted_runs.emplace_back(run_start - position_delete_ctx.first_row_id,
+                                      run_end - position_delete_ctx.first_row_id);
+        }
+    }
+    if (deleted_runs.empty()) {
+        return;
+    }
+
+    std::vector<RowRange> read_row_ranges;
+    int64_t skipped_rows = 0;
+    size_t run_index = 0;
+    for (const auto& range : candidate_row_ranges) {
+        int64_t from = range.first_row;
+        while (run_index < deleted_runs.size() && deleted_runs[run_index].last_row <= from) {
+            ++run_index;
+        }
+        // a run can cover several ranges, so keep `run_index` at the first overlapping run
+        for (size_t i = run_index;
+             i < deleted_runs.size() && deleted_runs[i].first_row < range.last_row; ++i) {
+            if (deleted_runs[i].first_row > from) {
+                read_row_ranges.emplace_back(from, deleted_runs[i].first_row);
+            }
+            int64_t to = std::min(deleted_runs[i].last_row, range.last_row);
+            skipped_rows += to - std::max(from, deleted_runs[i].first_row);
+            from = to;
+        }
+        if (from < range.last_row) {
+            read_row_ranges.emplace_back(from, range.last_row);
+        }
+    }
+    candidate_row_ranges = std::move(read_row_ranges);
+    _statistics.read_rows -= skipped_rows;
+    _statistics.position_delete_skipped_rows += skipped_rows;
+}
+
 Status ParquetReader::_next_row_group_reader() {
     if (_current_group_reader != nullptr) {
         _current_group_reader->collect_profile_before_close();
@@ -602,6 +664,15 @@ Status ParquetReader::_next_row_group_reader() {
 
     RowGroupReader::PositionDeleteContext position_delete_ctx =
             _get_position_delete_ctx(row_group, row_group_index);
+    if (!_read_line_mode_mode && position_delete_ctx.has_filter &&
+        !candidate_row_ranges.empty()) {
+        _skip_position_deleted_ranges(position_delete_ctx, candidate_row_ranges);
+        if (candidate_row_ranges.empty()) {
+            // all the rows of the row group are deleted
+            _current_group_reader.reset(nullptr);
+            return _next_row_group_reader();
+        }
+    }
     io::FileReaderSPtr group_file_reader;
     if (typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
         // InMemoryFileReader has the ability to merge small IO
@@ -754,6 +825,50 @@ bool ParquetReader::_has_page_index(const std::vector<tparquet::ColumnChunk>& co
     return page_index.check_and_get_page_index_ranges(columns);
 }
 
+Status ParquetReader::_read_page_index(int32_t row_group_id, const PageIndex& page_index,
+                                       std::unique_ptr<ParquetPageIndexData>* page_index_data,
+                                       ObjLRUCache::CacheHandle* handle,
+                                       const ParquetPageIndexData** page_index_buff) {
+    if (_meta_cache != nullptr &&
+        _meta_cache->lookup_parquet_page_index(_file_reader, _file_description.mtime,
+                                               row_group_id, handle)) {
+        *page_index_buff =
+                static_cast<const ParquetPageIndexData*>(handle->data<ParquetPageIndexData>());
+        return Status::OK();
+    }
+    auto data = std::make_unique<ParquetPageIndexData>();
+    data->column_index.resize(page_index._column_index_size);
+    data->offset_index.resize(page_index._offset_index_size);
+    size_t bytes_read = 0;
+    {
+        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
+        RETURN_IF_ERROR(_file_reader->read_at(page_index._column_index_start,
+                                              Slice(data->column_index.data(),
+                                                    data->column_index.size()),
+                                              &bytes_read, _io_ctx));
+        _column_statistics.read_bytes += bytes_read;
+        RETURN_IF_ERROR(_file_reader->read_at(page_index._offset_index_start,
+                                              Slice(data->offset_index.data(),
+                                                    data->offset_index.size()),
+                                              &bytes_read, _io_ctx));
+        _column_statistics.read_bytes += bytes_read;
+    }
+    // read twice: parse column index & parse offset index
+    _column_statistics.meta_read_calls += 2;
+    if (_meta_cache != nullptr) {
+        _meta_cache->insert_parquet_page_index(_file_reader, _file_description.mtime, row_group_id,
+                                               data.get(), handle);
+        if (handle->valid()) {
+            // owned by the cache now
+            *page_index_buff = data.release();
+            return Status::OK();
+        }
+    }
+    *page_index_buff = data.get();
+    *page_index_data = std::move(data);
+    return Status::OK();
+}
+
 Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
                                           const RowGroupReader::RowGroupIndex& row_group_index,
                                           std::vector<RowRange>& candidate_row_ranges) {
@@ -773,9 +888,10 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         _statistics.read_rows += row_group.num_rows;
     };
 
+    bool has_late_value_ranges = _colname_to_value_range == &_late_colname_to_value_range;
     if ((!_enable_filter_by_min_max) || _lazy_read_ctx.has_complex_type ||
-        _lazy_read_ctx.conjuncts.empty() || _colname_to_value_range == nullptr ||
-        _colname_to_value_range->empty()) {
+        (_lazy_read_ctx.conjuncts.empty() && !has_late_value_ranges) ||
+        _colname_to_value_range == nullptr || _colname_to_value_range->empty()) {
         read_whole_row_group();
         return Status::OK();
     }
@@ -784,27 +900,15 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         read_whole_row_group();
         return Status::OK();
     }
-    std::vector<uint8_t> col_index_buff(page_index._column_index_size);
-    size_t bytes_read = 0;
-    Slice result(col_index_buff.data(), page_index._column_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(_file_reader->read_at(page_index._column_index_start, result, &bytes_read,
-                                              _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
+    std::unique_ptr<ParquetPageIndexData> page_index_data;
+    ObjLRUCache::CacheHandle page_index_handle;
+    const ParquetPageIndexData* page_index_buff = nullptr;
+    RETURN_IF_ERROR(_read_page_index(row_group_index.row_group_id, page_index, &page_index_data,
+                                     &page_index_handle, &page_index_buff));
+    const uint8_t* col_index_buff = page_index_buff->column_index.data();
+    const uint8_t* off_index_buff = page_index_buff->offset_index.data();
     auto& schema_desc = _file_metadata->schema();
     std::vector<RowRange> skipped_row_ranges;
-    std::vector<uint8_t> off_index_buff(page_index._offset_index_size);
-    Slice res(off_index_buff.data(), page_index._offset_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(
-                _file_reader->read_at(page_index._offset_index_start, res, &bytes_read, _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
-    // read twice: parse column index & parse offset index
-    _column_statistics.meta_read_calls += 2;
     SCOPED_RAW_TIMER(&_statistics.parse_page_index_time);
 
     for (size_t idx = 0; idx < _read_table_columns.size(); idx++) {
@@ -825,7 +929,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::ColumnIndex column_index;
-        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff.data(), &column_index));
+        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff, &column_index));
         const int64_t num_of_pages = column_index.null_pages.size();
         if (num_of_pages <= 0) {
             continue;
@@ -839,7 +943,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::OffsetIndex offset_index;
-        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff.data(), &offset_index));
+        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff, &offset_index));
         for (int page_id : skipped_page_range) {
             RowRange skipped_row_range;
             RETURN_IF_ERROR(page_index.create_skipped_row_range(offset_index, row_group.num_rows,
@@ -883,6 +987,146 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
     return Status::OK();
 }
 
+// The IN filters with more values are left to the scanner, as the min max filter of the values
+// hardly skips a row group.
+static constexpr size_t MAX_RUNTIME_FILTER_IN_VALUES = 1024;
+
+// Narrows `range` by a runtime filter on its column, which is an IN filter or a comparison with
+// a literal as the min max filters are. Returns false if the filter can not narrow it.
+template <PrimitiveType T>
+static bool narrow_range_by_runtime_filter(VExpr* impl, ColumnValueRange<T>& range) {
+    if constexpr (T == TYPE_DATE || T == TYPE_DATETIME || T == TYPE_HLL) {
+        // the values need a conversion, or are not comparable
+        return false;
+    } else {
+        using CppType = typename ColumnValueRange<T>::CppType;
+        if (impl->node_type() == TExprNodeType::IN_PRED) {
+            auto hybrid_set = impl->get_set_func();
+            if (hybrid_set == nullptr || hybrid_set->contain_null() ||
+                static_cast<size_t>(hybrid_set->size()) > MAX_RUNTIME_FILTER_IN_VALUES) {
+                return false;
+            }
+            auto temp_range = ColumnValueRange<T>::create_empty_column_value_range(
+                    range.is_nullable_col(), range.precision(), range.scale());
+            auto* iter = hybrid_set->begin();
+            while (iter->has_next()) {
+                ColumnValueRange<T>::add_fixed_value_range(
+                        temp_range, reinterpret_cast<CppType*>(const_cast<void*>(iter->get_value())));
+                iter->next();
+            }
+            range.intersection(temp_range);
+            return true;
+        }
+        if (impl->node_type() == TExprNodeType::BINARY_PRED && impl->get_num_children() == 2) {
+            const auto& fn_name =
+                    assert_cast<VectorizedFnCall*>(impl)->fn().name.function_name;
+            if (fn_name != "lt" && fn_name != "le" && fn_name != "gt" && fn_name != "ge") {
+                return false;
+            }
+            int slot_ref_child = impl->get_child(0)->is_slot_ref() ? 0 : 1;
+            auto literal = impl->get_child(1 - slot_ref_child);
+            if (!literal->is_literal() ||
+                remove_nullable(literal->data_type())->get_primitive_type() != T) {
+                return false;
+            }
+            if constexpr (is_decimal(T)) {
+                // the raw value is only comparable at the scale of the column
+                if (literal->data_type()->get_scale() != range.scale()) {
+                    return false;
+                }
+            }
+            auto value = assert_cast<VLiteral*>(literal.get())->get_column_ptr()->get_data_at(0);
+            if (value.data == nullptr) {
+                return false;
+            }
+            SQLFilterOp op = to_olap_filter_type(fn_name, slot_ref_child == 1);
+            if constexpr (is_string_type(T)) {
+                ColumnValueRange<T>::add_value_range(range, op, &value);
+            } else {
+                ColumnValueRange<T>::add_value_range(
+                        range, op, reinterpret_cast<CppType*>(const_cast<char*>(value.data)));
+            }
+            return true;
+        }
+        return false;
+    }
+}
+
+Status ParquetReader::on_late_runtime_filters(const VExprContextSPtrs& conjuncts) {
+    if (!_enable_filter_by_min_max || _read_line_mode_mode || _colname_to_value_range == nullptr ||
+        _t_metadata == nullptr) {
+        return Status::OK();
+    }
+    bool narrowed = false;
+    for (const auto& conjunct : conjuncts) {
+        auto root = conjunct->root();
+        if (root == nullptr || !root->is_rf_wrapper() || root->get_impl() == nullptr) {
+            continue;
+        }
+        auto impl = root->get_impl();
+        if (impl->get_num_children() == 0) {
+            continue;
+        }
+        VExprSPtr slot_ref;
+        for (const auto& child : impl->children()) {
+            if (child->is_slot_ref()) {
+                slot_ref = child;
+                break;
+            }
+        }
+        if (slot_ref == nullptr) {
+            continue;
+        }
+        const auto& col_name = slot_ref->expr_name();
+        if (std::find(_read_table_columns.begin(), _read_table_columns.end(), col_name) ==
+            _read_table_columns.end()) {
+            continue;
+        }
+        auto range_iter = _colname_to_value_range->find(col_name);
+        if (range_iter == _colname_to_value_range->end()) {
+            continue;
+        }
+        auto range = range_iter->second;
+        bool range_narrowed = std::visit(
+                [&](auto&& col_range) {
+                    if (remove_nullable(slot_ref->data_type())->get_primitive_type() !=
+                        col_range.type()) {
+                        return false;
+                    }
+                    return narrow_range_by_runtime_filter(impl.get(), col_range);
+                },
+                range);
+        if (!range_narrowed) {
+            continue;
+        }
+        if (_colname_to_value_range != &_late_colname_to_value_range) {
+            _late_colname_to_value_range = *_colname_to_value_range;
+            _colname_to_value_range = &_late_colname_to_value_range;
+        }
+        _late_colname_to_value_range[col_name] = std::move(range);
+        narrowed = true;
+    }
+    if (!narrowed) {
+        return Status::OK();
+    }
+
+    SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
+    for (auto it = _read_row_groups.begin(); it != _read_row_groups.end();) {
+        const auto& row_group = _t_metadata->row_groups[it->row_group_id];
+        bool filter_group = false;
+        RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns, &filter_group));
+        if (filter_group) {
+            _statistics.read_row_groups--;
+            _statistics.filtered_row_groups++;
+            _statistics.filtered_group_rows += row_group.num_rows;
+            it = _read_row_groups.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return Status::OK();
+}
+
 Status ParquetReader::_process_row_group_filter(
         const RowGroupReader::RowGroupIndex& row_group_index, const tparquet::RowGroup& row_group,
         bool* filter_group) {
@@ -1031,6 +1275,8 @@ void ParquetReader::_collect_profile() {
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
+    COUNTER_UPDATE(_parquet_profile.position_delete_skipped_rows,
+                   _statistics.position_delete_skipped_rows);
     COUNTER_UPDATE(_parquet_profile.lazy_read_filtered_rows, _statistics.lazy_read_filtered_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_bytes, _statistics.filtered_bytes);
     COUNTER_UPDATE(_parquet_profile.raw_rows_read, _statistics.read_rows);
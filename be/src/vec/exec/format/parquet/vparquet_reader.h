@@ -78,6 +78,7 @@ public:
         int32_t read_row_groups = 0;
         int64_t filtered_group_rows = 0;
         int64_t filtered_page_rows = 0;
+        int64_t position_delete_skipped_rows = 0;
         int64_t lazy_read_filtered_rows = 0;
         int64_t read_rows = 0;
         int64_t filtered_bytes = 0;
@@ -121,6 +122,11 @@ public:
 
     Status get_next_block(Block* block, size_t* read_rows, bool* eof) override;
 
+    // Narrows the value ranges by the IN and min max runtime filters, and skips the row groups
+    // not read yet that the row group statistics rule out. The page indexes of the row groups
+    // read afterwards are filtered by the narrowed ranges as well.
+    Status on_late_runtime_filters(const VExprContextSPtrs& conjuncts) override;
+
     Status close() override;
 
     RowRange get_whole_range() { return _whole_range; }
@@ -166,6 +172,7 @@ private:
         RuntimeProfile::Counter* to_read_row_groups = nullptr;
         RuntimeProfile::Counter* filtered_group_rows = nullptr;
         RuntimeProfile::Counter* filtered_page_rows = nullptr;
+        RuntimeProfile::Counter* position_delete_skipped_rows = nullptr;
         RuntimeProfile::Counter* lazy_read_filtered_rows = nullptr;
         RuntimeProfile::Counter* filtered_bytes = nullptr;
         RuntimeProfile::Counter* raw_rows_read = nullptr;
@@ -204,6 +211,11 @@ private:
     RowGroupReader::PositionDeleteContext _get_position_delete_ctx(
             const tparquet::RowGroup& row_group,
             const RowGroupReader::RowGroupIndex& row_group_index);
+    // Removes the long runs of position deleted rows from the ranges to read, so the pages
+    // holding only deleted rows are not decoded.
+    void _skip_position_deleted_ranges(
+            const RowGroupReader::PositionDeleteContext& position_delete_ctx,
+            std::vector<RowRange>& candidate_row_ranges);
     Status _init_row_groups(const bool& is_filter_groups);
     void _init_system_properties();
     void _init_file_description();
@@ -215,6 +227,12 @@ private:
 
     // Row Group Filter
     bool _is_misaligned_range_group(const tparquet::RowGroup& row_group);
+    // Reads the page indexes of a row group, or gets them from the meta cache. The buffers
+    // are owned by `page_index_data` or `handle`.
+    Status _read_page_index(int32_t row_group_id, const PageIndex& page_index,
+                            std::unique_ptr<ParquetPageIndexData>* page_index_data,
+                            ObjLRUCache::CacheHandle* handle,
+                            const ParquetPageIndexData** page_index_buff);
     Status _process_column_stat_filter(const std::vector<tparquet::ColumnChunk>& column_meta,
                                        bool* filter_group);
     Status _process_row_group_filter(const RowGroupReader::RowGroupIndex& row_group_index,
@@ -263,6 +281,9 @@ private:
             TableSchemaChangeHelper::ConstNode::get_instance();
 
     const std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
+    // A copy of the value ranges narrowed by the late runtime filters,
+    // `_colname_to_value_range` points to it once a filter narrowed a range.
+    std::unordered_map<std::string, ColumnValueRangeType> _late_colname_to_value_range;
 
     //sequence in file, need to read
     std::vector<std::string> _read_table_columns;
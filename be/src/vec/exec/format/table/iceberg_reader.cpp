@@ -143,62 +143,47 @@ Status IcebergTableReader::init_row_filters() {
 
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
-    bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<DataTypePtr> equality_delete_col_types;
-    std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
-            partition_columns;
-    std::unordered_map<std::string, VExprContextSPtr> missing_columns;
-
+    std::vector<Block*> delete_blocks;
     for (const auto& delete_file : delete_files) {
-        TFileRangeDesc delete_desc;
-        // must use __set() method to make sure __isset is true
-        delete_desc.__set_fs_name(_range.fs_name);
-        delete_desc.path = delete_file.path;
-        delete_desc.start_offset = 0;
-        delete_desc.size = -1;
-        delete_desc.file_size = -1;
-        std::unique_ptr<GenericReader> delete_reader = _create_equality_reader(delete_desc);
-        if (!init_schema) {
-            RETURN_IF_ERROR(delete_reader->init_schema_reader());
-            RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
-                                                             &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
-                                            equality_delete_col_types);
-            init_schema = true;
-        }
-        if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
-            RETURN_IF_ERROR(parquet_reader->init_reader(
-                    equality_delete_col_names, nullptr, {}, nullptr, nullptr, nullptr, nullptr,
-                    nullptr, TableSchemaChangeHelper::ConstNode::get_instance(), false));
-        } else if (auto* orc_reader = typeid_cast<OrcReader*>(delete_reader.get())) {
-            RETURN_IF_ERROR(orc_reader->init_reader(&equality_delete_col_names, nullptr, {}, false,
-                                                    {}, {}, nullptr, nullptr));
-        } else {
-            return Status::InternalError("Unsupported format of delete file");
+        SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+        Status create_status = Status::OK();
+        // The equality delete files of a snapshot are shared by most data files, so read each
+        // of them once and let all the scanners of the scan node share the immutable block.
+        auto* delete_block = _kv_cache->get<Block>(
+                _equality_delete_file_cache_key(delete_file.path), [&]() -> Block* {
+                    auto* block = new Block;
+                    create_status = _read_equality_delete_file(delete_file.path, block);
+                    if (!create_status) {
+                        delete block;
+                        return nullptr;
+                    }
+                    return block;
+                });
+        RETURN_IF_ERROR(create_status);
+        if (!delete_blocks.empty() && delete_blocks.front()->columns() != delete_block->columns()) {
+            return Status::InternalError("Equality delete file '{}' has a different schema",
+                                         delete_file.path);
         }
+        delete_blocks.emplace_back(delete_block);
+    }
 
-        RETURN_IF_ERROR(delete_reader->set_fill_columns(partition_columns, missing_columns));
-
-        bool eof = false;
-        while (!eof) {
-            Block block;
-            _generate_equality_delete_block(&block, equality_delete_col_names,
-                                            equality_delete_col_types);
-            size_t read_rows = 0;
-            RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
-            if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
-                RETURN_IF_ERROR(mutable_block.merge(block));
-            }
+    Block* equality_delete_block = delete_blocks.front();
+    if (delete_blocks.size() > 1) {
+        // Merge into a private block, the cached blocks are shared by other scanners
+        _equality_delete_block = equality_delete_block->clone_empty();
+        MutableBlock mutable_block(&_equality_delete_block);
+        for (const Block* delete_block : delete_blocks) {
+            RETURN_IF_ERROR(mutable_block.merge(*delete_block));
         }
+        equality_delete_block = &_equality_delete_block;
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
+
+    for (const auto& column_and_type : *equality_delete_block) {
+        const std::string& delete_col = column_and_type.name;
         if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
             _all_required_col_names.end()) {
             _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
+            DataTypePtr data_type = make_nullable(column_and_type.type);
             MutableColumnPtr data_column = data_type->create_column();
             _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
         }
@@ -206,10 +191,59 @@ Status IcebergTableReader::_equality_delete_base(
     for (const std::string& delete_col : _expand_col_names) {
         _all_required_col_names.emplace_back(delete_col);
     }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
+    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(equality_delete_block);
     return _equality_delete_impl->init(_profile);
 }
 
+Status IcebergTableReader::_read_equality_delete_file(const std::string& delete_file_path,
+                                                      Block* delete_block) {
+    std::vector<std::string> equality_delete_col_names;
+    std::vector<DataTypePtr> equality_delete_col_types;
+    std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
+            partition_columns;
+    std::unordered_map<std::string, VExprContextSPtr> missing_columns;
+
+    TFileRangeDesc delete_desc;
+    // must use __set() method to make sure __isset is true
+    delete_desc.__set_fs_name(_range.fs_name);
+    delete_desc.path = delete_file_path;
+    delete_desc.start_offset = 0;
+    delete_desc.size = -1;
+    delete_desc.file_size = -1;
+    std::unique_ptr<GenericReader> delete_reader = _create_equality_reader(delete_desc);
+    RETURN_IF_ERROR(delete_reader->init_schema_reader());
+    RETURN_IF_ERROR(
+            delete_reader->get_parsed_schema(&equality_delete_col_names, &equality_delete_col_types));
+    _generate_equality_delete_block(delete_block, equality_delete_col_names,
+                                    equality_delete_col_types);
+    if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
+        RETURN_IF_ERROR(parquet_reader->init_reader(
+                equality_delete_col_names, nullptr, {}, nullptr, nullptr, nullptr, nullptr,
+                nullptr, TableSchemaChangeHelper::ConstNode::get_instance(), false));
+    } else if (auto* orc_reader = typeid_cast<OrcReader*>(delete_reader.get())) {
+        RETURN_IF_ERROR(orc_reader->init_reader(&equality_delete_col_names, nullptr, {}, false, {},
+                                                {}, nullptr, nullptr));
+    } else {
+        return Status::InternalError("Unsupported format of delete file");
+    }
+
+    RETURN_IF_ERROR(delete_reader->set_fill_columns(partition_columns, missing_columns));
+
+    bool eof = false;
+    while (!eof) {
+        Block block;
+        _generate_equality_delete_block(&block, equality_delete_col_names,
+                                        equality_delete_col_types);
+        size_t read_rows = 0;
+        RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
+        if (read_rows > 0) {
+            MutableBlock mutable_block(delete_block);
+            RETURN_IF_ERROR(mutable_block.merge(block));
+        }
+    }
+    return Status::OK();
+}
+
 void IcebergTableReader::_generate_equality_delete_block(
         Block* block, const std::vector<std::string>& equality_delete_col_names,
         const std::vector<DataTypePtr>& equality_delete_col_types) {
@@ -112,9 +112,15 @@ protected:
 
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
 
+    static std::string _equality_delete_file_cache_key(const std::string& path) {
+        return "equality_delete_" + path;
+    }
+
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    // Read all the rows of an equality delete file into `delete_block`
+    Status _read_equality_delete_file(const std::string& delete_file_path, Block* delete_block);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(Block* block,
@@ -149,7 +155,7 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
+    // equality delete, only used when merging several cached delete blocks
     Block _equality_delete_block;
     std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
 };
@@ -101,6 +101,10 @@ public:
 
     bool fill_all_columns() const override { return _file_format_reader->fill_all_columns(); }
 
+    Status on_late_runtime_filters(const VExprContextSPtrs& conjuncts) override {
+        return _file_format_reader->on_late_runtime_filters(conjuncts);
+    }
+
     virtual Status init_row_filters() = 0;
 
 protected:
@@ -430,6 +430,12 @@ Status FileScanner::_get_block_wrapped(RuntimeState* state, Block* block, bool*
         // For query job, simply set _src_block_ptr to block.
         size_t read_rows = 0;
         RETURN_IF_ERROR(_init_src_block(block));
+        if (_cur_reader_takes_late_rf && _conjuncts.size() > _cur_reader_conjuncts_num) {
+            VExprContextSPtrs late_conjuncts(_conjuncts.begin() + _cur_reader_conjuncts_num,
+                                             _conjuncts.end());
+            RETURN_IF_ERROR(_cur_reader->on_late_runtime_filters(late_conjuncts));
+            _cur_reader_conjuncts_num = _conjuncts.size();
+        }
         {
             SCOPED_TIMER(_get_block_timer);
 
@@ -945,6 +951,7 @@ Status FileScanner::_get_next_reader() {
         }
 
         bool need_to_get_parsed_schema = false;
+        _cur_reader_takes_late_rf = false;
         switch (format_type) {
         case TFileFormatType::FORMAT_JNI: {
             if (range.__isset.table_format_params &&
@@ -1006,6 +1013,8 @@ Status FileScanner::_get_next_reader() {
             parquet_reader->set_push_down_agg_type(_get_push_down_agg_type());
             if (push_down_predicates) {
                 RETURN_IF_ERROR(_process_late_arrival_conjuncts());
+                _cur_reader_takes_late_rf = true;
+                _cur_reader_conjuncts_num = _push_down_conjuncts.size();
             }
             RETURN_IF_ERROR(_init_parquet_reader(std::move(parquet_reader)));
 
@@ -1022,6 +1031,9 @@ Status FileScanner::_get_next_reader() {
             }
 
             orc_reader->set_push_down_agg_type(_get_push_down_agg_type());
+            if (_should_enable_file_meta_cache()) {
+                orc_reader->set_file_meta_cache(ExecEnv::GetInstance()->file_meta_cache());
+            }
             if (push_down_predicates) {
                 RETURN_IF_ERROR(_process_late_arrival_conjuncts());
             }
@@ -179,6 +179,11 @@ protected:
     Block _src_block;
 
     VExprContextSPtrs _push_down_conjuncts;
+    // Whether the current reader was given the pushed down conjuncts, and how many of
+    // `_conjuncts` it has seen. The runtime filters arriving after are passed to it by
+    // `on_late_runtime_filters` before its next block.
+    bool _cur_reader_takes_late_rf = false;
+    size_t _cur_reader_conjuncts_num = 0;
     VExprContextSPtrs _runtime_filter_partition_prune_ctxs;
     Block _runtime_filter_partition_prune_block;
 
@@ -38,6 +38,7 @@
 #include "common/consts.h"
 #include "common/logging.h"
 #include "exec/olap_utils.h"
+#include "exprs/create_predicate_function.h"
 #include "exprs/function_filter.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/io_common.h"
@@ -45,6 +46,7 @@
 #include "olap/inverted_index_profile.h"
 #include "olap/olap_common.h"
 #include "olap/olap_tuple.h"
+#include "olap/predicate_creator.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/schema_cache.h"
@@ -64,6 +66,7 @@
 #include "vec/core/block.h"
 #include "vec/exec/scan/scan_node.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/json/path_in_data.h"
 #include "vec/olap/block_reader.h"
 
@@ -234,6 +237,12 @@ Status OlapScanner::open(RuntimeState* state) {
     RETURN_IF_ERROR(Scanner::open(state));
     SCOPED_TIMER(_local_state->cast<pipeline::OlapScanLocalState>()._reader_init_timer);
 
+    if (config::enable_synchronized_scan && !_tablet_reader_params.rs_splits.empty()) {
+        const auto& split = _tablet_reader_params.rs_splits.front();
+        _tablet_reader_params.tablet->set_scan_position(split.rs_reader->rowset()->rowset_id(),
+                                                        split.segment_offsets.first);
+    }
+
     auto res = _tablet_reader->init(_tablet_reader_params);
     if (!res.ok()) {
         std::stringstream ss;
@@ -244,11 +253,21 @@ Status OlapScanner::open(RuntimeState* state) {
     }
 
     // Do not hold rs_splits any more to release memory.
+    _num_rowsets_read = _tablet_reader_params.rs_splits.size();
     _tablet_reader_params.rs_splits.clear();
 
     return Status::OK();
 }
 
+bool OlapScanner::reads_segment(const RowsetId& rowset_id, int64_t segment_id) const {
+    return std::any_of(_tablet_reader_params.rs_splits.begin(),
+                       _tablet_reader_params.rs_splits.end(), [&](const RowSetSplits& split) {
+                           return split.rs_reader->rowset()->rowset_id() == rowset_id &&
+                                  split.segment_offsets.first <= segment_id &&
+                                  segment_id < split.segment_offsets.second;
+                       });
+}
+
 // it will be called under tablet read lock because capture rs readers need
 Status OlapScanner::_init_tablet_reader_params(
         const std::vector<OlapScanRange*>& key_ranges,
@@ -286,6 +305,11 @@ Status OlapScanner::_init_tablet_reader_params(
     }
 
     _tablet_reader_params.common_expr_ctxs_push_down = _common_expr_ctxs_push_down;
+    // The runtime filters arrived so far are normalized by the scan operator already.
+    for (auto& conjunct : _conjuncts) {
+        _pushed_down_conjunct_roots.insert(conjunct->root().get());
+    }
+    _tablet_reader_params.late_arrival_rf_predicates = &_late_arrival_rf_predicates;
     _tablet_reader_params.output_columns =
             ((pipeline::OlapScanLocalState*)_local_state)->_maybe_read_column_ids;
     for (const auto& ele :
@@ -517,6 +541,7 @@ doris::TabletStorageType OlapScanner::get_storage_type() {
 }
 
 Status OlapScanner::_get_block_impl(RuntimeState* state, Block* block, bool* eof) {
+    _push_down_late_arrival_runtime_filters();
     // Read one block from block reader
     // ATTN: Here we need to let the _get_block_impl method guarantee the semantics of the interface,
     // that is, eof can be set to true only when the returned block is empty.
@@ -528,6 +553,60 @@ Status OlapScanner::_get_block_impl(RuntimeState* state, Block* block, bool* eof
     return Status::OK();
 }
 
+static bool is_integer_field(FieldType type) {
+    return type == FieldType::OLAP_FIELD_TYPE_TINYINT ||
+           type == FieldType::OLAP_FIELD_TYPE_SMALLINT || type == FieldType::OLAP_FIELD_TYPE_INT ||
+           type == FieldType::OLAP_FIELD_TYPE_BIGINT || type == FieldType::OLAP_FIELD_TYPE_LARGEINT;
+}
+
+void OlapScanner::_push_down_late_arrival_runtime_filters() {
+    const auto& tablet_schema = *_tablet_reader_params.tablet_schema;
+    for (const auto& conjunct : _conjuncts) {
+        const auto& root = conjunct->root();
+        if (!root->is_rf_wrapper() || !_pushed_down_conjunct_roots.insert(root.get()).second) {
+            continue;
+        }
+        auto impl = root->get_impl();
+        if (impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        int32_t index = tablet_schema.field_index(impl->children()[0]->expr_name());
+        if (index < 0) {
+            continue;
+        }
+        const TabletColumn& column = tablet_schema.column(index);
+        // Only the columns whose predicates are pushed down to every rowset in
+        // `TabletReader::_init_conditions_param`.
+        if (column.is_variant_type() || column.is_extracted_column() ||
+            column.aggregation() != FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE) {
+            continue;
+        }
+
+        // The null aware runtime filters are NULL_AWARE_IN_PRED and NULL_AWARE_BINARY_PRED,
+        // they keep the null rows and are not pushed down.
+        ColumnPredicate* predicate = nullptr;
+        if (impl->node_type() == TExprNodeType::IN_PRED && impl->get_set_func() != nullptr) {
+            predicate = create_column_predicate(index, impl->get_set_func(), column.type(),
+                                                &column);
+        } else if (impl->node_type() == TExprNodeType::BINARY_PRED &&
+                   impl->children().size() == 2 && impl->children()[1]->is_literal() &&
+                   is_integer_field(column.type())) {
+            // MIN_FILTER and MAX_FILTER, the literal is printed as the integer it holds.
+            auto value = assert_cast<const VLiteral*>(impl->children()[1].get())->value();
+            if (impl->op() == TExprOpcode::GE) {
+                predicate = create_comparison_predicate<PredicateType::GE>(
+                        column, index, value, false, _late_arrival_rf_arena);
+            } else if (impl->op() == TExprOpcode::LE) {
+                predicate = create_comparison_predicate<PredicateType::LE>(
+                        column, index, value, false, _late_arrival_rf_arena);
+            }
+        }
+        if (predicate != nullptr) {
+            _late_arrival_rf_predicates.emplace_back(predicate);
+        }
+    }
+}
+
 Status OlapScanner::close(RuntimeState* state) {
     if (_is_closed) {
         return Status::OK();
@@ -738,6 +817,9 @@ void OlapScanner::_collect_profile_before_close() {
     tablet->query_scan_bytes->increment(local_state->_read_uncompressed_counter->value());
     tablet->query_scan_rows->increment(local_state->_scan_rows->value());
     tablet->query_scan_count->increment(1);
+    tablet->update_read_amplification(_num_rowsets_read,
+                                      stats.total_segment_number - stats.filtered_segment_number,
+                                      stats.rows_del_by_bitmap);
 }
 
 } // namespace doris::vectorized
@@ -34,6 +34,7 @@
 #include "olap/tablet.h"
 #include "olap/tablet_reader.h"
 #include "olap/tablet_schema.h"
+#include "vec/common/arena.h"
 #include "vec/exec/scan/scanner.h"
 
 namespace doris {
@@ -79,6 +80,11 @@ public:
 
     void update_realtime_counters() override;
 
+    const BaseTabletSPtr& tablet() const { return _tablet_reader_params.tablet; }
+
+    // Whether the scanner reads segment `segment_id` of `rowset_id`, only before it is opened.
+    bool reads_segment(const RowsetId& rowset_id, int64_t segment_id) const;
+
 protected:
     Status _get_block_impl(RuntimeState* state, Block* block, bool* eos) override;
     void _collect_profile_before_close() override;
@@ -92,13 +98,23 @@ private:
     [[nodiscard]] Status _init_return_columns();
     [[nodiscard]] Status _init_variant_columns();
 
+    // Turns the runtime filters arriving after `init` into column predicates, so that the
+    // segments which are not initialized yet can be pruned by zone map and bloom filter index.
+    void _push_down_late_arrival_runtime_filters();
+
     std::vector<OlapScanRange*> _key_ranges;
 
     TabletReader::ReaderParams _tablet_reader_params;
     std::unique_ptr<TabletReader> _tablet_reader;
+    // rs_splits are released after the reader is initialized
+    int64_t _num_rowsets_read = 0;
 
     std::vector<uint32_t> _return_columns;
     std::unordered_set<uint32_t> _tablet_columns_convert_to_null_set;
+
+    std::unordered_set<const VExpr*> _pushed_down_conjunct_roots;
+    std::vector<std::shared_ptr<ColumnPredicate>> _late_arrival_rf_predicates;
+    Arena _late_arrival_rf_arena;
 };
 } // namespace vectorized
 } // namespace doris
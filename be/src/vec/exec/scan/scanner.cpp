@@ -56,6 +56,7 @@ Status Scanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts)
             RETURN_IF_ERROR(projections[i]->clone(state, _projections[i]));
         }
     }
+    _equal_projections = VExprContext::find_equal_exprs(_projections);
 
     const auto& intermediate_projections = _local_state->_intermediate_projections;
     if (!intermediate_projections.empty()) {
@@ -66,6 +67,8 @@ Status Scanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts)
                 RETURN_IF_ERROR(intermediate_projections[i][j]->clone(
                         state, _intermediate_projections[i][j]));
             }
+            _equal_intermediate_projections.push_back(
+                    VExprContext::find_equal_exprs(_intermediate_projections[i]));
         }
     }
 
@@ -151,7 +154,15 @@ Status Scanner::_filter_output_block(Block* block) {
         return Status::OK();
     }
     auto old_rows = block->rows();
-    Status st = VExprContext::filter_block(_conjuncts, block, block->columns());
+    // Evaluate the conjuncts in the order of their observed cost and selectivity. `_conjuncts`
+    // keeps the planner's order, as the late arrival runtime filters are appended to it.
+    if (_ordered_conjuncts.size() != _conjuncts.size()) {
+        _ordered_conjuncts = _conjuncts;
+        _num_filtered_blocks = 0;
+    } else if (++_num_filtered_blocks % REORDER_CONJUNCTS_INTERVAL == 0) {
+        VExprContext::reorder_conjuncts(_ordered_conjuncts);
+    }
+    Status st = VExprContext::filter_block(_ordered_conjuncts, block, block->columns());
     _counter.num_rows_unselected += old_rows - block->rows();
     return st;
 }
@@ -167,9 +178,15 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
     vectorized::Block input_block = *origin_block;
 
     std::vector<int> result_column_ids;
-    for (auto& projections : _intermediate_projections) {
+    for (size_t level = 0; level < _intermediate_projections.size(); ++level) {
+        const auto& projections = _intermediate_projections[level];
+        const auto& equal_projections = _equal_intermediate_projections[level];
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
+            if (equal_projections[i] != -1) {
+                result_column_ids[i] = result_column_ids[equal_projections[i]];
+                continue;
+            }
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
         }
         input_block.shuffle_columns(result_column_ids);
@@ -183,9 +200,14 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
 
     DCHECK_EQ(mutable_columns.size(), _projections.size());
 
+    result_column_ids.resize(mutable_columns.size());
     for (int i = 0; i < mutable_columns.size(); ++i) {
-        auto result_column_id = -1;
-        RETURN_IF_ERROR(_projections[i]->execute(&input_block, &result_column_id));
+        auto& result_column_id = result_column_ids[i];
+        if (_equal_projections[i] != -1) {
+            result_column_id = result_column_ids[_equal_projections[i]];
+        } else {
+            RETURN_IF_ERROR(_projections[i]->execute(&input_block, &result_column_id));
+        }
         auto column_ptr = input_block.get_by_position(result_column_id)
                                   .column->convert_to_full_column_if_const();
         //TODO: this is a quick fix, we need a new function like "change_to_nullable" to do it
@@ -67,6 +67,7 @@ public:
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_state->query_mem_tracker());
         _input_block.clear();
         _conjuncts.clear();
+        _ordered_conjuncts.clear();
         _projections.clear();
         _origin_block.clear();
         _common_expr_ctxs_push_down.clear();
@@ -176,6 +177,7 @@ protected:
             _stale_expr_ctxs.emplace_back(conjunct);
         }
         _conjuncts.clear();
+        _ordered_conjuncts.clear();
     }
 
     RuntimeState* _state = nullptr;
@@ -205,9 +207,16 @@ protected:
     // Cloned from _conjuncts of scan node.
     // It includes predicate in SQL and runtime filters.
     VExprContextSPtrs _conjuncts;
+    // `_conjuncts` reordered by VExprContext::reorder_conjuncts every few blocks
+    VExprContextSPtrs _ordered_conjuncts;
+    int64_t _num_filtered_blocks = 0;
+    static constexpr int64_t REORDER_CONJUNCTS_INTERVAL = 16;
     VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The earlier projection with the same expr of each projection, or -1
+    std::vector<int> _equal_projections;
+    std::vector<std::vector<int>> _equal_intermediate_projections;
     vectorized::Block _origin_block;
 
     VExprContextSPtrs _common_expr_ctxs_push_down;
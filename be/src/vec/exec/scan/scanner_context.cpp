@@ -120,7 +120,10 @@ Status ScannerContext::init() {
         std::shared_ptr<TaskExecutor> task_executor = task_executor_scheduler->task_executor();
         vectorized::TaskId task_id(fmt::format("{}-{}", print_id(_state->query_id()), ctx_id));
         _task_handle = DORIS_TRY(task_executor->create_task(
-                task_id, []() { return 0.0; },
+                task_id,
+                [queue_utilization = _queue_utilization]() {
+                    return queue_utilization->load(std::memory_order_relaxed);
+                },
                 config::task_executor_initial_max_concurrency_per_task,
                 std::chrono::milliseconds(100), std::nullopt));
     }
@@ -233,6 +236,7 @@ vectorized::BlockUPtr ScannerContext::get_free_block(bool force) {
     if (_free_blocks.try_dequeue(block)) {
         DCHECK(block->mem_reuse());
         _block_memory_usage -= block->allocated_bytes();
+        _update_queue_utilization();
         _scanner_memory_used_counter->set(_block_memory_usage);
         // A free block is reused, so the memory usage should be decreased
         // The caller of get_free_block will increase the memory usage
@@ -250,6 +254,7 @@ void ScannerContext::return_free_block(vectorized::BlockUPtr block) {
         _block_memory_usage < _max_bytes_in_queue) {
         size_t block_size_to_reuse = block->allocated_bytes();
         _block_memory_usage += block_size_to_reuse;
+        _update_queue_utilization();
         _scanner_memory_used_counter->set(_block_memory_usage);
         block->clear_column_data();
         // Free blocks is used to improve memory efficiency. Failure during pushing back
@@ -332,6 +337,7 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
             auto [current_block, block_size] = std::move(scan_task->cached_blocks.front());
             scan_task->cached_blocks.pop_front();
             _block_memory_usage -= block_size;
+            _update_queue_utilization();
             // consume current block
             block->swap(*current_block);
             return_free_block(std::move(current_block));
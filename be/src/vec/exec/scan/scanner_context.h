@@ -132,7 +132,10 @@ public:
     vectorized::BlockUPtr get_free_block(bool force);
     void return_free_block(vectorized::BlockUPtr block);
     void clear_free_blocks();
-    inline void inc_block_usage(size_t usage) { _block_memory_usage += usage; }
+    inline void inc_block_usage(size_t usage) {
+        _block_memory_usage += usage;
+        _update_queue_utilization();
+    }
 
     int64_t block_memory_usage() { return _block_memory_usage; }
 
@@ -251,6 +254,18 @@ protected:
     std::shared_ptr<doris::vectorized::TaskHandle> _task_handle;
 
     std::atomic<int64_t> _block_memory_usage = 0;
+    // `_block_memory_usage` relative to `_max_bytes_in_queue`, reported to the task executor
+    // which runs fewer scanners of this context when the blocks are not consumed fast enough.
+    // Shared with the task handle since the executor may still poll it after the context is gone.
+    std::shared_ptr<std::atomic<double>> _queue_utilization =
+            std::make_shared<std::atomic<double>>(0);
+    void _update_queue_utilization() {
+        if (_max_bytes_in_queue > 0) {
+            _queue_utilization->store(
+                    static_cast<double>(_block_memory_usage) / (double)_max_bytes_in_queue,
+                    std::memory_order_relaxed);
+        }
+    }
 
     // adaptive scan concurrency related
 
@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcompound_pred.h"
+
+#include <fmt/format.h>
+#include <glog/logging.h>
+#include <hs/hs_runtime.h>
+
+#include "runtime/primitive_type.h"
+#include "udf/udf.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+#include "vec/functions/like.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+static void collect_or_leaves(const VExprSPtr& expr, VExprSPtrs& leaves) {
+    if (expr->is_compound_predicate() && expr->fn().name.function_name == "or") {
+        for (const auto& child : expr->children()) {
+            collect_or_leaves(child, leaves);
+        }
+    } else {
+        leaves.push_back(expr);
+    }
+}
+
+void VCompoundPred::_init_multi_pattern() {
+    _multi_pattern_slot.reset();
+    _multi_patterns.clear();
+    if (_op != TExprOpcode::COMPOUND_OR || is_constant()) {
+        return;
+    }
+
+    VExprSPtrs leaves;
+    for (const auto& child : _children) {
+        collect_or_leaves(child, leaves);
+    }
+    const VSlotRef* slot_ref = nullptr;
+    std::vector<std::string> patterns;
+    for (const auto& leaf : leaves) {
+        if (leaf->node_type() != TExprNodeType::FUNCTION_CALL ||
+            leaf->fn().binary_type != TFunctionBinaryType::BUILTIN ||
+            leaf->get_num_children() != 2) {
+            return;
+        }
+        const auto& name = leaf->fn().name.function_name;
+        bool is_like = name == FunctionLike::name;
+        if (!is_like && name != FunctionRegexpLike::name && name != FunctionRegexpLike::alias) {
+            return;
+        }
+        const auto* leaf_slot = dynamic_cast<const VSlotRef*>(leaf->get_child(0).get());
+        const auto* literal = dynamic_cast<const VLiteral*>(leaf->get_child(1).get());
+        if (leaf_slot == nullptr || literal == nullptr ||
+            !is_string_type(remove_nullable(leaf_slot->data_type())->get_primitive_type()) ||
+            (slot_ref != nullptr && slot_ref->column_id() != leaf_slot->column_id())) {
+            return;
+        }
+        slot_ref = leaf_slot;
+        const auto& pattern_column = literal->get_column_ptr();
+        if (pattern_column->is_null_at(0)) {
+            return;
+        }
+        std::string pattern = pattern_column->get_data_at(0).to_string();
+        if (is_like) {
+            std::string re_pattern;
+            FunctionLike::convert_like_pattern(nullptr, pattern, &re_pattern);
+            pattern.swap(re_pattern);
+        }
+        patterns.push_back(std::move(pattern));
+    }
+
+    _multi_pattern_slot = leaves[0]->get_child(0);
+    _multi_patterns = std::move(patterns);
+}
+
+const hs_database_t* VCompoundPred::_get_multi_pattern_database() {
+    if (_multi_patterns.empty()) {
+        return nullptr;
+    }
+    std::call_once(_multi_pattern_compiled, [this]() {
+        hs_database_t* database = nullptr;
+        if (Status st = FunctionLikeBase::hs_prepare_multi(_multi_patterns, &database); st.ok()) {
+            _multi_pattern_database.reset(database, hs_free_database);
+        } else {
+            // fallback to evaluate every pattern on its own
+            LOG(INFO) << "expr:" << _expr_name << " fallback from multi pattern matching, "
+                      << st.to_string();
+        }
+    });
+    return _multi_pattern_database.get();
+}
+
+Status VCompoundPred::_execute_multi_pattern(VExprContext* context, Block* block,
+                                             const hs_database_t* database,
+                                             int* result_column_id) {
+    // the scratch space is per thread, keep it in the thread local state of this context
+    FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
+    auto* scratch = reinterpret_cast<hs_scratch_t*>(
+            fn_ctx->get_function_state(FunctionContext::THREAD_LOCAL));
+    if (scratch == nullptr) {
+        if (hs_alloc_scratch(database, &scratch) != HS_SUCCESS) {
+            return Status::RuntimeError("hs_alloc_scratch allocate scratch space error");
+        }
+        fn_ctx->set_function_state(FunctionContext::THREAD_LOCAL,
+                                   std::shared_ptr<hs_scratch_t>(scratch, hs_free_scratch));
+    }
+
+    int arg_id = -1;
+    RETURN_IF_ERROR(_multi_pattern_slot->execute(context, block, &arg_id));
+    ColumnPtr arg_column = block->get_by_position(arg_id).column->convert_to_full_column_if_const();
+    ColumnPtr null_map_column;
+    const NullMap* null_map = nullptr;
+    const ColumnString* strings = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(*arg_column)) {
+        null_map_column = nullable->get_null_map_column_ptr();
+        null_map = &nullable->get_null_map_data();
+        strings = &assert_cast<const ColumnString&>(nullable->get_nested_column());
+    } else {
+        strings = &assert_cast<const ColumnString&>(*arg_column);
+    }
+
+    // every leaf is NULL exactly when the slot is NULL, so is the OR of them
+    size_t size = strings->size();
+    auto res = ColumnUInt8::create(size, 0);
+    auto& res_data = res->get_data();
+    for (size_t i = 0; i < size; ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            continue;
+        }
+        const auto str_ref = strings->get_data_at(i);
+        auto ret = hs_scan(database, str_ref.data, static_cast<unsigned int>(str_ref.size), 0,
+                           scratch, LikeSearchState::hs_match_handler, res_data.data() + i);
+        if (ret != HS_SUCCESS && ret != HS_SCAN_TERMINATED) {
+            return Status::RuntimeError(fmt::format("hyperscan error: {}", ret));
+        }
+    }
+
+    ColumnPtr result = std::move(res);
+    if (_data_type->is_nullable()) {
+        if (null_map_column == nullptr) {
+            null_map_column = ColumnUInt8::create(size, 0);
+        }
+        result = ColumnNullable::create(result, null_map_column);
+    }
+    *result_column_id = block->columns();
+    block->insert({std::move(result), _data_type, _expr_name});
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -17,9 +17,14 @@
 
 #pragma once
 #include <gen_cpp/Opcodes_types.h>
+#include <hs/hs_common.h>
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "util/simd/bits.h"
@@ -55,6 +60,12 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
 
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override {
+        RETURN_IF_ERROR(VectorizedFnCall::prepare(state, desc, context));
+        _init_multi_pattern();
+        return Status::OK();
+    }
+
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override {
         segment_v2::InvertedIndexResultBitmap res;
         bool all_pass = true;
@@ -154,6 +165,9 @@ public:
         if (fast_execute(context, block, result_column_id)) {
             return Status::OK();
         }
+        if (const auto* database = _get_multi_pattern_database(); database != nullptr) {
+            return _execute_multi_pattern(context, block, database, result_column_id);
+        }
         if (get_num_children() == 1 || _has_const_child()) {
             return VectorizedFnCall::execute(context, block, result_column_id);
         }
@@ -407,7 +421,21 @@ private:
         }
     }
 
+    // An OR tree whose leaves are all LIKE/REGEXP of the same string slot against constant
+    // patterns is evaluated by one hyperscan multi-pattern scan of the slot instead of one
+    // pass over the column per pattern.
+    void _init_multi_pattern();
+    const hs_database_t* _get_multi_pattern_database();
+    Status _execute_multi_pattern(VExprContext* context, Block* block,
+                                  const hs_database_t* database, int* result_column_id);
+
     TExprOpcode::type _op;
+
+    VExprSPtr _multi_pattern_slot;
+    std::vector<std::string> _multi_patterns;
+    // compiled on first execution, so the nested ORs of a chain never pay for it
+    std::once_flag _multi_pattern_compiled;
+    std::shared_ptr<hs_database_t> _multi_pattern_database;
 };
 
 #include "common/compile_check_end.h"
@@ -30,6 +30,10 @@
 #include "runtime/runtime_state.h"
 #include "udf/udf.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_agg_state.h"
@@ -123,6 +127,7 @@ Status VectorizedFnCall::prepare(RuntimeState* state, const RowDescriptor& desc,
     }
     VExpr::register_function_context(state, context);
     _function_name = _fn.name.function_name;
+    _init_multiply_add();
     _prepare_finished = true;
 
     FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
@@ -240,10 +245,119 @@ Status VectorizedFnCall::execute_runtime_filter(doris::vectorized::VExprContext*
 
 Status VectorizedFnCall::execute(VExprContext* context, vectorized::Block* block,
                                  int* result_column_id) {
+    if (_multiply_add_child != -1 && !is_const_and_have_executed()) {
+        return _execute_multiply_add(context, block, result_column_id);
+    }
     ColumnNumbers arguments;
     return _do_execute(context, block, result_column_id, arguments);
 }
 
+void VectorizedFnCall::_init_multiply_add() {
+    auto is_double = [](const DataTypePtr& type) {
+        return remove_nullable(type)->get_primitive_type() == TYPE_DOUBLE;
+    };
+    auto is_builtin_call = [](const VExprSPtr& expr, const std::string& name) {
+        const auto* fn_call = dynamic_cast<const VectorizedFnCall*>(expr.get());
+        return fn_call != nullptr && fn_call->_fn.binary_type == TFunctionBinaryType::BUILTIN &&
+               fn_call->_fn.name.function_name == name && fn_call->get_num_children() == 2;
+    };
+    if (_fn.binary_type != TFunctionBinaryType::BUILTIN || _function_name != "add" ||
+        _children.size() != 2 || !is_double(_data_type) || is_constant()) {
+        return;
+    }
+    for (int i = 0; i < 2; ++i) {
+        const auto& multiply = _children[i];
+        if (!is_builtin_call(multiply, "multiply")) {
+            continue;
+        }
+        const DataTypePtr operand_types[3] = {multiply->get_child(0)->data_type(),
+                                              multiply->get_child(1)->data_type(),
+                                              _children[1 - i]->data_type()};
+        bool can_fuse = is_double(multiply->data_type());
+        for (const auto& type : operand_types) {
+            // the nulls of the operands must be kept in the result
+            can_fuse &= is_double(type) && (_data_type->is_nullable() || !type->is_nullable());
+        }
+        if (can_fuse) {
+            _multiply_add_child = i;
+            return;
+        }
+    }
+}
+
+template <bool a_const, bool b_const, bool c_const>
+static void multiply_add(const Float64* __restrict a, const Float64* __restrict b,
+                         const Float64* __restrict c, Float64* __restrict res, size_t rows) {
+#ifdef __clang__
+    // keep the rounding of the separate multiply and add functions
+#pragma clang fp contract(off)
+#endif
+    for (size_t i = 0; i < rows; ++i) {
+        Float64 product = a[a_const ? 0 : i] * b[b_const ? 0 : i];
+        res[i] = product + c[c_const ? 0 : i];
+    }
+}
+
+Status VectorizedFnCall::_execute_multiply_add(VExprContext* context, Block* block,
+                                               int* result_column_id) {
+    const auto& multiply = _children[_multiply_add_child];
+    const VExprSPtr operands[3] = {multiply->get_child(0), multiply->get_child(1),
+                                   _children[1 - _multiply_add_child]};
+    const size_t rows = block->rows();
+    const Float64* data[3];
+    bool is_const[3];
+    const NullMap* null_maps[3] = {nullptr, nullptr, nullptr};
+    ColumnPtr columns[3];
+    for (int i = 0; i < 3; ++i) {
+        int column_id = -1;
+        RETURN_IF_ERROR(operands[i]->execute(context, block, &column_id));
+        auto [column, column_is_const] = unpack_if_const(block->get_by_position(column_id).column);
+        columns[i] = column;
+        is_const[i] = column_is_const;
+        const IColumn* nested = column.get();
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(nested)) {
+            nested = &nullable->get_nested_column();
+            null_maps[i] = &nullable->get_null_map_data();
+        }
+        data[i] = assert_cast<const ColumnFloat64*>(nested)->get_data().data();
+    }
+
+    auto result = ColumnFloat64::create(rows);
+    auto* res = result->get_data().data();
+    using Kernel = void (*)(const Float64*, const Float64*, const Float64*, Float64*, size_t);
+    static constexpr Kernel kernels[8] = {
+            multiply_add<false, false, false>, multiply_add<false, false, true>,
+            multiply_add<false, true, false>,  multiply_add<false, true, true>,
+            multiply_add<true, false, false>,  multiply_add<true, false, true>,
+            multiply_add<true, true, false>,   multiply_add<true, true, true>};
+    kernels[is_const[0] * 4 + is_const[1] * 2 + is_const[2]](data[0], data[1], data[2], res, rows);
+
+    ColumnPtr result_column = std::move(result);
+    if (_data_type->is_nullable()) {
+        auto null_map = ColumnUInt8::create(rows, 0);
+        auto* __restrict result_null_map = null_map->get_data().data();
+        for (int i = 0; i < 3; ++i) {
+            if (null_maps[i] == nullptr) {
+                continue;
+            }
+            const auto* __restrict operand_null_map = null_maps[i]->data();
+            if (is_const[i]) {
+                if (operand_null_map[0]) {
+                    memset(result_null_map, 1, rows);
+                }
+                continue;
+            }
+            for (size_t j = 0; j < rows; ++j) {
+                result_null_map[j] |= operand_null_map[j];
+            }
+        }
+        result_column = ColumnNullable::create(std::move(result_column), std::move(null_map));
+    }
+    *result_column_id = static_cast<int>(block->columns());
+    block->insert({std::move(result_column), _data_type, _expr_name});
+    return Status::OK();
+}
+
 const std::string& VectorizedFnCall::expr_name() const {
     return _expr_name;
 }
@@ -288,6 +402,13 @@ bool VectorizedFnCall::equals(const VExpr& other) {
     if (this->_function_name != other_ptr->_function_name) {
         return false;
     }
+    // the calls of a non deterministic function, like random(), give different results
+    if (_function == nullptr || !_function->is_use_default_implementation_for_constants()) {
+        return false;
+    }
+    if (!_data_type->equals(*other_ptr->_data_type)) {
+        return false;
+    }
     if (get_num_children() != other_ptr->get_num_children()) {
         return false;
     }
@@ -83,6 +83,13 @@ protected:
 private:
     Status _do_execute(doris::vectorized::VExprContext* context, doris::vectorized::Block* block,
                        int* result_column_id, ColumnNumbers& args);
+
+    // `a * b + c` over DOUBLE is computed in one pass, without the column of `a * b`
+    void _init_multiply_add();
+    Status _execute_multiply_add(VExprContext* context, Block* block, int* result_column_id);
+
+    // the index of the multiply child of a fused multiply add, or -1
+    int _multiply_add_child = -1;
 };
 
 #include "common/compile_check_end.h"
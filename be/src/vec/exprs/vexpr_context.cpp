@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <ostream>
 #include <string>
 
@@ -28,6 +29,7 @@
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "udf/udf.h"
+#include "util/runtime_profile.h"
 #include "util/simd/bits.h"
 #include "vec/columns/column_const.h"
 #include "vec/core/column_numbers.h"
@@ -326,18 +328,44 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& conjuncts, Block
     return Status::OK();
 }
 
-// TODO Performance Optimization
 // need exception safety
 Status VExprContext::execute_conjuncts_and_filter_block(const VExprContextSPtrs& ctxs, Block* block,
                                                         std::vector<uint32_t>& columns_to_filter,
                                                         int column_to_keep) {
     IColumn::Filter result_filter(block->rows(), 1);
-    bool can_filter_all;
+    bool can_filter_all = false;
 
     _reset_memory_usage(ctxs);
 
-    RETURN_IF_ERROR(
-            execute_conjuncts(ctxs, nullptr, false, block, &result_filter, &can_filter_all));
+    // When a conjunct drops most of the rows, filter the block before the remaining conjuncts,
+    // so they are only evaluated on the surviving rows. It needs all the kept columns filtered.
+    const bool can_filter_early =
+            columns_to_filter.size() == static_cast<size_t>(column_to_keep);
+    size_t input_rows = block->rows();
+    for (size_t i = 0; i < ctxs.size() && !can_filter_all; ++i) {
+        const auto& ctx = ctxs[i];
+        {
+            SCOPED_RAW_TIMER(&ctx->_conjunct_exec_ns);
+            RETURN_IF_ERROR(execute_conjuncts({ctx}, nullptr, false, block, &result_filter,
+                                              &can_filter_all));
+        }
+        const size_t rows = block->rows();
+        const size_t selected_rows =
+                can_filter_all ? 0
+                               : rows - simd::count_zero_num((int8_t*)result_filter.data(), rows);
+        ctx->_conjunct_input_rows += static_cast<int64_t>(input_rows);
+        ctx->_conjunct_output_rows += static_cast<int64_t>(selected_rows);
+        input_rows = selected_rows;
+        if (can_filter_all || !can_filter_early || i + 1 == ctxs.size() ||
+            selected_rows * 2 > rows) {
+            continue;
+        }
+        RETURN_IF_CATCH_EXCEPTION(
+                Block::filter_block_internal(block, columns_to_filter, result_filter));
+        // the results of the evaluated conjuncts are not needed anymore
+        Block::erase_useless_column(block, column_to_keep);
+        result_filter.assign(block->rows(), UInt8(1));
+    }
 
     // Accumulate the usage of `result_filter` into the first context.
     if (!ctxs.empty()) {
@@ -427,6 +455,49 @@ Status VExprContext::get_output_block_after_execute_exprs(
     return Status::OK();
 }
 
+void VExprContext::reorder_conjuncts(VExprContextSPtrs& ctxs) {
+    // the expected time a conjunct spends for each row it drops
+    auto rank = [](const VExprContextSPtr& ctx) {
+        if (ctx->_conjunct_input_rows == 0) {
+            return 0.0;
+        }
+        double cost_per_row = static_cast<double>(ctx->_conjunct_exec_ns) /
+                              static_cast<double>(ctx->_conjunct_input_rows);
+        double drop_rate = 1.0 - static_cast<double>(ctx->_conjunct_output_rows) /
+                                         static_cast<double>(ctx->_conjunct_input_rows);
+        return drop_rate > 0 ? cost_per_row / drop_rate : std::numeric_limits<double>::max();
+    };
+    if (std::any_of(ctxs.begin(), ctxs.end(),
+                    [](const auto& ctx) { return ctx->_conjunct_input_rows == 0; })) {
+        return;
+    }
+    std::stable_sort(ctxs.begin(), ctxs.end(),
+                     [&](const auto& lhs, const auto& rhs) { return rank(lhs) < rank(rhs); });
+    // decay the statistics, so the order follows the changes of the data
+    for (const auto& ctx : ctxs) {
+        ctx->_conjunct_input_rows /= 2;
+        ctx->_conjunct_output_rows /= 2;
+        ctx->_conjunct_exec_ns /= 2;
+    }
+}
+
+std::vector<int> VExprContext::find_equal_exprs(const VExprContextSPtrs& ctxs) {
+    std::vector<int> equal_exprs(ctxs.size(), -1);
+    for (size_t i = 0; i < ctxs.size(); ++i) {
+        const auto& root = ctxs[i]->root();
+        if (root->is_slot_ref() || root->is_literal()) {
+            continue;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (equal_exprs[j] == -1 && root->equals(*ctxs[j]->root())) {
+                equal_exprs[i] = static_cast<int>(j);
+                break;
+            }
+        }
+    }
+    return equal_exprs;
+}
+
 void VExprContext::_reset_memory_usage(const VExprContextSPtrs& contexts) {
     std::for_each(contexts.begin(), contexts.end(),
                   [](auto&& context) { context->_memory_usage = 0; });
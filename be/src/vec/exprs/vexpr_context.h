@@ -224,6 +224,11 @@ public:
                                                                      const Block&, Block*,
                                                                      bool do_projection = false);
 
+    // Returns, for each context, the index of an earlier context whose expr is equal to it and
+    // so has the same result on a block, or -1. Slot refs and literals are never reported, as
+    // they cost nothing to execute again.
+    static std::vector<int> find_equal_exprs(const VExprContextSPtrs& ctxs);
+
     int get_last_result_column_id() const {
         DCHECK(_last_result_column_id != -1);
         return _last_result_column_id;
@@ -279,6 +284,11 @@ public:
 
     [[nodiscard]] size_t get_memory_usage() const { return _memory_usage; }
 
+    // Sorts the conjuncts by the cost to drop a row seen in execute_conjuncts_and_filter_block
+    // so far, so that cheap and selective conjuncts are evaluated first. Nothing is reordered
+    // until every conjunct has seen some rows.
+    static void reorder_conjuncts(VExprContextSPtrs& ctxs);
+
 private:
     // Close method is called in vexpr context dector, not need call expicility
     void close();
@@ -312,5 +322,10 @@ private:
 
     std::shared_ptr<InvertedIndexContext> _inverted_index_context;
     size_t _memory_usage = 0;
+
+    // The statistics of the expr as a conjunct, used to reorder the conjuncts
+    int64_t _conjunct_input_rows = 0;
+    int64_t _conjunct_output_rows = 0;
+    int64_t _conjunct_exec_ns = 0;
 };
 } // namespace doris::vectorized
@@ -145,6 +145,21 @@ struct PlusMinusDecimalImpl {
         return column_result;
     }
 
+    // The sum or difference of two decimals has at most one more integer digit than the wider
+    // one, so it can not overflow a result type with more digits, and the per row check is
+    // skipped.
+    template <PrimitiveType ResultType>
+        requires(is_decimal(ResultType))
+    static bool result_may_overflow(const DataTypeA& type_left, const DataTypeB& type_right,
+                                    const DataTypeDecimal<ResultType>& type_result) {
+        if constexpr (ResultType == TYPE_DECIMALV2) {
+            return true;
+        } else {
+            return std::max(type_left.get_precision(), type_right.get_precision()) >=
+                   type_result.get_precision();
+        }
+    }
+
     template <PrimitiveType ResultType>
         requires(is_decimal(ResultType))
     static ColumnPtr vector_constant(
@@ -156,6 +171,8 @@ struct PlusMinusDecimalImpl {
         auto column_result =
                 ColumnDecimal<ResultType>::create(column_left->size(), res_data_type.get_scale());
         DCHECK(column_left_ptr != nullptr);
+        check_overflow_for_decimal = check_overflow_for_decimal &&
+                                     result_may_overflow(*type_left, *type_right, res_data_type);
 
         const auto& a = column_left_ptr->get_data();
         auto& c = column_result->get_data();
@@ -183,6 +200,8 @@ struct PlusMinusDecimalImpl {
         const auto* column_right_ptr = assert_cast<const ColumnTypeB*>(column_right.get());
         auto column_result =
                 ColumnDecimal<ResultType>::create(column_right->size(), res_data_type.get_scale());
+        check_overflow_for_decimal = check_overflow_for_decimal &&
+                                     result_may_overflow(*type_left, *type_right, res_data_type);
 
         auto& b = column_right_ptr->get_data();
         auto& c = column_result->get_data();
@@ -267,6 +286,8 @@ struct PlusMinusDecimalImpl {
 
         auto column_result =
                 ColumnDecimal<ResultType>::create(column_left->size(), res_data_type.get_scale());
+        check_overflow_for_decimal = check_overflow_for_decimal &&
+                                     result_may_overflow(*type_left, *type_right, res_data_type);
         auto sz = column_left->size();
         const auto& a = column_left_ptr->get_data().data();
         const auto& b = column_right_ptr->get_data().data();
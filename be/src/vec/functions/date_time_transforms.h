@@ -23,6 +23,7 @@
 #include "common/status.h"
 #include "udf/udf.h"
 #include "util/binary_cast.hpp"
+#include "util/timezone_transition_cache.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
@@ -230,7 +231,7 @@ struct DateFormatImpl {
 
     template <typename Impl>
     static bool execute(const FromType& t, StringRef format, ColumnString::Chars& res_data,
-                        size_t& offset, const cctz::time_zone& time_zone) {
+                        size_t& offset, TimezoneTransitionCache& time_zone) {
         if constexpr (std::is_same_v<Impl, time_format_type::NoneImpl>) {
             // Handle non-special formats.
             const auto& dt = (DateType&)t;
@@ -274,15 +275,24 @@ struct FromUnixTimeImpl {
     static const int64_t TIMESTAMP_VALID_MAX = 32536771199;
     static constexpr auto name = "from_unixtime";
 
+    static void from_unixtime(DateV2Value<DateTimeV2ValueType>& dt, FromType val,
+                              TimezoneTransitionCache& time_zone) {
+        const auto cs = TimezoneTransitionCache::to_civil(time_zone.utc_to_local(val));
+        dt.unchecked_set_time(static_cast<uint16_t>(cs.year()), static_cast<uint8_t>(cs.month()),
+                              static_cast<uint8_t>(cs.day()), static_cast<uint8_t>(cs.hour()),
+                              static_cast<uint8_t>(cs.minute()),
+                              static_cast<uint16_t>(cs.second()));
+    }
+
     template <typename Impl>
     static bool execute(const FromType& val, StringRef format, ColumnString::Chars& res_data,
-                        size_t& offset, const cctz::time_zone& time_zone) {
+                        size_t& offset, TimezoneTransitionCache& time_zone) {
         if constexpr (std::is_same_v<Impl, time_format_type::NoneImpl>) {
             DateV2Value<DateTimeV2ValueType> dt;
             if (val < 0 || val > TIMESTAMP_VALID_MAX) {
                 return true;
             }
-            dt.from_unixtime(val, time_zone);
+            from_unixtime(dt, val, time_zone);
 
             char buf[100 + SAFE_FORMAT_STRING_MARGIN];
             if (!dt.to_format_string_conservative(format.data, format.size, buf,
@@ -300,7 +310,7 @@ struct FromUnixTimeImpl {
             if (val < 0 || val > TIMESTAMP_VALID_MAX) {
                 return true;
             }
-            dt.from_unixtime(val, time_zone);
+            from_unixtime(dt, val, time_zone);
 
             if (!dt.is_valid_date()) {
                 return true;
@@ -30,6 +30,7 @@
 #include "udf/udf.h"
 #include "util/binary_cast.hpp"
 #include "util/datetype_cast.hpp"
+#include "util/timezone_transition_cache.h"
 #include "util/timezone_utils.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -231,6 +232,9 @@ private:
             }
             return;
         }
+        // the zones are fixed for the whole column, so keep the transition ranges of both
+        TimezoneTransitionCache from_tz_cache(from_tz);
+        TimezoneTransitionCache to_tz_cache(to_tz);
         for (size_t i = 0; i < input_rows_count; i++) {
             if (result_null_map[i]) {
                 result_column->insert_default();
@@ -242,12 +246,16 @@ private:
             ReturnDateValueType ts_value2;
 
             if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
-                std::pair<int64_t, int64_t> timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
-                    continue;
-                }
-                ts_value2.from_unixtime(timestamp, to_tz);
+                const int64_t local_seconds = TimezoneTransitionCache::to_local_seconds(
+                        cctz::civil_second(ts_value.year(), ts_value.month(), ts_value.day(),
+                                           ts_value.hour(), ts_value.minute(), ts_value.second()));
+                const auto cs = TimezoneTransitionCache::to_civil(
+                        to_tz_cache.utc_to_local(from_tz_cache.local_to_utc(local_seconds)));
+                ts_value2.unchecked_set_time(
+                        static_cast<uint16_t>(cs.year()), static_cast<uint8_t>(cs.month()),
+                        static_cast<uint8_t>(cs.day()), static_cast<uint8_t>(cs.hour()),
+                        static_cast<uint8_t>(cs.minute()), static_cast<uint16_t>(cs.second()),
+                        ts_value.microsecond());
             } else {
                 int64_t timestamp;
                 if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
@@ -26,6 +26,7 @@
 #include "common/cast_set.h"
 #include "common/status.h"
 #include "runtime/runtime_state.h"
+#include "util/timezone_transition_cache.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
@@ -188,9 +189,10 @@ public:
                 [&](auto type) {
                     using Impl = decltype(type);
                     size_t offset = 0;
+                    TimezoneTransitionCache time_zone(context->state()->timezone_obj());
                     for (int i = 0; i < len; ++i) {
-                        null_map[i] = Transform::template execute<Impl>(
-                                ts[i], format, res_data, offset, context->state()->timezone_obj());
+                        null_map[i] = Transform::template execute<Impl>(ts[i], format, res_data,
+                                                                        offset, time_zone);
                         res_offsets[i] = cast_set<uint32_t>(offset);
                     }
                     res_data.resize(offset);
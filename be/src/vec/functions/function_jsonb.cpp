@@ -359,6 +359,87 @@ using FunctionJsonbParseErrorNull =
 using FunctionJsonbParseErrorValue =
         FunctionJsonbParseBase<NullalbeMode::FOLLOW_INPUT, JsonbParseErrorMode::RETURN_VALUE>;
 
+static bool is_wildcard_leg(const leg_info* leg) {
+    return leg->leg_len == 1 && *leg->leg_ptr == WILDCARD;
+}
+
+static bool is_same_leg(const leg_info* lhs, const leg_info* rhs) {
+    return lhs->type == rhs->type && lhs->array_index == rhs->array_index &&
+           lhs->leg_len == rhs->leg_len &&
+           (lhs->leg_len == 0 || memcmp(lhs->leg_ptr, rhs->leg_ptr, lhs->leg_len) == 0);
+}
+
+// Same as one step of JsonbValue::findValue for a leg without wildcard.
+static const JsonbValue* seek_leg(const JsonbValue* value, const leg_info* leg) {
+    if (leg->type == MEMBER_CODE) {
+        if (!value->isObject()) {
+            return nullptr;
+        }
+        return value->unpack<ObjectVal>()->find(leg->leg_ptr, leg->leg_len, nullptr);
+    }
+    if (!value->isArray()) {
+        return leg->array_index == 0 ? value : nullptr;
+    }
+    if (leg->leg_ptr != nullptr || leg->leg_len != 0) {
+        return nullptr;
+    }
+    const auto* array = value->unpack<ArrayVal>();
+    return array->get(leg->array_index >= 0 ? leg->array_index
+                                            : array->numElem() + leg->array_index);
+}
+
+// The constant json paths of a jsonb extract function, parsed once in open().
+struct JsonbExtractPathState {
+    // The parsed legs point into these strings, so they must not move after parsing.
+    std::vector<std::string> path_strings;
+    // Indexed by path argument, nullptr if the path is not constant or is null.
+    std::vector<std::unique_ptr<JsonbPath>> paths;
+    // The number of leading legs each path shares with the previous one. Only set if all the
+    // paths are constant and have no wildcard, so a document can be navigated once for all of
+    // them, e.g. `json_extract(j, '$.a.b', '$.a.c')` looks up `a` only once.
+    std::vector<size_t> shared_prefix_legs;
+
+    Status init(FunctionContext* context) {
+        const int num_paths = context->get_num_args() - 1;
+        path_strings.resize(num_paths);
+        paths.resize(num_paths);
+        bool all_paths_simple = true;
+        for (int pi = 0; pi < num_paths; ++pi) {
+            if (!context->is_col_constant(pi + 1) ||
+                context->get_constant_col(pi + 1)->column_ptr->is_null_at(0)) {
+                all_paths_simple = false;
+                continue;
+            }
+            path_strings[pi] =
+                    context->get_constant_col(pi + 1)->column_ptr->get_data_at(0).to_string();
+            paths[pi] = std::make_unique<JsonbPath>();
+            if (!paths[pi]->seek(path_strings[pi].data(), path_strings[pi].size())) {
+                return Status::InvalidArgument("Json path error: Invalid Json Path for value: {}",
+                                               path_strings[pi]);
+            }
+            for (size_t li = 0; li < paths[pi]->get_leg_vector_size(); ++li) {
+                all_paths_simple &= !is_wildcard_leg(paths[pi]->get_leg_from_leg_vector(li));
+            }
+        }
+        if (num_paths < 2 || !all_paths_simple) {
+            return Status::OK();
+        }
+        shared_prefix_legs.resize(num_paths, 0);
+        for (int pi = 1; pi < num_paths; ++pi) {
+            const auto& prev = *paths[pi - 1];
+            const auto& cur = *paths[pi];
+            size_t legs = 0;
+            while (legs < prev.get_leg_vector_size() && legs < cur.get_leg_vector_size() &&
+                   is_same_leg(prev.get_leg_from_leg_vector(legs),
+                               cur.get_leg_from_leg_vector(legs))) {
+                ++legs;
+            }
+            shared_prefix_legs[pi] = legs;
+        }
+        return Status::OK();
+    }
+};
+
 // func(jsonb, [varchar, varchar, ...]) -> nullable(type)
 template <typename Impl>
 class FunctionJsonbExtract : public IFunction {
@@ -381,9 +462,21 @@ public:
         }
     }
 
+    Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override {
+        if (scope != FunctionContext::THREAD_LOCAL) {
+            return Status::OK();
+        }
+        auto state = std::make_shared<JsonbExtractPathState>();
+        RETURN_IF_ERROR(state->init(context));
+        context->set_function_state(scope, state);
+        return Status::OK();
+    }
+
     Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                         uint32_t result, size_t input_rows_count) const override {
         DCHECK_GE(arguments.size(), 2);
+        auto* path_state = reinterpret_cast<JsonbExtractPathState*>(
+                context->get_function_state(FunctionContext::THREAD_LOCAL));
 
         ColumnPtr jsonb_data_column;
         bool jsonb_data_const = false;
@@ -436,7 +529,8 @@ public:
             auto& res_offsets = res->get_offsets();
             RETURN_IF_ERROR(Impl::vector_vector_v2(
                     context, ldata, loffsets, data_null_map, jsonb_data_const, jsonb_path_columns,
-                    path_null_maps, path_const, res_data, res_offsets, null_map->get_data()));
+                    path_null_maps, path_const, path_state, res_data, res_offsets,
+                    null_map->get_data()));
         } else {
             // not support other extract type for now (e.g. int, double, ...)
             DCHECK_EQ(jsonb_path_columns.size(), 1);
@@ -466,8 +560,18 @@ public:
                 if (path_null_maps[0] && (*path_null_maps[0])[0]) {
                     return create_all_null_result();
                 }
-                RETURN_IF_ERROR(Impl::vector_scalar(context, ldata, loffsets, data_null_map,
-                                                    jsonb_path_columns[0]->get_data_at(0),
+                JsonbPath local_path;
+                JsonbPath* path = path_state ? path_state->paths[0].get() : nullptr;
+                if (!path) {
+                    const auto path_str = jsonb_path_columns[0]->get_data_at(0);
+                    if (!local_path.seek(path_str.data, path_str.size)) {
+                        return Status::InvalidArgument(
+                                "Json path error: Invalid Json Path for value: {}",
+                                std::string_view(path_str.data, path_str.size));
+                    }
+                    path = &local_path;
+                }
+                RETURN_IF_ERROR(Impl::vector_scalar(context, ldata, loffsets, data_null_map, *path,
                                                     res->get_data(), null_map->get_data()));
             } else {
                 RETURN_IF_ERROR(Impl::vector_vector(context, ldata, loffsets, data_null_map, rdata,
@@ -899,7 +1003,8 @@ public:
             const bool& json_data_const,
             const std::vector<const ColumnString*>& rdata_columns, // here we can support more paths
             const std::vector<const NullMap*>& r_null_maps, const std::vector<bool>& path_const,
-            ColumnString::Chars& res_data, ColumnString::Offsets& res_offsets, NullMap& null_map) {
+            JsonbExtractPathState* path_state, ColumnString::Chars& res_data,
+            ColumnString::Offsets& res_offsets, NullMap& null_map) {
         const size_t input_rows_count = null_map.size();
         res_offsets.resize(input_rows_count);
 
@@ -909,6 +1014,8 @@ public:
         // reuseable json path list, espacially for const path
         std::vector<JsonbPath> json_path_list;
         json_path_list.resize(rdata_columns.size());
+        // the path used for each path column, the const paths may come from `path_state`
+        std::vector<JsonbPath*> paths(rdata_columns.size());
 
         // lambda function to parse json path for row i and path pi
         auto parse_json_path = [&](size_t i, size_t pi) -> Status {
@@ -928,18 +1035,29 @@ public:
             }
 
             json_path_list[pi] = std::move(path);
+            paths[pi] = &json_path_list[pi];
 
             return Status::OK();
         };
 
+        bool all_paths_cached = path_state != nullptr;
         for (size_t pi = 0; pi < rdata_columns.size(); pi++) {
             if (path_const[pi]) {
                 if (r_null_maps[pi] && (*r_null_maps[pi])[0]) {
+                    all_paths_cached = false;
+                    continue;
+                }
+                if (path_state && path_state->paths[pi]) {
+                    paths[pi] = path_state->paths[pi].get();
                     continue;
                 }
                 RETURN_IF_ERROR(parse_json_path(0, pi));
             }
+            all_paths_cached = false;
         }
+        // the values reached by the legs of the previous path, `trail[k]` is after k legs
+        const bool share_prefix = all_paths_cached && !path_state->shared_prefix_legs.empty();
+        std::vector<const JsonbValue*> trail;
 
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (null_map[i]) {
@@ -966,7 +1084,7 @@ public:
                     RETURN_IF_ERROR(parse_json_path(i, 0));
                 }
                 inner_loop_impl(i, res_data, res_offsets, null_map, formater, l_raw, l_size,
-                                json_path_list[0]);
+                                *paths[0]);
             } else { // will make array string to user
                 writer->reset();
                 bool has_value = false;
@@ -975,7 +1093,32 @@ public:
                 JsonbDocument* doc = nullptr;
                 auto st = JsonbDocument::checkAndCreateDocument(l_raw, l_size, &doc);
 
-                for (size_t pi = 0; pi < rdata_columns.size(); ++pi) {
+                if (share_prefix && st.ok() && doc && doc->getValue()) {
+                    trail.assign(1, doc->getValue());
+                    for (size_t pi = 0; pi < rdata_columns.size(); ++pi) {
+                        const auto& path = *paths[pi];
+                        trail.resize(std::min(path_state->shared_prefix_legs[pi] + 1,
+                                              trail.size()));
+                        for (size_t li = trail.size() - 1; li < path.get_leg_vector_size(); ++li) {
+                            const auto* value =
+                                    seek_leg(trail.back(), path.get_leg_from_leg_vector(li));
+                            if (!value) {
+                                break;
+                            }
+                            trail.push_back(value);
+                        }
+                        if (trail.size() != path.get_leg_vector_size() + 1) {
+                            continue;
+                        }
+                        if (!has_value) {
+                            has_value = true;
+                            writer->writeStartArray();
+                        }
+                        writer->writeValue(trail.back());
+                    }
+                }
+
+                for (size_t pi = 0; !share_prefix && pi < rdata_columns.size(); ++pi) {
                     if (!st.ok() || !doc || !doc->getValue()) [[unlikely]] {
                         continue;
                     }
@@ -990,7 +1133,7 @@ public:
                         RETURN_IF_ERROR(parse_json_path(i, pi));
                     }
 
-                    auto find_result = doc->getValue()->findValue(json_path_list[pi]);
+                    auto find_result = doc->getValue()->findValue(*paths[pi]);
 
                     if (find_result.value) {
                         if (!has_value) {
@@ -1064,19 +1207,13 @@ public:
 
     static Status vector_scalar(FunctionContext* context, const ColumnString::Chars& ldata,
                                 const ColumnString::Offsets& loffsets, const NullMap* l_null_map,
-                                const StringRef& rdata, ColumnString::Chars& res_data,
+                                JsonbPath& path, ColumnString::Chars& res_data,
                                 ColumnString::Offsets& res_offsets, NullMap& null_map) {
         size_t input_rows_count = loffsets.size();
         res_offsets.resize(input_rows_count);
 
         std::unique_ptr<JsonbToJson> formater;
 
-        JsonbPath path;
-        if (!path.seek(rdata.data, rdata.size)) {
-            return Status::InvalidArgument("Json path error: Invalid Json Path for value: {}",
-                                           std::string_view(rdata.data, rdata.size));
-        }
-
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (l_null_map && (*l_null_map)[i]) {
                 StringOP::push_null_string(i, res_data, res_offsets, null_map);
@@ -1229,16 +1366,10 @@ public:
 
     static Status vector_scalar(FunctionContext* context, const ColumnString::Chars& ldata,
                                 const ColumnString::Offsets& loffsets, const NullMap* l_null_map,
-                                const StringRef& rdata, Container& res, NullMap& null_map) {
+                                JsonbPath& path, Container& res, NullMap& null_map) {
         size_t size = loffsets.size();
         res.resize(size);
 
-        JsonbPath path;
-        if (!path.seek(rdata.data, rdata.size)) {
-            return Status::InvalidArgument("Json path error: Invalid Json Path for value: {}",
-                                           std::string_view(rdata.data, rdata.size));
-        }
-
         for (size_t i = 0; i < loffsets.size(); i++) {
             if (l_null_map && (*l_null_map)[i]) {
                 res[i] = 0;
@@ -3754,17 +3754,20 @@ struct ReverseImpl {
     static Status vector(const ColumnString::Chars& data, const ColumnString::Offsets& offsets,
                          ColumnString::Chars& res_data, ColumnString::Offsets& res_offsets) {
         auto rows_count = offsets.size();
-        res_offsets.resize(rows_count);
-        res_data.reserve(data.size());
+        // a reversed string has the same length, so the result shares the offsets of the source
+        res_offsets.assign(offsets.begin(), offsets.end());
+        res_data.resize(data.size());
+        const bool is_ascii = simd::VStringFunctions::is_ascii({data.data(), data.size()});
         for (ssize_t i = 0; i < rows_count; ++i) {
-            auto src_str = reinterpret_cast<const char*>(&data[offsets[i - 1]]);
+            const auto* src_str = data.data() + offsets[i - 1];
+            auto* dst_str = res_data.data() + offsets[i - 1];
             int64_t src_len = offsets[i] - offsets[i - 1];
-            std::string dst;
-            dst.resize(src_len);
-            simd::VStringFunctions::reverse(StringRef((uint8_t*)src_str, src_len),
-                                            StringRef((uint8_t*)dst.data(), src_len));
-            StringOP::push_value_string(std::string_view(dst.data(), src_len), i, res_data,
-                                        res_offsets);
+            if (is_ascii) {
+                std::reverse_copy(src_str, src_str + src_len, dst_str);
+            } else {
+                simd::VStringFunctions::reverse(StringRef(src_str, src_len),
+                                                StringRef(dst_str, src_len));
+            }
         }
         return Status::OK();
     }
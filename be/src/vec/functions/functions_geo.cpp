@@ -636,51 +636,57 @@ struct StRelationFunction {
         return Status::OK();
     }
 
-    static void loop_do(StringRef& lhs_value, StringRef& rhs_value,
-                        std::vector<std::unique_ptr<GeoShape>>& shapes,
-                        ColumnUInt8::MutablePtr& res, NullMap& null_map, int row) {
-        StringRef* strs[2] = {&lhs_value, &rhs_value};
-        for (int i = 0; i < 2; ++i) {
-            std::unique_ptr<GeoShape> shape(GeoShape::from_encoded(strs[i]->data, strs[i]->size));
-            shapes[i] = std::move(shape);
-            if (!shapes[i]) {
-                null_map[row] = 1;
-                break;
-            }
-        }
-        if (shapes[0] && shapes[1]) {
-            auto relation_value = Func::evaluate(shapes[0].get(), shapes[1].get());
-            res->get_data()[row] = relation_value;
+    static std::unique_ptr<GeoShape> decode_shape(const StringRef& value) {
+        return std::unique_ptr<GeoShape>(GeoShape::from_encoded(value.data, value.size));
+    }
+
+    static void evaluate_row(GeoShape* lhs_shape, GeoShape* rhs_shape,
+                             ColumnUInt8::MutablePtr& res, NullMap& null_map, size_t row) {
+        if (lhs_shape == nullptr || rhs_shape == nullptr) {
+            null_map[row] = 1;
+            return;
         }
+        res->get_data()[row] = Func::evaluate(lhs_shape, rhs_shape);
     }
 
+    // The constant shape is decoded once for the column rather than once per row, as decoding
+    // a polygon rebuilds its S2 loops and costs far more than most relation tests.
     static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+        auto lhs_shape = decode_shape(left_column->get_data_at(0));
+        if (lhs_shape == nullptr) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        for (size_t row = 0; row < size; ++row) {
+            auto rhs_shape = decode_shape(right_column->get_data_at(row));
+            evaluate_row(lhs_shape.get(), rhs_shape.get(), res, null_map, row);
         }
     }
 
     static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+        auto rhs_shape = decode_shape(right_column->get_data_at(0));
+        if (rhs_shape == nullptr) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        for (size_t row = 0; row < size; ++row) {
+            auto lhs_shape = decode_shape(left_column->get_data_at(row));
+            evaluate_row(lhs_shape.get(), rhs_shape.get(), res, null_map, row);
         }
     }
 
     static void vector_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
                               ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+        for (size_t row = 0; row < size; ++row) {
+            auto lhs_shape = decode_shape(left_column->get_data_at(row));
+            if (lhs_shape == nullptr) {
+                null_map[row] = 1;
+                continue;
+            }
+            auto rhs_shape = decode_shape(right_column->get_data_at(row));
+            evaluate_row(lhs_shape.get(), rhs_shape.get(), res, null_map, row);
         }
     }
 };
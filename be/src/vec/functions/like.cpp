@@ -504,6 +504,33 @@ Status FunctionLikeBase::hs_prepare(FunctionContext* context, const char* expres
     return Status::OK();
 }
 
+Status FunctionLikeBase::hs_prepare_multi(const std::vector<std::string>& expressions,
+                                          hs_database_t** database) {
+    std::vector<const char*> patterns;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    patterns.reserve(expressions.size());
+    for (const auto& expression : expressions) {
+        patterns.push_back(expression.c_str());
+        flags.push_back(HS_FLAG_DOTALL | HS_FLAG_ALLOWEMPTY | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.push_back(static_cast<unsigned int>(ids.size()));
+    }
+
+    hs_compile_error_t* compile_err;
+    auto res = hs_compile_multi(patterns.data(), flags.data(), ids.data(),
+                                static_cast<unsigned int>(patterns.size()), HS_MODE_BLOCK, nullptr,
+                                database, &compile_err);
+    if (res != HS_SUCCESS) {
+        *database = nullptr;
+        std::string error_message = compile_err->message;
+        hs_free_compile_error(compile_err);
+        return Status::RuntimeError<false>("hs_compile_multi regex pattern error:" +
+                                           error_message);
+    }
+    hs_free_compile_error(compile_err);
+    return Status::OK();
+}
+
 Status FunctionLikeBase::execute_impl(FunctionContext* context, Block& block,
                                       const ColumnNumbers& arguments, uint32_t result,
                                       size_t input_rows_count) const {
@@ -269,6 +269,12 @@ protected:
     // hyperscan compile expression to database and allocate scratch space
     static Status hs_prepare(FunctionContext* context, const char* expression,
                              hs_database_t** database, hs_scratch_t** scratch);
+
+public:
+    // hyperscan compile several expressions into one database, a string matches the database
+    // if it matches any of them. Scratch space is left to the caller since it is per thread.
+    static Status hs_prepare_multi(const std::vector<std::string>& expressions,
+                                   hs_database_t** database);
 };
 
 class FunctionLike : public FunctionLikeBase {
@@ -285,6 +291,10 @@ public:
                                              std::shared_ptr<LikeState>& state,
                                              bool try_hyperscan = true);
 
+    // convert a LIKE pattern to the equivalent hyperscan/re2 regular expression
+    static void convert_like_pattern(LikeSearchState* state, const std::string& pattern,
+                                     std::string* re_pattern);
+
     friend struct LikeSearchState;
     friend struct VectorAllpassSearchState;
     friend struct VectorEqualSearchState;
@@ -299,9 +309,6 @@ private:
     static Status like_fn_scalar(LikeSearchState* state, const StringRef& val,
                                  const StringRef& pattern, unsigned char* result);
 
-    static void convert_like_pattern(LikeSearchState* state, const std::string& pattern,
-                                     std::string* re_pattern);
-
     static void remove_escape_character(std::string* search_string);
 };
 
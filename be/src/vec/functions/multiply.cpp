@@ -170,6 +170,24 @@ struct MultiplyDecimalImpl {
         return column_result;
     }
 
+    // The product of two decimals has at most as many digits as both of them together. If the
+    // result type keeps all of them and no scale is cut, it can not overflow, and the per row
+    // check is skipped.
+    template <PrimitiveType ResultType>
+        requires(is_decimal(ResultType))
+    static bool result_may_overflow(
+            const DataTypeA& type_left, const DataTypeB& type_right,
+            const DataTypeDecimal<ResultType>& type_result,
+            const typename PrimitiveTypeTraits<ResultType>::ColumnItemType& scale_diff_multiplier) {
+        if constexpr (ResultType == TYPE_DECIMALV2) {
+            return true;
+        } else {
+            return scale_diff_multiplier.value > 1 ||
+                   type_left.get_precision() + type_right.get_precision() >
+                           type_result.get_precision();
+        }
+    }
+
     template <PrimitiveType ResultType>
         requires(is_decimal(ResultType))
     static ColumnPtr vector_constant(
@@ -181,6 +199,9 @@ struct MultiplyDecimalImpl {
         auto column_result =
                 ColumnDecimal<ResultType>::create(column_left->size(), res_data_type.get_scale());
         DCHECK(column_left_ptr != nullptr);
+        check_overflow_for_decimal =
+                check_overflow_for_decimal &&
+                result_may_overflow(*type_left, *type_right, res_data_type, scale_diff_multiplier);
 
         bool need_adjust_scale = scale_diff_multiplier.value > 1;
         const auto& a = column_left_ptr->get_data();
@@ -210,6 +231,9 @@ struct MultiplyDecimalImpl {
         const auto* column_right_ptr = assert_cast<const ColumnTypeB*>(column_right.get());
         auto column_result =
                 ColumnDecimal<ResultType>::create(column_right->size(), res_data_type.get_scale());
+        check_overflow_for_decimal =
+                check_overflow_for_decimal &&
+                result_may_overflow(*type_left, *type_right, res_data_type, scale_diff_multiplier);
 
         bool need_adjust_scale = scale_diff_multiplier.value > 1;
         auto& b = column_right_ptr->get_data();
@@ -311,6 +335,9 @@ struct MultiplyDecimalImpl {
             const auto& a = column_left_ptr->get_data().data();
             const auto& b = column_right_ptr->get_data().data();
             const auto& c = column_result->get_data().data();
+            check_overflow_for_decimal = check_overflow_for_decimal &&
+                                         result_may_overflow(*type_left, *type_right,
+                                                             res_data_type, scale_diff_multiplier);
             bool need_adjust_scale = scale_diff_multiplier.value > 1;
             std::visit(
                     [&](auto need_adjust_scale, auto check_overflow_for_decimal) {
@@ -72,36 +72,6 @@ Status BlockReader::next_block_with_aggregation(Block* block, bool* eof) {
     return res;
 }
 
-bool BlockReader::_rowsets_not_mono_asc_disjoint(const ReaderParams& read_params) {
-    std::string pre_rs_last_key;
-    bool pre_rs_key_bounds_truncated {false};
-    const std::vector<RowSetSplits>& rs_splits = read_params.rs_splits;
-    for (const auto& rs_split : rs_splits) {
-        if (rs_split.rs_reader->rowset()->num_rows() == 0) {
-            continue;
-        }
-        if (rs_split.rs_reader->rowset()->is_segments_overlapping()) {
-            return true;
-        }
-        std::string rs_first_key;
-        bool has_first_key = rs_split.rs_reader->rowset()->first_key(&rs_first_key);
-        if (!has_first_key) {
-            return true;
-        }
-        bool cur_rs_key_bounds_truncated {
-                rs_split.rs_reader->rowset()->is_segments_key_bounds_truncated()};
-        if (!Slice::lhs_is_strictly_less_than_rhs(Slice {pre_rs_last_key},
-                                                  pre_rs_key_bounds_truncated, Slice {rs_first_key},
-                                                  cur_rs_key_bounds_truncated)) {
-            return true;
-        }
-        bool has_last_key = rs_split.rs_reader->rowset()->last_key(&pre_rs_last_key);
-        pre_rs_key_bounds_truncated = cur_rs_key_bounds_truncated;
-        CHECK(has_last_key);
-    }
-    return false;
-}
-
 Status BlockReader::_init_collect_iter(const ReaderParams& read_params) {
     auto res = _capture_rs_readers(read_params);
     if (!res.ok()) {
@@ -252,6 +222,12 @@ Status BlockReader::init(const ReaderParams& read_params) {
         }
         break;
     case KeysType::AGG_KEYS:
+        // Rowsets whose key ranges are strictly ascending and disjoint hold every key at most
+        // once, so there is nothing to aggregate and whole blocks can be passed through.
+        if (!_is_rowsets_overlapping) {
+            _next_block_func = &BlockReader::_direct_agg_key_next_block;
+            break;
+        }
         _next_block_func = &BlockReader::_agg_key_next_block;
         RETURN_IF_ERROR(_init_agg_state(read_params));
         break;
@@ -281,7 +257,8 @@ Status BlockReader::_direct_next_block(Block* block, bool* eof) {
 }
 
 Status BlockReader::_direct_agg_key_next_block(Block* block, bool* eof) {
-    return Status::OK();
+    DCHECK(!_is_rowsets_overlapping);
+    return _direct_next_block(block, eof);
 }
 
 Status BlockReader::_agg_key_next_block(Block* block, bool* eof) {
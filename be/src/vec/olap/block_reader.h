@@ -61,7 +61,8 @@ private:
     Status _direct_next_block(Block* block, bool* eof);
     // Just same as _direct_next_block, but this is only for AGGREGATE KEY tables.
     // And this is an optimization for AGGR tables.
-    // When there is only one rowset and is not overlapping, we can read it directly without aggregation.
+    // When the rowsets are not overlapping, every key appears only once, so we can read them
+    // directly without aggregation.
     Status _direct_agg_key_next_block(Block* block, bool* eof);
     // For normal AGGREGATE KEY tables, read data by a merge heap.
     Status _agg_key_next_block(Block* block, bool* eof);
@@ -86,9 +87,6 @@ private:
 
     bool _get_next_row_same();
 
-    // return false if keys of rowsets are mono ascending and disjoint
-    bool _rowsets_not_mono_asc_disjoint(const ReaderParams& read_params);
-
     VCollectIterator _vcollect_iter;
     IteratorRowRef _next_row {{}, -1, false};
 
@@ -670,7 +670,8 @@ Status VCollectIterator::Level1Iterator::init(bool get_data_by_ref) {
                 break;
             }
         }
-        _heap = std::make_unique<MergeHeap>(LevelIteratorComparator(sequence_loc, _is_reverse));
+        _heap_comparator.emplace(sequence_loc, _is_reverse);
+        _heap = std::make_unique<MergeHeap>(*_heap_comparator);
         for (auto&& child : _children) {
             DCHECK(child != nullptr);
             //DCHECK(child->current_row().ok());
@@ -728,9 +729,14 @@ void VCollectIterator::Level1Iterator::init_level0_iterators_for_union() {
 Status VCollectIterator::Level1Iterator::_merge_next(IteratorRowRef* ref) {
     auto res = _cur_child->next(ref);
     if (LIKELY(res.ok())) {
-        _heap->push(_cur_child.release());
-        _cur_child.reset(_heap->top());
-        _heap->pop();
+        // Keep the current child while its next row still precedes the top of the heap, so a
+        // run of rows from one child costs a comparison per row instead of a push and a pop.
+        // The comparison marks the same rows the same way as the push.
+        if (!_heap->empty() && (*_heap_comparator)(_cur_child.get(), _heap->top())) {
+            _heap->push(_cur_child.release());
+            _cur_child.reset(_heap->top());
+            _heap->pop();
+        }
     } else if (res.is<END_OF_FILE>()) {
         // current child has been read, to read next
         if (!_heap->empty()) {
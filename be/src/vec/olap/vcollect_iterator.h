@@ -22,6 +22,7 @@
 
 #include <list>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "common/status.h"
@@ -324,6 +325,8 @@ private:
         bool _skip_same;
         // used when `_merge == true`
         std::unique_ptr<MergeHeap> _heap;
+        // the comparator of `_heap`, to check if `_cur_child` still precedes the top of `_heap`
+        std::optional<LevelIteratorComparator> _heap_comparator;
 
         std::vector<RowLocation> _block_row_locations;
     };
@@ -142,7 +142,12 @@ Status VerticalBlockReader::_init_collect_iter(const ReaderParams& read_params,
             read_params.tablet->tablet_schema()->cluster_key_uids().empty()) {
             seq_col_idx = read_params.tablet->tablet_schema()->sequence_col_idx();
         }
-        if (read_params.tablet->tablet_schema()->num_key_columns() == 0) {
+        // Rowsets with ascending and disjoint keys are merged by concatenating them, as rows
+        // of different rowsets never compare equal and are already in order.
+        bool concat_rowsets = segment_iters_ptr == &iter_ptr_vector &&
+                              read_params.tablet->tablet_schema()->cluster_key_uids().empty() &&
+                              !_rowsets_not_mono_asc_disjoint(read_params);
+        if (read_params.tablet->tablet_schema()->num_key_columns() == 0 || concat_rowsets) {
             _vcollect_iter = new_vertical_fifo_merge_iterator(
                     std::move(*segment_iters_ptr), iterator_init_flag, rowset_ids,
                     ori_return_col_size, read_params.tablet->keys_type(), seq_col_idx,
@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include <gen_cpp/olap_file.pb.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include <cstddef>
 #include <ostream>
@@ -96,11 +97,29 @@ Status RowSourcesBuffer::seek_to_begin() {
             LOG(WARNING) << "failed to seek to 0";
             return Status::InternalError("failed to seek to 0");
         }
+        _read_offset = 0;
         _reset_buffer();
     }
     return Status::OK();
 }
 
+Status RowSourcesBuffer::clone(std::unique_ptr<RowSourcesBuffer>* result) const {
+    auto buffer = std::make_unique<RowSourcesBuffer>(_tablet_id, _tablet_path, _reader_type);
+    if (_fd > 0) {
+        DCHECK(_buffer.empty());
+        buffer->_fd = ::dup(_fd);
+        if (buffer->_fd < 0) {
+            LOG(WARNING) << "failed to dup row sources buffer file, err: " << strerror(errno);
+            return Status::InternalError("failed to dup row sources buffer file");
+        }
+    } else {
+        buffer->_buffer.assign(_buffer.begin(), _buffer.end());
+    }
+    buffer->_total_size = _total_size;
+    *result = std::move(buffer);
+    return Status::OK();
+}
+
 Status RowSourcesBuffer::has_remaining() {
     if (_buf_idx < _buffer.size()) {
         return Status::OK();
@@ -234,7 +253,7 @@ Status RowSourcesBuffer::_serialize() {
 
 Status RowSourcesBuffer::_deserialize() {
     size_t rows = 0;
-    ssize_t bytes_read = ::read(_fd, &rows, sizeof(rows));
+    ssize_t bytes_read = ::pread(_fd, &rows, sizeof(rows), _read_offset);
     if (bytes_read == 0) {
         LOG(WARNING) << "end of row source buffer file";
         return Status::EndOfFile("end of row source buffer file");
@@ -242,14 +261,16 @@ Status RowSourcesBuffer::_deserialize() {
         LOG(WARNING) << "failed to read buffer size from file, bytes_read=" << bytes_read;
         return Status::InternalError("failed to read buffer size from file");
     }
+    _read_offset += sizeof(rows);
     _buffer.resize(rows);
     auto& internal_data = _buffer;
-    bytes_read = ::read(_fd, internal_data.data(), rows * sizeof(UInt16));
+    bytes_read = ::pread(_fd, internal_data.data(), rows * sizeof(UInt16), _read_offset);
     if (bytes_read != rows * sizeof(UInt16)) {
         LOG(WARNING) << "failed to read buffer data from file, bytes_read=" << bytes_read
                      << ", expect bytes=" << rows * sizeof(UInt16);
         return Status::InternalError("failed to read buffer data from file");
     }
+    _read_offset += bytes_read;
     return Status::OK();
 }
 
@@ -572,7 +593,7 @@ Status VerticalFifoMergeIterator::next_batch(Block* block) {
 
         tmp_row_sources.emplace_back(_cur_iter_ctx->order(), false);
 
-        // Fifo only for duplicate no key
+        // Fifo only for duplicate no key or disjoint input, no rows to aggregate
         _cur_iter_ctx->add_cur_batch();
         if (UNLIKELY(_record_rowids)) {
             _block_row_locations[row_idx] = _cur_iter_ctx->current_row_location();
@@ -618,7 +639,6 @@ Status VerticalFifoMergeIterator::next_batch(Block* block) {
 Status VerticalFifoMergeIterator::init(const StorageReadOptions& opts,
                                        CompactionSampleInfo* sample_info) {
     DCHECK(_origin_iters.size() == _iterator_init_flags.size());
-    DCHECK(_keys_type == KeysType::DUP_KEYS);
     _record_rowids = opts.record_rowids;
     if (_origin_iters.empty()) {
         return Status::OK();
@@ -115,6 +115,11 @@ public:
 
     Status seek_to_begin();
 
+    // Creates a buffer that reads the same row sources from the beginning, independently of
+    // this one, so that several column groups can be merged at the same time. Must be called
+    // after flush(), the row sources must not change afterwards.
+    Status clone(std::unique_ptr<RowSourcesBuffer>* result) const;
+
     size_t same_source_count(uint16_t source, size_t limit);
 
     // return continuous agg_flag=true count from index
@@ -134,6 +139,8 @@ private:
     ReaderType _reader_type = ReaderType::UNKNOWN;
     uint64_t _buf_idx = 0;
     int _fd = -1;
+    // Clones share the file, so it is read at an own offset instead of the file position.
+    off_t _read_offset = 0;
     PaddedPODArray<UInt16> _buffer;
     uint64_t _total_size = 0;
 };
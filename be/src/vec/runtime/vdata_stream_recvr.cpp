@@ -89,6 +89,7 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
 
         if (_block_queue.empty()) {
             DCHECK_EQ(_num_remaining_senders, 0);
+            block->clear();
             *eos = true;
             return Status::OK();
         }
@@ -97,8 +98,7 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
         block_item = std::move(_block_queue.front());
         _block_queue.pop_front();
     }
-    BlockUPtr next_block;
-    RETURN_IF_ERROR(block_item.get_block(next_block));
+    RETURN_IF_ERROR(block_item.get_block(block));
     size_t block_byte_size = block_item.block_byte_size();
     COUNTER_UPDATE(_recvr->_deserialize_row_batch_timer, block_item.deserialize_time());
     COUNTER_UPDATE(_recvr->_decompress_timer, block->get_decompress_time());
@@ -113,7 +113,13 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
         }
     }
 
-    if (!_pending_closures.empty()) {
+    // The senders waiting for buffer are granted the buffer below the limit, each of them is
+    // expected to send a block like this one. At least one is released, so that the queue does
+    // not wait for the other queues of the receiver to free memory.
+    auto credit = _recvr->buffer_bytes_below_limit();
+    size_t num_released = 0;
+    while (!_pending_closures.empty() &&
+           (num_released == 0 || credit >= static_cast<int64_t>(block_byte_size))) {
         auto closure_pair = _pending_closures.front();
         closure_pair.first->Run();
         int64_t elapse_time = closure_pair.second.elapsed_time();
@@ -124,9 +130,9 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
 
         closure_pair.second.stop();
         _recvr->_buffer_full_total_timer->update(closure_pair.second.elapsed_time());
+        credit -= static_cast<int64_t>(block_byte_size);
+        ++num_released;
     }
-    DCHECK(block->empty());
-    block->swap(*next_block);
     *eos = false;
     return Status::OK();
 }
@@ -222,7 +228,10 @@ void VDataStreamRecvr::SenderQueue::add_block(Block* block, bool use_move) {
     }
     BlockUPtr nblock = Block::create_unique(block->get_columns_with_type_and_name());
 
-    // local exchange should copy the block contented if use move == false
+    // local exchange should copy the block contented if use move == false.
+    // The columns can not be shared with the other receivers of a broadcast even though they
+    // are ref counted, because the operators clear and filter the columns of their blocks in
+    // place, see Block::clear_column_data and Block::filter_block_internal.
     if (use_move) {
         block->clear();
     } else {
@@ -420,7 +429,7 @@ std::shared_ptr<pipeline::Dependency> VDataStreamRecvr::get_local_channel_depend
 
 Status VDataStreamRecvr::get_next(Block* block, bool* eos) {
     if (!_is_merging) {
-        block->clear();
+        // the columns of the block are kept for the next block to deserialize into
         return _sender_queues[0]->get_batch(block, eos);
     } else {
         return _merger->get_next(block, eos);
@@ -472,6 +481,10 @@ bool VDataStreamRecvr::exceeds_limit(size_t block_byte_size) {
     return _mem_tracker->consumption() + block_byte_size > config::exchg_node_buffer_size_bytes;
 }
 
+int64_t VDataStreamRecvr::buffer_bytes_below_limit() const {
+    return config::exchg_node_buffer_size_bytes - _mem_tracker->consumption();
+}
+
 bool VDataStreamRecvr::queue_exceeds_limit(size_t queue_byte_size) const {
     return queue_byte_size >= _sender_queue_mem_limit;
 }
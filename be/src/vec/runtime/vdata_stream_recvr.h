@@ -112,6 +112,9 @@ public:
     // accessing members of receiver that are allocated by Object pool
     // in this function is not safe.
     MOCK_FUNCTION bool exceeds_limit(size_t block_byte_size);
+    // The buffer the senders can still fill before the receiver exceeds the limit, negative if
+    // it already does.
+    int64_t buffer_bytes_below_limit() const;
     bool queue_exceeds_limit(size_t byte_size) const;
     bool is_closed() const { return _is_closed; }
 
@@ -262,16 +265,17 @@ protected:
     // `BlockItem` is used in `_block_queue` to handle both local and remote exchange blocks.
     // For local exchange blocks, `BlockUPtr` is used directly without any modification.
     // For remote exchange blocks, the `pblock` is stored in `BlockItem`.
-    // When `getBlock` is called, the `pblock` is deserialized into a usable block.
+    // When `getBlock` is called, the `pblock` is deserialized into the caller's block, reusing
+    // the columns the caller kept from its previous block.
     struct BlockItem {
-        Status get_block(BlockUPtr& block) {
+        Status get_block(Block* block) {
             if (!_block) {
                 DCHECK(_pblock);
                 SCOPED_RAW_TIMER(&_deserialize_time);
-                _block = Block::create_unique();
-                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_block->deserialize(*_pblock));
+                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(block->deserialize(*_pblock));
+                return Status::OK();
             }
-            block.swap(_block);
+            block->swap(*_block);
             _block.reset();
             return Status::OK();
         }
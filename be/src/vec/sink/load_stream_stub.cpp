@@ -211,7 +211,7 @@ Status LoadStreamStub::open(BrpcClientCache<PBackendService_Stub>* client_cache,
 
 // APPEND_DATA
 Status LoadStreamStub::append_data(int64_t partition_id, int64_t index_id, int64_t tablet_id,
-                                   int32_t segment_id, uint64_t offset, std::span<const Slice> data,
+                                   int32_t segment_id, uint64_t offset, const butil::IOBuf& data,
                                    bool segment_eos, FileType file_type) {
     if (!_is_open.load()) {
         add_failed_tablet(tablet_id, _status);
@@ -370,17 +370,14 @@ void LoadStreamStub::cancel(Status reason) {
     _is_closed.store(true);
 }
 
-Status LoadStreamStub::_encode_and_send(PStreamHeader& header, std::span<const Slice> data) {
+Status LoadStreamStub::_encode_and_send(PStreamHeader& header, const butil::IOBuf& data) {
     butil::IOBuf buf;
     size_t header_len = header.ByteSizeLong();
     buf.append(reinterpret_cast<uint8_t*>(&header_len), sizeof(header_len));
     buf.append(header.SerializeAsString());
-    size_t data_len = std::transform_reduce(data.begin(), data.end(), 0, std::plus(),
-                                            [](const Slice& s) { return s.get_size(); });
+    size_t data_len = data.size();
     buf.append(reinterpret_cast<uint8_t*>(&data_len), sizeof(data_len));
-    for (const auto& slice : data) {
-        buf.append(slice.get_data(), slice.get_size());
-    }
+    buf.append(data);
     bool eos = header.opcode() == doris::PStreamHeader::CLOSE_LOAD;
     bool get_schema = header.opcode() == doris::PStreamHeader::GET_SCHEMA;
     add_bytes_written(buf.size());
@@ -137,9 +137,11 @@ public:
             // so in practice it will not exceed the range of i16.
 
             // APPEND_DATA
+            // the blocks of `data` are shared instead of copied, so the data sent to all replicas
+            // of a tablet is copied only once
             Status
             append_data(int64_t partition_id, int64_t index_id, int64_t tablet_id,
-                        int32_t segment_id, uint64_t offset, std::span<const Slice> data,
+                        int32_t segment_id, uint64_t offset, const butil::IOBuf& data,
                         bool segment_eos = false, FileType file_type = FileType::SEGMENT_FILE);
 
     // ADD_SEGMENT
@@ -248,7 +250,7 @@ public:
     }
 
 private:
-    Status _encode_and_send(PStreamHeader& header, std::span<const Slice> data = {});
+    Status _encode_and_send(PStreamHeader& header, const butil::IOBuf& data = {});
     Status _send_with_buffer(butil::IOBuf& buf, bool sync = false);
     Status _send_with_retry(butil::IOBuf& buf);
     void _handle_failure(butil::IOBuf& buf, Status st);
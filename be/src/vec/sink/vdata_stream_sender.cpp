@@ -335,8 +335,9 @@ Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t n
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
+                                   &compressed_bytes, _next_compression_type(),
                                    _parent->transfer_large_data_by_brpc()));
+    _update_compression_saving(*dest, uncompressed_bytes, compressed_bytes);
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
@@ -350,4 +351,32 @@ Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t n
     return Status::OK();
 }
 
+segment_v2::CompressionTypePB BlockSerializer::_next_compression_type() {
+    auto compression_type = _parent->compression_type();
+    if (compression_type == segment_v2::NO_COMPRESSION || _compression_skip_blocks == 0) {
+        return compression_type;
+    }
+    --_compression_skip_blocks;
+    COUNTER_UPDATE(_parent->_uncompressed_blocks_counter, 1);
+    return segment_v2::NO_COMPRESSION;
+}
+
+void BlockSerializer::_update_compression_saving(const PBlock& block, size_t uncompressed_bytes,
+                                                 size_t compressed_bytes) {
+    if (!block.has_compression_type() || uncompressed_bytes == 0) {
+        // not compressed
+        return;
+    }
+    if (static_cast<double>(compressed_bytes) <
+        static_cast<double>(uncompressed_bytes) *
+                (1 - config::exchange_compression_min_saving_ratio)) {
+        _compression_backoff_blocks = 1;
+        return;
+    }
+    // the blocks of a channel are usually alike, skip some of the next blocks and skip twice as
+    // many each time the compression is still not worth it
+    _compression_skip_blocks = _compression_backoff_blocks;
+    _compression_backoff_blocks = std::min(_compression_backoff_blocks * 2, 64);
+}
+
 } // namespace doris::vectorized
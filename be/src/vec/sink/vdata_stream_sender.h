@@ -97,9 +97,18 @@ public:
 
 private:
     Status _serialize_block(PBlock* dest, size_t num_receivers = 1);
+    // The compression of the next block, none if the last compressed blocks were not small
+    // enough to be worth the cpu.
+    segment_v2::CompressionTypePB _next_compression_type();
+    void _update_compression_saving(const PBlock& block, size_t uncompressed_bytes,
+                                    size_t compressed_bytes);
 
     pipeline::ExchangeSinkLocalState* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
+    // blocks to send without compression before trying to compress again, and the number of
+    // blocks skipped after the next compression that saves too little
+    int _compression_skip_blocks = 0;
+    int _compression_backoff_blocks = 1;
 
     bool _is_local;
     const int _batch_size;
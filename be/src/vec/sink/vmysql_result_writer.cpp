@@ -39,6 +39,8 @@
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/types.h"
@@ -96,6 +98,49 @@ Status GetResultBatchCtx::on_data(const std::shared_ptr<TFetchDataResult>& t_res
     return Status::OK();
 }
 
+struct EncodedFields {
+    std::string buf;
+    std::vector<size_t> offsets;
+};
+
+template <PrimitiveType T>
+static void encode_int_column(const IColumn& column, const uint8_t* null_map, size_t num_rows,
+                              EncodedFields* fields) {
+    const auto& data = assert_cast<const ColumnVector<T>&>(column).get_data();
+    encode_int_fields(data.data(), null_map, num_rows, &fields->buf, &fields->offsets);
+}
+
+// Encodes the integer columns of the text protocol at once, so the rows are assembled from the
+// encoded fields. Returns false for the other columns, they are written cell by cell.
+static bool encode_column_fields(const ColumnWithTypeAndName& column, size_t num_rows,
+                                 EncodedFields* fields) {
+    if (is_column_const(*column.column)) {
+        return false;
+    }
+    const IColumn* nested_column = column.column.get();
+    const uint8_t* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(*column.column)) {
+        nested_column = &nullable->get_nested_column();
+        null_map = nullable->get_null_map_data().data();
+    }
+    switch (remove_nullable(column.type)->get_primitive_type()) {
+    case TYPE_TINYINT:
+        encode_int_column<TYPE_TINYINT>(*nested_column, null_map, num_rows, fields);
+        return true;
+    case TYPE_SMALLINT:
+        encode_int_column<TYPE_SMALLINT>(*nested_column, null_map, num_rows, fields);
+        return true;
+    case TYPE_INT:
+        encode_int_column<TYPE_INT>(*nested_column, null_map, num_rows, fields);
+        return true;
+    case TYPE_BIGINT:
+        encode_int_column<TYPE_BIGINT>(*nested_column, null_map, num_rows, fields);
+        return true;
+    default:
+        return false;
+    }
+}
+
 template <bool is_binary_format>
 VMysqlResultWriter<is_binary_format>::VMysqlResultWriter(
         std::shared_ptr<ResultBlockBufferBase> sinker, const VExprContextSPtrs& output_vexpr_ctxs,
@@ -193,6 +238,8 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             const IColumn* column;
             bool is_const;
             DataTypeSerDeSPtr serde;
+            // set if the column is encoded at once
+            const EncodedFields* fields = nullptr;
         };
 
         const size_t num_cols = _output_vexpr_ctxs.size();
@@ -233,8 +280,26 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
+        std::vector<EncodedFields> encoded_fields;
+        if constexpr (!is_binary_format) {
+            encoded_fields.resize(num_cols);
+            for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                if (encode_column_fields(block.get_by_position(col_idx), num_rows,
+                                         &encoded_fields[col_idx])) {
+                    arguments[col_idx].fields = &encoded_fields[col_idx];
+                }
+            }
+        }
+
         for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
             for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                if (const auto* fields = arguments[col_idx].fields; fields != nullptr) {
+                    auto begin = fields->offsets[row_idx];
+                    auto length = fields->offsets[row_idx + 1] - begin;
+                    memcpy(row_buffer.reserved(static_cast<int64_t>(length)),
+                           fields->buf.data() + begin, length);
+                    continue;
+                }
                 RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
                         *(arguments[col_idx].column), row_buffer, row_idx,
                         arguments[col_idx].is_const, _options));
@@ -42,10 +42,13 @@
 #include "runtime/decimalv2_value.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/large_int_value.h"
 #include "runtime/primitive_type.h"
 #include "runtime/result_block_buffer.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/mysql_row_buffer.h"
 #include "util/s3_uri.h"
@@ -86,6 +89,12 @@ VFileResultWriter::VFileResultWriter(
     _output_object_data = output_object_data;
 }
 
+VFileResultWriter::~VFileResultWriter() {
+    if (_closing_file != nullptr) {
+        static_cast<void>(_closing_file_status.get());
+    }
+}
+
 Status VFileResultWriter::open(RuntimeState* state, RuntimeProfile* profile) {
     _state = state;
     _init_profile(profile);
@@ -237,7 +246,7 @@ Status VFileResultWriter::_create_new_file_if_exceed_size() {
     // and create new one
     {
         SCOPED_TIMER(_writer_close_timer);
-        RETURN_IF_ERROR(_close_file_writer(false));
+        RETURN_IF_ERROR(_close_file_writer_async());
     }
     _current_written_bytes = 0;
     return Status::OK();
@@ -270,6 +279,41 @@ Status VFileResultWriter::_close_file_writer(bool done) {
     return Status::OK();
 }
 
+Status VFileResultWriter::_close_file_writer_async() {
+    // only one file is closed in background at a time
+    RETURN_IF_ERROR(_wait_closing_file());
+    if (_vfile_writer == nullptr) {
+        return _close_file_writer(false);
+    }
+    _closing_file = std::make_shared<ClosingFile>();
+    _closing_file->file_writer_impl = std::move(_file_writer_impl);
+    _closing_file->vfile_writer = std::move(_vfile_writer);
+    _closing_file_status = _closing_file->promise.get_future();
+    Status st = ExecEnv::GetInstance()->non_block_close_thread_pool()->submit_func(
+            [closing_file = _closing_file,
+             resource_ctx = _state->get_query_ctx()->resource_ctx()]() {
+                SCOPED_ATTACH_TASK(resource_ctx);
+                closing_file->promise.set_value(closing_file->vfile_writer->close());
+            });
+    if (!st.ok()) {
+        _closing_file->promise.set_value(_closing_file->vfile_writer->close());
+    }
+    return _create_next_file_writer();
+}
+
+Status VFileResultWriter::_wait_closing_file() {
+    if (_closing_file == nullptr) {
+        return Status::OK();
+    }
+    Status st = _closing_file_status.get();
+    if (st.ok()) {
+        // same as _close_file_writer, written_len is final only after the file is closed
+        COUNTER_UPDATE(_written_data_bytes, _closing_file->vfile_writer->written_len());
+    }
+    _closing_file.reset();
+    return st;
+}
+
 Status VFileResultWriter::_send_result() {
     if (_is_result_sent) {
         return Status::OK();
@@ -432,6 +476,11 @@ double VFileResultWriter::_get_write_speed(int64_t write_bytes, int64_t write_ti
 
 Status VFileResultWriter::close(Status exec_status) {
     Status st = exec_status;
+    // the file closed in background must be finished whatever the exec status is
+    Status closing_st = _wait_closing_file();
+    if (st.ok()) {
+        st = closing_st;
+    }
     if (st.ok()) {
         // the following 2 profile "_written_rows_counter" and "_writer_close_timer"
         // must be outside the `_close_file_writer()`.
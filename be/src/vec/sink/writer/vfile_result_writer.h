@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include <cstdint>
+#include <future>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -68,6 +69,8 @@ public:
                       std::shared_ptr<pipeline::Dependency> dep,
                       std::shared_ptr<pipeline::Dependency> fin_dep);
 
+    ~VFileResultWriter() override;
+
     Status write(RuntimeState* state, Block& block) override;
 
     Status close(Status exec_status) override;
@@ -95,6 +98,10 @@ private:
     std::string _file_format_to_name();
     // close file writer, and if !done, it will create new writer for next file.
     Status _close_file_writer(bool done);
+    // close the current file in background, and create new writer for next file.
+    Status _close_file_writer_async();
+    // wait for the file closed by _close_file_writer_async to be finished
+    Status _wait_closing_file();
     // create a new file if current file size exceed limit
     Status _create_new_file_if_exceed_size();
     // send the final statistic result
@@ -148,6 +155,16 @@ private:
     // convert block to parquet/orc/csv fomrat
     std::unique_ptr<VFileFormatTransformer> _vfile_writer;
 
+    // A file exceeding max_file_size is closed in background, so that flushing its remaining
+    // data and finishing the upload overlaps with writing the next file.
+    struct ClosingFile {
+        std::unique_ptr<doris::io::FileWriter> file_writer_impl;
+        std::unique_ptr<VFileFormatTransformer> vfile_writer;
+        std::promise<Status> promise;
+    };
+    std::shared_ptr<ClosingFile> _closing_file;
+    std::future<Status> _closing_file_status;
+
     std::string_view _header_type;
     std::string_view _header;
 };
@@ -97,7 +97,9 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
             _vec_output_expr_ctxs, block, &output_block, false));
     materialize_block_inplace(output_block);
 
-    std::unordered_map<std::shared_ptr<VHivePartitionWriter>, IColumn::Filter> writer_positions;
+    // the rows of the block to write by each partition writer
+    std::unordered_map<std::shared_ptr<VHivePartitionWriter>, std::vector<uint32_t>>
+            writer_positions;
     _row_count += output_block.rows();
     auto& hive_table_sink = _t_sink.hive_table_sink;
 
@@ -162,9 +164,7 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
                     auto writer = _create_partition_writer(output_block, position, file_name,
                                                            file_name_index);
                     RETURN_IF_ERROR(writer->open(_state, _operator_profile));
-                    IColumn::Filter filter(output_block.rows(), 0);
-                    filter[position] = 1;
-                    writer_positions.insert({writer, std::move(filter)});
+                    writer_positions.insert({writer, {static_cast<uint32_t>(position)}});
                     _partitions_to_writers.insert({partition_name, writer});
                     writer_ptr = writer;
                 } catch (doris::Exception& e) {
@@ -201,46 +201,41 @@ Status VHiveTableWriter::write(RuntimeState* state, vectorized::Block& block) {
                 }
                 auto writer_pos_iter = writer_positions.find(writer);
                 if (writer_pos_iter == writer_positions.end()) {
-                    IColumn::Filter filter(output_block.rows(), 0);
-                    filter[i] = 1;
-                    writer_positions.insert({writer, std::move(filter)});
+                    writer_positions.insert({writer, {static_cast<uint32_t>(i)}});
                 } else {
-                    writer_pos_iter->second[i] = 1;
+                    writer_pos_iter->second.push_back(static_cast<uint32_t>(i));
                 }
             }
         }
     }
     SCOPED_RAW_TIMER(&_partition_writers_write_ns);
     output_block.erase(_non_write_columns_indices);
+    if (writer_positions.size() == 1) {
+        // all the rows belong to one partition, which is common for the sorted or clustered input
+        return writer_positions.begin()->first->write(output_block);
+    }
     for (auto it = writer_positions.begin(); it != writer_positions.end(); ++it) {
         Block filtered_block;
-        RETURN_IF_ERROR(_filter_block(output_block, &it->second, &filtered_block));
+        RETURN_IF_ERROR(_filter_block(output_block, it->second, &filtered_block));
         RETURN_IF_ERROR(it->first->write(filtered_block));
     }
     return Status::OK();
 }
 
 Status VHiveTableWriter::_filter_block(doris::vectorized::Block& block,
-                                       const vectorized::IColumn::Filter* filter,
+                                       const std::vector<uint32_t>& rows,
                                        doris::vectorized::Block* output_block) {
     const ColumnsWithTypeAndName& columns_with_type_and_name =
             block.get_columns_with_type_and_name();
     vectorized::ColumnsWithTypeAndName result_columns;
     for (int i = 0; i < columns_with_type_and_name.size(); ++i) {
         const auto& col = columns_with_type_and_name[i];
-        result_columns.emplace_back(col.column->clone_resized(col.column->size()), col.type,
-                                    col.name);
+        // gather the rows of the partition rather than copying and filtering the whole block
+        auto column = col.column->clone_empty();
+        column->insert_indices_from(*col.column, rows.data(), rows.data() + rows.size());
+        result_columns.emplace_back(std::move(column), col.type, col.name);
     }
     *output_block = {std::move(result_columns)};
-
-    std::vector<uint32_t> columns_to_filter;
-    int column_to_keep = output_block->columns();
-    columns_to_filter.resize(column_to_keep);
-    for (uint32_t i = 0; i < column_to_keep; ++i) {
-        columns_to_filter[i] = i;
-    }
-
-    Block::filter_block_internal(output_block, columns_to_filter, *filter);
     return Status::OK();
 }
 
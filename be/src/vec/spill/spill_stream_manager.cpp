@@ -130,22 +130,32 @@ Status SpillStreamManager::_init_spill_store_map() {
 
 std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
         TStorageMedium::type storage_medium) {
-    std::vector<std::pair<SpillDataDir*, double>> stores_with_usage;
+    struct StoreLoad {
+        SpillDataDir* store;
+        int64_t writing_streams;
+        double usage;
+    };
+    std::vector<StoreLoad> stores_with_load;
     for (auto& [_, store] : _spill_store_map) {
         if (store->storage_medium() == storage_medium && !store->reach_capacity_limit(0)) {
-            stores_with_usage.emplace_back(store.get(), store->_get_disk_usage(0));
+            stores_with_load.push_back(
+                    {store.get(), store->get_writing_streams(), store->_get_disk_usage(0)});
         }
     }
-    if (stores_with_usage.empty()) {
+    if (stores_with_load.empty()) {
         return {};
     }
 
-    std::sort(stores_with_usage.begin(), stores_with_usage.end(),
-              [](auto&& a, auto&& b) { return a.second < b.second; });
+    // the disk usage only changes after the data is written, choosing by it alone puts all the
+    // streams of a spilling query on the same disk
+    std::sort(stores_with_load.begin(), stores_with_load.end(), [](auto&& a, auto&& b) {
+        return a.writing_streams != b.writing_streams ? a.writing_streams < b.writing_streams
+                                                      : a.usage < b.usage;
+    });
 
     std::vector<SpillDataDir*> stores;
-    for (const auto& [store, _] : stores_with_usage) {
-        stores.emplace_back(store);
+    for (const auto& store_with_load : stores_with_load) {
+        stores.emplace_back(store_with_load.store);
     }
     return stores;
 }
@@ -416,10 +426,10 @@ bool SpillDataDir::reach_capacity_limit(int64_t incoming_data_size) {
 std::string SpillDataDir::debug_string() {
     return fmt::format(
             "path: {}, capacity: {}, limit: {}, used: {}, available: "
-            "{}",
+            "{}, writing streams: {}",
             _path, PrettyPrinter::print_bytes(_disk_capacity_bytes),
             PrettyPrinter::print_bytes(_spill_data_limit_bytes),
             PrettyPrinter::print_bytes(_spill_data_bytes),
-            PrettyPrinter::print_bytes(_available_bytes));
+            PrettyPrinter::print_bytes(_available_bytes), _writing_streams.load());
 }
 } // namespace doris::vectorized
@@ -79,6 +79,12 @@ public:
         return _spill_data_limit_bytes;
     }
 
+    // The spill streams that are writing to this data dir, new streams go to the data dirs with
+    // the fewest of them so that the writes are spread over all the disks.
+    int64_t get_writing_streams() const { return _writing_streams; }
+
+    void update_writing_streams(int64_t delta) { _writing_streams += delta; }
+
     std::string debug_string();
 
 private:
@@ -102,6 +108,7 @@ private:
     size_t _available_bytes = 0;
     int64_t _spill_data_bytes = 0;
     TStorageMedium::type _storage_medium;
+    std::atomic_int64_t _writing_streams = 0;
 
     std::shared_ptr<MetricEntity> spill_data_dir_metric_entity;
     IntGauge* spill_disk_capacity = nullptr;
@@ -18,6 +18,7 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/local_file_writer.h"
@@ -28,11 +29,37 @@
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+namespace {
+segment_v2::CompressionTypePB spill_compression_type(const SpillDataDir& data_dir) {
+    const auto& type = config::spill_compression_type;
+    if (type == "NONE") {
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    } else if (type == "LZ4") {
+        return segment_v2::CompressionTypePB::LZ4;
+    } else if (type == "ZSTD") {
+        return segment_v2::CompressionTypePB::ZSTD;
+    }
+    // ZSTD for better compression ratio on slow disks
+    return data_dir.storage_medium() == TStorageMedium::SSD ? segment_v2::CompressionTypePB::LZ4
+                                                            : segment_v2::CompressionTypePB::ZSTD;
+}
+} // namespace
+
+SpillWriter::~SpillWriter() {
+    if (writing_) {
+        data_dir_->update_writing_streams(-1);
+    }
+}
+
 Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    compression_type_ = spill_compression_type(*data_dir_);
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_file(file_path_, &file_writer_));
+    data_dir_->update_writing_streams(1);
+    writing_ = true;
+    return Status::OK();
 }
 
 Status SpillWriter::close() {
@@ -40,6 +67,9 @@ Status SpillWriter::close() {
         return Status::OK();
     }
     closed_ = true;
+    data_dir_->update_writing_streams(-1);
+    writing_ = false;
+    std::string().swap(serialize_buff_);
 
     meta_.append((const char*)&max_sub_block_size_, sizeof(max_sub_block_size_));
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
@@ -108,21 +138,20 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
 
     Status status;
-    std::string buff;
+    auto& buff = serialize_buff_;
     int64_t buff_size {0};
 
     if (block.rows() > 0) {
         {
             PBlock pblock;
             SCOPED_TIMER(_serialize_timer);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
+            status = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                     &uncompressed_bytes, &compressed_bytes, compression_type_);
             RETURN_IF_ERROR(status);
             int64_t pblock_mem = pblock.ByteSizeLong();
             COUNTER_UPDATE(_memory_used_counter, pblock_mem);
             Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -pblock_mem); }};
+            // keeps the capacity of the buffer of the previous block
             if (!pblock.SerializeToString(&buff)) {
                 return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
                         "serialize spill data error. [path={}]", file_path_);
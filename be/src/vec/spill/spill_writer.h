@@ -47,6 +47,8 @@ public:
         _memory_used_counter = common_profile->get_counter("MemoryUsage");
     }
 
+    ~SpillWriter();
+
     Status open();
 
     Status close();
@@ -77,12 +79,18 @@ private:
     // for checking disk capacity when write data to disk.
     SpillDataDir* data_dir_ = nullptr;
     std::atomic_bool closed_ = false;
+    // counted in the writing streams of `data_dir_` from open to close
+    bool writing_ = false;
     int64_t stream_id_;
     size_t batch_size_;
     size_t max_sub_block_size_ = 0;
     std::string file_path_;
     std::unique_ptr<doris::io::FileWriter> file_writer_;
 
+    segment_v2::CompressionTypePB compression_type_ = segment_v2::CompressionTypePB::ZSTD;
+    // reused by the blocks to serialize into
+    std::string serialize_buff_;
+
     size_t written_blocks_ = 0;
     int64_t total_written_bytes_ = 0;
     std::string meta_;
@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "testutil/column_helper.h"
 #include "vec/common/columns_hashing.h"
 #include "vec/common/hash_table/hash.h"
@@ -115,6 +116,26 @@ TEST(HashTableMethodTest, testMethodSerialized) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodSerializedExactSizes) {
+    MethodSerialized<StringHashMap<IColumn::ColumnIndex>> method;
+    auto int_column = ColumnHelper::create_column<DataTypeInt32>({1, 2, 3, 4, 5});
+    auto str_column = ColumnHelper::create_column<DataTypeString>(
+            {"1", std::string(1000, 'x'), "3", "4", "5"});
+    ColumnRawPtrs key_raw_columns {int_column.get(), str_column.get()};
+
+    // sized by the longest row the keys reach the limit, sized exactly they do not
+    auto limit = config::pre_serialize_keys_limit_bytes;
+    config::pre_serialize_keys_limit_bytes = 2048;
+    method.init_serialized_keys(key_raw_columns, 5);
+    config::pre_serialize_keys_limit_bytes = limit;
+
+    Arena arena;
+    for (size_t i = 0; i < 5; ++i) {
+        auto expected = method.serialize_keys_to_pool_contiguous(i, 2, key_raw_columns, arena);
+        EXPECT_EQ(expected, method.keys[i]);
+    }
+}
+
 TEST(HashTableMethodTest, testMethodStringNoCache) {
     MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>> method;
 
@@ -3332,6 +3332,61 @@ TEST_F(BlockFileCacheTest, test_disposable) {
     EXPECT_EQ(cache.get_used_cache_size(FileCacheType::DISPOSABLE), 0);
 }
 
+TEST_F(BlockFileCacheTest, lru_move_interval) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.capacity = 30;
+    settings.max_file_block_size = 30;
+    settings.max_query_cache_size = 30;
+    io::CacheContext context;
+    ReadStatistics rstats;
+    context.stats = &rstats;
+    context.cache_type = FileCacheType::NORMAL;
+    auto key = io::BlockFileCache::hash("key1");
+    io::BlockFileCache cache(cache_base_path, settings);
+    ASSERT_TRUE(cache.initialize());
+    for (int i = 0; i < 100; i++) {
+        if (cache.get_async_open_success()) {
+            break;
+        };
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (size_t offset : {0, 10}) {
+        auto holder = cache.get_or_set(key, offset, 10, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        ASSERT_TRUE(blocks[0]->get_or_set_downloader() == io::FileBlock::get_caller_id());
+        download(blocks[0]);
+    }
+    auto queue_string = [&]() {
+        std::lock_guard lock(cache._mutex);
+        return cache._normal_queue.to_string(lock);
+    };
+
+    auto interval = config::file_cache_lru_move_interval_s;
+    config::file_cache_lru_move_interval_s = 3600;
+    // the first hits move the blocks, they were not used before
+    cache.get_or_set(key, 0, 10, context);
+    cache.get_or_set(key, 10, 10, context);
+    auto queue_str = queue_string();
+    // hit again soon after, the block is kept in place
+    cache.get_or_set(key, 0, 10, context);
+    EXPECT_EQ(queue_str, queue_string());
+
+    config::file_cache_lru_move_interval_s = 0;
+    cache.get_or_set(key, 0, 10, context);
+    EXPECT_NE(queue_str, queue_string());
+    config::file_cache_lru_move_interval_s = interval;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
 TEST_F(BlockFileCacheTest, test_query_limit) {
     {
         config::enable_file_cache_query_limit = true;
@@ -125,11 +125,11 @@ TEST_F(CacheLRUDumperTest, test_dump_and_restore_queue) {
     src_queue.add(hash, offset, size, lock);
 
     // Test dump
-    dumper->do_dump_queue(src_queue, queue_name);
+    EXPECT_TRUE(dumper->do_dump_queue(src_queue, queue_name, 1).ok());
 
     // Test restore
     std::lock_guard<std::mutex> cache_lock(mock_cache->mutex());
-    dumper->restore_queue(dst_queue, queue_name, cache_lock);
+    EXPECT_TRUE(dumper->restore_queue(dst_queue, queue_name, cache_lock).ok());
 
     // Verify queue content and order
     auto src_it = src_queue.begin();
@@ -146,4 +146,25 @@ TEST_F(CacheLRUDumperTest, test_dump_and_restore_queue) {
     std::remove(fmt::format("lru_dump_{}.tail", queue_name).c_str());
 }
 
+TEST_F(CacheLRUDumperTest, test_dump_whole_queue) {
+    LRUQueue src_queue;
+    std::string queue_name = "index";
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < 10; ++i) {
+        src_queue.add(UInt128Wrapper(i), i * 4096, 4096, lock);
+    }
+    auto tail_record_num = config::file_cache_background_lru_dump_tail_record_num;
+    config::file_cache_background_lru_dump_tail_record_num = 3;
+    EXPECT_TRUE(dumper->dump_whole_queue(src_queue, queue_name).ok());
+    config::file_cache_background_lru_dump_tail_record_num = tail_record_num;
+
+    std::lock_guard<std::mutex> cache_lock(mock_cache->mutex());
+    EXPECT_TRUE(dumper->restore_queue(dst_queue, queue_name, cache_lock).ok());
+    EXPECT_EQ(dst_queue.get_elements_num(cache_lock), 10);
+
+    std::remove(fmt::format("lru_dump_{}.tail", queue_name).c_str());
+    auto st = dumper->restore_queue(dst_queue, queue_name, cache_lock);
+    EXPECT_TRUE(st.is<ErrorCode::NOT_FOUND>()) << st;
+}
+
 } // namespace doris::io
\ No newline at end of file
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "io/cache/frequency_sketch.h"
+
+#include <gtest/gtest.h>
+
+#include "io/cache/block_file_cache.h"
+
+namespace doris::io {
+
+TEST(FrequencySketchTest, Frequency) {
+    FrequencySketch sketch(1024);
+    auto hot = BlockFileCache::hash("hot");
+    auto cold = BlockFileCache::hash("cold");
+    for (int i = 0; i < 5; ++i) {
+        sketch.increment(hot, 0);
+    }
+    sketch.increment(cold, 0);
+    EXPECT_EQ(sketch.frequency(hot, 0), 5);
+    EXPECT_EQ(sketch.frequency(cold, 0), 1);
+    EXPECT_EQ(sketch.frequency(hot, 1024 * 1024), 0);
+
+    // the counters saturate
+    for (int i = 0; i < 20; ++i) {
+        sketch.increment(hot, 0);
+    }
+    EXPECT_EQ(sketch.frequency(hot, 0), 15);
+}
+
+TEST(FrequencySketchTest, Age) {
+    FrequencySketch sketch(1024);
+    auto hot = BlockFileCache::hash("hot");
+    for (int i = 0; i < 8; ++i) {
+        sketch.increment(hot, 0);
+    }
+    // the counters are halved after 10 * 1024 accesses
+    auto other = BlockFileCache::hash("other");
+    for (int i = 0; i < 10 * 1024 - 8; ++i) {
+        sketch.increment(other, 0);
+    }
+    EXPECT_EQ(sketch.frequency(hot, 0), 4);
+    EXPECT_EQ(sketch.frequency(other, 0), 7);
+}
+
+} // namespace doris::io
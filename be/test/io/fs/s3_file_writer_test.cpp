@@ -840,6 +840,60 @@ TEST_F(S3FileWriterTest, normal) {
     ASSERT_EQ(0, std::memcmp(content.data(), s.get_data(), file_size));
 }
 
+TEST_F(S3FileWriterTest, inflight_window) {
+    mock_client = std::make_shared<MockS3Client>();
+    auto max_inflight_parts = config::s3_file_writer_max_inflight_parts;
+    auto pool_max_num = config::s3_write_buffer_pool_max_num;
+    config::s3_file_writer_max_inflight_parts = 2;
+    config::s3_write_buffer_pool_max_num = 4;
+    Defer defer {[&]() {
+        config::s3_file_writer_max_inflight_parts = max_inflight_parts;
+        config::s3_write_buffer_pool_max_num = pool_max_num;
+    }};
+    doris::io::FileWriterOptions state;
+    auto fs = io::global_local_filesystem();
+
+    io::FileReaderSPtr local_file_reader;
+    ASSERT_TRUE(fs->open_file("./be/test/olap/test_data/all_types_100000.txt", &local_file_reader)
+                        .ok());
+
+    constexpr int buf_size = 8192;
+    io::FileWriterPtr s3_file_writer;
+    auto st = s3_fs->create_file("inflight_window", &s3_file_writer, &state);
+    ASSERT_TRUE(st.ok()) << st;
+
+    char buf[buf_size];
+    Slice slice(buf, buf_size);
+    size_t offset = 0;
+    size_t bytes_read = 0;
+    auto file_size = local_file_reader->size();
+    while (offset < file_size) {
+        st = local_file_reader->read_at(offset, slice, &bytes_read);
+        ASSERT_TRUE(st.ok()) << st;
+        st = s3_file_writer->append(Slice(buf, bytes_read));
+        ASSERT_TRUE(st.ok()) << st;
+        offset += bytes_read;
+    }
+    st = s3_file_writer->close();
+    ASSERT_TRUE(st.ok()) << st;
+    auto* writer = static_cast<S3FileWriter*>(s3_file_writer.get());
+    EXPECT_EQ(0, writer->_inflight_parts);
+    EXPECT_LE(writer->_inflight_window, 2);
+
+    const auto& contents = mock_client->contents();
+    std::stringstream ss;
+    for (size_t i = 1; i <= contents.size(); i++) {
+        ss << contents.at(i);
+    }
+    std::string content = ss.str();
+    ASSERT_EQ(content.size(), file_size);
+    std::unique_ptr<char[]> content_buf = std::make_unique<char[]>(file_size);
+    Slice s(content_buf.get(), file_size);
+    st = local_file_reader->read_at(0, s, &bytes_read);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(0, std::memcmp(content.data(), s.get_data(), file_size));
+}
+
 TEST_F(S3FileWriterTest, smallFile) {
     mock_client = std::make_shared<MockS3Client>();
     doris::io::FileWriterOptions state;
@@ -59,7 +59,7 @@ class StreamSinkFileWriterTest : public testing::Test {
 
         // APPEND_DATA
         virtual Status append_data(int64_t partition_id, int64_t index_id, int64_t tablet_id,
-                                   int32_t segment_id, uint64_t offset, std::span<const Slice> data,
+                                   int32_t segment_id, uint64_t offset, const butil::IOBuf& data,
                                    bool segment_eos = false,
                                    FileType file_type = FileType::SEGMENT_FILE) override {
             EXPECT_EQ(PARTITION_ID, partition_id);
@@ -70,9 +70,7 @@ class StreamSinkFileWriterTest : public testing::Test {
                 EXPECT_EQ(0, data.size());
                 EXPECT_EQ(DATA0.length() + DATA1.length(), offset);
             } else {
-                EXPECT_EQ(2, data.size());
-                EXPECT_EQ(DATA0, data[0].to_string());
-                EXPECT_EQ(DATA1, data[1].to_string());
+                EXPECT_EQ(DATA0 + DATA1, data.to_string());
                 EXPECT_EQ(0, offset);
             }
             g_num_request++;
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/column_ndv_collector.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris {
+
+TEST(ColumnNdvCollectorTest, CountDistinct) {
+    std::vector<int32_t> data1;
+    std::vector<int32_t> data2;
+    for (int32_t i = 0; i < 10000; ++i) {
+        data1.push_back(i % 100);
+        data2.push_back(i);
+    }
+    auto block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(data1, data2);
+
+    ColumnNdvCollector collector(3);
+    collector.add({0, 2}, block);
+    // a second block of the same values does not add distinct values
+    collector.add({0, 2}, block);
+
+    EXPECT_EQ(collector.ndv(0), 100);
+    // the estimation is within a few percent
+    EXPECT_NEAR(collector.ndv(2), 10000, 500);
+    EXPECT_EQ(collector.ndv(1), -1);
+}
+
+TEST(ColumnNdvCollectorTest, NullableColumn) {
+    auto block = vectorized::ColumnHelper::create_nullable_block<vectorized::DataTypeInt32>(
+            {1, 2, 3, 4}, {0, 1, 0, 1});
+
+    ColumnNdvCollector collector(1);
+    collector.add({0}, block);
+    // 1, 3 and null
+    EXPECT_EQ(collector.ndv(0), 3);
+}
+
+} // namespace doris
@@ -159,7 +159,9 @@ TEST_F(DateBloomFilterTest, query_index_test) {
 
     // date
     {
-        const auto& reader = segment->_column_readers[0];
+        OlapReaderStatistics stats;
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_column_reader_by_uid(0, &stats, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -178,7 +180,9 @@ TEST_F(DateBloomFilterTest, query_index_test) {
 
     // datetime
     {
-        const auto& reader = segment->_column_readers[1];
+        OlapReaderStatistics stats;
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_column_reader_by_uid(1, &stats, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -239,7 +243,9 @@ TEST_F(DateBloomFilterTest, in_list_predicate_test) {
 
     // Test DATE column with IN predicate
     {
-        const auto& reader = segment->_column_readers[0];
+        OlapReaderStatistics stats;
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_column_reader_by_uid(0, &stats, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
@@ -289,7 +295,9 @@ TEST_F(DateBloomFilterTest, in_list_predicate_test) {
 
     // Test DATETIME column with IN predicate
     {
-        const auto& reader = segment->_column_readers[1];
+        OlapReaderStatistics stats;
+        segment_v2::ColumnReader* reader = nullptr;
+        EXPECT_TRUE(segment->_get_column_reader_by_uid(1, &stats, &reader).ok());
         std::unique_ptr<BloomFilterIndexIterator> bf_iter;
         EXPECT_TRUE(reader->_bloom_filter_index->load(true, true, nullptr).ok());
         EXPECT_TRUE(reader->_bloom_filter_index->new_iterator(&bf_iter, nullptr).ok());
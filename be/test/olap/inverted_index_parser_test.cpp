@@ -317,4 +317,32 @@ TEST_F(InvertedIndexParserTest, TestConstants) {
     EXPECT_EQ(INVERTED_INDEX_PARSER_CHAR_FILTER_REPLACEMENT, "char_filter_replacement");
 }
 
+// Test is_same_index_analysis function
+TEST_F(InvertedIndexParserTest, TestIsSameIndexAnalysis) {
+    std::map<std::string, std::string> empty;
+    std::map<std::string, std::string> defaults = {{INVERTED_INDEX_PARSER_KEY, "NONE"},
+                                                   {INVERTED_INDEX_PARSER_LOWERCASE_KEY, "true"},
+                                                   {INVERTED_INDEX_PARSER_PHRASE_SUPPORT_KEY,
+                                                    INVERTED_INDEX_PARSER_PHRASE_SUPPORT_NO}};
+    EXPECT_TRUE(is_same_index_analysis(empty, defaults));
+    EXPECT_TRUE(is_same_index_analysis(defaults, empty));
+
+    std::map<std::string, std::string> english = {{INVERTED_INDEX_PARSER_KEY, "english"}};
+    EXPECT_FALSE(is_same_index_analysis(empty, english));
+
+    std::map<std::string, std::string> ik = {{INVERTED_INDEX_PARSER_KEY, "ik"}};
+    std::map<std::string, std::string> ik_smart = {
+            {INVERTED_INDEX_PARSER_KEY, "ik"},
+            {INVERTED_INDEX_PARSER_MODE_KEY, INVERTED_INDEX_PARSER_SMART}};
+    EXPECT_TRUE(is_same_index_analysis(ik, ik_smart));
+
+    std::map<std::string, std::string> no_lowercase = {
+            {INVERTED_INDEX_PARSER_LOWERCASE_KEY, "false"}};
+    EXPECT_FALSE(is_same_index_analysis(empty, no_lowercase));
+
+    std::map<std::string, std::string> ignore_above = {
+            {INVERTED_INDEX_PARSER_IGNORE_ABOVE_KEY, "128"}};
+    EXPECT_FALSE(is_same_index_analysis(empty, ignore_above));
+}
+
 } // namespace doris
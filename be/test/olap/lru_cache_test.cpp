@@ -22,6 +22,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <iosfwd>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -800,6 +801,27 @@ TEST_F(CacheTest, SetCapacity) {
     ASSERT_EQ(0, cache()->get_usage());
 }
 
+TEST_F(CacheTest, SetCapacityInSteps) {
+    auto shrink_step_bytes = config::cache_capacity_shrink_step_bytes;
+    config::cache_capacity_shrink_step_bytes = kCacheSize / 8;
+    init_size_cache();
+    for (int i = 0; i < kCacheSize; i++) {
+        Insert(i, 1000 + i, 1);
+    }
+    ASSERT_LE(cache()->get_usage(), kCacheSize);
+    auto element_count = static_cast<int64_t>(cache()->get_element_count());
+
+    // shrinks from kCacheSize to kCacheSize / 4 in 6 steps, the result is the same as at once
+    int64_t prune_num = cache()->adjust_capacity_weighted(0.25);
+    ASSERT_EQ(kCacheSize / 4, cache()->get_capacity());
+    ASSERT_LE(cache()->get_usage(), kCacheSize / 4);
+    ASSERT_EQ(prune_num, element_count - static_cast<int64_t>(cache()->get_element_count()));
+
+    cache()->adjust_capacity_weighted(1);
+    ASSERT_EQ(kCacheSize, cache()->get_capacity());
+    config::cache_capacity_shrink_step_bytes = shrink_step_bytes;
+}
+
 TEST_F(CacheTest, ResetInitialCapacity) {
     init_number_cache();
     for (int i = 0; i < kCacheSize; i++) {
@@ -857,4 +879,118 @@ TEST_F(CacheTest, ResetInitialCapacity) {
     ASSERT_EQ(kCacheSize / 2, cache()->get_usage());
 }
 
+static void insert_clock_LRUCache(LRUCache& cache, int key) {
+    std::string result;
+    CacheKey cache_key = EncodeKey(&result, key);
+    uint32_t hash = cache_key.hash(cache_key.data(), cache_key.size(), 0);
+    auto* cache_value = new CacheTest::CacheValueWithKey(key, EncodeValue(key));
+    cache.release(cache.insert(cache_key, hash, cache_value, 1));
+}
+
+static Cache::Handle* lookup_clock_LRUCache(LRUCache& cache, int key) {
+    std::string result;
+    CacheKey cache_key = EncodeKey(&result, key);
+    return cache.lookup(cache_key, cache_key.hash(cache_key.data(), cache_key.size(), 0));
+}
+
+static bool in_clock_LRUCache(LRUCache& cache, int key) {
+    Cache::Handle* handle = lookup_clock_LRUCache(cache, key);
+    cache.release(handle);
+    return handle != nullptr;
+}
+
+TEST_F(CacheTest, ClockEviction) {
+    LRUCache cache(LRUCacheType::NUMBER, false, true);
+    cache.set_capacity(3);
+    insert_clock_LRUCache(cache, 1);
+    insert_clock_LRUCache(cache, 2);
+    insert_clock_LRUCache(cache, 3);
+
+    // 1 is visited and gets a second chance, 2 is the oldest one not visited
+    cache.release(lookup_clock_LRUCache(cache, 1));
+    insert_clock_LRUCache(cache, 4);
+    ASSERT_EQ(1, _deleted_keys.size());
+    EXPECT_EQ(2, _deleted_keys[0]);
+    EXPECT_EQ(3, cache.get_usage());
+
+    // 3 is pinned, 1 lost its visited bit when the hand passed it
+    Cache::Handle* handle = lookup_clock_LRUCache(cache, 3);
+    ASSERT_NE(nullptr, handle);
+    insert_clock_LRUCache(cache, 5);
+    ASSERT_EQ(2, _deleted_keys.size());
+    EXPECT_EQ(1, _deleted_keys[1]);
+
+    // an erased entry is freed by its last handle
+    std::string result;
+    CacheKey key3 = EncodeKey(&result, 3);
+    cache.erase(key3, key3.hash(key3.data(), key3.size(), 0));
+    EXPECT_EQ(2, _deleted_keys.size());
+    EXPECT_EQ(3, DecodeValue(reinterpret_cast<CacheValueWithKey*>(
+                                     reinterpret_cast<LRUHandle*>(handle)->value)
+                                     ->value));
+    cache.release(handle);
+    ASSERT_EQ(3, _deleted_keys.size());
+    EXPECT_EQ(3, _deleted_keys[2]);
+    EXPECT_FALSE(in_clock_LRUCache(cache, 3));
+    EXPECT_TRUE(in_clock_LRUCache(cache, 4));
+    EXPECT_TRUE(in_clock_LRUCache(cache, 5));
+    EXPECT_EQ(2, cache.get_usage());
+
+    // pinned entries are left by prune
+    handle = lookup_clock_LRUCache(cache, 4);
+    EXPECT_EQ(1, cache.prune().pruned_count);
+    EXPECT_TRUE(in_clock_LRUCache(cache, 4));
+    cache.release(handle);
+}
+
+TEST_F(CacheTest, ClockConcurrentLookup) {
+    LRUCache cache(LRUCacheType::NUMBER, false, true);
+    cache.set_capacity(64);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t]() {
+            for (int i = 0; i < 10000; ++i) {
+                int key = (i * 7 + t) % 128;
+                Cache::Handle* handle = lookup_clock_LRUCache(cache, key);
+                if (handle == nullptr) {
+                    std::string result;
+                    CacheKey cache_key = EncodeKey(&result, key);
+                    handle = cache.insert(cache_key,
+                                          cache_key.hash(cache_key.data(), cache_key.size(), 0),
+                                          new CacheValue(EncodeValue(key)), 1);
+                }
+                EXPECT_EQ(key, DecodeValue(reinterpret_cast<CacheValue*>(
+                                                   reinterpret_cast<LRUHandle*>(handle)->value)
+                                                   ->value));
+                cache.release(handle);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(cache.get_usage(), 64);
+    EXPECT_EQ(40000, cache.get_lookup_count());
+}
+
+TEST_F(CacheTest, GhostHit) {
+    LRUCache cache(LRUCacheType::NUMBER, false);
+    cache.set_capacity(16);
+    cache.set_enable_ghost(true);
+    for (int i = 1; i <= 18; ++i) {
+        insert_clock_LRUCache(cache, i);
+    }
+    // 1 and 2 were evicted and are remembered, a key still cached is not a ghost hit
+    EXPECT_EQ(0, cache.get_ghost_hit_count());
+    insert_clock_LRUCache(cache, 10);
+    EXPECT_EQ(0, cache.get_ghost_hit_count());
+    insert_clock_LRUCache(cache, 1);
+    EXPECT_EQ(1, cache.get_ghost_hit_count());
+    insert_clock_LRUCache(cache, 1);
+    EXPECT_EQ(1, cache.get_ghost_hit_count());
+    insert_clock_LRUCache(cache, 2);
+    EXPECT_EQ(2, cache.get_ghost_hit_count());
+    EXPECT_EQ(16, cache.get_usage());
+}
+
 } // namespace doris
@@ -181,4 +181,20 @@ TEST_F(MemTableMemoryLimiterTest, handle_memtable_flush_test) {
     res = _engine_ref->tablet_manager()->drop_tablet(request.tablet_id, request.replica_id, false);
     EXPECT_EQ(Status::OK(), res);
 }
+
+TEST(MemTableMemoryLimiterFlushPriorityTest, flush_priority_test) {
+    constexpr int64_t MB = 1024 * 1024;
+    // without a target size, the largest memtable is flushed first
+    EXPECT_GT(MemTableMemoryLimiter::flush_priority(20 * MB, 0, false, 0),
+              MemTableMemoryLimiter::flush_priority(10 * MB, 100 * MB, false, 0));
+    // memtables that reached the target size go first
+    EXPECT_GT(MemTableMemoryLimiter::flush_priority(64 * MB, 0, false, 64 * MB),
+              MemTableMemoryLimiter::flush_priority(63 * MB, 0, false, 64 * MB));
+    // a slowly growing memtable is flushed before a fast growing one
+    EXPECT_GT(MemTableMemoryLimiter::flush_priority(10 * MB, 1 * MB, false, 64 * MB),
+              MemTableMemoryLimiter::flush_priority(30 * MB, 50 * MB, false, 64 * MB));
+    // writers with a full flush queue go last
+    EXPECT_LT(MemTableMemoryLimiter::flush_priority(100 * MB, 0, true, 64 * MB),
+              MemTableMemoryLimiter::flush_priority(1 * MB, 100 * MB, false, 64 * MB));
+}
 } // namespace doris
@@ -80,4 +80,13 @@ TEST_F(MemTableSortTest, Tie) {
     EXPECT_FALSE(it3.next());
 }
 
+TEST_F(MemTableSortTest, ContiguousRows) {
+    EXPECT_FALSE(MemTable::_is_contiguous_rows({}));
+    EXPECT_TRUE(MemTable::_is_contiguous_rows({7}));
+    EXPECT_TRUE(MemTable::_is_contiguous_rows({3, 4, 5, 6}));
+    EXPECT_FALSE(MemTable::_is_contiguous_rows({3, 5, 4, 6}));
+    EXPECT_FALSE(MemTable::_is_contiguous_rows({3, 4, 6}));
+    EXPECT_FALSE(MemTable::_is_contiguous_rows({6, 5, 4, 3}));
+}
+
 } // namespace doris
@@ -286,4 +286,55 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+TEST_F(StoragePageCacheTest, compressed_page) {
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    std::string compressed(512, 'x');
+    {
+        // disabled by default
+        StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards);
+        cache.insert_compressed(key, Slice(compressed));
+        PageCacheHandle handle;
+        EXPECT_FALSE(cache.lookup_compressed(key, &handle));
+    }
+
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards, 50);
+    cache.insert_compressed(key, Slice(compressed));
+    {
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache.lookup_compressed(key, &handle));
+        EXPECT_EQ(handle.data().to_string(), compressed);
+        // the compressed page is not visible to the decompressed page caches
+        EXPECT_FALSE(cache.lookup(key, &handle, segment_v2::DATA_PAGE));
+    }
+
+    PageCacheHandle handle;
+    StoragePageCache::CacheKey miss_key("abc", 0, 1);
+    EXPECT_FALSE(cache.lookup_compressed(miss_key, &handle));
+}
+
+TEST_F(StoragePageCacheTest, row_store_page) {
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+    {
+        // disabled by default, row store pages are kept in the data page cache
+        StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards);
+        PageCacheHandle handle;
+        auto* data = new DataPage(1024, cache.mem_tracker(page_type, true));
+        cache.insert(key, data, &handle, page_type, false, true);
+        EXPECT_TRUE(cache.lookup(key, &handle, page_type));
+    }
+
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards, 0, 50);
+    {
+        PageCacheHandle handle;
+        auto* data = new DataPage(1024, cache.mem_tracker(page_type, true));
+        cache.insert(key, data, &handle, page_type, false, true);
+        EXPECT_EQ(handle.data().data, data->data());
+    }
+    PageCacheHandle handle;
+    EXPECT_TRUE(cache.lookup(key, &handle, page_type, true));
+    // the row store page is not visible to the data page cache
+    EXPECT_FALSE(cache.lookup(key, &handle, page_type));
+}
+
 } // namespace doris
@@ -32,6 +32,7 @@
 #include "gtest/gtest_pred_impl.h"
 #include "olap/olap_common.h"
 #include "olap/olap_meta.h"
+#include "olap/tablet_schema.h"
 
 using ::testing::_;
 using ::testing::Return;
@@ -108,6 +109,30 @@ TEST_F(RowsetMetaTest, TestInit) {
     do_check(rowset_meta_3);
 }
 
+TEST_F(RowsetMetaTest, TestShareTabletSchema) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_schema_version(3);
+    auto* column = schema_pb.add_column();
+    column->set_unique_id(1);
+    column->set_name("k1");
+    column->set_type("INT");
+    column->set_is_key(true);
+
+    RowsetMeta rowset_meta;
+    rowset_meta.set_tablet_schema(schema_pb);
+    ASSERT_NE(rowset_meta.tablet_schema(), nullptr);
+
+    RowsetMeta rowset_meta_2;
+    rowset_meta_2.share_tablet_schema(rowset_meta);
+    EXPECT_EQ(rowset_meta_2.tablet_schema(), rowset_meta.tablet_schema());
+
+    // Setting an equal schema finds the same cached schema.
+    RowsetMeta rowset_meta_3;
+    rowset_meta_3.set_tablet_schema(schema_pb);
+    EXPECT_EQ(rowset_meta_3.tablet_schema(), rowset_meta.tablet_schema());
+}
+
 TEST_F(RowsetMetaTest, TestInitWithInvalidData) {
     RowsetMeta rowset_meta;
     EXPECT_FALSE(rowset_meta.init_from_json("invalid json meta data"));
@@ -212,5 +212,36 @@ TEST_F(BlockBloomFilterTest, contains) {
     ASSERT_FALSE(bf2->contains(*bf1));
 }
 
+TEST_F(BlockBloomFilterTest, test_any_hash) {
+    std::unique_ptr<BloomFilter> bf;
+    auto st = BloomFilter::create(BLOCK_BLOOM_FILTER, &bf);
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(bf->init(_expected_num, _fpp, HASH_MURMUR3_X64_64).ok());
+    std::vector<uint64_t> hashes;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        uint64_t hash = bf->hash((char*)&i, sizeof(i));
+        hashes.push_back(hash);
+        if (i % 2 == 0) {
+            bf->add_hash(hash);
+        }
+    }
+    for (uint64_t hash : hashes) {
+        EXPECT_EQ(bf->test_hash(hash), bf->test_any_hash(&hash, 1));
+    }
+    EXPECT_TRUE(bf->test_any_hash(hashes.data(), hashes.size()));
+
+    std::vector<uint64_t> absent;
+    for (uint64_t hash : hashes) {
+        if (!bf->test_hash(hash)) {
+            absent.push_back(hash);
+        }
+    }
+    ASSERT_FALSE(absent.empty());
+    EXPECT_FALSE(bf->test_any_hash(absent.data(), absent.size()));
+    EXPECT_FALSE(bf->test_any_hash(absent.data(), 0));
+    absent.push_back(hashes[0]);
+    EXPECT_TRUE(bf->test_any_hash(absent.data(), absent.size()));
+}
+
 } // namespace segment_v2
 } // namespace doris
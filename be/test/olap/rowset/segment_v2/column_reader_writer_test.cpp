@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <random>
 
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
@@ -659,6 +660,64 @@ TEST_F(ColumnReaderWriterTest, test_nullable) {
     delete[] double_vals;
 }
 
+static CompressionTypePB selected_compression(const std::vector<int64_t>& values,
+                                               const std::string& test_name) {
+    ColumnMetaPB meta;
+    std::string fname = TEST_DIR + "/" + test_name;
+    io::FileWriterPtr file_writer;
+    EXPECT_TRUE(io::global_local_filesystem()->create_file(fname, &file_writer).ok());
+
+    ColumnWriterOptions writer_opts;
+    writer_opts.meta = &meta;
+    writer_opts.meta->set_column_id(0);
+    writer_opts.meta->set_unique_id(0);
+    writer_opts.meta->set_type(FieldType::OLAP_FIELD_TYPE_BIGINT);
+    writer_opts.meta->set_length(0);
+    writer_opts.meta->set_encoding(BIT_SHUFFLE);
+    writer_opts.meta->set_compression(segment_v2::CompressionTypePB::LZ4F);
+    writer_opts.meta->set_is_nullable(false);
+
+    TabletColumn column(OLAP_FIELD_AGGREGATION_NONE, FieldType::OLAP_FIELD_TYPE_BIGINT);
+    std::unique_ptr<ColumnWriter> writer;
+    EXPECT_TRUE(ColumnWriter::create(writer_opts, &column, file_writer.get(), &writer).ok());
+    EXPECT_TRUE(writer->init().ok());
+    const auto* ptr = reinterpret_cast<const uint8_t*>(values.data());
+    EXPECT_TRUE(writer->append_data(&ptr, values.size()).ok());
+    EXPECT_TRUE(writer->finish().ok());
+    EXPECT_TRUE(writer->write_data().ok());
+    EXPECT_TRUE(file_writer->close().ok());
+    return meta.compression();
+}
+
+TEST_F(ColumnReaderWriterTest, test_adaptive_compression) {
+    config::enable_adaptive_column_compression = true;
+    std::vector<int64_t> sequential(8192);
+    std::vector<int64_t> random(8192);
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < sequential.size(); ++i) {
+        sequential[i] = i;
+        random[i] = static_cast<int64_t>(rng());
+    }
+    EXPECT_NE(selected_compression(sequential, "adaptive_sequential"),
+              segment_v2::CompressionTypePB::NO_COMPRESSION);
+    EXPECT_EQ(selected_compression(random, "adaptive_random"),
+              segment_v2::CompressionTypePB::NO_COMPRESSION);
+
+    // pages written with the selected compression are read back
+    size_t num_rows = 1024;
+    uint8_t* is_null = new uint8_t[num_rows];
+    uint8_t* val = new uint8_t[num_rows * sizeof(int64_t)];
+    for (int i = 0; i < num_rows; ++i) {
+        reinterpret_cast<int64_t*>(val)[i] = random[i];
+        BitmapChange(is_null, i, (i % 4) == 0);
+    }
+    test_nullable_data<FieldType::OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>(val, is_null, num_rows,
+                                                                       "adaptive_null_bigint");
+    delete[] val;
+    delete[] is_null;
+    config::enable_adaptive_column_compression = false;
+}
+
 TEST_F(ColumnReaderWriterTest, test_types) {
     size_t num_uint8_rows = LOOP_LESS_OR_MORE(1024, 1024 * 1024);
     uint8_t* is_null = new uint8_t[num_uint8_rows];
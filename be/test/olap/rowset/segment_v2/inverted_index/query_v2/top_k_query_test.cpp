@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/top_k_query.h"
+
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace doris::segment_v2::idx_query_v2 {
+
+class TopKQueryTest : public testing::Test {
+public:
+    // Postings of a term with a fixed score per doc.
+    class FakeScorer {
+    public:
+        FakeScorer(std::vector<ScoredDoc> postings, float max_score)
+                : _postings(std::move(postings)), _max_score(max_score) {}
+
+        int32_t next_doc() {
+            ++_pos;
+            return doc();
+        }
+        int32_t advance(int32_t target) {
+            ++_num_advanced;
+            while (doc() < target) {
+                ++_pos;
+            }
+            return doc();
+        }
+        float score() const { return _postings[_pos].score; }
+        float max_score() const { return _max_score; }
+
+        int32_t doc() const { return _pos < _postings.size() ? _postings[_pos].doc : INT_MAX; }
+
+        size_t _pos = SIZE_MAX;
+        size_t _num_advanced = 0;
+
+    private:
+        std::vector<ScoredDoc> _postings;
+        float _max_score;
+    };
+    using FakeScorerPtr = std::shared_ptr<FakeScorer>;
+
+    static std::vector<ScoredDoc> brute_force_top_k(const std::vector<FakeScorerPtr>& scorers,
+                                                    size_t k) {
+        std::map<int32_t, float> scores;
+        for (const auto& scorer : scorers) {
+            for (int32_t doc = scorer->next_doc(); doc != INT_MAX; doc = scorer->next_doc()) {
+                scores[doc] += scorer->score();
+            }
+        }
+        std::vector<ScoredDoc> docs;
+        for (const auto& [doc, score] : scores) {
+            docs.push_back({doc, score});
+        }
+        std::stable_sort(docs.begin(), docs.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.score > rhs.score; });
+        docs.resize(std::min(k, docs.size()));
+        return docs;
+    }
+};
+
+TEST_F(TopKQueryTest, Bm25Similarity) {
+    BM25Similarity rare(1, 100);
+    BM25Similarity common(50, 100);
+    EXPECT_GT(rare.score(1), common.score(1));
+    EXPECT_GT(rare.score(3), rare.score(1));
+    EXPECT_LT(rare.score(1000), rare.max_score());
+}
+
+TEST_F(TopKQueryTest, MaxScoreTopK) {
+    std::vector<FakeScorerPtr> scorers;
+    scorers.push_back(std::make_shared<FakeScorer>(
+            std::vector<ScoredDoc> {{1, 0.5F}, {3, 0.5F}, {5, 0.5F}, {7, 0.5F}, {9, 0.5F}},
+            0.5F));
+    scorers.push_back(std::make_shared<FakeScorer>(std::vector<ScoredDoc> {{3, 2.0F}, {8, 3.0F}},
+                                                   3.0F));
+    auto top_docs = max_score_top_k(scorers, 2);
+    ASSERT_EQ(top_docs.size(), 2);
+    EXPECT_EQ(top_docs[0].doc, 8);
+    EXPECT_FLOAT_EQ(top_docs[0].score, 3.0F);
+    EXPECT_EQ(top_docs[1].doc, 3);
+    EXPECT_FLOAT_EQ(top_docs[1].score, 2.5F);
+    // once docs 3 and 8 are collected, the low scoring term cannot make a doc competitive and
+    // is only advanced for the candidates of the other one
+    EXPECT_LE(scorers[0]->_num_advanced, 1);
+}
+
+TEST_F(TopKQueryTest, MaxScoreTopKMatchesBruteForce) {
+    std::mt19937 rng(42);
+    for (int round = 0; round < 20; ++round) {
+        const size_t num_terms = 1 + rng() % 5;
+        std::vector<std::vector<ScoredDoc>> postings(num_terms);
+        std::vector<float> max_scores(num_terms);
+        for (size_t t = 0; t < num_terms; ++t) {
+            for (int32_t doc = 0; doc < 200; ++doc) {
+                if (rng() % (t + 2) == 0) {
+                    // scores on a coarse grid so the sums are exact
+                    float score = static_cast<float>(1 + rng() % 8) / 4;
+                    postings[t].push_back({doc, score});
+                    max_scores[t] = std::max(max_scores[t], score);
+                }
+            }
+        }
+        for (size_t k : {1, 5, 50, 500}) {
+            std::vector<FakeScorerPtr> scorers;
+            std::vector<FakeScorerPtr> expected_scorers;
+            for (size_t t = 0; t < num_terms; ++t) {
+                scorers.push_back(std::make_shared<FakeScorer>(postings[t], max_scores[t]));
+                expected_scorers.push_back(
+                        std::make_shared<FakeScorer>(postings[t], max_scores[t]));
+            }
+            auto top_docs = max_score_top_k(scorers, k);
+            auto expected = brute_force_top_k(expected_scorers, k);
+            ASSERT_EQ(top_docs.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); ++i) {
+                EXPECT_EQ(top_docs[i].doc, expected[i].doc);
+                EXPECT_FLOAT_EQ(top_docs[i].score, expected[i].score);
+            }
+        }
+    }
+}
+
+} // namespace doris::segment_v2::idx_query_v2
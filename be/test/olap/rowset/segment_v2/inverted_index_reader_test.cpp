@@ -518,6 +518,73 @@ public:
         EXPECT_EQ(bitmap2->cardinality(), 1) << "Should find 1 document matching 'apple'";
     }
 
+    // Test that MATCH_ANY and MATCH_ALL share the cached postings of their terms
+    void test_term_query_cache() {
+        std::string_view rowset_id = "test_term_query_cache";
+        int seg_id = 0;
+
+        std::vector<Slice> values = {Slice("fast database"), Slice("fast text search"),
+                                     Slice("search engine"), Slice("lazy dog")};
+
+        TabletIndex idx_meta;
+        auto index_meta_pb = std::make_unique<TabletIndexPB>();
+        index_meta_pb->set_index_type(IndexType::INVERTED);
+        index_meta_pb->set_index_id(1);
+        index_meta_pb->set_index_name("test_term_query_cache");
+        index_meta_pb->clear_col_unique_id();
+        index_meta_pb->add_col_unique_id(1); // c2 column
+        index_meta_pb->mutable_properties()->insert({"parser", "english"});
+        idx_meta.init_from_pb(*index_meta_pb.get());
+
+        std::string index_path_prefix;
+        prepare_string_index(rowset_id, seg_id, values, &idx_meta, &index_path_prefix);
+
+        OlapReaderStatistics stats;
+        RuntimeState runtime_state;
+        TQueryOptions query_options;
+        query_options.enable_inverted_index_query_cache = true;
+        query_options.enable_inverted_index_searcher_cache = false;
+        runtime_state.set_query_options(query_options);
+
+        auto reader = std::make_shared<IndexFileReader>(
+                io::global_local_filesystem(), index_path_prefix, InvertedIndexStorageFormatPB::V2);
+        EXPECT_TRUE(reader->init().ok());
+
+        auto fulltext_reader = FullTextIndexReader::create_shared(&idx_meta, reader);
+        io::IOContext io_ctx;
+
+        std::shared_ptr<roaring::Roaring> any_bitmap = std::make_shared<roaring::Roaring>();
+        std::string any_query = "fast search";
+        StringRef any_ref(any_query.c_str(), any_query.length());
+        auto status = fulltext_reader->query(&io_ctx, &stats, &runtime_state, "c2", &any_ref,
+                                             InvertedIndexQueryType::MATCH_ANY_QUERY, any_bitmap);
+        EXPECT_TRUE(status.ok()) << status;
+        EXPECT_EQ(any_bitmap->cardinality(), 3);
+
+        // Both terms are cached now, so MATCH_ALL intersects them without opening the searcher.
+        int64_t searcher_misses = stats.inverted_index_searcher_cache_miss;
+        std::shared_ptr<roaring::Roaring> all_bitmap = std::make_shared<roaring::Roaring>();
+        std::string all_query = "search fast";
+        StringRef all_ref(all_query.c_str(), all_query.length());
+        status = fulltext_reader->query(&io_ctx, &stats, &runtime_state, "c2", &all_ref,
+                                        InvertedIndexQueryType::MATCH_ALL_QUERY, all_bitmap);
+        EXPECT_TRUE(status.ok()) << status;
+        EXPECT_EQ(stats.inverted_index_searcher_cache_miss, searcher_misses);
+        EXPECT_EQ(all_bitmap->cardinality(), 1);
+        EXPECT_TRUE(all_bitmap->contains(1));
+
+        // MATCH_ALL with an uncached term is searched as a whole.
+        std::shared_ptr<roaring::Roaring> mixed_bitmap = std::make_shared<roaring::Roaring>();
+        std::string mixed_query = "search engine";
+        StringRef mixed_ref(mixed_query.c_str(), mixed_query.length());
+        status = fulltext_reader->query(&io_ctx, &stats, &runtime_state, "c2", &mixed_ref,
+                                        InvertedIndexQueryType::MATCH_ALL_QUERY, mixed_bitmap);
+        EXPECT_TRUE(status.ok()) << status;
+        EXPECT_EQ(stats.inverted_index_searcher_cache_miss, searcher_misses + 1);
+        EXPECT_EQ(mixed_bitmap->cardinality(), 1);
+        EXPECT_TRUE(mixed_bitmap->contains(2));
+    }
+
     // Test searcher cache
     void test_searcher_cache() {
         std::string_view rowset_id = "test_read_rowset_5";
@@ -3390,6 +3457,11 @@ TEST_F(InvertedIndexReaderTest, QueryCache) {
     test_query_cache();
 }
 
+// Term level query cache test
+TEST_F(InvertedIndexReaderTest, TermQueryCache) {
+    test_term_query_cache();
+}
+
 // Searcher cache test
 TEST_F(InvertedIndexReaderTest, SearcherCache) {
     test_searcher_cache();
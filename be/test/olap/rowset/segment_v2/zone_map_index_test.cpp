@@ -31,6 +31,10 @@
 #include "olap/tablet_schema.h"
 #include "olap/tablet_schema_helper.h"
 #include "util/slice.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
 
 namespace doris {
 namespace segment_v2 {
@@ -233,5 +237,38 @@ TEST_F(ColumnZoneMapTest, ZoneMapCut) {
     delete field;
 }
 
+// Test the zone map of a sparse column of variant, written from an engine column
+TEST_F(ColumnZoneMapTest, SparseColumnZoneMap) {
+    std::string filename = kTestDir + "/SparseColumnZoneMap";
+    auto fs = io::global_local_filesystem();
+
+    TabletColumnPtr int_column = create_int_key(0);
+    auto nested = vectorized::ColumnInt32::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    for (int32_t value : {0, 7, 0, -3, 0, 12, 0}) {
+        nested->insert_value(value);
+        null_map->insert_value(value == 0 ? 1 : 0);
+    }
+    auto column = vectorized::ColumnNullable::create(std::move(nested), std::move(null_map));
+    auto type = vectorized::make_nullable(std::make_shared<vectorized::DataTypeInt32>());
+
+    ColumnMetaPB meta;
+    {
+        io::FileWriterPtr file_writer;
+        EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+        EXPECT_TRUE(write_sparse_column_zone_map(*int_column, {std::move(column), type, "v.k"}, 0,
+                                                 7, file_writer.get(), &meta)
+                            .ok());
+        EXPECT_TRUE(file_writer->close().ok());
+    }
+    ASSERT_EQ(1, meta.indexes_size());
+    EXPECT_EQ(ZONE_MAP_INDEX, meta.indexes(0).type());
+    const auto& zone_map = meta.indexes(0).zone_map_index().segment_zone_map();
+    EXPECT_EQ("-3", zone_map.min());
+    EXPECT_EQ("12", zone_map.max());
+    EXPECT_TRUE(zone_map.has_null());
+    EXPECT_TRUE(zone_map.has_not_null());
+}
+
 } // namespace segment_v2
 } // namespace doris
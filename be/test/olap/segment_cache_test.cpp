@@ -41,6 +41,7 @@
 #include "olap/iterators.h"
 #include "olap/olap_define.h"
 #include "olap/options.h"
+#include "olap/predicate_creator.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "olap/schema.h"
@@ -355,6 +356,16 @@ TEST_F(SegmentCacheTest, vec_sequence_col) {
     auto seq_v = read_block.get_by_position(4).column->get_int(0);
     ASSERT_EQ(100, seq_v);
 
+    // a runtime filter arriving after the reader is initialized prunes the segment by zone map
+    vectorized::Arena arena;
+    std::vector<std::shared_ptr<ColumnPredicate>> late_arrival_rf_predicates;
+    late_arrival_rf_predicates.emplace_back(create_comparison_predicate<PredicateType::GE>(
+            rowset->tablet_schema()->column(0), 0, "124", false, arena));
+    opts.late_arrival_rf_predicates = &late_arrival_rf_predicates;
+    s = segments[0]->new_iterator(schema, opts, &iter);
+    ASSERT_TRUE(s.ok());
+    ASSERT_EQ(1, stats.filtered_segment_number);
+
     res = engine_ref->tablet_manager()->drop_tablet(request.tablet_id, request.replica_id, false);
     ASSERT_TRUE(res.ok());
 }
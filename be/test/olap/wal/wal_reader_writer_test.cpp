@@ -18,8 +18,10 @@
 
 #include <filesystem>
 #include <memory>
+#include <thread>
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "gmock/gmock.h"
@@ -138,4 +140,48 @@ TEST_F(WalReaderWriterTest, TestWriteAndRead1) {
     static_cast<void>(wal_reader.finalize());
     EXPECT_EQ(3, block_count);
 }
+
+TEST_F(WalReaderWriterTest, TestSyncOnAppend) {
+    bool old_sync_on_append = config::group_commit_wal_sync_on_append;
+    config::group_commit_wal_sync_on_append = true;
+    constexpr int num_writers = 4;
+    constexpr int num_blocks = 10;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_writers; ++i) {
+        threads.emplace_back([i]() {
+            auto wal_writer = WalWriter(_s_test_data_path + "/sync_" + std::to_string(i));
+            EXPECT_TRUE(wal_writer.init().ok());
+            for (int j = 0; j < num_blocks; ++j) {
+                PBlock pblock;
+                generate_block(pblock, j * 1024);
+                EXPECT_TRUE(wal_writer.append_blocks(std::vector<PBlock*> {&pblock}).ok());
+            }
+            EXPECT_TRUE(wal_writer.finalize().ok());
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    config::group_commit_wal_sync_on_append = old_sync_on_append;
+
+    for (int i = 0; i < num_writers; ++i) {
+        auto wal_reader = WalReader(_s_test_data_path + "/sync_" + std::to_string(i));
+        ASSERT_TRUE(wal_reader.init().ok());
+        int block_count = 0;
+        while (true) {
+            PBlock pblock;
+            Status st = wal_reader.read_block(pblock);
+            if (st.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            ASSERT_TRUE(st.ok()) << st;
+            vectorized::Block block;
+            ASSERT_TRUE(block.deserialize(pblock).ok());
+            EXPECT_EQ(block_rows, block.rows());
+            ++block_count;
+        }
+        EXPECT_TRUE(wal_reader.finalize().ok());
+        EXPECT_EQ(num_blocks, block_count);
+    }
+}
 } // namespace doris
\ No newline at end of file
@@ -158,6 +158,36 @@ TEST_F(AggregateDataContainerTest, MemoryManagement) {
     EXPECT_GT(container.memory_usage(), initial_memory);
 }
 
+TEST_F(AggregateDataContainerTest, ResetKeepsSubContainers) {
+    AggregateDataContainer container(sizeof(uint32_t), sizeof(double));
+
+    const auto count = AggregateDataContainer::SUB_CONTAINER_CAPACITY + 1;
+    for (uint32_t i = 0; i < count; ++i) {
+        container.append_data(i);
+    }
+    int64_t memory = container.memory_usage();
+
+    container.reset();
+    EXPECT_EQ(0, container.total_count());
+    EXPECT_EQ(container.begin(), container.end());
+    // the two sub containers are reused
+    EXPECT_EQ(0, container.estimate_memory(count));
+    EXPECT_GT(container.estimate_memory(count * 2), 0);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        container.append_data(i + 100);
+    }
+    EXPECT_EQ(memory, container.memory_usage());
+    container.init_once();
+    EXPECT_EQ(100, container.iterator.get_key<uint32_t>());
+    uint32_t num_entries = 0;
+    for (auto it = container.begin(); it != container.end(); ++it) {
+        EXPECT_EQ(num_entries + 100, it.get_key<uint32_t>());
+        ++num_entries;
+    }
+    EXPECT_EQ(count, num_entries);
+}
+
 TEST_F(AggregateDataContainerTest, EdgeCases) {
     AggregateDataContainer container(sizeof(uint32_t), sizeof(double));
 
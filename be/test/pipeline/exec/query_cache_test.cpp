@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "testutil/column_helper.h"
+#include "testutil/mock/mock_runtime_state.h"
 #include "vec/data_types/data_type_number.h"
 
 namespace doris::pipeline {
@@ -120,6 +121,48 @@ TEST_F(QueryCacheTest, insert_and_lookup) {
     }
 }
 
+TEST_F(QueryCacheTest, lookup_once) {
+    std::unique_ptr<QueryCache> query_cache {QueryCache::create_global_cache(1024 * 1024 * 1024)};
+    std::vector<TScanRangeParams> scan_ranges;
+    TScanRangeParams scan_range;
+    TPaloScanRange palp_scan_range;
+    palp_scan_range.__set_tablet_id(42);
+    palp_scan_range.__set_version("114514");
+    scan_range.scan_range.__set_palo_scan_range(palp_scan_range);
+    scan_ranges.push_back(scan_range);
+    TQueryCacheParam cache_param;
+    cache_param.tablet_to_range.insert({42, "test"});
+    std::string cache_key;
+    int64_t version = 0;
+    EXPECT_TRUE(QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version).ok());
+
+    CacheResult result;
+    result.push_back(std::make_unique<Block>());
+    *result.back() = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4, 5});
+    // the entry of an older version is not reused if it is not a partial result
+    query_cache->insert(cache_key, version - 1, result, {0}, 1);
+    MockRuntimeState state;
+    std::shared_ptr<QueryCacheLookup> lookup;
+    EXPECT_TRUE(query_cache->lookup_once(&state, scan_ranges, cache_param, &lookup).ok());
+    EXPECT_FALSE(lookup->hit);
+
+    // the entry is looked up once per query
+    query_cache->insert(cache_key, version, result, {0}, 1);
+    std::shared_ptr<QueryCacheLookup> same_query_lookup;
+    EXPECT_TRUE(query_cache->lookup_once(&state, scan_ranges, cache_param, &same_query_lookup)
+                        .ok());
+    EXPECT_EQ(lookup, same_query_lookup);
+
+    MockRuntimeState other_state;
+    std::shared_ptr<QueryCacheLookup> other_query_lookup;
+    EXPECT_TRUE(query_cache->lookup_once(&other_state, scan_ranges, cache_param,
+                                         &other_query_lookup)
+                        .ok());
+    EXPECT_TRUE(other_query_lookup->hit);
+    EXPECT_FALSE(other_query_lookup->is_delta);
+    EXPECT_EQ(other_query_lookup->handle.get_cache_version(), version);
+}
+
 // ./run-be-ut.sh --run --filter=DataQueueTest.*
 
 } // namespace doris::pipeline
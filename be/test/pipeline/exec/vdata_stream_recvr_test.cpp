@@ -400,6 +400,46 @@ TEST_F(DataStreamRecvrTest, TestRemoteMemLimitSender) {
     sender->close();
 }
 
+TEST_F(DataStreamRecvrTest, TestRemoteMemLimitReleaseByCredit) {
+    create_recvr(3, false);
+    auto* sender = recvr->sender_queues().back();
+    auto source_dep = std::make_shared<Dependency>(0, 0, "test", false);
+    sender->set_dependency(source_dep);
+
+    config::exchg_node_buffer_size_bytes = 1;
+    Defer set_([&]() { config::exchg_node_buffer_size_bytes = 20485760; });
+
+    int num_released = 0;
+    std::vector<MockClosure> closures(3);
+    for (int i = 0; i < 3; ++i) {
+        auto block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4, 5});
+        auto pblock = std::make_unique<PBlock>();
+        to_pblock(block, pblock.get());
+        closures[i]._cb = [&]() { ++num_released; };
+        google::protobuf::Closure* done = &closures[i];
+        EXPECT_TRUE(sender->add_block(std::move(pblock), i + 1, 1, &done, 0, 0).ok());
+        EXPECT_EQ(done, nullptr);
+    }
+
+    {
+        // still over the limit, only one sender is released
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(sender->get_batch(&block, &eos).ok());
+        EXPECT_EQ(num_released, 1);
+    }
+
+    config::exchg_node_buffer_size_bytes = 20485760;
+    {
+        // the buffer below the limit is enough for the blocks of all waiting senders
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(sender->get_batch(&block, &eos).ok());
+        EXPECT_EQ(num_released, 3);
+    }
+    sender->close();
+}
+
 TEST_F(DataStreamRecvrTest, TestRemoteMultiSender) {
     create_recvr(3, false);
     EXPECT_EQ(recvr->sender_queues().size(), 1);
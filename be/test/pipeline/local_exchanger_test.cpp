@@ -25,6 +25,7 @@
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "thrift_builder.h"
+#include "util/defer_op.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_vector.h"
 #include "vec/data_types/data_type.h"
@@ -318,6 +319,102 @@ TEST_F(LocalExchangerTest, ShuffleExchanger) {
     }
 }
 
+TEST_F(LocalExchangerTest, ShuffleExchangerSplitHotPartitions) {
+    int num_sink = 1;
+    int num_sources = 4;
+    int num_partitions = 4;
+    int free_block_limit = 0;
+    std::map<int, int> shuffle_idx_to_instance_idx;
+    for (int i = 0; i < num_partitions; i++) {
+        shuffle_idx_to_instance_idx[i] = i;
+    }
+    config::local_exchange_buffer_mem_limit = 1024 * 1024;
+    auto min_rows = config::local_exchange_hot_partition_min_rows;
+    Defer defer {[&]() { config::local_exchange_hot_partition_min_rows = min_rows; }};
+    config::local_exchange_hot_partition_min_rows = 0;
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_partitions);
+    shared_state->exchanger = ShuffleExchanger::create_unique(num_sink, num_sources, num_partitions,
+                                                              free_block_limit);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+
+    auto* exchanger = (ShuffleExchanger*)shared_state->exchanger.get();
+    exchanger->set_split_hot_partitions();
+    std::unique_ptr<LocalExchangeSinkLocalState> sink_local_state(
+            new LocalExchangeSinkLocalState(nullptr, nullptr));
+    sink_local_state->_exchanger = shared_state->exchanger.get();
+    sink_local_state->_compute_hash_value_timer = ADD_TIMER(profile, "ComputeHashValueTime");
+    sink_local_state->_distribute_timer = ADD_TIMER(profile, "distribute_timer");
+    sink_local_state->_partitioner.reset(
+            new vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>(num_partitions));
+    auto texpr = TExprNodeBuilder(TExprNodeType::SLOT_REF,
+                                  TTypeDescBuilder()
+                                          .set_types(TTypeNodeBuilder()
+                                                             .set_type(TTypeNodeType::SCALAR)
+                                                             .set_scalar_type(TPrimitiveType::INT)
+                                                             .build())
+                                          .build(),
+                                  0)
+                         .set_slot_ref(TSlotRefBuilder(0, 0).build())
+                         .build();
+    auto slot = doris::vectorized::VSlotRef::create_shared(texpr);
+    slot->_column_id = 0;
+    ((vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>*)
+             sink_local_state->_partitioner.get())
+            ->_partition_expr_ctxs.push_back(
+                    std::make_shared<doris::vectorized::VExprContext>(slot));
+    sink_local_state->_channel_id = 0;
+    sink_local_state->_shared_state = shared_state.get();
+    sink_local_state->_dependency = sink_dep.get();
+    sink_local_state->_memory_used_counter =
+            profile->AddHighWaterMarkCounter("SinkMemoryUsage", TUnit::BYTES, "", 1);
+
+    std::vector<std::unique_ptr<LocalExchangeSourceLocalState>> local_states(num_sources);
+    for (size_t i = 0; i < num_sources; i++) {
+        local_states[i].reset(new LocalExchangeSourceLocalState(nullptr, nullptr));
+        local_states[i]->_exchanger = shared_state->exchanger.get();
+        local_states[i]->_get_block_failed_counter =
+                ADD_TIMER(profile, "_get_block_failed_counter" + std::to_string(i));
+        local_states[i]->_copy_data_timer =
+                ADD_TIMER(profile, "_copy_data_timer" + std::to_string(i));
+        local_states[i]->_channel_id = i;
+        local_states[i]->_shared_state = shared_state.get();
+        local_states[i]->_dependency = shared_state->get_dep_by_channel_id(i).front().get();
+        local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+        shared_state->mem_counters[i] = local_states[i]->_memory_used_counter;
+    }
+
+    // All rows have the same key, the partition is spread over the 4 sources.
+    vectorized::Block in_block;
+    auto int_col0 = vectorized::ColumnInt32::create();
+    int_col0->insert_many_vals(7, 1024);
+    in_block.insert({std::move(int_col0), std::make_shared<vectorized::DataTypeInt32>(),
+                     "test_int_col0"});
+    EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                              {sink_local_state->_compute_hash_value_timer,
+                               sink_local_state->_distribute_timer, nullptr},
+                              {&sink_local_state->_channel_id, sink_local_state->_partitioner.get(),
+                               sink_local_state.get(), &shuffle_idx_to_instance_idx}),
+              Status::OK());
+    for (size_t i = 0; i < num_sources; i++) {
+        EXPECT_EQ(exchanger->_data_queue[i].data_queue.size_approx(), 1);
+        bool eos = false;
+        vectorized::Block block;
+        EXPECT_EQ(exchanger->get_block(
+                          _runtime_state.get(), &block, &eos,
+                          {nullptr, nullptr, local_states[i]->_copy_data_timer},
+                          {cast_set<int>(local_states[i]->_channel_id), local_states[i].get()}),
+                  Status::OK());
+        EXPECT_EQ(block.rows(), 256);
+    }
+    EXPECT_EQ(shared_state->mem_usage, 0);
+}
+
 TEST_F(LocalExchangerTest, PassthroughExchanger) {
     int num_sink = 4;
     int num_sources = 4;
@@ -512,6 +609,71 @@ TEST_F(LocalExchangerTest, PassthroughExchanger) {
     }
 }
 
+TEST_F(LocalExchangerTest, PassthroughExchangerGrowChannels) {
+    int num_sink = 1;
+    int num_sources = 4;
+    int free_block_limit = 1;
+    config::local_exchange_buffer_mem_limit = 1024 * 1024;
+    auto initial_channels = config::local_exchange_passthrough_initial_channels;
+    auto rows_per_channel = config::local_exchange_passthrough_rows_per_channel;
+    auto channel_max_blocks = config::local_exchange_passthrough_channel_max_blocks;
+    Defer defer {[&]() {
+        config::local_exchange_passthrough_initial_channels = initial_channels;
+        config::local_exchange_passthrough_rows_per_channel = rows_per_channel;
+        config::local_exchange_passthrough_channel_max_blocks = channel_max_blocks;
+    }};
+    config::local_exchange_passthrough_initial_channels = 1;
+    config::local_exchange_passthrough_rows_per_channel = 20;
+    config::local_exchange_passthrough_channel_max_blocks = 100;
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_sources);
+    shared_state->exchanger =
+            PassthroughExchanger::create_unique(num_sink, num_sources, free_block_limit);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+    for (size_t i = 0; i < num_sources; i++) {
+        shared_state->mem_counters[i] = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+    }
+
+    auto* exchanger = (PassthroughExchanger*)shared_state->exchanger.get();
+    std::unique_ptr<LocalExchangeSinkLocalState> sink_local_state(
+            new LocalExchangeSinkLocalState(nullptr, nullptr));
+    sink_local_state->_exchanger = shared_state->exchanger.get();
+    sink_local_state->_compute_hash_value_timer = ADD_TIMER(profile, "ComputeHashValueTime");
+    sink_local_state->_distribute_timer = ADD_TIMER(profile, "distribute_timer");
+    sink_local_state->_channel_id = 0;
+    sink_local_state->_shared_state = shared_state.get();
+    sink_local_state->_dependency = sink_dep.get();
+    sink_local_state->_memory_used_counter =
+            profile->AddHighWaterMarkCounter("SinkMemoryUsage", TUnit::BYTES, "", 1);
+
+    // Sink 6 blocks with 10 rows. The first 20 rows go to source 0 only, then the channels
+    // double every time the rows exceed 20 per active channel.
+    for (size_t i = 0; i < 6; i++) {
+        vectorized::Block in_block;
+        vectorized::DataTypePtr int_type = std::make_shared<vectorized::DataTypeInt32>();
+        auto int_col0 = vectorized::ColumnInt32::create();
+        int_col0->insert_many_vals(cast_set<int>(i), 10);
+        in_block.insert({std::move(int_col0), int_type, "test_int_col0"});
+        EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                                  {sink_local_state->_compute_hash_value_timer,
+                                   sink_local_state->_distribute_timer, nullptr},
+                                  {&sink_local_state->_channel_id,
+                                   sink_local_state->_partitioner.get(), sink_local_state.get(),
+                                   nullptr}),
+                  Status::OK());
+    }
+    EXPECT_EQ(exchanger->_num_active_channels, 4);
+    std::vector<size_t> expected_blocks {2, 3, 1, 0};
+    for (size_t i = 0; i < num_sources; i++) {
+        EXPECT_EQ(exchanger->_data_queue[i].data_queue.size_approx(), expected_blocks[i]);
+    }
+}
+
 TEST_F(LocalExchangerTest, PassToOneExchanger) {
     int num_sink = 4;
     int num_sources = 4;
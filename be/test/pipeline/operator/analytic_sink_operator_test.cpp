@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 #include "pipeline/exec/analytic_source_operator.h"
@@ -716,6 +717,65 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction7) {
 }
 
 // range between is not support by FE, shouldn't consider this test
+TEST_F(AnalyticSinkOperatorTest, SlidingFrameMerge) {
+    int batch_size = 2;
+    Initialize(batch_size);
+    create_operator(true, 1, "max", {std::make_shared<DataTypeInt64>()});
+    sink->_agg_expr_ctxs.resize(1);
+    sink->_agg_expr_ctxs[0] =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+    TAnalyticWindow temp_window;
+    temp_window.type = TAnalyticWindowType::ROWS;
+    TAnalyticWindowBoundary window_start;
+    window_start.type = TAnalyticWindowBoundaryType::PRECEDING;
+    window_start.__set_rows_offset_value(2);
+    temp_window.__set_window_start(window_start);
+    TAnalyticWindowBoundary window_end;
+    window_end.type = TAnalyticWindowBoundaryType::FOLLOWING;
+    window_end.__set_rows_offset_value(1);
+    temp_window.__set_window_end(window_end);
+    create_window_type(true, true, temp_window);
+    sink->_has_range_window = false;
+    create_local_state();
+    // max over rows between 2 preceding and 1 following: _get_next_for_sliding_rows
+    EXPECT_TRUE(sink_local_state->_sliding_frame_states[0]);
+
+    std::vector<int64_t> data_vals {9, 3, 8, 7, 1, 6, 5, 2, 4, 0};
+    const int num_rows = static_cast<int>(data_vals.size());
+    std::vector<int64_t> expect_vals;
+    for (int i = 0; i < num_rows; ++i) {
+        int64_t max_val = std::numeric_limits<int64_t>::min();
+        for (int j = std::max(i - 2, 0); j < std::min(i + 2, num_rows); ++j) {
+            max_val = std::max(max_val, data_vals[j]);
+        }
+        expect_vals.push_back(max_val);
+    }
+
+    for (int row_count = 0; row_count < num_rows; row_count += batch_size) {
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>(
+                {data_vals[row_count], data_vals[row_count + 1]});
+        auto st = sink->sink(state.get(), &block, row_count + batch_size == num_rows);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+
+    for (int row_count = 0; row_count < num_rows; row_count += batch_size) {
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>(
+                               {data_vals[row_count], data_vals[row_count + 1]},
+                               {expect_vals[row_count], expect_vals[row_count + 1]})));
+    }
+    vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+    bool eos = false;
+    auto st = source->get_block(state.get(), &block, &eos);
+    EXPECT_TRUE(st.ok()) << st.msg();
+    EXPECT_EQ(block.rows(), 0);
+    EXPECT_TRUE(eos);
+}
+
 TEST_F(AnalyticSinkOperatorTest, AggFunction8) {
     int batch_size = 1;
     Initialize(batch_size);
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "pipeline/operator/operator_helper.h"
@@ -189,4 +190,40 @@ TEST(ExchangeSinkOperatorTest, test_some_api) {
     EXPECT_TRUE(exchange_sink_local_state->_finish_dependency->ready());
 }
 
+TEST(ExchangeSinkOperatorTest, test_skip_compression) {
+    auto [op, ctx, mock_channel] = create_exchange_sink(
+            {{.is_local = false, .fragment_instance_id = create_TUniqueId(1, 1)}});
+    op->_compression_type = segment_v2::CompressionTypePB::LZ4;
+    auto* local_state = dynamic_cast<MockExchangeLocalState*>(ctx->state.get_sink_local_state());
+    BlockSerializer serializer(local_state, false);
+
+    std::mt19937 rng(42);
+    std::vector<int32_t> random_values;
+    for (int i = 0; i < 4096; ++i) {
+        random_values.push_back(static_cast<int32_t>(rng()));
+    }
+    auto random_block = ColumnHelper::create_block<DataTypeInt32>(random_values);
+    auto compressible_block =
+            ColumnHelper::create_block<DataTypeInt32>(std::vector<int32_t>(4096, 7));
+
+    // the random values do not compress, the next block is sent as it is, then compression is
+    // tried again and skipped for the next 2 blocks
+    std::vector<bool> compressed;
+    for (int i = 0; i < 5; ++i) {
+        PBlock pblock;
+        EXPECT_TRUE(serializer.serialize_block(&random_block, &pblock).ok());
+        compressed.push_back(pblock.has_compression_type());
+    }
+    EXPECT_EQ(compressed, std::vector<bool>({true, false, true, false, false}));
+    EXPECT_EQ(local_state->_uncompressed_blocks_counter->value(), 3);
+
+    {
+        PBlock pblock;
+        EXPECT_TRUE(serializer.serialize_block(&compressible_block, &pblock).ok());
+        EXPECT_TRUE(pblock.compressed());
+        // saving enough resets the backoff
+        EXPECT_EQ(serializer._compression_backoff_blocks, 1);
+    }
+}
+
 } // namespace doris::pipeline
@@ -334,4 +334,65 @@ TEST_F(MaterializationSharedStateTest, TestMergeMultiResponseMultiBlocks) {
     EXPECT_EQ(merged_value_col2->get_data_at(2).data, nullptr);
 }
 
+TEST_F(MaterializationSharedStateTest, TestFetchDuplicateRowsOnce) {
+    // A join outputs the first row of backend 1 twice
+    GlobalRowLoacationV2 loc1(0, _backend_id1, 1, 1);
+    GlobalRowLoacationV2 loc2(0, _backend_id2, 2, 2);
+    auto rowid_col = _string_type->create_column();
+    auto* col_data = reinterpret_cast<vectorized::ColumnString*>(rowid_col.get());
+    col_data->insert_data(reinterpret_cast<const char*>(&loc1), sizeof(GlobalRowLoacationV2));
+    col_data->insert_data(reinterpret_cast<const char*>(&loc2), sizeof(GlobalRowLoacationV2));
+    col_data->insert_data(reinterpret_cast<const char*>(&loc1), sizeof(GlobalRowLoacationV2));
+    vectorized::Columns columns;
+    columns.push_back(rowid_col->get_ptr());
+
+    Status st = _shared_state->create_muiltget_result(columns, true, false);
+    EXPECT_TRUE(st.ok());
+    auto& request1 = _shared_state->rpc_struct_map[_backend_id1].request;
+    auto& request2 = _shared_state->rpc_struct_map[_backend_id2].request;
+    EXPECT_EQ(request1.request_block_descs(0).row_id_size(), 1);
+    EXPECT_EQ(request2.request_block_descs(0).row_id_size(), 1);
+    ASSERT_EQ(_shared_state->duplicate_rows.size(), 1);
+    ASSERT_EQ(_shared_state->duplicate_rows[0].size(), 1);
+    EXPECT_EQ(_shared_state->duplicate_rows[0][0], std::make_pair(2U, 0U));
+
+    auto value_col = _int_type->create_column();
+    for (int i = 0; i < 3; ++i) {
+        value_col->insert(vectorized::Field::create_field<PrimitiveType::TYPE_INT>(i));
+    }
+    _shared_state->origin_block =
+            vectorized::Block({{std::move(rowid_col), _string_type, "rowid"},
+                               {std::move(value_col), _int_type, "value"}});
+    _shared_state->rowid_locs = {0};
+    _shared_state->response_blocks = std::vector<vectorized::MutableBlock>(1);
+
+    std::vector<std::pair<int64_t, int>> responses = {{_backend_id1, 100}, {_backend_id2, 200}};
+    for (auto [backend_id, value] : responses) {
+        vectorized::Block resp_block;
+        auto resp_value_col = _int_type->create_column();
+        resp_value_col->insert(vectorized::Field::create_field<PrimitiveType::TYPE_INT>(value));
+        resp_block.insert({std::move(resp_value_col), _int_type, "fetched"});
+
+        auto callback = std::make_shared<doris::DummyBrpcCallback<PMultiGetResponseV2>>();
+        callback->response_.reset(new PMultiGetResponseV2());
+        size_t uncompressed_size = 0;
+        size_t compressed_size = 0;
+        EXPECT_TRUE(resp_block
+                            .serialize(0, callback->response_->add_blocks()->mutable_block(),
+                                       &uncompressed_size, &compressed_size, CompressionTypePB::LZ4)
+                            .ok());
+        _shared_state->rpc_struct_map[backend_id].callback = callback;
+        _shared_state->response_blocks[0] = resp_block.clone_empty();
+    }
+
+    vectorized::Block result_block;
+    st = _shared_state->merge_multi_response(&result_block);
+    EXPECT_TRUE(st.ok());
+    ASSERT_EQ(result_block.rows(), 3);
+    auto* fetched_col = result_block.get_by_position(0).column.get();
+    EXPECT_EQ(*((int*)fetched_col->get_data_at(0).data), 100);
+    EXPECT_EQ(*((int*)fetched_col->get_data_at(1).data), 200);
+    EXPECT_EQ(*((int*)fetched_col->get_data_at(2).data), 100);
+}
+
 } // namespace doris::pipeline
@@ -88,8 +88,9 @@ struct PartitionSortOperatorTest : public ::testing::Test {
         return true;
     }
 
+    // the rows are partitioned by the first column and ordered by the last column
     void test_for_sink_and_source(int partition_exprs_num = 1, bool has_global_limit = false,
-                                  int partition_inner_limit = 0) {
+                                  int partition_inner_limit = 0, int num_columns = 1) {
         SetUp();
         sink = std::make_unique<PartitionSortSinkOperatorX>(
                 &pool, -1, partition_exprs_num, has_global_limit, partition_inner_limit);
@@ -101,15 +102,15 @@ struct PartitionSortOperatorTest : public ::testing::Test {
 
         sink->_vsort_exec_exprs._materialize_tuple = false;
 
-        sink->_vsort_exec_exprs._ordering_expr_ctxs =
-                MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+        sink->_vsort_exec_exprs._ordering_expr_ctxs = MockSlotRef::create_mock_contexts(
+                num_columns - 1, std::make_shared<DataTypeInt64>());
 
         if (partition_exprs_num > 0) {
             sink->_partition_expr_ctxs =
                     MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
         }
-        _child_op->_mock_row_desc.reset(
-                new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt64>()}, &pool});
+        DataTypes row_types(num_columns, std::make_shared<vectorized::DataTypeInt64>());
+        _child_op->_mock_row_desc.reset(new MockRowDescriptor {row_types, &pool});
 
         EXPECT_TRUE(sink->set_child(_child_op));
 
@@ -232,6 +233,29 @@ TEST_F(PartitionSortOperatorTest, test_one_partition) {
     test_partition_sort(partition_exprs_num, topn_num);
 }
 
+TEST_F(PartitionSortOperatorTest, TestPruneByThreshold) {
+    test_for_sink_and_source(1, false, 3, 2);
+    // the topn sort of the partition keeps 1, 2 and 3
+    std::vector<int64_t> partition_vals;
+    std::vector<int64_t> order_vals;
+    for (auto i = static_cast<int64_t>(PARTITION_SORT_ROWS_THRESHOLD * 2); i > 0; --i) {
+        partition_vals.push_back(1);
+        order_vals.push_back(i);
+    }
+    Block block = ColumnHelper::create_block<DataTypeInt64>(partition_vals, order_vals);
+    EXPECT_TRUE(sink->sink(state.get(), &block, false));
+    EXPECT_TRUE(sink_local_state->_has_topn_threshold);
+    Block block2 = ColumnHelper::create_block<DataTypeInt64>({1, 1, 1, 1}, {5, 2, 3, 9});
+    EXPECT_TRUE(sink->sink(state.get(), &block2, true));
+    EXPECT_EQ(sink_local_state->_pruned_rows_counter->value(), 2);
+
+    bool eos = false;
+    Block output_block;
+    EXPECT_TRUE(source->get_block(state.get(), &output_block, &eos).ok());
+    EXPECT_TRUE(ColumnHelper::block_equal(
+            output_block, ColumnHelper::create_block<DataTypeInt64>({1, 1, 1}, {1, 2, 2})));
+}
+
 TEST_F(PartitionSortOperatorTest, TestWithoutKey) {
     std::vector<vectorized::DataTypePtr> types {std::make_shared<vectorized::DataTypeInt32>()};
     std::unique_ptr<PartitionedHashMapVariants> _variants =
@@ -576,4 +576,66 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpillError) {
     ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
 }
 
+TEST_F(SpillSortSourceOperatorTest, CalcStreamsToMerge) {
+    auto [source_operator, sink_operator] = _helper.create_operators();
+    ASSERT_TRUE(source_operator != nullptr);
+
+    auto tnode = _helper.create_test_plan_node();
+    auto st = source_operator->init(tnode, _helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "init failed: " << st.to_string();
+
+    st = source_operator->prepare(_helper.runtime_state.get());
+    ASSERT_TRUE(st.ok()) << "prepare failed: " << st.to_string();
+
+    auto shared_state =
+            std::dynamic_pointer_cast<SpillSortSharedState>(sink_operator->create_shared_state());
+    ASSERT_TRUE(shared_state != nullptr);
+
+    LocalStateInfo info {.parent_profile = _helper.operator_profile.get(),
+                         .scan_ranges = {},
+                         .shared_state = shared_state.get(),
+                         .shared_state_map = {},
+                         .task_idx = 0};
+
+    st = source_operator->setup_local_state(_helper.runtime_state.get(), info);
+    ASSERT_TRUE(st.ok()) << "setup_local_state failed: " << st.to_string();
+
+    auto* local_state = reinterpret_cast<SpillSortLocalState*>(
+            _helper.runtime_state->get_local_state(source_operator->operator_id()));
+    ASSERT_TRUE(local_state != nullptr);
+
+    // streams with 60, 50, ..., 10 rows
+    for (size_t i = 0; i != 6; ++i) {
+        vectorized::SpillStreamSPtr spill_stream;
+        st = ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                _helper.runtime_state.get(), spill_stream,
+                print_id(_helper.runtime_state->query_id()), sink_operator->get_name(),
+                sink_operator->node_id(), std::numeric_limits<int32_t>::max(),
+                std::numeric_limits<int32_t>::max(), _helper.operator_profile.get());
+        ASSERT_TRUE(st.ok()) << "register_spill_stream failed: " << st.to_string();
+
+        std::vector<int32_t> data((6 - i) * 10, static_cast<int32_t>(i));
+        auto input_block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(data);
+        st = spill_stream->spill_block(_helper.runtime_state.get(), input_block, true);
+        ASSERT_TRUE(st.ok()) << "spill_block failed: " << st.to_string();
+
+        shared_state->sorted_streams.emplace_back(std::move(spill_stream));
+    }
+
+    // all streams could be merged at once
+    ASSERT_EQ(local_state->_calc_streams_to_merge(6), 6);
+    // 6 streams with fan-in 3 are merged by 2, then 3 and 3 streams
+    ASSERT_EQ(local_state->_calc_streams_to_merge(3), 2);
+    for (size_t i = 1; i != shared_state->sorted_streams.size(); ++i) {
+        ASSERT_LE(shared_state->sorted_streams[i - 1]->get_written_bytes(),
+                  shared_state->sorted_streams[i]->get_written_bytes());
+    }
+    ASSERT_EQ(local_state->_calc_streams_to_merge(4), 3);
+
+    for (auto& stream : shared_state->sorted_streams) {
+        (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+    }
+    shared_state->sorted_streams.clear();
+}
+
 } // namespace doris::pipeline
\ No newline at end of file
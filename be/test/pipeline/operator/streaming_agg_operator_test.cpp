@@ -20,6 +20,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
 #include "pipeline/exec/mock_operator.h"
@@ -237,6 +238,84 @@ TEST_F(StreamingAggOperatorTest, test2) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, merge_existing_groups) {
+    config::enable_streaming_agg_merge_existing_groups = true;
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    {
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 2, 2, 2, 3}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 3);
+    }
+
+    {
+        // the rows of group 2 are merged into it, the rows of group 4 pass through
+        local_state->should_not_do_pre_agg = true;
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({2, 2, 2, 2, 4, 4}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+
+        EXPECT_EQ(local_state->_get_hash_table_size(), 3);
+        EXPECT_EQ(local_state->_merged_pass_through_rows_counter->value(), 4);
+        EXPECT_FALSE(op->need_more_input_data(state.get()));
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(block.rows(), 2);
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(eos);
+        EXPECT_EQ(block.rows(), 3);
+    }
+
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+    config::enable_streaming_agg_merge_existing_groups = false;
+}
+
 TEST_F(StreamingAggOperatorTest, test3) {
     op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
             pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
@@ -982,6 +982,90 @@ TEST_F(PipelineTaskTest, TEST_RESERVE_MEMORY_FAIL) {
     delete ExecEnv::GetInstance()->_workload_group_manager;
 }
 
+TEST_F(PipelineTaskTest, TEST_RESERVE_LARGE_MEMORY_FAIL) {
+    {
+        _query_options = TQueryOptionsBuilder()
+                                 .set_enable_local_exchange(true)
+                                 .set_enable_local_shuffle(true)
+                                 .set_runtime_filter_max_in_num(15)
+                                 .set_enable_reserve_memory(true)
+                                 .build();
+        auto fe_address = TNetworkAddress();
+        fe_address.hostname = LOCALHOST;
+        fe_address.port = DUMMY_PORT;
+        _query_ctx =
+                QueryContext::create(_query_id, ExecEnv::GetInstance(), _query_options, fe_address,
+                                     true, fe_address, QuerySource::INTERNAL_FRONTEND);
+        _task_queue = std::make_unique<DummyTaskQueue>(1);
+        _build_fragment_context();
+
+        TWorkloadGroupInfo twg_info;
+        twg_info.__set_id(0);
+        twg_info.__set_name("_dummpy_workload_group");
+        twg_info.__set_version(0);
+
+        WorkloadGroupInfo workload_group_info = WorkloadGroupInfo::parse_topic_info(twg_info);
+
+        ((MockRuntimeState*)_runtime_state.get())->_workload_group =
+                std::make_shared<WorkloadGroup>(workload_group_info);
+        ((MockThreadMemTrackerMgr*)thread_context()->thread_mem_tracker_mgr.get())
+                ->_test_low_memory = true;
+
+        ExecEnv::GetInstance()->_workload_group_manager = new MockWorkloadGroupMgr();
+    }
+    auto num_instances = 1;
+    auto pip_id = 0;
+    auto task_id = 0;
+    auto pip = std::make_shared<Pipeline>(pip_id, num_instances, num_instances);
+    {
+        OperatorPtr source_op;
+        source_op.reset(new DummyOperator());
+        EXPECT_TRUE(pip->add_operator(source_op, num_instances).ok());
+
+        int op_id = 1;
+        int node_id = 2;
+        int dest_id = 3;
+        DataSinkOperatorPtr sink_op;
+        sink_op.reset(new DummySinkOperatorX(op_id, node_id, dest_id));
+        EXPECT_TRUE(pip->set_sink(sink_op).ok());
+    }
+    auto profile = std::make_shared<RuntimeProfile>("Pipeline : " + std::to_string(pip_id));
+    std::map<int,
+             std::pair<std::shared_ptr<BasicSharedState>, std::vector<std::shared_ptr<Dependency>>>>
+            shared_state_map;
+    _runtime_state->resize_op_id_to_local_state(-1);
+    auto task = std::make_shared<PipelineTask>(pip, task_id, _runtime_state.get(), _context,
+                                               profile.get(), shared_state_map, task_id);
+    task->set_task_queue(_task_queue.get());
+    {
+        std::vector<TScanRangeParams> scan_range;
+        int sender_id = 0;
+        TDataSink tsink;
+        EXPECT_TRUE(task->prepare(scan_range, sender_id, tsink).ok());
+    }
+    _query_ctx->get_execution_dependency()->set_ready();
+    const auto min_reserve_bytes = config::paused_query_min_reserve_bytes;
+    {
+        // Nothing to spill and a small reservation, set low memory mode and do not pause.
+        config::paused_query_min_reserve_bytes = std::numeric_limits<int64_t>::max();
+        EXPECT_TRUE(task->_try_to_reserve_memory(1024, task->_sink.get()));
+        EXPECT_TRUE(_query_ctx->resource_ctx()->task_controller()->low_memory_mode());
+        EXPECT_FALSE(task->_spilling);
+        EXPECT_FALSE(
+                ((MockWorkloadGroupMgr*)ExecEnv::GetInstance()->_workload_group_manager)->_paused);
+    }
+    {
+        // Nothing to spill but a large reservation, pause the query to wait for memory.
+        config::paused_query_min_reserve_bytes = 1024;
+        EXPECT_FALSE(task->_try_to_reserve_memory(1024, task->_sink.get()));
+        EXPECT_TRUE(task->_spilling);
+        EXPECT_TRUE(
+                ((MockWorkloadGroupMgr*)ExecEnv::GetInstance()->_workload_group_manager)->_paused);
+    }
+    config::paused_query_min_reserve_bytes = min_reserve_bytes;
+    delete ExecEnv::GetInstance()->_workload_group_manager;
+}
+
 TEST_F(PipelineTaskTest, TEST_INJECT_SHARED_STATE) {
     auto num_instances = 1;
     auto pip_id = 0;
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_tracing.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include <thread>
+
+namespace doris::pipeline {
+
+static TaskTraceEvent make_event(int32_t task_id, int64_t start_ns) {
+    TaskTraceEvent event;
+    event.task_id = task_id;
+    event.start_ns = start_ns;
+    event.end_ns = start_ns + 1000;
+    return event;
+}
+
+TEST(PipelineTracingTest, TraceRingKeepsLastEvents) {
+    TaskTraceRing ring(4);
+    for (int32_t i = 0; i < 10; ++i) {
+        ring.push(make_event(i, i * 10000));
+    }
+    std::vector<TaskTraceEvent> events;
+    ring.snapshot(0, &events);
+    ASSERT_EQ(events.size(), 4);
+    for (int32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(events[i].task_id, 6 + i);
+    }
+
+    // the runs that ended before `since_ns` are left out
+    events.clear();
+    ring.snapshot(80000, &events);
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].task_id, 8);
+}
+
+TEST(PipelineTracingTest, SnapshotAllThreads) {
+    PipelineTracerContext ctx;
+    auto now = MonotonicNanos();
+    ctx.trace(make_event(1, now + 2));
+    std::thread([&]() { ctx.trace(make_event(2, now + 1)); }).join();
+    // ended long before the snapshot window
+    ctx.trace(make_event(3, now - 3600 * NANOS_PER_SEC));
+
+    auto events = ctx.snapshot(60);
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].task_id, 2);
+    EXPECT_EQ(events[1].task_id, 1);
+}
+
+TEST(PipelineTracingTest, ChromeTrace) {
+    auto event = make_event(3, 5000);
+    event.pipeline_id = 2;
+    event.outcome = TaskTraceEvent::Outcome::BLOCK;
+    event.wait_ns = 2000;
+
+    rapidjson::Document doc;
+    doc.Parse(PipelineTracerContext::to_chrome_trace({event}).c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    const auto& trace_events = doc["traceEvents"];
+    ASSERT_EQ(trace_events.Size(), 1);
+    const auto& slice = trace_events[0];
+    EXPECT_STREQ(slice["ph"].GetString(), "X");
+    EXPECT_STREQ(slice["cat"].GetString(), "block");
+    EXPECT_DOUBLE_EQ(slice["ts"].GetDouble(), 5);
+    EXPECT_DOUBLE_EQ(slice["dur"].GetDouble(), 1);
+    EXPECT_DOUBLE_EQ(slice["args"]["wait_us"].GetDouble(), 2);
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "runtime/group_commit_mgr.h"
+
+namespace doris {
+
+TEST(GroupCommitIntervalEstimatorTest, NoSamples) {
+    GroupCommitIntervalEstimator estimator;
+    EXPECT_EQ(estimator.interval_ms(5000, 50), 5000);
+}
+
+TEST(GroupCommitIntervalEstimatorTest, SubtractCommitCost) {
+    GroupCommitIntervalEstimator estimator;
+    for (int64_t i = 0; i < 100; ++i) {
+        estimator.update_load_arrival(i * 10);
+        estimator.update_wal_write_latency(1000);
+        estimator.update_commit_latency(100);
+    }
+    // steady latencies have no deviation: 1ms WAL write + 100ms commit
+    EXPECT_EQ(estimator.interval_ms(5000, 50), 4899);
+    // the cost does not fit in the target
+    EXPECT_EQ(estimator.interval_ms(80, 50), 50);
+}
+
+TEST(GroupCommitIntervalEstimatorTest, JitterWidensCost) {
+    GroupCommitIntervalEstimator estimator;
+    for (int64_t i = 0; i < 100; ++i) {
+        estimator.update_load_arrival(i * 10);
+        estimator.update_commit_latency(i % 2 == 0 ? 50 : 150);
+    }
+    EXPECT_LT(estimator.interval_ms(5000, 50), 4900);
+}
+
+TEST(GroupCommitIntervalEstimatorTest, SparseLoadsCommitEarly) {
+    GroupCommitIntervalEstimator estimator;
+    for (int64_t i = 0; i < 10; ++i) {
+        estimator.update_load_arrival(i * 10000);
+    }
+    EXPECT_EQ(estimator.interval_ms(5000, 50), 50);
+}
+
+} // namespace doris
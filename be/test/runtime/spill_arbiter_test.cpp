@@ -0,0 +1,36 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "runtime/workload_management/spill_arbiter.h"
+
+#include <gtest/gtest.h>
+
+namespace doris {
+
+TEST(SpillArbiterTest, ChooseSmallestEnoughTask) {
+    // 30 alone frees the target, spilling 100 would write more than needed
+    EXPECT_EQ(SpillArbiter::choose({100, 10, 30, 50}, 25), std::vector<size_t>({2}));
+    // no task is enough alone, the largest one is taken first
+    EXPECT_EQ(SpillArbiter::choose({40, 10, 30, 50}, 70), std::vector<size_t>({3, 2}));
+    // all tasks are not enough
+    EXPECT_EQ(SpillArbiter::choose({10, 20}, 100), std::vector<size_t>({1, 0}));
+    EXPECT_TRUE(SpillArbiter::choose({10, 20}, 0).empty());
+    EXPECT_TRUE(SpillArbiter::choose({}, 10).empty());
+}
+
+} // namespace doris
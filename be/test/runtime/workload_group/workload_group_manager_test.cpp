@@ -125,6 +125,15 @@ TEST_F(WorkloadGroupManagerTest, get_or_create_workload_group) {
     ASSERT_EQ(wg->id(), 0);
 }
 
+TEST_F(WorkloadGroupManagerTest, get_cpuset) {
+    ASSERT_EQ(WorkloadGroup::get_cpuset("", "normal"), "");
+    const std::string conf = "online:0-15; etl : 16-31,48-63 ;bad";
+    ASSERT_EQ(WorkloadGroup::get_cpuset(conf, "online"), "0-15");
+    ASSERT_EQ(WorkloadGroup::get_cpuset(conf, "etl"), "16-31,48-63");
+    ASSERT_EQ(WorkloadGroup::get_cpuset(conf, "normal"), "");
+    ASSERT_EQ(WorkloadGroup::get_cpuset(conf, "bad"), "");
+}
+
 TEST_F(WorkloadGroupManagerTest, query_exceed) {
     auto wg = _wg_manager->get_or_create_workload_group({});
     auto query_context = _generate_on_query(wg);
@@ -80,6 +80,75 @@ TEST_F(RuntimeFilterProducerHelperTest, basic) {
     FAIL_IF_ERROR_OR_CATCH_EXCEPTION(helper.publish(_runtime_states[0].get()));
 }
 
+TEST_F(RuntimeFilterProducerHelperTest, size_by_ndv) {
+    auto helper = RuntimeFilterProducerHelper(true, false);
+
+    vectorized::VExprContextSPtr ctx;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(vectorized::VExpr::create_expr_tree(
+            TRuntimeFilterDescBuilder::get_default_expr(), ctx));
+    ctx->_last_result_column_id = 0;
+
+    vectorized::VExprContextSPtrs build_expr_ctxs = {ctx};
+    std::vector<TRuntimeFilterDesc> runtime_filter_descs = {TRuntimeFilterDescBuilder().build()};
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            helper.init(_runtime_states[0].get(), build_expr_ctxs, runtime_filter_descs));
+
+    // many more rows than max_in_num, but only a few distinct keys
+    vectorized::Block block;
+    auto column = vectorized::ColumnInt32::create();
+    for (int i = 0; i < 5000; i++) {
+        column->insert(vectorized::Field::create_field<TYPE_INT>(i % 10));
+    }
+    block.insert({std::move(column), std::make_shared<vectorized::DataTypeInt32>(), "col1"});
+
+    helper.estimate_filter_ndv(&block, 1);
+    ASSERT_EQ(helper._filter_ndvs.size(), 1);
+    ASSERT_GE(helper._filter_ndvs[0], 10);
+    ASSERT_LE(helper._filter_ndvs[0], 12);
+
+    std::map<int, std::shared_ptr<RuntimeFilterWrapper>> runtime_filters;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            helper.build(_runtime_states[0].get(), &block, false, runtime_filters));
+    ASSERT_EQ(helper._producers[0]->wrapper()->get_real_type(), RuntimeFilterType::IN_FILTER);
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(helper.publish(_runtime_states[0].get()));
+}
+
+TEST_F(RuntimeFilterProducerHelperTest, dense_keys_build_bitmap) {
+    auto helper = RuntimeFilterProducerHelper(true, false);
+
+    vectorized::VExprContextSPtr ctx;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(vectorized::VExpr::create_expr_tree(
+            TRuntimeFilterDescBuilder::get_default_expr(), ctx));
+    ctx->_last_result_column_id = 0;
+
+    vectorized::VExprContextSPtrs build_expr_ctxs = {ctx};
+    std::vector<TRuntimeFilterDesc> runtime_filter_descs = {TRuntimeFilterDescBuilder().build()};
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            helper.init(_runtime_states[0].get(), build_expr_ctxs, runtime_filter_descs));
+
+    // many more distinct keys than max_in_num in a small range
+    vectorized::Block block;
+    auto column = vectorized::ColumnInt32::create();
+    for (int i = 0; i < 5000; i++) {
+        column->insert(vectorized::Field::create_field<TYPE_INT>(i + 100));
+    }
+    block.insert({std::move(column), std::make_shared<vectorized::DataTypeInt32>(), "col1"});
+
+    std::map<int, std::shared_ptr<RuntimeFilterWrapper>> runtime_filters;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            helper.build(_runtime_states[0].get(), &block, false, runtime_filters));
+    auto wrapper = helper._producers[0]->wrapper();
+    ASSERT_EQ(wrapper->get_real_type(), RuntimeFilterType::BITMAP_FILTER);
+    // the first row is mocked and not inserted
+    ASSERT_EQ(wrapper->bitmap_filter_func()->size(), 4999);
+    std::vector<int32_t> probe = {100, 150, 5099, 5100};
+    std::vector<uint8_t> results(probe.size());
+    wrapper->bitmap_filter_func()->find_batch(reinterpret_cast<const char*>(probe.data()),
+                                              nullptr, probe.size(), results.data());
+    ASSERT_EQ(results, std::vector<uint8_t>({0, 1, 1, 0}));
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(helper.publish(_runtime_states[0].get()));
+}
+
 TEST_F(RuntimeFilterProducerHelperTest, wake_up_eraly) {
     auto helper = RuntimeFilterProducerHelper(true, false);
 
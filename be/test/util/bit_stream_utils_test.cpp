@@ -218,4 +218,24 @@ TEST(TestBitStreamUtil, TestUint64) {
     reader.GetValue(16, &v4);
     EXPECT_EQ(v4, 126);
 }
+
+TEST(TestBitStreamUtil, TestUnpackBatch) {
+    // enough values for the batches unpacked with SIMD, and the last ones without
+    const int num_values = 32 * 8 + 7;
+    for (int width = 1; width <= 32; ++width) {
+        faststring buffer(1);
+        BitWriter writer(&buffer);
+        std::vector<uint32_t> values(num_values);
+        for (int i = 0; i < num_values; ++i) {
+            values[i] = static_cast<uint32_t>((i * 2654435761U) & ((1ULL << width) - 1));
+            writer.PutValue(values[i], width);
+        }
+        writer.Flush();
+
+        BatchedBitReader reader(buffer.data(), buffer.size());
+        std::vector<uint32_t> unpacked(num_values);
+        EXPECT_EQ(reader.UnpackBatch(width, num_values, unpacked.data()), num_values);
+        EXPECT_EQ(unpacked, values) << "width " << width;
+    }
+}
 } // namespace doris
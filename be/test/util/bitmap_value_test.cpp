@@ -159,6 +159,32 @@ TEST(BitmapValueTest, Roaring64Map_shrinkToFit) {
     EXPECT_EQ(roaring64_map.shrinkToFit(), 88);
 }
 
+TEST(BitmapValueTest, Roaring64Map_fastunion) {
+    const uint64_t high = uint64_t(1) << 40;
+    detail::Roaring64Map map1;
+    map1.add(uint64_t(1));
+    map1.add(high + 1);
+    detail::Roaring64Map map2;
+    map2.add(uint64_t(2));
+    for (uint64_t v = 1000; v < 2000; ++v) {
+        map2.add(v);
+    }
+    detail::Roaring64Map map3;
+    map3.add(high + 2);
+
+    const detail::Roaring64Map* inputs[] = {&map1, &map2, &map3};
+    auto result = detail::Roaring64Map::fastunion(3, inputs);
+
+    detail::Roaring64Map expected;
+    expected |= map1;
+    expected |= map2;
+    expected |= map3;
+    EXPECT_TRUE(result == expected);
+    EXPECT_EQ(result.cardinality(), 1004);
+
+    EXPECT_TRUE(detail::Roaring64Map::fastunion(0, inputs).isEmpty());
+}
+
 TEST(BitmapValueTest, Roaring64Map_iterate) {
     detail::Roaring64Map roaring64_map;
     const std::vector<uint32_t> values({0, 1, 3, 4, 5, 7, 8});
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/arrow/block_convertor.h"
+
+#include <arrow/array.h>
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "util/arrow/row_batch.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris {
+
+TEST(BlockConvertorTest, ShareColumnBuffers) {
+    auto block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt64>({1, 2, 3});
+    block.insert(vectorized::ColumnHelper::create_nullable_column_with_name<
+                 vectorized::DataTypeFloat64>({1.5, 2.5, 3.5}, {0, 1, 0}));
+    block.insert(
+            vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeString>(
+                    {"a", "b", "c"}));
+    std::shared_ptr<arrow::Schema> schema;
+    ASSERT_TRUE(get_arrow_schema_from_block(block, &schema, "UTC").ok());
+    cctz::time_zone timezone_obj;
+
+    std::shared_ptr<arrow::RecordBatch> copied;
+    ASSERT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &copied,
+                                       timezone_obj)
+                        .ok());
+    std::shared_ptr<arrow::RecordBatch> shared;
+    ASSERT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &shared,
+                                       timezone_obj, true)
+                        .ok());
+    EXPECT_TRUE(shared->Equals(*copied));
+    EXPECT_EQ(shared->column(1)->null_count(), 1);
+
+    // the numeric arrays are on the data of the columns
+    auto raw = block.get_by_position(0).column->get_raw_data();
+    EXPECT_EQ(shared->column(0)->data()->buffers[1]->data(),
+              reinterpret_cast<const uint8_t*>(raw.data));
+    EXPECT_NE(copied->column(0)->data()->buffers[1]->data(),
+              reinterpret_cast<const uint8_t*>(raw.data));
+
+    // the batch keeps the columns alive after the block is gone
+    block.clear();
+    auto values = std::static_pointer_cast<arrow::Int64Array>(shared->column(0));
+    EXPECT_EQ(values->Value(2), 3);
+}
+
+} // namespace doris
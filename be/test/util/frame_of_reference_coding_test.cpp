@@ -21,6 +21,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <cstring>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -191,6 +192,86 @@ TEST_F(TestForCoding, TestBytesAlign) {
     EXPECT_EQ(2020, actual_value);
 }
 
+TEST_F(TestForCoding, TestConstantDelta) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer);
+    std::vector<int64_t> data(300, 1700000000000L);
+    encoder.put_batch(data.data(), data.size());
+    encoder.flush();
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    std::vector<int64_t> actual_result(data.size(), -1);
+    EXPECT_TRUE(decoder.get_batch(actual_result.data(), actual_result.size()));
+    EXPECT_EQ(data, actual_result);
+}
+
+TEST_F(TestForCoding, TestFrameValueRange) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer);
+    std::vector<int64_t> data;
+    // an ascending frame
+    for (int64_t i = 0; i < 128; ++i) {
+        data.push_back(1000 + i * 3);
+    }
+    // an unordered frame
+    for (int64_t i = 0; i < 128; ++i) {
+        data.push_back(5000 + (i * 37) % 100);
+    }
+    // a frame that keeps original values
+    data.push_back(std::numeric_limits<int64_t>::min());
+    data.push_back(std::numeric_limits<int64_t>::max());
+    encoder.put_batch(data.data(), data.size());
+    encoder.flush();
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    EXPECT_TRUE(decoder.init());
+    EXPECT_EQ(3, decoder.frame_count());
+
+    uint32_t first = 0;
+    uint32_t count = 0;
+    int64_t min = 0;
+    int64_t max = 0;
+    EXPECT_TRUE(decoder.frame_value_range(0, &first, &count, &min, &max));
+    EXPECT_EQ(0, first);
+    EXPECT_EQ(128, count);
+    EXPECT_EQ(1000, min);
+    EXPECT_GE(max, 1000 + 127 * 3);
+
+    EXPECT_TRUE(decoder.frame_value_range(1, &first, &count, &min, &max));
+    EXPECT_EQ(128, first);
+    EXPECT_EQ(128, count);
+    EXPECT_EQ(5000, min);
+    EXPECT_GE(max, 5099);
+    EXPECT_LT(max, 5128);
+
+    EXPECT_FALSE(decoder.frame_value_range(2, &first, &count, &min, &max));
+    EXPECT_EQ(256, first);
+    EXPECT_EQ(2, count);
+}
+
+TEST_F(TestForCoding, TestBatchAcrossFrames) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer);
+    std::vector<int64_t> data;
+    for (int64_t i = 0; i < 1000; ++i) {
+        data.push_back(1700000000000L + i * 1000 + i % 7);
+    }
+    encoder.put_batch(data.data(), data.size());
+    encoder.flush();
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    // the middle batch decodes whole frames straight into the output
+    std::vector<int64_t> actual_result(data.size());
+    EXPECT_TRUE(decoder.get_batch(actual_result.data(), 100));
+    EXPECT_TRUE(decoder.get_batch(actual_result.data() + 100, 412));
+    // go back into a frame the previous batch decoded directly
+    EXPECT_TRUE(decoder.skip(-100));
+    EXPECT_TRUE(decoder.get_batch(actual_result.data() + 412, 588));
+    EXPECT_EQ(data, actual_result);
+}
+
 TEST_F(TestForCoding, TestValueSeekSpecialCase) {
     faststring buffer(1);
     ForEncoder<int64_t> encoder(&buffer);
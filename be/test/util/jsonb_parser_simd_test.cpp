@@ -18,6 +18,7 @@
 #include "common/status.h"
 #include "gtest/gtest.h"
 #include "runtime/jsonb_value.h"
+#include "util/jsonb_parser_simd.h"
 
 namespace doris {
 class JsonbParserTest : public testing::Test {};
@@ -387,4 +388,38 @@ TEST_F(JsonbParserTest, ParseJsonWithToLongKey) {
     EXPECT_FALSE(st.ok());
     std::cout << st.msg() << std::endl;
 }
+
+TEST_F(JsonbParserTest, ParseJsonReuseBuffer) {
+    // the parser and input buffer are reused, a shorter document must not see the longer one
+    EXPECT_EQ(parse_json_and_check(R"({"key":[1,2,3],"other":"value"})",
+                                   R"({"key":[1,2,3],"other":"value"})"),
+              Status::OK());
+    EXPECT_EQ(parse_json_and_check("[1]", "[1]"), Status::OK());
+    EXPECT_FALSE(parse_json_and_check("[1", "[1"));
+    EXPECT_EQ(parse_json_and_check("12", "12"), Status::OK());
+}
+
+TEST_F(JsonbParserTest, ParseJsonLargerThanReusedBuffer) {
+    std::string json = R"({"key":")";
+    json.append(JsonbParser::MAX_REUSED_BUFFER_SIZE, 'a');
+    json.append(R"("})");
+    EXPECT_EQ(parse_json_and_check(json, json), Status::OK());
+}
+
+TEST_F(JsonbParserTest, ParseJsonValue) {
+    simdjson::ondemand::parser parser;
+    simdjson::padded_string json {std::string_view(R"({"a":{"b":[1,"x",null]},"c":2.5})")};
+    simdjson::ondemand::document doc = parser.iterate(json);
+    JsonbWriter writer;
+    simdjson::ondemand::value value = doc["a"];
+    EXPECT_EQ(JsonbParser::parse_value(value, writer), Status::OK());
+    EXPECT_EQ(JsonbToJson::jsonb_to_json_string(writer.getOutput()->getBuffer(),
+                                                writer.getOutput()->getSize()),
+              R"({"b":[1,"x",null]})");
+    value = doc["c"];
+    EXPECT_EQ(JsonbParser::parse_value(value, writer), Status::OK());
+    EXPECT_EQ(JsonbToJson::jsonb_to_json_string(writer.getOutput()->getBuffer(),
+                                                writer.getOutput()->getSize()),
+              "2.5");
+}
 } // namespace doris
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 
@@ -255,4 +256,26 @@ TEST(MysqlRowBufferTest, TestBinaryTimeCompressedEncoding) {
     offset += 9;
 }
 
+TEST(MysqlRowBufferTest, EncodeIntFields) {
+    std::vector<int64_t> data {5, -30000, 0, 900000, INT64_MIN};
+    std::vector<uint8_t> null_map {0, 0, 1, 0, 0};
+    std::string buf;
+    std::vector<size_t> offsets;
+    encode_int_fields(data.data(), null_map.data(), data.size(), &buf, &offsets);
+
+    MysqlRowBuffer mrb;
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (null_map[i]) {
+            mrb.push_null();
+        } else {
+            mrb.push_bigint(data[i]);
+        }
+    }
+    ASSERT_EQ(offsets.size(), data.size() + 1);
+    EXPECT_EQ(offsets.back(), buf.size());
+    EXPECT_EQ(buf, std::string(mrb.buf(), mrb.length()));
+    // the null field
+    EXPECT_EQ(offsets[3] - offsets[2], 1);
+}
+
 } // namespace doris
@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/simd/bits.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris::simd {
+
+TEST(SimdBitsTest, bytes16_eq_mask) {
+    std::string data = "a,bb,,ccc,dddd,e";
+    ASSERT_EQ(data.size(), 16);
+    std::vector<size_t> positions;
+    iterate_through_bits_mask([&](auto pos) { positions.push_back(pos); },
+                              bytes16_eq_mask(data.data(), ','));
+    EXPECT_EQ(positions, (std::vector<size_t> {1, 4, 5, 9, 14}));
+    EXPECT_EQ(find_first_in_bits_mask(bytes16_eq_mask(data.data(), ',')), 1);
+    EXPECT_EQ(find_first_in_bits_mask(bytes16_eq_mask(data.data(), 'e')), 15);
+    EXPECT_EQ(bytes16_eq_mask(data.data(), '|'), 0);
+}
+
+} // namespace doris::simd
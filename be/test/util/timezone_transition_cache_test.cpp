@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/timezone_transition_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include "cctz/civil_time.h"
+#include "cctz/time_zone.h"
+#include "util/timezone_utils.h"
+
+namespace doris {
+
+// walk across the DST transitions of 2024 and compare with plain cctz conversions
+static void check_time_zone(const std::string& tz_name) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone(tz_name, ctz));
+    TimezoneTransitionCache cache(ctz);
+    const auto epoch =
+            std::chrono::time_point_cast<cctz::seconds>(std::chrono::system_clock::from_time_t(0));
+    const int64_t begin = 1704067200; // 2024-01-01 00:00:00 UTC
+    for (int64_t value = begin; value < begin + 366 * 86400; value += 599) {
+        const auto local = cctz::convert(epoch + cctz::seconds(value), ctz);
+        EXPECT_EQ(cache.utc_to_local(value), TimezoneTransitionCache::to_local_seconds(local));
+
+        // treat the value as local seconds as well, which also hits skipped and repeated times
+        const auto utc = cctz::convert(TimezoneTransitionCache::to_civil(value), ctz);
+        EXPECT_EQ(cache.local_to_utc(value), utc.time_since_epoch().count());
+    }
+}
+
+TEST(TimezoneTransitionCacheTest, MatchCctz) {
+    TimezoneUtils::load_timezones_to_cache();
+    check_time_zone("America/New_York");
+    check_time_zone("Australia/Lord_Howe");
+    check_time_zone("Asia/Shanghai");
+    check_time_zone("+08:00");
+}
+
+TEST(TimezoneTransitionCacheTest, SkippedAndRepeated) {
+    TimezoneUtils::load_timezones_to_cache();
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("America/New_York", ctz));
+    TimezoneTransitionCache cache(ctz);
+
+    // 2024-03-10 02:30:00 does not exist, cctz maps it to the transition
+    auto skipped = TimezoneTransitionCache::to_local_seconds(
+            cctz::civil_second(2024, 3, 10, 2, 30, 0));
+    EXPECT_EQ(cache.local_to_utc(skipped), 1710054000);
+    // 2024-11-03 01:30:00 happens twice, cctz takes the earlier one
+    auto repeated = TimezoneTransitionCache::to_local_seconds(
+            cctz::civil_second(2024, 11, 3, 1, 30, 0));
+    EXPECT_EQ(cache.local_to_utc(repeated), 1730611800);
+    EXPECT_EQ(TimezoneTransitionCache::to_civil(cache.utc_to_local(1730611800)),
+              cctz::civil_second(2024, 11, 3, 1, 30, 0));
+    EXPECT_EQ(TimezoneTransitionCache::to_civil(cache.utc_to_local(1730615400)),
+              cctz::civil_second(2024, 11, 3, 1, 30, 0));
+}
+
+} // namespace doris
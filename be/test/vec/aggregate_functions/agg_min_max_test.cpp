@@ -77,6 +77,34 @@ TEST_P(AggMinMaxTest, min_max_test) {
     agg_function->destroy(place);
 }
 
+TEST_P(AggMinMaxTest, min_max_batch_single_place_test) {
+    Arena arena;
+    std::string min_max_type = GetParam();
+    auto column_vector_int32 = ColumnInt32::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        // neither the first nor the last row holds the result
+        column_vector_int32->insert(Field::create_field<TYPE_INT>(
+                cast_to_nearest_field_type((i * 7 + 1) % agg_test_batch_size)));
+    }
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_minmax(factory);
+    DataTypes data_types = {std::make_shared<DataTypeInt32>()};
+    auto agg_function = factory.get(min_max_type, data_types, false, -1);
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+    AggregateDataPtr place = memory.get();
+    agg_function->create(place);
+
+    const IColumn* column[1] = {column_vector_int32.get()};
+    agg_function->add_batch_single_place(agg_test_batch_size / 2, place, column, arena);
+    agg_function->add_batch_single_place(agg_test_batch_size, place, column, arena);
+
+    ColumnInt32 ans;
+    agg_function->insert_result_into(place, ans);
+    EXPECT_EQ(min_max_type == "min" ? 0 : agg_test_batch_size - 1, ans.get_element(0));
+    agg_function->destroy(place);
+}
+
 TEST_P(AggMinMaxTest, min_max_decimal_test) {
     Arena arena;
     std::string min_max_type = GetParam();
@@ -919,6 +919,23 @@ TEST_F(ColumnStringTest, filter) {
         EXPECT_THROW(column_str64->filter(filter), Exception);
     }
 }
+TEST_F(ColumnStringTest, filter_large_values) {
+    auto col = ColumnString::create();
+    IColumn::Filter filter;
+    for (int i = 0; i < 64; ++i) {
+        std::string value(60000, static_cast<char>('a' + i % 26));
+        col->insert_data(value.data(), value.size());
+        filter.push_back(i % 2);
+    }
+    auto res = col->filter(filter, -1);
+    const auto& res_col = assert_cast<const ColumnString&>(*res);
+    ASSERT_EQ(res_col.size(), 32);
+    for (size_t i = 0; i < res_col.size(); ++i) {
+        EXPECT_EQ(res_col.get_data_at(i).to_string(), col->get_data_at(i * 2 + 1).to_string());
+    }
+    // the result chars are reserved by their exact size instead of by the source
+    EXPECT_LT(res_col.get_chars().allocated_bytes(), col->get_chars().size());
+}
 TEST_F(ColumnStringTest, filter_by_selector) {
     auto test_func = [&](const auto& source_column) {
         auto src_size = source_column->size();
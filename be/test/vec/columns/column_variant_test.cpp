@@ -354,6 +354,63 @@ TEST_F(ColumnVariantTest, test_insert_indices_from) {
     }
 }
 
+TEST_F(ColumnVariantTest, test_finalize_multiple_types) {
+    ColumnVariant::Subcolumn subcolumn(0, true /* is_nullable */, false /* is_root */);
+    subcolumn.insert(Field::create_field<TYPE_INT>(1234567));
+    subcolumn.insert(Field::create_field<TYPE_INT>(7654321));
+    subcolumn.insert(Field::create_field<TYPE_STRING>("hello"));
+    EXPECT_EQ(subcolumn.data_types.size(), 2);
+
+    subcolumn.finalize();
+    EXPECT_TRUE(subcolumn.is_finalized());
+    EXPECT_EQ(subcolumn.get_finalized_column().size(), 3);
+    EXPECT_EQ(subcolumn.get_least_common_type()->get_name(), "Nullable(JSONB)");
+
+    // the first part already has the common type and is reused
+    ColumnVariant::Subcolumn widened(0, true /* is_nullable */, false /* is_root */);
+    widened.insert(Field::create_field<TYPE_BIGINT>(1));
+    widened.insert(Field::create_field<TYPE_BIGINT>(2));
+    widened.add_new_column_part(widened.get_least_common_type());
+    widened.insert(Field::create_field<TYPE_BIGINT>(3));
+    widened.finalize();
+    EXPECT_TRUE(widened.is_finalized());
+    Field field;
+    widened.get(2, field);
+    EXPECT_EQ(field.get<Int64>(), 3);
+    EXPECT_EQ(widened.size(), 3);
+}
+
+TEST_F(ColumnVariantTest, test_insert_from_same_subcolumns) {
+    auto create_column = [](Int64 a, const String& b) {
+        auto column = ColumnVariant::create(true);
+        Field field_map = Field::create_field<TYPE_VARIANT>(VariantMap());
+        auto& map = field_map.get<VariantMap&>();
+        map[PathInData("a")] = Field::create_field<TYPE_BIGINT>(a);
+        map[PathInData("b")] = Field::create_field<TYPE_STRING>(b);
+        column->try_insert(field_map);
+        column->try_insert(field_map);
+        column->finalize();
+        return column;
+    };
+    auto src_column = create_column(1, "hello");
+    auto dst_column = create_column(2, "world");
+    EXPECT_TRUE(dst_column->has_same_finalized_subcolumns(*src_column));
+
+    dst_column->insert_from(*src_column, 0);
+    std::vector<uint32_t> indices = {1, 0};
+    dst_column->insert_indices_from(*src_column, indices.data(), indices.data() + indices.size());
+    EXPECT_EQ(dst_column->size(), 5);
+    EXPECT_TRUE(dst_column->is_finalized());
+
+    Field result;
+    dst_column->get(4, result);
+    const auto& result_map = result.get<const VariantMap&>();
+    EXPECT_EQ(result_map.at(PathInData("a")).get<Int64>(), 1);
+    EXPECT_EQ(result_map.at(PathInData("b")).get<const String&>(), "hello");
+    dst_column->get(1, result);
+    EXPECT_EQ(result.get<const VariantMap&>().at(PathInData("a")).get<Int64>(), 2);
+}
+
 TEST_F(ColumnVariantTest, test_nested_array_of_jsonb_get) {
     // Test case: Create a ColumnVariant with subcolumn type Array<JSONB>
 
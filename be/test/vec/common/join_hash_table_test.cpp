@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "vec/common/hash_table/hash.h"
+
+namespace doris {
+
+using TestJoinHashTable = JoinHashTable<uint64_t, HashCRC32<uint64_t>>;
+
+static DorisVector<uint32_t> bucket_nums_of(const TestJoinHashTable& table,
+                                            const std::vector<uint64_t>& keys) {
+    DorisVector<uint32_t> bucket_nums(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        bucket_nums[i] = table.hash(keys[i]) & (table.get_bucket_size() - 1);
+    }
+    return bucket_nums;
+}
+
+TEST(JoinHashTableTest, ProbeFilter) {
+    // row 0 is the placeholder of the build block
+    std::vector<uint64_t> build_keys(10001);
+    for (uint32_t i = 1; i < build_keys.size(); ++i) {
+        build_keys[i] = i * 2;
+    }
+    auto num_elem = static_cast<uint32_t>(build_keys.size());
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::LEFT_SEMI_JOIN>(num_elem, 4096, false);
+    auto build_bucket_nums = bucket_nums_of(table, build_keys);
+    table.build(build_keys.data(), build_bucket_nums.data(), num_elem, false);
+    table.build_probe_filter(build_bucket_nums.data(), num_elem);
+    ASSERT_TRUE(table.has_probe_filter());
+
+    // the even keys are in the table, the odd ones are not
+    std::vector<uint64_t> probe_keys;
+    for (uint64_t key = 0; key < 20000; ++key) {
+        probe_keys.push_back(key + 2);
+    }
+    auto probe_bucket_nums = bucket_nums_of(table, probe_keys);
+    auto buckets = probe_bucket_nums;
+    auto filtered = table.apply_probe_filter(probe_keys.data(), buckets);
+    // all but a few of the keys that are not in the table
+    EXPECT_GT(filtered, 9900);
+    EXPECT_LE(filtered, 10000);
+
+    auto filtered_buckets = buckets;
+    table.pre_build_idxs(buckets);
+    for (size_t i = 0; i < probe_keys.size(); ++i) {
+        if (probe_keys[i] % 2 == 0) {
+            EXPECT_EQ(filtered_buckets[i], probe_bucket_nums[i]);
+            EXPECT_NE(buckets[i], 0);
+        } else if (filtered_buckets[i] != probe_bucket_nums[i]) {
+            // a filtered row finds no build row
+            EXPECT_EQ(buckets[i], 0);
+        }
+    }
+}
+
+TEST(JoinHashTableTest, NoProbeFilterWithNullKey) {
+    std::vector<uint64_t> build_keys {0, 1, 2, 3};
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(build_keys.size(), 4096, true);
+    auto bucket_nums = bucket_nums_of(table, build_keys);
+    table.build(build_keys.data(), bucket_nums.data(), 4, true);
+    // the null bucket is not empty
+    table.build_probe_filter(bucket_nums.data(), 4);
+    EXPECT_FALSE(table.has_probe_filter());
+}
+
+TEST(JoinHashTableTest, DirectMapping) {
+    std::vector<uint64_t> build_keys {0, 1000, 1001, 1001, 1003};
+    auto num_elem = static_cast<uint32_t>(build_keys.size());
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(num_elem, 4096, false);
+    ASSERT_TRUE(table.try_direct_mapping(1000, 1003));
+    ASSERT_TRUE(table.is_direct_mapping());
+    EXPECT_EQ(table.get_bucket_size(), 5);
+
+    DorisVector<uint32_t> bucket_nums(num_elem);
+    for (uint32_t i = 0; i < num_elem; ++i) {
+        bucket_nums[i] = table.direct_bucket_num(build_keys[i]);
+    }
+    table.build(build_keys.data(), bucket_nums.data(), num_elem, false);
+
+    // the keys out of the range, also below it, go to the empty bucket 0
+    EXPECT_EQ(table.direct_bucket_num(999), 0);
+    EXPECT_EQ(table.direct_bucket_num(1004), 0);
+    std::vector<uint64_t> probe_keys {999, 1000, 1001, 1002, 1004};
+    DorisVector<uint32_t> buckets;
+    for (auto key : probe_keys) {
+        buckets.push_back(table.direct_bucket_num(key));
+    }
+    table.pre_build_idxs(buckets);
+    EXPECT_EQ(buckets[0], 0);
+    EXPECT_EQ(buckets[1], 1);
+    // the last inserted row of the key heads the chain
+    EXPECT_EQ(buckets[2], 3);
+    EXPECT_EQ(buckets[3], 0);
+    EXPECT_EQ(buckets[4], 0);
+}
+
+TEST(JoinHashTableTest, NoDirectMappingForWideRange) {
+    TestJoinHashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(5, 4096, false);
+    auto bucket_size = table.get_bucket_size();
+    EXPECT_FALSE(table.try_direct_mapping(0, 1000000));
+    EXPECT_FALSE(table.is_direct_mapping());
+    EXPECT_EQ(table.get_bucket_size(), bucket_size);
+}
+
+} // namespace doris
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/sort/radix_sort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace doris::vectorized {
+
+TEST(RadixSortTest, SortRandomKeys) {
+    std::mt19937_64 rng(42);
+    for (size_t key_bytes : {1, 2, 4, 5, 8}) {
+        uint64_t mask = key_bytes == 8 ? ~uint64_t(0) : (uint64_t(1) << (key_bytes * 8)) - 1;
+        std::vector<RadixSortElement> data(1000);
+        for (uint32_t i = 0; i < data.size(); ++i) {
+            data[i] = {rng() & mask, i};
+        }
+        auto expected = data;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const auto& l, const auto& r) { return l.key < r.key; });
+
+        std::vector<RadixSortElement> buffer(data.size());
+        radix_sort_lsd(data.data(), buffer.data(), data.size(), key_bytes);
+        for (size_t i = 0; i < data.size(); ++i) {
+            EXPECT_EQ(data[i].key, expected[i].key);
+            EXPECT_EQ(data[i].index, expected[i].index);
+        }
+    }
+}
+
+TEST(RadixSortTest, StableOnDuplicateKeys) {
+    std::vector<RadixSortElement> data;
+    for (uint32_t i = 0; i < 300; ++i) {
+        data.push_back({(300 - i) % 3, i});
+    }
+    std::vector<RadixSortElement> buffer(data.size());
+    radix_sort_lsd(data.data(), buffer.data(), data.size(), 4);
+    for (size_t i = 1; i < data.size(); ++i) {
+        EXPECT_LE(data[i - 1].key, data[i].key);
+        if (data[i - 1].key == data[i].key) {
+            EXPECT_LT(data[i - 1].index, data[i].index);
+        }
+    }
+}
+
+TEST(RadixSortTest, AllKeysEqual) {
+    std::vector<RadixSortElement> data;
+    for (uint32_t i = 0; i < 10; ++i) {
+        data.push_back({0x1234, i});
+    }
+    std::vector<RadixSortElement> buffer(data.size());
+    radix_sort_lsd(data.data(), buffer.data(), data.size(), 8);
+    for (uint32_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(data[i].index, i);
+    }
+}
+
+} // namespace doris::vectorized
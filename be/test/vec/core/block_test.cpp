@@ -716,6 +716,32 @@ TEST(BlockTest, SerializeAndDeserializeBlock) {
     serialize_and_deserialize_test_one();
 }
 
+TEST(BlockTest, DeserializeReuseColumns) {
+    auto vec = vectorized::ColumnInt32::create();
+    for (int i = 0; i < 1024; ++i) {
+        vec->get_data().push_back(i);
+    }
+    vectorized::DataTypePtr data_type(std::make_shared<vectorized::DataTypeInt32>());
+    vectorized::Block block({{vec->get_ptr(), data_type, "test_int"}});
+    PBlock pblock;
+    block_to_pb(block, &pblock, segment_v2::CompressionTypePB::LZ4);
+
+    vectorized::Block block2;
+    ASSERT_TRUE(block2.deserialize(pblock).ok());
+    const auto* column = block2.get_by_position(0).column.get();
+    block2.clear_column_data();
+    ASSERT_TRUE(block2.deserialize(pblock).ok());
+    // the exclusive column of the same type is deserialized into again
+    EXPECT_EQ(column, block2.get_by_position(0).column.get());
+    EXPECT_EQ(block.dump_data(), block2.dump_data());
+
+    // a column shared with another block is left untouched
+    vectorized::ColumnPtr shared = block2.get_by_position(0).column;
+    ASSERT_TRUE(block2.deserialize(pblock).ok());
+    EXPECT_NE(shared.get(), block2.get_by_position(0).column.get());
+    EXPECT_EQ(block.dump_data(), block2.dump_data());
+}
+
 TEST(BlockTest, dump_data) {
     auto vec = vectorized::ColumnInt32::create();
     auto& int32_data = vec->get_data();
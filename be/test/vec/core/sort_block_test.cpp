@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+static Block create_sort_test_block(size_t rows) {
+    std::mt19937 rng(42);
+    std::vector<int32_t> ints;
+    std::vector<NullMap::value_type> nulls;
+    std::vector<int8_t> tiny_ints;
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < rows; ++i) {
+        ints.push_back(static_cast<int32_t>(rng() % 21) - 10);
+        nulls.push_back(rng() % 8 == 0);
+        tiny_ints.push_back(static_cast<int8_t>(rng() % 5) - 2);
+        strings.push_back(std::to_string(rng() % 3));
+    }
+    Block block;
+    block.insert(ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(ints, nulls));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeInt8>(tiny_ints));
+    block.insert(ColumnHelper::create_column_with_name<DataTypeString>(strings));
+    return block;
+}
+
+static Block sort_test_block(const SortDescription& description, bool radix_sort) {
+    auto block = create_sort_test_block(1000);
+    bool enabled = config::enable_sort_block_radix_sort;
+    config::enable_sort_block_radix_sort = radix_sort;
+    sort_block(block, block, description);
+    config::enable_sort_block_radix_sort = enabled;
+    return block;
+}
+
+TEST(SortBlockTest, RadixSortPrefix) {
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            SortDescription description {{0, direction, nulls_direction},
+                                         {1, -direction, nulls_direction},
+                                         {2, direction, nulls_direction}};
+            auto expected = sort_test_block(description, false);
+            auto sorted = sort_test_block(description, true);
+            EXPECT_TRUE(ColumnHelper::block_equal(expected, sorted))
+                    << "direction " << direction << ", nulls_direction " << nulls_direction;
+        }
+    }
+}
+
+TEST(SortBlockTest, SortedInput) {
+    SortDescription description {{0, 1, 1}, {1, -1, 1}};
+    auto block = ColumnHelper::create_block<DataTypeInt32>({1, 1, 2, 3, 3}, {5, 4, 4, 2, 2});
+    auto expected = ColumnHelper::create_block<DataTypeInt32>({1, 1, 2, 3, 3}, {5, 4, 4, 2, 2});
+    sort_block(block, block, description);
+    EXPECT_TRUE(ColumnHelper::block_equal(expected, block));
+
+    Block dest_block = block.clone_empty();
+    sort_block(block, dest_block, description, 3);
+    EXPECT_TRUE(ColumnHelper::block_equal(
+            ColumnHelper::create_block<DataTypeInt32>({1, 1, 2}, {5, 4, 4}), dest_block));
+
+    // one pair of rows out of order
+    block = ColumnHelper::create_block<DataTypeInt32>({1, 1, 2, 3, 3}, {5, 4, 4, 1, 2});
+    sort_block(block, block, description);
+    EXPECT_TRUE(ColumnHelper::block_equal(
+            ColumnHelper::create_block<DataTypeInt32>({1, 1, 2, 3, 3}, {5, 4, 4, 2, 1}), block));
+}
+
+} // namespace doris::vectorized
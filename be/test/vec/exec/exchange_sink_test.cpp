@@ -235,4 +235,25 @@ TEST_F(ExchangeSInkTest, test_queue_size) {
     }
 }
 
+TEST_F(ExchangeSInkTest, test_rpc_time_distribution) {
+    {
+        auto state = create_runtime_state();
+        auto buffer = create_buffer(state);
+
+        auto sink1 = create_sink(state, buffer);
+
+        EXPECT_EQ(sink1.add_block(dest_ins_id_1, false), Status::OK());
+        EXPECT_EQ(sink1.add_block(dest_ins_id_1, false), Status::OK());
+        // the first block is sent at once, the second waits in the queue
+        const auto& ins = *buffer->_rpc_instances[dest_ins_id_1];
+        EXPECT_EQ(ins.queue_wait_hist.num(), 1);
+
+        pop_block(dest_ins_id_1, PopState::accept);
+        EXPECT_EQ(ins.queue_wait_hist.num(), 2);
+        EXPECT_EQ(ins.rpc_time_hist.num(), ins.stats.rpc_count);
+        EXPECT_TRUE(buffer->_rpc_instances[dest_ins_id_2]->queue_wait_hist.is_empty());
+        clear_all_done();
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/file_reader/decompress_pipeline.h"
+
+#include <gen_cpp/Metrics_types.h>
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include <filesystem>
+#include <string>
+
+#include "exec/decompressor.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "util/runtime_profile.h"
+#include "util/threadpool.h"
+
+namespace doris {
+
+class DecompressPipelineTest : public testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(ThreadPoolBuilder("DecompressPipelineTest").build(&_pool).ok());
+        _bytes_read = ADD_COUNTER(&_profile, "BytesRead", TUnit::BYTES);
+        _bytes_decompressed = ADD_COUNTER(&_profile, "BytesDecompressed", TUnit::BYTES);
+        _decompress_timer = ADD_TIMER(&_profile, "DecompressTime");
+        ASSERT_TRUE(io::global_local_filesystem()->delete_directory(_test_dir).ok());
+        ASSERT_TRUE(io::global_local_filesystem()->create_directory(_test_dir).ok());
+    }
+
+    void TearDown() override {
+        _pool->shutdown();
+        ASSERT_TRUE(io::global_local_filesystem()->delete_directory(_test_dir).ok());
+    }
+
+    std::string write_compressed(const std::string& name, const std::string& content,
+                                 size_t truncate_bytes = 0) {
+        uLongf compressed_len = compressBound(content.size());
+        std::string compressed(compressed_len, '\0');
+        EXPECT_EQ(compress2(reinterpret_cast<Bytef*>(compressed.data()), &compressed_len,
+                            reinterpret_cast<const Bytef*>(content.data()), content.size(), 6),
+                  Z_OK);
+        compressed.resize(compressed_len - truncate_bytes);
+
+        std::string path = _test_dir + "/" + name;
+        io::FileWriterPtr file_writer;
+        EXPECT_TRUE(io::global_local_filesystem()->create_file(path, &file_writer).ok());
+        EXPECT_TRUE(file_writer->append(compressed).ok());
+        EXPECT_TRUE(file_writer->close().ok());
+        return path;
+    }
+
+    Status read_all(const std::string& path, std::string* output) {
+        io::FileReaderSPtr file_reader;
+        RETURN_IF_ERROR(io::global_local_filesystem()->open_file(path, &file_reader));
+        std::unique_ptr<Decompressor> decompressor;
+        RETURN_IF_ERROR(Decompressor::create_decompressor(CompressType::GZIP, &decompressor));
+
+        // small chunks so that the worker has to wait for the reader many times
+        DecompressPipeline pipeline(file_reader, decompressor.get(), 0, nullptr, 1000, 3,
+                                    _bytes_read, _bytes_decompressed, _decompress_timer);
+        RETURN_IF_ERROR(pipeline.start(_pool.get()));
+        uint8_t buf[777];
+        while (true) {
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(pipeline.read(buf, sizeof(buf), &bytes_read));
+            if (bytes_read == 0) {
+                break;
+            }
+            output->append(reinterpret_cast<char*>(buf), bytes_read);
+        }
+        return Status::OK();
+    }
+
+    std::unique_ptr<ThreadPool> _pool;
+    RuntimeProfile _profile {"DecompressPipelineTest"};
+    RuntimeProfile::Counter* _bytes_read = nullptr;
+    RuntimeProfile::Counter* _bytes_decompressed = nullptr;
+    RuntimeProfile::Counter* _decompress_timer = nullptr;
+    std::string _test_dir = "./ut_dir/decompress_pipeline_test";
+};
+
+TEST_F(DecompressPipelineTest, ReadAll) {
+    std::string content;
+    for (int i = 0; i < 100000; ++i) {
+        content += std::to_string(i * 7919) + "," + std::to_string(i) + "\n";
+    }
+    std::string path = write_compressed("data.gz", content);
+
+    std::string output;
+    ASSERT_TRUE(read_all(path, &output).ok());
+    ASSERT_EQ(output.size(), content.size());
+    ASSERT_EQ(output, content);
+    ASSERT_EQ(_bytes_decompressed->value(), static_cast<int64_t>(content.size()));
+}
+
+TEST_F(DecompressPipelineTest, TruncatedFile) {
+    std::string content(100000, 'a');
+    std::string path = write_compressed("truncated.gz", content, 8);
+
+    std::string output;
+    Status st = read_all(path, &output);
+    ASSERT_FALSE(st.ok());
+    ASSERT_LT(output.size(), content.size());
+}
+
+TEST_F(DecompressPipelineTest, CloseBeforeEnd) {
+    std::string content(1000000, 'b');
+    std::string path = write_compressed("close.gz", content);
+
+    io::FileReaderSPtr file_reader;
+    ASSERT_TRUE(io::global_local_filesystem()->open_file(path, &file_reader).ok());
+    std::unique_ptr<Decompressor> decompressor;
+    ASSERT_TRUE(Decompressor::create_decompressor(CompressType::GZIP, &decompressor).ok());
+    DecompressPipeline pipeline(file_reader, decompressor.get(), 0, nullptr, 1000, 2, _bytes_read,
+                                _bytes_decompressed, _decompress_timer);
+    ASSERT_TRUE(pipeline.start(_pool.get()).ok());
+    uint8_t buf[100];
+    size_t bytes_read = 0;
+    ASSERT_TRUE(pipeline.read(buf, sizeof(buf), &bytes_read).ok());
+    ASSERT_EQ(bytes_read, sizeof(buf));
+    // must return although the worker is blocked on a full ring
+    pipeline.close();
+}
+
+} // namespace doris
@@ -132,4 +132,41 @@ TEST_F(HeapSorterTest, test_topn_sorter1) {
     }
 }
 
+TEST_F(HeapSorterTest, test_shared_threshold) {
+    auto threshold = HeapSortThreshold::create_shared();
+    auto sorter1 = HeapSorter::create_unique(sort_exec_exprs, 3, 0, &pool, is_asc_order,
+                                             nulls_first, *row_desc);
+    auto sorter2 = HeapSorter::create_unique(sort_exec_exprs, 3, 0, &pool, is_asc_order,
+                                             nulls_first, *row_desc);
+    RuntimeProfile profile1 {"sorter1"};
+    RuntimeProfile profile2 {"sorter2"};
+    sorter1->init_profile(&profile1);
+    sorter2->init_profile(&profile2);
+    sorter1->set_threshold(threshold);
+    sorter2->set_threshold(threshold);
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({5, 1, 3, 7});
+        EXPECT_TRUE(sorter1->append_block(&block).ok());
+        auto columns = threshold->get();
+        ASSERT_EQ(columns.size(), 1);
+        EXPECT_EQ(columns[0]->get_int(0), 5);
+    }
+
+    {
+        // 6 and 9 go after the full heap of sorter1
+        Block block = ColumnHelper::create_block<DataTypeInt64>({6, 5, 2, 9});
+        EXPECT_TRUE(sorter2->append_block(&block).ok());
+        EXPECT_EQ(sorter2->_queue_row_num, 2);
+        EXPECT_EQ(sorter2->_pruned_rows_counter->value(), 2);
+    }
+
+    EXPECT_TRUE(sorter2->prepare_for_read());
+    Block block;
+    bool eos = false;
+    EXPECT_TRUE(sorter2->get_next(&_state, &block, &eos));
+    EXPECT_TRUE(ColumnHelper::block_equal(
+            block, ColumnHelper::create_block<DataTypeInt64>({2, 5})));
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -78,6 +78,35 @@ TEST(TEST_VEXPR, ABSTEST) {
     ASSERT_TRUE(state.ok());
 }
 
+TEST(TEST_VEXPR, FIND_EQUAL_EXPRS) {
+    doris::ObjectPool object_pool;
+    doris::DescriptorTblBuilder builder(&object_pool);
+    builder.declare_tuple() << doris::vectorized::DataTypeFactory::instance().create_data_type(
+                                       doris::TYPE_INT, false)
+                            << doris::vectorized::DataTypeFactory::instance().create_data_type(
+                                       doris::TYPE_DOUBLE, false);
+    doris::DescriptorTbl* desc_tbl = builder.build();
+
+    auto tuple_desc = const_cast<doris::TupleDescriptor*>(desc_tbl->get_tuple_descriptor(0));
+    doris::RowDescriptor row_desc(tuple_desc, false);
+    std::string expr_json =
+            R"|({"1":{"lst":["rec",2,{"1":{"i32":20},"2":{"rec":{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":6}}}}]}}},"4":{"i32":1},"20":{"i32":-1},"26":{"rec":{"1":{"rec":{"2":{"str":"abs"}}},"2":{"i32":0},"3":{"lst":["rec",1,{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":5}}}}]}}]},"4":{"rec":{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":6}}}}]}}},"5":{"tf":0},"7":{"str":"abs(INT)"},"9":{"rec":{"1":{"str":"_ZN5doris13MathFunctions3absEPN9doris_udf15FunctionContextERKNS1_6IntValE"}}},"11":{"i64":0}}}},{"1":{"i32":16},"2":{"rec":{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":5}}}}]}}},"4":{"i32":0},"15":{"rec":{"1":{"i32":0},"2":{"i32":0}}},"20":{"i32":-1},"23":{"i32":-1}}]}})|";
+    doris::TExpr exprx = apache::thrift::from_json_string<doris::TExpr>(expr_json);
+    doris::RuntimeState runtime_stat;
+    runtime_stat.set_desc_tbl(desc_tbl);
+    doris::vectorized::VExprContextSPtrs contexts(2);
+    for (auto& context : contexts) {
+        ASSERT_TRUE(doris::vectorized::VExpr::create_expr_tree(exprx, context).ok());
+        ASSERT_TRUE(context->prepare(&runtime_stat, row_desc).ok());
+        ASSERT_TRUE(context->open(&runtime_stat).ok());
+    }
+    // the second abs() is computed by the first one
+    auto equal_exprs = doris::vectorized::VExprContext::find_equal_exprs(contexts);
+    ASSERT_EQ(equal_exprs.size(), 2);
+    EXPECT_EQ(equal_exprs[0], -1);
+    EXPECT_EQ(equal_exprs[1], 0);
+}
+
 // Only the unit test depend on this, but it is wrong, should not use TTupleDesc to create tuple desc, not
 // use columndesc
 static doris::TupleDescriptor* create_tuple_desc(
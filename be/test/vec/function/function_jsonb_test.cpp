@@ -327,6 +327,40 @@ TEST(FunctionJsonbTEST, JsonbExtractTest) {
     static_cast<void>(check_function<DataTypeJsonb, true>(func_name, input_types, data_set));
 }
 
+TEST(FunctionJsonbTEST, JsonbExtractConstPathsTest) {
+    std::string func_name = "jsonb_extract";
+    InputTypeSet input_types = {PrimitiveType::TYPE_JSONB, Consted {PrimitiveType::TYPE_VARCHAR},
+                                Consted {PrimitiveType::TYPE_VARCHAR},
+                                Consted {PrimitiveType::TYPE_VARCHAR}};
+
+    // the paths share the prefix `$.k1`, so the document is navigated once for all of them
+    DataSet data_set = {
+            {{Null(), STRING("$.k1.a"), STRING("$.k1.b"), STRING("$.k2[1]")}, Null()},
+            {{STRING(R"({"k1":{"a":1,"b":"x"},"k2":[3,4]})"), STRING("$.k1.a"), STRING("$.k1.b"),
+              STRING("$.k2[1]")},
+             STRING(R"([1,"x",4])")},
+            {{STRING(R"({"k1":{"b":"y"},"k2":[5]})"), STRING("$.k1.a"), STRING("$.k1.b"),
+              STRING("$.k2[1]")},
+             STRING(R"(["y"])")},
+            {{STRING(R"({"k1":2,"k2":[6,7]})"), STRING("$.k1.a"), STRING("$.k1.b"),
+              STRING("$.k2[1]")},
+             STRING("[7]")},
+            {{STRING(R"({"k3":1})"), STRING("$.k1.a"), STRING("$.k1.b"), STRING("$.k2[1]")},
+             Null()},
+    };
+
+    static_cast<void>(check_function<DataTypeJsonb, true>(func_name, input_types, data_set));
+
+    // wildcard paths still go through the generic lookup
+    data_set = {
+            {{STRING(R"({"k1":{"a":1,"b":2},"k2":[3,4]})"), STRING("$.k1.*"), STRING("$.k2[*]"),
+              STRING("$.k1.a")},
+             STRING("[1,2,3,4,1]")},
+    };
+
+    static_cast<void>(check_function<DataTypeJsonb, true>(func_name, input_types, data_set));
+}
+
 TEST(FunctionJsonbTEST, JsonbCastToOtherTest) {
     std::string func_name = "CAST";
     InputTypeSet input_types = {Nullable {PrimitiveType::TYPE_JSONB},
@@ -15,8 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <hs/hs_runtime.h>
+
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "function_test_util.h"
 #include "gtest/gtest_pred_impl.h"
@@ -25,6 +28,7 @@
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
+#include "vec/functions/like.h"
 
 namespace doris::vectorized {
 
@@ -307,4 +311,43 @@ TEST(FunctionLikeTest, regexp_replace_one) {
     }
 }
 
+TEST(FunctionLikeTest, multi_pattern) {
+    std::vector<std::string> patterns;
+    for (const auto* like_pattern : {"%error%", "warn%", "%.log"}) {
+        std::string re_pattern;
+        FunctionLike::convert_like_pattern(nullptr, like_pattern, &re_pattern);
+        patterns.push_back(re_pattern);
+    }
+    patterns.emplace_back("^[0-9]+$");
+
+    hs_database_t* database = nullptr;
+    ASSERT_TRUE(FunctionLikeBase::hs_prepare_multi(patterns, &database).ok());
+    hs_scratch_t* scratch = nullptr;
+    ASSERT_EQ(hs_alloc_scratch(database, &scratch), HS_SUCCESS);
+
+    auto match = [&](const std::string& str) {
+        unsigned char matched = 0;
+        auto ret = hs_scan(database, str.data(), static_cast<unsigned int>(str.size()), 0, scratch,
+                           LikeSearchState::hs_match_handler, &matched);
+        EXPECT_TRUE(ret == HS_SUCCESS || ret == HS_SCAN_TERMINATED);
+        return matched;
+    };
+    EXPECT_EQ(match("an error occurred"), 1);
+    EXPECT_EQ(match("warning: disk"), 1);
+    EXPECT_EQ(match("be.log"), 1);
+    EXPECT_EQ(match("12345"), 1);
+    EXPECT_EQ(match("be.logs"), 0);
+    EXPECT_EQ(match("a warning"), 0);
+    EXPECT_EQ(match("12a45"), 0);
+    EXPECT_EQ(match(""), 0);
+
+    hs_free_scratch(scratch);
+    hs_free_database(database);
+
+    std::vector<std::string> invalid_patterns = {"abc", "(unclosed"};
+    database = nullptr;
+    EXPECT_FALSE(FunctionLikeBase::hs_prepare_multi(invalid_patterns, &database).ok());
+    EXPECT_EQ(database, nullptr);
+}
+
 } // namespace doris::vectorized
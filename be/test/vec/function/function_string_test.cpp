@@ -1014,6 +1014,16 @@ TEST(function_string_test, function_char_length_test) {
     };
 
     check_function_all_arg_comb<DataTypeInt32, true>(func_name, input_types, data_set);
+
+    // all ascii
+    data_set = {
+            {{std::string("__123hehe1")}, std::int32_t(10)},
+            {{std::string("")}, std::int32_t(0)},
+            {{Null()}, Null()},
+            {{std::string("123321!@#@$!@%!@#!@$!@")}, std::int32_t(22)},
+    };
+
+    check_function_all_arg_comb<DataTypeInt32, true>(func_name, input_types, data_set);
 }
 
 TEST(function_string_test, function_concat_test) {
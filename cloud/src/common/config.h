@@ -168,6 +168,11 @@ CONF_String(encryption_method, "AES_256_ECB");
 
 // Temporary configs for upgrade
 CONF_mBool(write_schema_kv, "true");
+// Max number of schemas read by get_rowset kept in memory, 0 to disable
+CONF_mInt64(schema_cache_capacity, "10000");
+// Max number of schemas read from schema kvs kept in memory, 0 to disable. A schema kv is never
+// modified once written, so the cached ones never need invalidation.
+CONF_mInt64(schema_cache_capacity, "10000");
 CONF_mBool(split_tablet_stats, "true");
 CONF_mBool(snapshot_get_tablet_stats, "true");
 
@@ -263,6 +268,9 @@ CONF_mInt64(max_s3_client_retry, "10");
 
 // Max byte getting delete bitmap can return, default is 1GB
 CONF_mInt64(max_get_delete_bitmap_byte, "1073741824");
+// get_delete_bitmap reads the whole delete bitmap range of a tablet in one scan, instead of one
+// range per rowset, when all versions of at least this many rowsets are requested. 0 disables it.
+CONF_mInt64(get_delete_bitmap_tablet_scan_threshold, "16");
 // retry configs of remove_delete_bitmap_update_lock txn_conflict
 CONF_Bool(delete_bitmap_enable_retry_txn_conflict, "true");
 
@@ -277,6 +285,9 @@ CONF_mInt64(max_txn_commit_byte, "7340032");
 
 CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
+// Queue the commits of a single partition in this process instead of letting them conflict on
+// the partition version key in fdb.
+CONF_mBool(enable_commit_txn_partition_lock, "true");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
 CONF_Int32(txn_lazy_max_rowsets_per_batch, "1000");
 // max TabletIndexPB num for batch get
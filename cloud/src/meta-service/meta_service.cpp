@@ -1673,11 +1673,15 @@ std::vector<std::pair<int64_t, int64_t>> calc_sync_versions(int64_t req_bc_cnt,
     return versions;
 }
 
-static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rowset_meta,
-                                       const std::string& key, MetaServiceCode& code,
-                                       std::string& msg) {
-    ValueBuf val_buf;
-    TxnErrorCode err = cloud::blob_get(txn, key, &val_buf);
+static bool try_fetch_and_parse_schema(Transaction* txn, SchemaCache& schema_cache,
+                                       RowsetMetaCloudPB& rowset_meta, const std::string& key,
+                                       MetaServiceCode& code, std::string& msg) {
+    TxnErrorCode err = schema_cache.get(txn, key, rowset_meta.mutable_tablet_schema());
+    if (err == TxnErrorCode::TXN_INVALID_DATA) {
+        code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+        msg = fmt::format("malformed schema value, key={}", key);
+        return false;
+    }
     if (err != TxnErrorCode::TXN_OK) {
         code = cast_as<ErrCategory::READ>(err);
         msg = fmt::format("failed to get schema, schema_version={}, rowset_version=[{}-{}]: {}",
@@ -1685,12 +1689,6 @@ static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rows
                           rowset_meta.end_version(), err);
         return false;
     }
-    auto schema = rowset_meta.mutable_tablet_schema();
-    if (!parse_schema_value(val_buf, schema)) {
-        code = MetaServiceCode::PROTOBUF_PARSE_ERR;
-        msg = fmt::format("malformed schema value, key={}", key);
-        return false;
-    }
     return true;
 }
 
@@ -1869,7 +1867,8 @@ void MetaServiceImpl::get_rowset(::google::protobuf::RpcController* controller,
             } else {
                 auto key = meta_schema_key(
                         {instance_id, idx.index_id(), rowset_meta.schema_version()});
-                if (!try_fetch_and_parse_schema(txn.get(), rowset_meta, key, code, msg)) {
+                if (!try_fetch_and_parse_schema(txn.get(), schema_cache_, rowset_meta, key, code,
+                                                msg)) {
                     return;
                 }
                 version_to_schema.emplace(rowset_meta.schema_version(),
@@ -2581,36 +2580,30 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
     bool test = false;
     TEST_SYNC_POINT_CALLBACK("get_delete_bitmap_test", &test);
 
-    for (size_t i = 0; i < rowset_ids.size(); i++) {
+    // Reads the delete bitmap kvs in [start_key, end_key) and adds those accepted by `filter`
+    // to the response. Returns false with `code` and `msg` set on failure.
+    auto read_delete_bitmap =
+            [&](std::string start_key, const std::string& end_key,
+                const std::function<bool(const std::string& rowset_id, int64_t ver)>& filter,
+                int64_t* round) -> bool {
         // create a new transaction every time, avoid using one transaction that takes too long
         std::unique_ptr<Transaction> txn;
         TxnErrorCode err = txn_kv_->create_txn(&txn);
         if (err != TxnErrorCode::TXN_OK) {
             code = cast_as<ErrCategory::CREATE>(err);
             msg = "failed to init txn";
-            return;
+            return false;
         }
         DORIS_CLOUD_DEFER {
             if (txn == nullptr) return;
             stats.get_bytes += txn->get_bytes();
             stats.get_counter += txn->num_get_keys();
         };
-        MetaDeleteBitmapInfo start_key_info {instance_id, tablet_id, rowset_ids[i],
-                                             begin_versions[i], 0};
-        MetaDeleteBitmapInfo end_key_info {instance_id, tablet_id, rowset_ids[i], end_versions[i],
-                                           INT64_MAX};
-        std::string start_key;
-        std::string end_key;
-        meta_delete_bitmap_key(start_key_info, &start_key);
-        meta_delete_bitmap_key(end_key_info, &end_key);
-
-        // in order to get splitted large value
-        encode_int64(INT64_MAX, &end_key);
 
         std::unique_ptr<RangeGetIterator> it;
+        std::string last_rowset_id;
         int64_t last_ver = -1;
         int64_t last_seg_id = -1;
-        int64_t round = 0;
         do {
             if (test) {
                 LOG(INFO) << "test";
@@ -2618,7 +2611,7 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
             } else {
                 err = txn->get(start_key, end_key, &it);
             }
-            TEST_SYNC_POINT_CALLBACK("get_delete_bitmap_err", &round, &err);
+            TEST_SYNC_POINT_CALLBACK("get_delete_bitmap_err", round, &err);
             int64_t retry = 0;
             while (err == TxnErrorCode::TXN_TOO_OLD && retry < 3) {
                 stats.get_bytes += txn->get_bytes();
@@ -2627,9 +2620,9 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
                 err = txn_kv_->create_txn(&txn);
                 if (err != TxnErrorCode::TXN_OK) {
                     code = cast_as<ErrCategory::CREATE>(err);
-                    ss << "failed to init txn, retry=" << retry << ", internal round=" << round;
+                    ss << "failed to init txn, retry=" << retry << ", internal round=" << *round;
                     msg = ss.str();
-                    return;
+                    return false;
                 }
                 if (test) {
                     err = txn->get(start_key, end_key, &it, false, 2);
@@ -2638,17 +2631,17 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
                 }
                 retry++;
                 LOG(INFO) << "retry get delete bitmap, tablet=" << tablet_id << ", retry=" << retry
-                          << ", internal round=" << round
+                          << ", internal round=" << *round
                           << ", delete_bitmap_num=" << delete_bitmap_num
                           << ", delete_bitmap_byte=" << delete_bitmap_byte;
             }
             if (err != TxnErrorCode::TXN_OK) {
                 code = cast_as<ErrCategory::READ>(err);
-                ss << "internal error, failed to get delete bitmap, internal round=" << round
+                ss << "internal error, failed to get delete bitmap, internal round=" << *round
                    << ", ret=" << err;
                 msg = ss.str();
                 g_bvar_get_delete_bitmap_fail_counter << 1;
-                return;
+                return false;
             }
 
             while (it->has_next()) {
@@ -2659,16 +2652,21 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
                 decode_key(&k1, &out);
                 // 0x01 "meta" ${instance_id}  "delete_bitmap" ${tablet_id}
                 // ${rowset_id0} ${version1} ${segment_id0} -> DeleteBitmapPB
+                const auto& rowset_id = std::get<std::string>(std::get<0>(out[4]));
                 auto ver = std::get<int64_t>(std::get<0>(out[5]));
                 auto seg_id = std::get<int64_t>(std::get<0>(out[6]));
+                if (!filter(rowset_id, ver)) {
+                    continue;
+                }
 
                 // FIXME: Don't expose the implementation details of splitting large value.
                 // merge splitted large values (>90*1000)
-                if (ver != last_ver || seg_id != last_seg_id) {
-                    response->add_rowset_ids(rowset_ids[i]);
+                if (ver != last_ver || seg_id != last_seg_id || rowset_id != last_rowset_id) {
+                    response->add_rowset_ids(rowset_id);
                     response->add_segment_ids(seg_id);
                     response->add_versions(ver);
                     response->add_segment_delete_bitmaps(std::string(v));
+                    last_rowset_id = rowset_id;
                     last_ver = ver;
                     last_seg_id = seg_id;
                     delete_bitmap_num++;
@@ -2677,9 +2675,9 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
                     TEST_SYNC_POINT_CALLBACK("get_delete_bitmap_code", &code);
                     if (code != MetaServiceCode::OK) {
                         ss << "test get get_delete_bitmap fail, code=" << MetaServiceCode_Name(code)
-                           << ", internal round=" << round;
+                           << ", internal round=" << *round;
                         msg = ss.str();
-                        return;
+                        return false;
                     }
                     delete_bitmap_byte += v.length();
                     response->mutable_segment_delete_bitmaps()->rbegin()->append(v);
@@ -2692,11 +2690,68 @@ void MetaServiceImpl::get_delete_bitmap(google::protobuf::RpcController* control
                 msg = ss.str();
                 LOG(WARNING) << msg;
                 g_bvar_get_delete_bitmap_fail_counter << 1;
-                return;
+                return false;
             }
-            round++;
+            (*round)++;
             start_key = it->next_begin_key(); // Update to next smallest key for iteration
         } while (it->more());
+        return true;
+    };
+
+    // A cold BE asks for all versions of every rowset of the tablet, which took one range read
+    // per rowset. The keys are ordered by rowset, so read the tablet's whole delete bitmap range
+    // once instead and skip the rowsets that are not requested.
+    bool read_whole_tablet =
+            config::get_delete_bitmap_tablet_scan_threshold > 0 &&
+            rowset_ids.size() >= config::get_delete_bitmap_tablet_scan_threshold &&
+            std::all_of(begin_versions.begin(), begin_versions.end(),
+                        [](int64_t ver) { return ver <= 0; });
+    if (read_whole_tablet) {
+        std::unordered_map<std::string, int64_t> end_version_of_rowset;
+        for (size_t i = 0; i < rowset_ids.size(); i++) {
+            auto [iter, inserted] = end_version_of_rowset.emplace(rowset_ids[i], end_versions[i]);
+            if (!inserted) {
+                iter->second = std::max(iter->second, end_versions[i]);
+            }
+        }
+        std::string start_key = meta_delete_bitmap_key({instance_id, tablet_id, "", 0, 0});
+        std::string end_key = meta_delete_bitmap_key({instance_id, tablet_id + 1, "", 0, 0});
+        int64_t round = 0;
+        if (!read_delete_bitmap(
+                    std::move(start_key), end_key,
+                    [&](const std::string& rowset_id, int64_t ver) {
+                        auto iter = end_version_of_rowset.find(rowset_id);
+                        return iter != end_version_of_rowset.end() && ver <= iter->second;
+                    },
+                    &round)) {
+            return;
+        }
+        LOG(INFO) << "get delete bitmap for tablet=" << tablet_id
+                  << ", num_rowsets=" << rowset_ids.size() << ", internal round=" << round
+                  << ", delete_bitmap_num=" << delete_bitmap_num
+                  << ", delete_bitmap_byte=" << delete_bitmap_byte;
+    }
+
+    for (size_t i = 0; !read_whole_tablet && i < rowset_ids.size(); i++) {
+        MetaDeleteBitmapInfo start_key_info {instance_id, tablet_id, rowset_ids[i],
+                                             begin_versions[i], 0};
+        MetaDeleteBitmapInfo end_key_info {instance_id, tablet_id, rowset_ids[i], end_versions[i],
+                                           INT64_MAX};
+        std::string start_key;
+        std::string end_key;
+        meta_delete_bitmap_key(start_key_info, &start_key);
+        meta_delete_bitmap_key(end_key_info, &end_key);
+
+        // in order to get splitted large value
+        encode_int64(INT64_MAX, &end_key);
+
+        int64_t round = 0;
+        if (!read_delete_bitmap(
+                    std::move(start_key), end_key,
+                    [](const std::string& /* rowset_id */, int64_t /* ver */) { return true; },
+                    &round)) {
+            return;
+        }
         LOG(INFO) << "get delete bitmap for tablet=" << tablet_id << ", rowset=" << rowset_ids[i]
                   << ", start version=" << begin_versions[i] << ", end version=" << end_versions[i]
                   << ", internal round=" << round << ", delete_bitmap_num=" << delete_bitmap_num
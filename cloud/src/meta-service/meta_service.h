@@ -31,6 +31,7 @@
 #include "common/stats.h"
 #include "cpp/sync_point.h"
 #include "meta-service/delete_bitmap_lock_white_list.h"
+#include "meta-service/meta_service_schema.h"
 #include "meta-service/txn_lazy_committer.h"
 #include "meta-store/txn_kv.h"
 #include "rate-limiter/rate_limiter.h"
@@ -406,6 +407,8 @@ private:
     std::shared_ptr<RateLimiter> rate_limiter_;
     std::shared_ptr<TxnLazyCommitter> txn_lazy_committer_;
     std::shared_ptr<DeleteBitmapLockWhiteList> delete_bitmap_lock_white_list_;
+    // schemas referenced by the rowsets returned by get_rowset
+    SchemaCache schema_cache_;
 };
 
 class MetaServiceProxy final : public MetaService {
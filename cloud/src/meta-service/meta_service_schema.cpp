@@ -131,6 +131,40 @@ bool parse_schema_value(const ValueBuf& buf, doris::TabletSchemaCloudPB* schema)
     // TODO(plat1ko): Apply decompression based on value version
     return buf.to_pb(schema);
 }
+
+TxnErrorCode SchemaCache::get(Transaction* txn, const std::string& schema_key,
+                              doris::TabletSchemaCloudPB* schema) {
+    {
+        std::lock_guard lock(mutex_);
+        if (auto it = schemas_.find(schema_key); it != schemas_.end()) {
+            schema->CopyFrom(*it->second);
+            return TxnErrorCode::TXN_OK;
+        }
+    }
+
+    ValueBuf val_buf;
+    TxnErrorCode err = cloud::blob_get(txn, schema_key, &val_buf);
+    if (err != TxnErrorCode::TXN_OK) {
+        return err;
+    }
+    auto parsed_schema = std::make_shared<doris::TabletSchemaCloudPB>();
+    if (!parse_schema_value(val_buf, parsed_schema.get())) {
+        return TxnErrorCode::TXN_INVALID_DATA;
+    }
+    schema->CopyFrom(*parsed_schema);
+
+    int64_t capacity = config::schema_cache_capacity;
+    std::lock_guard lock(mutex_);
+    if (capacity <= 0) {
+        schemas_.clear();
+        return TxnErrorCode::TXN_OK;
+    }
+    while (!schemas_.empty() && static_cast<int64_t>(schemas_.size()) >= capacity) {
+        schemas_.erase(schemas_.begin());
+    }
+    schemas_.emplace(schema_key, std::move(parsed_schema));
+    return TxnErrorCode::TXN_OK;
+}
 /**
  * Processes dictionary items, mapping them to a dictionary key and adding the key to rowset meta.
  * If it's a new item, generates a new key and increments the item ID. This function is also responsible
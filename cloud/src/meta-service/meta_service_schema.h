@@ -20,6 +20,13 @@
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "meta-store/txn_kv_error.h"
+
 namespace doris::cloud {
 class Transaction;
 struct ValueBuf;
@@ -30,6 +37,21 @@ void put_schema_kv(MetaServiceCode& code, std::string& msg, Transaction* txn,
 // Return true if parse success
 [[nodiscard]] bool parse_schema_value(const ValueBuf& buf, doris::TabletSchemaCloudPB* schema);
 
+// Caches the schemas read from the schema kvs, which are written once by put_schema_kv and never
+// modified, so a cached schema never needs invalidation. At most `config::schema_cache_capacity`
+// schemas are kept.
+class SchemaCache {
+public:
+    // Get the schema of `schema_key` from the cache, or from the kv and cache it.
+    // Return TXN_INVALID_DATA if the value in the kv is malformed.
+    TxnErrorCode get(Transaction* txn, const std::string& schema_key,
+                     doris::TabletSchemaCloudPB* schema);
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const doris::TabletSchemaCloudPB>> schemas_;
+};
+
 // Writes schema dictionary metadata to RowsetMetaCloudPB
 void write_schema_dict(MetaServiceCode& code, std::string& msg, const std::string& instance_id,
                        Transaction* txn, RowsetMetaCloudPB* rowset_meta);
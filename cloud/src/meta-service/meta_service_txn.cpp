@@ -15,11 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <bthread/mutex.h>
 #include <gen_cpp/cloud.pb.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <limits>
+#include <mutex>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -2574,6 +2579,16 @@ static bool force_txn_lazy_commit() {
     return false;
 }
 
+// Commits of the same partition read and write its partition version key, so concurrent commits
+// conflict in fdb and all but one of them retry after a backoff. The lock returned here queues
+// the single partition commits of this process instead, so they run back to back.
+static bthread::Mutex& partition_commit_lock(const std::string& instance_id, int64_t partition_id) {
+    static constexpr size_t NUM_PARTITION_COMMIT_LOCKS = 1024;
+    static std::array<bthread::Mutex, NUM_PARTITION_COMMIT_LOCKS> locks;
+    size_t hash = std::hash<std::string> {}(instance_id) * 31 + std::hash<int64_t> {}(partition_id);
+    return locks[hash % NUM_PARTITION_COMMIT_LOCKS];
+}
+
 void MetaServiceImpl::commit_txn(::google::protobuf::RpcController* controller,
                                  const CommitTxnRequest* request, CommitTxnResponse* response,
                                  ::google::protobuf::Closure* done) {
@@ -2613,6 +2628,16 @@ void MetaServiceImpl::commit_txn(::google::protobuf::RpcController* controller,
             (request->has_is_2pc() && !request->is_2pc() && request->has_enable_txn_lazy_commit() &&
              request->enable_txn_lazy_commit() && config::enable_cloud_txn_lazy_commit);
 
+    std::unique_lock<bthread::Mutex> partition_lock;
+    if (config::enable_commit_txn_partition_lock && !tmp_rowsets_meta.empty() &&
+        tmp_rowsets_meta.size() <= config::txn_lazy_commit_rowsets_thresold &&
+        std::all_of(tmp_rowsets_meta.begin(), tmp_rowsets_meta.end(), [&](const auto& rs) {
+            return rs.second.partition_id() == tmp_rowsets_meta[0].second.partition_id();
+        })) {
+        partition_lock = std::unique_lock(
+                partition_commit_lock(instance_id, tmp_rowsets_meta[0].second.partition_id()));
+    }
+
     while ((!enable_txn_lazy_commit_feature ||
             (tmp_rowsets_meta.size() <= config::txn_lazy_commit_rowsets_thresold))) {
         if (force_txn_lazy_commit()) {
@@ -2646,6 +2671,9 @@ void MetaServiceImpl::commit_txn(::google::protobuf::RpcController* controller,
         break;
     }
 
+    if (partition_lock.owns_lock()) {
+        partition_lock.unlock();
+    }
     LOG(INFO) << "txn_id=" << txn_id << " commit_txn_eventually"
               << " tmp_rowsets_meta.size=" << tmp_rowsets_meta.size();
     code = MetaServiceCode::OK;
@@ -25,6 +25,7 @@
 #include <atomic>
 #include <bit>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <string>
@@ -684,48 +685,52 @@ TxnErrorCode Transaction::batch_get(std::vector<std::optional<std::string>>* res
     size_t num_keys = keys.size();
     res->reserve(keys.size());
     g_bvar_txn_kv_get_count_normalized << keys.size();
-    std::vector<std::unique_ptr<FDBFuture, FDBFutureDelete>> futures;
-    futures.reserve(opts.concurrency);
-    for (size_t i = 0; i < num_keys; i += opts.concurrency) {
-        size_t size = std::min(i + opts.concurrency, num_keys);
-        for (size_t j = i; j < size; j++) {
-            const auto& k = keys[j];
+    // Keep `opts.concurrency` gets in flight, the next one is issued as soon as the oldest one is
+    // consumed rather than after the whole batch is.
+    std::deque<std::unique_ptr<FDBFuture, FDBFutureDelete>> futures;
+    size_t num_issued = 0;
+    auto issue_gets = [&](size_t num_in_flight) {
+        for (; num_issued < num_keys && futures.size() < num_in_flight; ++num_issued) {
+            const auto& k = keys[num_issued];
             futures.emplace_back(
                     fdb_transaction_get(txn_, (uint8_t*)k.data(), k.size(), opts.snapshot));
             approximate_bytes_ += k.size() * 2;
         }
-
-        size_t num_futures = futures.size();
-        for (auto j = 0; j < num_futures; j++) {
-            FDBFuture* future = futures[j].get();
-            std::string_view key = keys[i + j];
-            RETURN_IF_ERROR(await_future(future));
-            fdb_error_t err = fdb_future_get_error(future);
-            if (err) {
-                LOG(WARNING) << __PRETTY_FUNCTION__
-                             << " failed to fdb_future_get_error err=" << fdb_get_error(err)
-                             << " key=" << hex(key);
-                return cast_as_txn_code(err);
-            }
-            fdb_bool_t found;
-            const uint8_t* ret;
-            int len;
-            err = fdb_future_get_value(future, &found, &ret, &len);
-            num_get_keys_++;
-            if (err) {
-                LOG(WARNING) << __PRETTY_FUNCTION__
-                             << " failed to fdb_future_get_value err=" << fdb_get_error(err)
-                             << " key=" << hex(key);
-                return cast_as_txn_code(err);
-            }
-            if (!found) {
-                res->push_back(std::nullopt);
-                continue;
-            }
-            get_bytes_ += len + key.size();
-            res->push_back(std::string((char*)ret, len));
+    };
+    const size_t concurrency = std::max<size_t>(opts.concurrency, 1);
+    issue_gets(concurrency);
+    for (size_t i = 0; i < num_keys; ++i) {
+        std::unique_ptr<FDBFuture, FDBFutureDelete> future_holder = std::move(futures.front());
+        futures.pop_front();
+        issue_gets(concurrency);
+
+        FDBFuture* future = future_holder.get();
+        std::string_view key = keys[i];
+        RETURN_IF_ERROR(await_future(future));
+        fdb_error_t err = fdb_future_get_error(future);
+        if (err) {
+            LOG(WARNING) << __PRETTY_FUNCTION__
+                         << " failed to fdb_future_get_error err=" << fdb_get_error(err)
+                         << " key=" << hex(key);
+            return cast_as_txn_code(err);
+        }
+        fdb_bool_t found;
+        const uint8_t* ret;
+        int len;
+        err = fdb_future_get_value(future, &found, &ret, &len);
+        num_get_keys_++;
+        if (err) {
+            LOG(WARNING) << __PRETTY_FUNCTION__
+                         << " failed to fdb_future_get_value err=" << fdb_get_error(err)
+                         << " key=" << hex(key);
+            return cast_as_txn_code(err);
+        }
+        if (!found) {
+            res->push_back(std::nullopt);
+            continue;
         }
-        futures.clear();
+        get_bytes_ += len + key.size();
+        res->push_back(std::string((char*)ret, len));
     }
     DCHECK_EQ(res->size(), num_keys);
     return TxnErrorCode::TXN_OK;
@@ -34,6 +34,7 @@
 #include "cpp/s3_rate_limiter.h"
 #include "cpp/sync_point.h"
 #include "recycler/s3_accessor.h"
+#include "recycler/sync_executor.h"
 #include "recycler/util.h"
 
 namespace doris::cloud {
@@ -220,15 +221,14 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
         return {0};
     }
 
-    Aws::S3::Model::DeleteObjectsRequest delete_request;
-    delete_request.SetBucket(bucket);
-
-    auto issue_delete = [&bucket, &delete_request,
+    auto issue_delete = [&bucket,
                          this](std::vector<Aws::S3::Model::ObjectIdentifier> objects) -> int {
         if (objects.size() == 1) {
             return delete_object({.bucket = bucket, .key = objects[0].GetKey()}).ret;
         }
 
+        Aws::S3::Model::DeleteObjectsRequest delete_request;
+        delete_request.SetBucket(bucket);
         Aws::S3::Model::Delete del;
         del.WithObjects(std::move(objects)).SetQuiet(true);
         delete_request.SetDelete(std::move(del));
@@ -247,45 +247,54 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
             return -1;
         }
 
-        if (!delete_outcome.IsSuccess()) {
-            LOG_WARNING("failed to delete objects")
-                    .tag("endpoint", endpoint_)
-                    .tag("bucket", bucket)
-                    .tag("key[0]", delete_request.GetDelete().GetObjects().front().GetKey())
-                    .tag("responseCode",
-                         static_cast<int>(delete_outcome.GetError().GetResponseCode()))
-                    .tag("error", delete_outcome.GetError().GetMessage());
-            return -1;
-        }
-
         return 0;
     };
 
-    int ret = 0;
     // `DeleteObjectsRequest` can only contain 1000 keys at most.
-    std::vector<Aws::S3::Model::ObjectIdentifier> objects;
-
     size_t delete_batch_size = MaxDeleteBatch;
     TEST_INJECTION_POINT_CALLBACK("S3ObjClient::delete_objects", &delete_batch_size);
 
     // std::views::chunk(1000)
+    std::vector<std::vector<Aws::S3::Model::ObjectIdentifier>> batches;
+    batches.reserve((keys.size() + delete_batch_size - 1) / delete_batch_size);
     for (auto&& key : keys) {
-        objects.emplace_back().SetKey(std::move(key));
-        if (objects.size() < delete_batch_size) {
-            continue;
+        if (batches.empty() || batches.back().size() >= delete_batch_size) {
+            batches.emplace_back().reserve(delete_batch_size);
         }
+        batches.back().emplace_back().SetKey(std::move(key));
+    }
 
-        ret = issue_delete(std::move(objects));
-        if (ret != 0) {
-            return {ret};
+    if (batches.size() == 1 || option.executor == nullptr) {
+        for (auto&& objects : batches) {
+            if (int ret = issue_delete(std::move(objects)); ret != 0) {
+                return {ret};
+            }
         }
+        return {0};
     }
 
-    if (!objects.empty()) {
-        ret = issue_delete(std::move(objects));
+    // Issue the batches concurrently, a large drop would otherwise send thousands of
+    // DeleteObjects requests one after another. The rate limiter still caps the request rate.
+    SyncExecutor<int> concurrent_delete_executor(
+            option.executor,
+            fmt::format("delete {} objects under bucket {}", keys.size(), bucket),
+            [](const int& ret) { return ret != 0; });
+    for (auto&& objects : batches) {
+        concurrent_delete_executor.add([&issue_delete, objs = std::move(objects)]() mutable {
+            return issue_delete(std::move(objs));
+        });
     }
-
-    return {ret};
+    bool finished = true;
+    std::vector<int> rets = concurrent_delete_executor.when_all(&finished);
+    if (!finished) {
+        return {-1};
+    }
+    for (int r : rets) {
+        if (r != 0) {
+            return {r};
+        }
+    }
+    return {0};
 }
 
 ObjectStorageResponse S3ObjClient::delete_object(ObjectStoragePathRef path) {
@@ -6923,6 +6923,76 @@ TEST(MetaServiceTest, GetDeleteBitmapWithRetryTest3) {
     SyncPoint::get_instance()->clear_all_call_backs();
 }
 
+TEST(MetaServiceTest, GetDeleteBitmapOfWholeTablet) {
+    auto meta_service = get_meta_service();
+    auto threshold = config::get_delete_bitmap_tablet_scan_threshold;
+    config::get_delete_bitmap_tablet_scan_threshold = 4;
+    DORIS_CLOUD_DEFER {
+        config::get_delete_bitmap_tablet_scan_threshold = threshold;
+    };
+
+    brpc::Controller cntl;
+    GetDeleteBitmapUpdateLockRequest get_lock_req;
+    GetDeleteBitmapUpdateLockResponse get_lock_res;
+    get_lock_req.set_cloud_unique_id("test_cloud_unique_id");
+    get_lock_req.set_table_id(110);
+    get_lock_req.add_partition_ids(123);
+    get_lock_req.set_expiration(5);
+    get_lock_req.set_lock_id(888);
+    get_lock_req.set_initiator(-1);
+    meta_service->get_delete_bitmap_update_lock(
+            reinterpret_cast<::google::protobuf::RpcController*>(&cntl), &get_lock_req,
+            &get_lock_res, nullptr);
+    ASSERT_EQ(get_lock_res.status().code(), MetaServiceCode::OK);
+
+    // rowset 1..8 have delete bitmaps of version 2 and 3, rowset 9 is not requested
+    UpdateDeleteBitmapRequest update_delete_bitmap_req;
+    UpdateDeleteBitmapResponse update_delete_bitmap_res;
+    update_delete_bitmap_req.set_cloud_unique_id("test_cloud_unique_id");
+    update_delete_bitmap_req.set_table_id(110);
+    update_delete_bitmap_req.set_partition_id(123);
+    update_delete_bitmap_req.set_lock_id(888);
+    update_delete_bitmap_req.set_initiator(-1);
+    update_delete_bitmap_req.set_tablet_id(334);
+    std::string large_value = generate_random_string(300 * 1000 * 3);
+    for (int rs = 1; rs <= 9; rs++) {
+        for (int ver = 2; ver <= 3; ver++) {
+            update_delete_bitmap_req.add_rowset_ids(std::to_string(rs));
+            update_delete_bitmap_req.add_segment_ids(0);
+            update_delete_bitmap_req.add_versions(ver);
+            update_delete_bitmap_req.add_segment_delete_bitmaps(rs == 5 ? large_value : "abc");
+        }
+    }
+    meta_service->update_delete_bitmap(reinterpret_cast<google::protobuf::RpcController*>(&cntl),
+                                       &update_delete_bitmap_req, &update_delete_bitmap_res,
+                                       nullptr);
+    ASSERT_EQ(update_delete_bitmap_res.status().code(), MetaServiceCode::OK);
+
+    GetDeleteBitmapRequest get_delete_bitmap_req;
+    GetDeleteBitmapResponse get_delete_bitmap_res;
+    get_delete_bitmap_req.set_cloud_unique_id("test_cloud_unique_id");
+    get_delete_bitmap_req.set_tablet_id(334);
+    for (int rs = 1; rs <= 8; rs++) {
+        get_delete_bitmap_req.add_rowset_ids(std::to_string(rs));
+        get_delete_bitmap_req.add_begin_versions(0);
+        // rowset 8 only asks for the versions up to 2
+        get_delete_bitmap_req.add_end_versions(rs == 8 ? 2 : 3);
+    }
+    meta_service->get_delete_bitmap(reinterpret_cast<google::protobuf::RpcController*>(&cntl),
+                                    &get_delete_bitmap_req, &get_delete_bitmap_res, nullptr);
+    ASSERT_EQ(get_delete_bitmap_res.status().code(), MetaServiceCode::OK);
+    ASSERT_EQ(get_delete_bitmap_res.rowset_ids_size(), 15);
+    ASSERT_EQ(get_delete_bitmap_res.segment_delete_bitmaps_size(), 15);
+    for (int i = 0; i < 15; i++) {
+        int rs = i / 2 + 1;
+        ASSERT_EQ(get_delete_bitmap_res.rowset_ids(i), std::to_string(rs));
+        ASSERT_EQ(get_delete_bitmap_res.segment_ids(i), 0);
+        ASSERT_EQ(get_delete_bitmap_res.versions(i), i % 2 + 2);
+        ASSERT_EQ(get_delete_bitmap_res.segment_delete_bitmaps(i),
+                  rs == 5 ? large_value : "abc");
+    }
+}
+
 TEST(MetaServiceTest, GetVersion) {
     auto service = get_meta_service();
 
@@ -697,6 +697,48 @@ TEST(SchemaKVTest, InsertExistedRowsetTest) {
     check_get_tablet(meta_service.get(), 10005, 2);
 }
 
+TEST(SchemaKVTest, SchemaCacheTest) {
+    auto meta_service = get_meta_service();
+
+    auto sp = SyncPoint::get_instance();
+    DORIS_CLOUD_DEFER {
+        SyncPoint::get_instance()->clear_all_call_backs();
+    };
+    sp->set_call_back("get_instance_id", [&](auto&& args) {
+        auto* ret = try_any_cast_ret<std::string>(args);
+        ret->first = instance_id;
+        ret->second = true;
+    });
+    sp->enable_processing();
+
+    constexpr auto table_id = 10021, index_id = 10022, partition_id = 10023, tablet_id = 10024;
+    config::write_schema_kv = true;
+    ASSERT_NO_FATAL_FAILURE(create_tablet(meta_service.get(), table_id, index_id, partition_id,
+                                          tablet_id, next_rowset_id(), 1));
+    {
+        GetRowsetResponse res;
+        ASSERT_NO_FATAL_FAILURE(
+                get_rowset(meta_service.get(), table_id, index_id, partition_id, tablet_id, res));
+        ASSERT_EQ(res.rowset_meta_size(), 1);
+        EXPECT_EQ(res.rowset_meta(0).tablet_schema().column_size(), 10);
+    }
+
+    // the schema read by the last get_rowset is cached, the schema kv is not read again
+    std::unique_ptr<Transaction> txn;
+    ASSERT_EQ(meta_service->txn_kv()->create_txn(&txn), TxnErrorCode::TXN_OK);
+    auto schema_key = meta_schema_key({instance_id, index_id, 1});
+    txn->remove(schema_key, schema_key + '\xff');
+    ASSERT_EQ(txn->commit(), TxnErrorCode::TXN_OK);
+    {
+        GetRowsetResponse res;
+        ASSERT_NO_FATAL_FAILURE(
+                get_rowset(meta_service.get(), table_id, index_id, partition_id, tablet_id, res));
+        ASSERT_EQ(res.rowset_meta_size(), 1);
+        EXPECT_EQ(res.rowset_meta(0).tablet_schema().schema_version(), 1);
+        EXPECT_EQ(res.rowset_meta(0).tablet_schema().column_size(), 10);
+    }
+}
+
 static void check_schema(MetaServiceProxy* meta_service, int64_t tablet_id,
                          int32_t schema_version) {
     brpc::Controller cntl;
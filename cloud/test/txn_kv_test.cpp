@@ -586,6 +586,22 @@ TEST(TxnKvTest, BatchGet) {
         }
     }
 
+    // batch get with fewer gets in flight than keys
+    {
+        auto ret = txn_kv->create_txn(&txn);
+        ASSERT_EQ(ret, TxnErrorCode::TXN_OK);
+        std::vector<std::optional<std::string>> res;
+        Transaction::BatchGetOptions opts;
+        opts.concurrency = 7;
+        ret = txn->batch_get(&res, keys, opts);
+        ASSERT_EQ(ret, TxnErrorCode::TXN_OK);
+        ASSERT_EQ(res.size(), values.size());
+        for (auto i = 0; i < res.size(); ++i) {
+            ASSERT_EQ(res[i].has_value(), true);
+            ASSERT_EQ(res[i].value(), values[i]);
+        }
+    }
+
     // batch get with no-exists keys
     {
         auto ret = txn_kv->create_txn(&txn);